@@ -0,0 +1,180 @@
+//
+//  DebugLog.cpp
+//  vk-triangle
+//
+//  Created by Kai Chen on 10/18/26.
+//
+
+#include "DebugLog.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <iostream>
+#include <string_view>
+
+#include "VkBootstrap.h"
+
+namespace {
+
+const size_t kSummaryLength = 80;
+
+// Messages without an id (driver and loader messages) are told apart by their text
+uint64_t hashText(std::string_view text) {
+    uint64_t hash = 14695981039346656037ull;
+    for (char c : text) {
+        hash = (hash ^ static_cast<uint8_t>(c)) * 1099511628211ull;
+    }
+    return hash;
+}
+
+} // namespace
+
+DebugLog::DebugLog() : slots(new Slot[kCapacity]), rateWindowStart(Clock::now()) {
+    for (uint32_t i = 0; i < kCapacity; i++) {
+        slots[i].sequence.store(i, std::memory_order_relaxed);
+    }
+    thread = std::thread(&DebugLog::run, this);
+}
+
+DebugLog::~DebugLog() {
+    running.store(false, std::memory_order_release);
+    thread.join();
+}
+
+VKAPI_ATTR VkBool32 VKAPI_CALL DebugLog::callback(VkDebugUtilsMessageSeverityFlagBitsEXT severity,
+                                                  VkDebugUtilsMessageTypeFlagsEXT type,
+                                                  const VkDebugUtilsMessengerCallbackDataEXT* data,
+                                                  void* userData) {
+    static_cast<DebugLog*>(userData)->push(severity, type, data);
+    return VK_FALSE;
+}
+
+void DebugLog::push(VkDebugUtilsMessageSeverityFlagBitsEXT severity, VkDebugUtilsMessageTypeFlagsEXT type,
+                    const VkDebugUtilsMessengerCallbackDataEXT* data) {
+    // Claim the slot at the enqueue position, unless the consumer hasn't freed it yet
+    uint64_t position = enqueuePosition.load(std::memory_order_relaxed);
+    Slot* slot = nullptr;
+    while (true) {
+        slot = &slots[position & (kCapacity - 1)];
+        uint64_t sequence = slot->sequence.load(std::memory_order_acquire);
+        auto difference = static_cast<int64_t>(sequence - position);
+        if (difference == 0) {
+            if (enqueuePosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) {
+                break;
+            }
+        } else if (difference < 0) {
+            dropped.fetch_add(1, std::memory_order_relaxed);
+            return;
+        } else {
+            position = enqueuePosition.load(std::memory_order_relaxed);
+        }
+    }
+
+    const char* message = data->pMessage != nullptr ? data->pMessage : "";
+    size_t length = std::min(std::strlen(message), kMaxMessageLength);
+    std::memcpy(slot->text, message, length);
+    slot->length = static_cast<uint32_t>(length);
+    slot->severity = severity;
+    slot->type = type;
+    slot->messageId = data->messageIdNumber;
+    slot->sequence.store(position + 1, std::memory_order_release);
+}
+
+void DebugLog::run() {
+    while (running.load(std::memory_order_acquire)) {
+        if (!drain(Clock::now())) {
+            std::this_thread::sleep_for(kPollInterval);
+        }
+    }
+    // Producers are gone once the messenger is destroyed, pick up what they left
+    drain(Clock::now());
+    flushRepeats(Clock::now(), true);
+    reportRateLimited();
+    std::cout.flush();
+}
+
+bool DebugLog::drain(Clock::time_point now) {
+    flushRepeats(now, false);
+
+    bool drained = false;
+    while (true) {
+        Slot& slot = slots[dequeuePosition & (kCapacity - 1)];
+        if (slot.sequence.load(std::memory_order_acquire) != dequeuePosition + 1) {
+            break;
+        }
+        print(slot, now);
+        slot.sequence.store(dequeuePosition + kCapacity, std::memory_order_release);
+        dequeuePosition++;
+        drained = true;
+    }
+
+    uint64_t lost = dropped.exchange(0, std::memory_order_relaxed);
+    if (lost > 0) {
+        std::cout << "debug messenger: " << lost << " messages dropped, the queue was full" << '\n';
+        printedSinceFlush = true;
+    }
+    // One flush per batch rather than one per line
+    if (printedSinceFlush) {
+        std::cout.flush();
+        printedSinceFlush = false;
+    }
+    return drained;
+}
+
+void DebugLog::print(const Slot& slot, Clock::time_point now) {
+    std::string_view text(slot.text, slot.length);
+    uint64_t key = slot.messageId != 0 ? static_cast<uint32_t>(slot.messageId) : hashText(text);
+    key = key * 31 + slot.severity;
+
+    // Still in the map means it was printed within the repeat window
+    auto repeat = repeats.find(key);
+    if (repeat != repeats.end()) {
+        repeat->second.count++;
+        return;
+    }
+    if (!admitLine(now)) {
+        return;
+    }
+    std::cout << "[" << vkb::to_string_message_severity(slot.severity) << ": "
+              << vkb::to_string_message_type(slot.type) << "] " << text << '\n';
+    repeats.emplace(key, Repeat { now, 0, std::string(text.substr(0, kSummaryLength)) });
+    printedSinceFlush = true;
+}
+
+void DebugLog::flushRepeats(Clock::time_point now, bool all) {
+    for (auto it = repeats.begin(); it != repeats.end();) {
+        if (!all && now - it->second.printed < kRepeatWindow) {
+            ++it;
+            continue;
+        }
+        if (it->second.count > 0) {
+            std::cout << "debug messenger: repeated " << it->second.count << " more times: "
+                      << it->second.summary << (it->second.summary.size() == kSummaryLength ? "..." : "") << '\n';
+            printedSinceFlush = true;
+        }
+        it = repeats.erase(it);
+    }
+}
+
+bool DebugLog::admitLine(Clock::time_point now) {
+    if (now - rateWindowStart >= std::chrono::seconds(1)) {
+        reportRateLimited();
+        rateWindowStart = now;
+        linesInWindow = 0;
+    }
+    if (linesInWindow >= kMaxLinesPerSecond) {
+        rateLimited++;
+        return false;
+    }
+    linesInWindow++;
+    return true;
+}
+
+void DebugLog::reportRateLimited() {
+    if (rateLimited > 0) {
+        std::cout << "debug messenger: " << rateLimited << " messages over " << kMaxLinesPerSecond
+                  << " per second not shown" << '\n';
+        printedSinceFlush = true;
+        rateLimited = 0;
+    }
+}
@@ -0,0 +1,104 @@
+//
+//  DebugLog.hpp
+//  vk-triangle
+//
+//  Created by Kai Chen on 10/18/26.
+//
+
+#ifndef DebugLog_hpp
+#define DebugLog_hpp
+
+#include <vulkan/vulkan.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <thread>
+#include <unordered_map>
+
+// Debug messenger output, printed by a background thread.
+//
+// The messenger callback runs inside driver calls on whatever thread made them, so all it does is
+// copy the message into a fixed ring shared by every producer and return: no locks, no allocations
+// and no output. When the ring is full the message is dropped and counted instead of waiting.
+// The logging thread drains the ring, folds repeats of a message into one line with a count, and
+// caps the number of lines it prints per second.
+class DebugLog {
+public:
+    // Power of two
+    static constexpr uint32_t kCapacity = 256;
+    // Longer messages are cut off
+    static constexpr size_t kMaxMessageLength = 1024;
+    // Repeats of a message this soon after it was printed are only counted
+    static constexpr std::chrono::milliseconds kRepeatWindow { 1000 };
+    static constexpr uint32_t kMaxLinesPerSecond = 50;
+    // How long the logging thread sleeps when the ring is empty
+    static constexpr std::chrono::milliseconds kPollInterval { 5 };
+
+    DebugLog();
+    // Prints whatever is still queued
+    ~DebugLog();
+    DebugLog(const DebugLog&) = delete;
+    DebugLog& operator=(const DebugLog&) = delete;
+
+    // For InstanceBuilder::set_debug_callback, with the DebugLog as the user data pointer
+    static VKAPI_ATTR VkBool32 VKAPI_CALL callback(VkDebugUtilsMessageSeverityFlagBitsEXT severity,
+                                                   VkDebugUtilsMessageTypeFlagsEXT type,
+                                                   const VkDebugUtilsMessengerCallbackDataEXT* data,
+                                                   void* userData);
+
+private:
+    using Clock = std::chrono::steady_clock;
+
+    struct Slot {
+        // Equal to the enqueue position it's free for, one past it once the message is written
+        std::atomic<uint64_t> sequence;
+        VkDebugUtilsMessageSeverityFlagBitsEXT severity;
+        VkDebugUtilsMessageTypeFlagsEXT type;
+        int32_t messageId;
+        uint32_t length;
+        char text[kMaxMessageLength];
+    };
+
+    // A message printed within the last kRepeatWindow
+    struct Repeat {
+        Clock::time_point printed;
+        uint64_t count = 0;
+        // Start of the message, for the line reporting the repeats
+        std::string summary;
+    };
+
+    void push(VkDebugUtilsMessageSeverityFlagBitsEXT severity, VkDebugUtilsMessageTypeFlagsEXT type,
+              const VkDebugUtilsMessengerCallbackDataEXT* data);
+    // Logging thread only
+    void run();
+    bool drain(Clock::time_point now);
+    void print(const Slot& slot, Clock::time_point now);
+    // Reports the repeats of messages whose window is over, or of all of them
+    void flushRepeats(Clock::time_point now, bool all);
+    // Whether another line fits in this second
+    bool admitLine(Clock::time_point now);
+    void reportRateLimited();
+
+    std::unique_ptr<Slot[]> slots;
+    // Producers and the consumer each get their own cache line
+    alignas(64) std::atomic<uint64_t> enqueuePosition { 0 };
+    alignas(64) uint64_t dequeuePosition = 0;
+    std::atomic<uint64_t> dropped { 0 };
+    std::atomic<bool> running { true };
+
+    // Logging thread only
+    std::unordered_map<uint64_t, Repeat> repeats;
+    Clock::time_point rateWindowStart;
+    uint32_t linesInWindow = 0;
+    uint64_t rateLimited = 0;
+    bool printedSinceFlush = false;
+
+    // Started last, once everything it uses is constructed
+    std::thread thread;
+};
+
+#endif /* DebugLog_hpp */
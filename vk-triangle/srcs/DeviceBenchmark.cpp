@@ -0,0 +1,361 @@
+//
+//  DeviceBenchmark.cpp
+//  vk-triangle
+//
+//  Created by Kai Chen on 10/18/26.
+//
+
+#include "DeviceBenchmark.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <limits>
+#include <stdexcept>
+
+#include "GraphicsPipelineCache.hpp"
+#include "ShaderModuleCache.hpp"
+
+namespace {
+
+const VkFormat kColorFormat = VK_FORMAT_R8G8B8A8_UNORM;
+const VkExtent2D kTargetExtent = { 1024, 1024 };
+// The scene's triangle covers an eighth of the viewport, each one is blended over the last
+const uint32_t kFillTriangles = 64;
+// Small enough that rasterization is negligible next to the geometry work
+const VkExtent2D kTriangleViewport = { 4, 4 };
+const uint32_t kTriangles = 1u << 16;
+// The fastest of a few runs counts, the first one also pays for warming up the driver
+const int kRuns = 4;
+
+uint32_t findMemoryType(const VkPhysicalDeviceMemoryProperties& memoryProperties, uint32_t typeBits,
+                        VkMemoryPropertyFlags properties) {
+    for (uint32_t i = 0; i < memoryProperties.memoryTypeCount; i++) {
+        if ((typeBits & (1u << i)) && (memoryProperties.memoryTypes[i].propertyFlags & properties) == properties) {
+            return i;
+        }
+    }
+    return UINT32_MAX;
+}
+
+} // namespace
+
+DeviceBenchmark::DeviceBenchmark(const ShaderArchive& shaders, std::string cachePath, Workload workload,
+                                 VkAllocationCallbacks* allocationCallbacks)
+    : shaders(shaders), cachePath(std::move(cachePath)), workload(workload), allocationCallbacks(allocationCallbacks) {
+    load();
+}
+
+double DeviceBenchmark::score(const vkb::PhysicalDevice& physicalDevice) {
+    auto key = cacheKey(physicalDevice);
+    auto it = key.empty() ? results.end() : results.find(key);
+    bool cached = it != results.end();
+    Result result = cached ? it->second : measure(physicalDevice);
+    if (result.fillRate <= 0.0 || result.triangleRate <= 0.0) {
+        return 0.0;
+    }
+    // A device that failed is tried again next run
+    if (!cached && !key.empty()) {
+        results[key] = result;
+        dirty = true;
+    }
+
+    double frameTime = workload.pixels / result.fillRate + workload.triangles / result.triangleRate;
+    double score = 1.0 / frameTime;
+    std::cout << "benchmark: " << physicalDevice.name << ": " << result.fillRate / 1e6 << " Mpixels/s, "
+              << result.triangleRate / 1e6 << " Mtriangles/s, " << score << " fps predicted"
+              << (cached ? " (cached)" : "") << std::endl;
+    return score;
+}
+
+DeviceBenchmark::Result DeviceBenchmark::measure(const vkb::PhysicalDevice& physicalDevice) {
+    Result result;
+
+    vkb::DeviceBuilder builder { physicalDevice };
+    builder.set_allocation_callbacks(allocationCallbacks);
+    auto vkbDevice = builder.build();
+    if (!vkbDevice) {
+        std::cout << "benchmark: skipping " << physicalDevice.name << ": " << vkbDevice.error().message() << std::endl;
+        return result;
+    }
+    auto queue = vkbDevice.value().get_queue(vkb::QueueType::graphics);
+    if (!queue) {
+        std::cout << "benchmark: skipping " << physicalDevice.name << ": " << queue.error().message() << std::endl;
+        vkb::destroy_device(vkbDevice.value());
+        return result;
+    }
+    auto device = vkbDevice.value().device;
+
+    // Created inside the try, a Vulkan failure anywhere skips the device and still releases what exists
+    VkCommandPool commandPool = VK_NULL_HANDLE;
+    VkCommandBuffer commandBuffer = VK_NULL_HANDLE;
+    VkFence fence = VK_NULL_HANDLE;
+    VkRenderPass renderPass = VK_NULL_HANDLE;
+    VkImage image = VK_NULL_HANDLE;
+    VkDeviceMemory memory = VK_NULL_HANDLE;
+    VkImageView view = VK_NULL_HANDLE;
+    VkFramebuffer framebuffer = VK_NULL_HANDLE;
+    VkPipelineLayout layout = VK_NULL_HANDLE;
+    ShaderModuleCache shaderModules;
+    GraphicsPipelineCache pipelines;
+    bool pipelinesCreated = false;
+
+    try {
+        VkCommandPoolCreateInfo poolInfo = {};
+        poolInfo.sType = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO;
+        poolInfo.flags = VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT;
+        poolInfo.queueFamilyIndex = vkbDevice.value().get_queue_index(vkb::QueueType::graphics).value();
+        if (vkCreateCommandPool(device, &poolInfo, allocationCallbacks, &commandPool) != VK_SUCCESS) {
+            throw std::runtime_error("failed to create command pool for " + physicalDevice.name);
+        }
+
+        VkCommandBufferAllocateInfo allocInfo = {};
+        allocInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
+        allocInfo.commandPool = commandPool;
+        allocInfo.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+        allocInfo.commandBufferCount = 1;
+        if (vkAllocateCommandBuffers(device, &allocInfo, &commandBuffer) != VK_SUCCESS) {
+            throw std::runtime_error("failed to create command buffer for " + physicalDevice.name);
+        }
+
+        VkFenceCreateInfo fenceInfo = {};
+        fenceInfo.sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO;
+        if (vkCreateFence(device, &fenceInfo, allocationCallbacks, &fence) != VK_SUCCESS) {
+            throw std::runtime_error("failed to create fence for " + physicalDevice.name);
+        }
+
+        // Stored so the driver can't skip the work
+        VkAttachmentDescription colorAttachment = {};
+        colorAttachment.format = kColorFormat;
+        colorAttachment.samples = VK_SAMPLE_COUNT_1_BIT;
+        colorAttachment.loadOp = VK_ATTACHMENT_LOAD_OP_CLEAR;
+        colorAttachment.storeOp = VK_ATTACHMENT_STORE_OP_STORE;
+        colorAttachment.stencilLoadOp = VK_ATTACHMENT_LOAD_OP_DONT_CARE;
+        colorAttachment.stencilStoreOp = VK_ATTACHMENT_STORE_OP_DONT_CARE;
+        colorAttachment.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+        colorAttachment.finalLayout = VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL;
+
+        VkAttachmentReference colorAttachmentRef = { 0, VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL };
+
+        VkSubpassDescription subpass = {};
+        subpass.pipelineBindPoint = VK_PIPELINE_BIND_POINT_GRAPHICS;
+        subpass.colorAttachmentCount = 1;
+        subpass.pColorAttachments = &colorAttachmentRef;
+
+        VkRenderPassCreateInfo renderPassInfo = {};
+        renderPassInfo.sType = VK_STRUCTURE_TYPE_RENDER_PASS_CREATE_INFO;
+        renderPassInfo.attachmentCount = 1;
+        renderPassInfo.pAttachments = &colorAttachment;
+        renderPassInfo.subpassCount = 1;
+        renderPassInfo.pSubpasses = &subpass;
+        if (vkCreateRenderPass(device, &renderPassInfo, allocationCallbacks, &renderPass) != VK_SUCCESS) {
+            throw std::runtime_error("failed to create render pass for " + physicalDevice.name);
+        }
+
+        VkImageCreateInfo imageInfo = {};
+        imageInfo.sType = VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO;
+        imageInfo.imageType = VK_IMAGE_TYPE_2D;
+        imageInfo.format = kColorFormat;
+        imageInfo.extent = { kTargetExtent.width, kTargetExtent.height, 1 };
+        imageInfo.mipLevels = 1;
+        imageInfo.arrayLayers = 1;
+        imageInfo.samples = VK_SAMPLE_COUNT_1_BIT;
+        imageInfo.tiling = VK_IMAGE_TILING_OPTIMAL;
+        imageInfo.usage = VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT;
+        imageInfo.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+        imageInfo.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+        if (vkCreateImage(device, &imageInfo, allocationCallbacks, &image) != VK_SUCCESS) {
+            throw std::runtime_error("failed to create benchmark image for " + physicalDevice.name);
+        }
+
+        VkMemoryRequirements requirements;
+        vkGetImageMemoryRequirements(device, image, &requirements);
+
+        const auto& memoryProperties = physicalDevice.memory_properties;
+        VkMemoryAllocateInfo memoryInfo = {};
+        memoryInfo.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
+        memoryInfo.allocationSize = requirements.size;
+        memoryInfo.memoryTypeIndex = findMemoryType(memoryProperties, requirements.memoryTypeBits, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT);
+        if (memoryInfo.memoryTypeIndex == UINT32_MAX) {
+            // Software devices have no device local memory
+            memoryInfo.memoryTypeIndex = findMemoryType(memoryProperties, requirements.memoryTypeBits, 0);
+        }
+        if (vkAllocateMemory(device, &memoryInfo, allocationCallbacks, &memory) != VK_SUCCESS) {
+            throw std::runtime_error("failed to allocate benchmark image for " + physicalDevice.name);
+        }
+        vkBindImageMemory(device, image, memory, 0);
+
+        VkImageViewCreateInfo viewInfo = {};
+        viewInfo.sType = VK_STRUCTURE_TYPE_IMAGE_VIEW_CREATE_INFO;
+        viewInfo.image = image;
+        viewInfo.viewType = VK_IMAGE_VIEW_TYPE_2D;
+        viewInfo.format = kColorFormat;
+        viewInfo.subresourceRange = { VK_IMAGE_ASPECT_COLOR_BIT, 0, 1, 0, 1 };
+        if (vkCreateImageView(device, &viewInfo, allocationCallbacks, &view) != VK_SUCCESS) {
+            throw std::runtime_error("failed to create benchmark image view for " + physicalDevice.name);
+        }
+
+        VkFramebufferCreateInfo framebufferInfo = {};
+        framebufferInfo.sType = VK_STRUCTURE_TYPE_FRAMEBUFFER_CREATE_INFO;
+        framebufferInfo.renderPass = renderPass;
+        framebufferInfo.attachmentCount = 1;
+        framebufferInfo.pAttachments = &view;
+        framebufferInfo.width = kTargetExtent.width;
+        framebufferInfo.height = kTargetExtent.height;
+        framebufferInfo.layers = 1;
+        if (vkCreateFramebuffer(device, &framebufferInfo, allocationCallbacks, &framebuffer) != VK_SUCCESS) {
+            throw std::runtime_error("failed to create benchmark framebuffer for " + physicalDevice.name);
+        }
+
+        VkPipelineLayoutCreateInfo layoutInfo = {};
+        layoutInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO;
+        if (vkCreatePipelineLayout(device, &layoutInfo, allocationCallbacks, &layout) != VK_SUCCESS) {
+            throw std::runtime_error("failed to create pipeline layout for " + physicalDevice.name);
+        }
+
+        shaderModules.init(device, vkbDevice.value().fp_vkGetDeviceProcAddr, false, allocationCallbacks);
+        GraphicsPipelineCache::Options pipelineOptions;
+        pipelineOptions.workerCount = 1;
+        pipelineOptions.allocationCallbacks = allocationCallbacks;
+        pipelines.init(device, vkbDevice.value().fp_vkGetDeviceProcAddr, &shaderModules, pipelineOptions);
+        pipelinesCreated = true;
+
+        GraphicsPipelineDesc desc;
+        desc.vertexShader = &shaders.get("vert");
+        desc.fragmentShader = &shaders.get("frag");
+        desc.layout = layout;
+        desc.target.colorFormat = kColorFormat;
+        desc.blend.enable = VK_TRUE;
+        desc.blend.srcColor = VK_BLEND_FACTOR_SRC_ALPHA;
+        desc.blend.dstColor = VK_BLEND_FACTOR_ONE_MINUS_SRC_ALPHA;
+        auto pipeline = pipelines.get(desc, renderPass);
+
+        // Wall clock from submit to fence, the fastest run of `triangles` instances of the scene's triangle
+        auto run = [&] (VkExtent2D viewportExtent, uint32_t triangles) {
+            double best = std::numeric_limits<double>::max();
+            for (int i = 0; i < kRuns; i++) {
+                vkResetCommandBuffer(commandBuffer, 0);
+
+                VkCommandBufferBeginInfo beginInfo = {};
+                beginInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+                beginInfo.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+                if (vkBeginCommandBuffer(commandBuffer, &beginInfo) != VK_SUCCESS) {
+                    throw std::runtime_error("failed to begin command buffer for " + physicalDevice.name);
+                }
+
+                VkClearValue clearColor { { { 0.0f, 0.0f, 0.0f, 1.0f } } };
+                VkRenderPassBeginInfo beginPass = {};
+                beginPass.sType = VK_STRUCTURE_TYPE_RENDER_PASS_BEGIN_INFO;
+                beginPass.renderPass = renderPass;
+                beginPass.framebuffer = framebuffer;
+                beginPass.renderArea.extent = viewportExtent;
+                beginPass.clearValueCount = 1;
+                beginPass.pClearValues = &clearColor;
+                vkCmdBeginRenderPass(commandBuffer, &beginPass, VK_SUBPASS_CONTENTS_INLINE);
+
+                VkViewport viewport = {};
+                viewport.width = (float)viewportExtent.width;
+                viewport.height = (float)viewportExtent.height;
+                viewport.minDepth = 0.0f;
+                viewport.maxDepth = 1.0f;
+                VkRect2D scissor = { { 0, 0 }, viewportExtent };
+                vkCmdSetViewport(commandBuffer, 0, 1, &viewport);
+                vkCmdSetScissor(commandBuffer, 0, 1, &scissor);
+
+                vkCmdBindPipeline(commandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, pipeline);
+                pipelines.setDynamicState(commandBuffer, desc);
+                vkCmdDraw(commandBuffer, 3, triangles, 0, 0);
+
+                vkCmdEndRenderPass(commandBuffer);
+                if (vkEndCommandBuffer(commandBuffer) != VK_SUCCESS) {
+                    throw std::runtime_error("failed to end command buffer for " + physicalDevice.name);
+                }
+
+                VkSubmitInfo submitInfo = {};
+                submitInfo.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+                submitInfo.commandBufferCount = 1;
+                submitInfo.pCommandBuffers = &commandBuffer;
+
+                vkResetFences(device, 1, &fence);
+                auto start = std::chrono::steady_clock::now();
+                if (vkQueueSubmit(queue.value(), 1, &submitInfo, fence) != VK_SUCCESS) {
+                    throw std::runtime_error("failed to submit to " + physicalDevice.name);
+                }
+                vkWaitForFences(device, 1, &fence, VK_TRUE, UINT64_MAX);
+                std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+                best = std::min(best, elapsed.count());
+            }
+            return best;
+        };
+
+        double targetPixels = static_cast<double>(kTargetExtent.width) * kTargetExtent.height;
+        result.fillRate = kFillTriangles * targetPixels / 8.0 / run(kTargetExtent, kFillTriangles);
+        result.triangleRate = kTriangles / run(kTriangleViewport, kTriangles);
+    } catch (const std::exception& e) {
+        std::cout << "benchmark: skipping " << physicalDevice.name << ": " << e.what() << std::endl;
+        result = {};
+    }
+
+    // Null handles are ignored, a run that failed half way may still be executing
+    vkDeviceWaitIdle(device);
+    if (pipelinesCreated) {
+        pipelines.destroy();
+    }
+    shaderModules.destroy();
+    vkDestroyPipelineLayout(device, layout, allocationCallbacks);
+    vkDestroyFramebuffer(device, framebuffer, allocationCallbacks);
+    vkDestroyImageView(device, view, allocationCallbacks);
+    vkDestroyImage(device, image, allocationCallbacks);
+    vkFreeMemory(device, memory, allocationCallbacks);
+    vkDestroyRenderPass(device, renderPass, allocationCallbacks);
+    vkDestroyFence(device, fence, allocationCallbacks);
+    vkDestroyCommandPool(device, commandPool, allocationCallbacks);
+    vkb::destroy_device(vkbDevice.value());
+    return result;
+}
+
+std::string DeviceBenchmark::cacheKey(const vkb::PhysicalDevice& physicalDevice) {
+    const auto& uuid = physicalDevice.device_uuid;
+    if (std::all_of(std::begin(uuid), std::end(uuid), [] (uint8_t byte) { return byte == 0; })) {
+        return {};
+    }
+
+    // UUID in hex, then the driver version
+    std::string key;
+    char digits[9];
+    for (auto byte: uuid) {
+        std::snprintf(digits, sizeof(digits), "%02x", byte);
+        key += digits;
+    }
+    std::snprintf(digits, sizeof(digits), "%08x", physicalDevice.properties.driverVersion);
+    return key + "-" + digits;
+}
+
+void DeviceBenchmark::load() {
+    if (cachePath.empty()) {
+        return;
+    }
+    // One device per line: key, fill rate, triangle rate
+    std::ifstream file(cachePath);
+    std::string key;
+    Result result;
+    while (file >> key >> result.fillRate >> result.triangleRate) {
+        results[key] = result;
+    }
+}
+
+void DeviceBenchmark::save() const {
+    if (!dirty || cachePath.empty()) {
+        return;
+    }
+
+    std::ofstream file(cachePath, std::ios::trunc);
+    for (const auto& [key, result]: results) {
+        file << key << " " << result.fillRate << " " << result.triangleRate << "\n";
+    }
+    if (!file) {
+        std::cout << "benchmark: failed to write " << cachePath << std::endl;
+    }
+}
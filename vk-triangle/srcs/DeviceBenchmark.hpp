@@ -0,0 +1,66 @@
+//
+//  DeviceBenchmark.hpp
+//  vk-triangle
+//
+//  Created by Kai Chen on 10/18/26.
+//
+
+#ifndef DeviceBenchmark_hpp
+#define DeviceBenchmark_hpp
+
+#include <vulkan/vulkan.h>
+
+#include <string>
+#include <unordered_map>
+
+#include "VkBootstrap.h"
+#include "ShaderArchive.hpp"
+
+// Scores candidate devices by how fast they draw, for PhysicalDeviceSelector::set_device_scorer(),
+// so the device that suits the workload wins rather than the first discrete one.
+//
+// Two short offscreen runs with the scene's shaders: blended triangles covering a large target
+// for fill rate, and the same triangles squeezed into a few pixels for triangle throughput.
+// Results are kept in a text file per device UUID and driver version, so a device is only
+// measured again after a driver update. Devices without a UUID (Vulkan 1.0) are measured every run.
+class DeviceBenchmark {
+public:
+    struct Result {
+        // Blended pixels per second
+        double fillRate = 0.0;
+        // Small triangles per second
+        double triangleRate = 0.0;
+    };
+
+    // What one frame costs, the score is the frame rate the results predict for it
+    struct Workload {
+        double pixels = 800.0 * 600.0;
+        double triangles = 1.0;
+    };
+
+    // `shaders` needs "vert" and "frag", and it and `allocationCallbacks` have to outlive the benchmark.
+    // An empty `cachePath` keeps the results in memory only.
+    DeviceBenchmark(const ShaderArchive& shaders, std::string cachePath, Workload workload,
+                    VkAllocationCallbacks* allocationCallbacks = nullptr);
+
+    // Predicted frames per second of the workload, 0 for a device the benchmark can't run on.
+    double score(const vkb::PhysicalDevice& physicalDevice);
+    // Runs the benchmark, ignoring the cache. Empty if it fails on the device.
+    Result measure(const vkb::PhysicalDevice& physicalDevice);
+
+    // Writes the results back if any were measured.
+    void save() const;
+
+private:
+    static std::string cacheKey(const vkb::PhysicalDevice& physicalDevice);
+    void load();
+
+    const ShaderArchive& shaders;
+    std::string cachePath;
+    Workload workload;
+    VkAllocationCallbacks* allocationCallbacks = nullptr;
+    std::unordered_map<std::string, Result> results;
+    bool dirty = false;
+};
+
+#endif /* DeviceBenchmark_hpp */
@@ -0,0 +1,19 @@
+//
+//  Formats.hpp
+//  vk-triangle
+//
+//  Created by Kai Chen on 10/18/26.
+//
+
+#ifndef Formats_hpp
+#define Formats_hpp
+
+#include <vulkan/vulkan.h>
+
+// Whether a depth format has a stencil aspect, which attachments, views and barriers have to include.
+inline bool hasStencil(VkFormat format) {
+    return format == VK_FORMAT_D32_SFLOAT_S8_UINT || format == VK_FORMAT_D24_UNORM_S8_UINT ||
+           format == VK_FORMAT_D16_UNORM_S8_UINT;
+}
+
+#endif /* Formats_hpp */
@@ -0,0 +1,691 @@
+//
+//  GraphicsPipelineCache.cpp
+//  vk-triangle
+//
+//  Created by Kai Chen on 10/18/26.
+//
+
+#include "GraphicsPipelineCache.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <stdexcept>
+#include <type_traits>
+
+#include "Formats.hpp"
+
+namespace {
+
+uint64_t shaderHash(const ShaderArchive::Shader* shader) {
+    return shader != nullptr ? shader->contentHash : 0;
+}
+
+struct HashBuilder {
+    uint64_t value = 0xcbf29ce484222325ull;
+
+    void add(uint64_t field) {
+        // FNV-1a over the 64-bit field, which keeps the hash independent of struct padding
+        for (int i = 0; i < 8; i++) {
+            value ^= (field >> (i * 8)) & 0xff;
+            value *= 0x100000001b3ull;
+        }
+    }
+};
+
+void hashVertexInput(HashBuilder& h, const GraphicsPipelineDesc& desc) {
+    h.add(desc.vertexBindingCount);
+    for (uint32_t i = 0; i < desc.vertexBindingCount; i++) {
+        h.add(desc.vertexBindings[i].binding);
+        h.add(desc.vertexBindings[i].stride);
+        h.add(desc.vertexBindings[i].inputRate);
+    }
+    h.add(desc.vertexAttributeCount);
+    for (uint32_t i = 0; i < desc.vertexAttributeCount; i++) {
+        h.add(desc.vertexAttributes[i].location);
+        h.add(desc.vertexAttributes[i].binding);
+        h.add(desc.vertexAttributes[i].format);
+        h.add(desc.vertexAttributes[i].offset);
+    }
+    h.add(desc.topology);
+}
+
+void hashTarget(HashBuilder& h, const GraphicsPipelineDesc& desc) {
+    h.add(desc.target.colorFormat);
+    h.add(desc.target.depthFormat);
+    h.add(desc.target.samples);
+    h.add(desc.target.subpass);
+}
+
+void hashPreRasterization(HashBuilder& h, const GraphicsPipelineDesc& desc) {
+    h.add(shaderHash(desc.vertexShader));
+    h.add(reinterpret_cast<uint64_t>(desc.layout));
+    h.add(desc.polygonMode);
+    h.add(desc.cullMode);
+    h.add(desc.frontFace);
+    hashTarget(h, desc);
+}
+
+void hashFragmentShader(HashBuilder& h, const GraphicsPipelineDesc& desc) {
+    h.add(shaderHash(desc.fragmentShader));
+    h.add(reinterpret_cast<uint64_t>(desc.layout));
+    h.add(desc.depth.testEnable);
+    h.add(desc.depth.writeEnable);
+    h.add(desc.depth.compareOp);
+    hashTarget(h, desc);
+}
+
+void hashFragmentOutput(HashBuilder& h, const GraphicsPipelineDesc& desc) {
+    h.add(desc.blend.enable);
+    h.add(desc.blend.srcColor);
+    h.add(desc.blend.dstColor);
+    h.add(desc.blend.colorOp);
+    h.add(desc.blend.srcAlpha);
+    h.add(desc.blend.dstAlpha);
+    h.add(desc.blend.alphaOp);
+    h.add(desc.blend.writeMask);
+    hashTarget(h, desc);
+}
+
+#if defined(VK_EXT_graphics_pipeline_library)
+// The fields of `desc` a library part is compiled from, everything else at its default.
+// Mirrors the hash*() function of each part.
+GraphicsPipelineDesc librarySlice(VkGraphicsPipelineLibraryFlagsEXT part, const GraphicsPipelineDesc& desc) {
+    GraphicsPipelineDesc slice;
+    switch (part) {
+        case VK_GRAPHICS_PIPELINE_LIBRARY_VERTEX_INPUT_INTERFACE_BIT_EXT:
+            slice.vertexBindingCount = desc.vertexBindingCount;
+            slice.vertexBindings = desc.vertexBindings;
+            slice.vertexAttributeCount = desc.vertexAttributeCount;
+            slice.vertexAttributes = desc.vertexAttributes;
+            slice.topology = desc.topology;
+            break;
+        case VK_GRAPHICS_PIPELINE_LIBRARY_PRE_RASTERIZATION_SHADERS_BIT_EXT:
+            slice.vertexShader = desc.vertexShader;
+            slice.layout = desc.layout;
+            slice.polygonMode = desc.polygonMode;
+            slice.cullMode = desc.cullMode;
+            slice.frontFace = desc.frontFace;
+            slice.target = desc.target;
+            break;
+        case VK_GRAPHICS_PIPELINE_LIBRARY_FRAGMENT_SHADER_BIT_EXT:
+            slice.fragmentShader = desc.fragmentShader;
+            slice.layout = desc.layout;
+            slice.depth = desc.depth;
+            slice.target = desc.target;
+            break;
+        case VK_GRAPHICS_PIPELINE_LIBRARY_FRAGMENT_OUTPUT_INTERFACE_BIT_EXT:
+            slice.blend = desc.blend;
+            slice.target = desc.target;
+            break;
+    }
+    return slice;
+}
+#endif
+
+// A pipeline with dynamic topology can only be drawn with topologies of the class it was created with.
+VkPrimitiveTopology topologyClass(VkPrimitiveTopology topology) {
+    switch (topology) {
+        case VK_PRIMITIVE_TOPOLOGY_POINT_LIST:
+            return VK_PRIMITIVE_TOPOLOGY_POINT_LIST;
+        case VK_PRIMITIVE_TOPOLOGY_LINE_LIST:
+        case VK_PRIMITIVE_TOPOLOGY_LINE_STRIP:
+        case VK_PRIMITIVE_TOPOLOGY_LINE_LIST_WITH_ADJACENCY:
+        case VK_PRIMITIVE_TOPOLOGY_LINE_STRIP_WITH_ADJACENCY:
+            return VK_PRIMITIVE_TOPOLOGY_LINE_LIST;
+        case VK_PRIMITIVE_TOPOLOGY_PATCH_LIST:
+            return VK_PRIMITIVE_TOPOLOGY_PATCH_LIST;
+        default:
+            return VK_PRIMITIVE_TOPOLOGY_TRIANGLE_LIST;
+    }
+}
+
+// Fixed function state of a description. The create infos point into the struct itself,
+// fill it in place and don't copy it afterwards.
+struct FixedFunctionState {
+    VkVertexInputBindingDescription bindings[GraphicsPipelineDesc::kMaxVertexBindings];
+    VkVertexInputAttributeDescription attributes[GraphicsPipelineDesc::kMaxVertexAttributes];
+    VkPipelineVertexInputStateCreateInfo vertexInput = {};
+    VkPipelineInputAssemblyStateCreateInfo inputAssembly = {};
+    VkPipelineViewportStateCreateInfo viewport = {};
+    VkPipelineRasterizationStateCreateInfo rasterizer = {};
+    VkPipelineMultisampleStateCreateInfo multisampling = {};
+    VkPipelineColorBlendAttachmentState colorBlendAttachment = {};
+    VkPipelineColorBlendStateCreateInfo colorBlending = {};
+    VkPipelineDepthStencilStateCreateInfo depthStencil = {};
+    VkDynamicState dynamicStates[8] = {};
+    VkPipelineDynamicStateCreateInfo dynamic = {};
+#if defined(VK_KHR_dynamic_rendering)
+    VkPipelineRenderingCreateInfoKHR rendering = {};
+#endif
+
+    void fill(const GraphicsPipelineDesc& desc, bool extendedDynamicState) {
+        for (uint32_t i = 0; i < desc.vertexBindingCount; i++) {
+            bindings[i] = { desc.vertexBindings[i].binding, desc.vertexBindings[i].stride, desc.vertexBindings[i].inputRate };
+        }
+        for (uint32_t i = 0; i < desc.vertexAttributeCount; i++) {
+            attributes[i] = { desc.vertexAttributes[i].location, desc.vertexAttributes[i].binding,
+                              desc.vertexAttributes[i].format, desc.vertexAttributes[i].offset };
+        }
+
+        vertexInput.sType = VK_STRUCTURE_TYPE_PIPELINE_VERTEX_INPUT_STATE_CREATE_INFO;
+        vertexInput.vertexBindingDescriptionCount = desc.vertexBindingCount;
+        vertexInput.pVertexBindingDescriptions = bindings;
+        vertexInput.vertexAttributeDescriptionCount = desc.vertexAttributeCount;
+        vertexInput.pVertexAttributeDescriptions = attributes;
+
+        inputAssembly.sType = VK_STRUCTURE_TYPE_PIPELINE_INPUT_ASSEMBLY_STATE_CREATE_INFO;
+        inputAssembly.topology = desc.topology;
+        inputAssembly.primitiveRestartEnable = VK_FALSE;
+
+        // Viewport and scissor are dynamic, only the counts matter here
+        viewport.sType = VK_STRUCTURE_TYPE_PIPELINE_VIEWPORT_STATE_CREATE_INFO;
+        viewport.viewportCount = 1;
+        viewport.scissorCount = 1;
+
+        rasterizer.sType = VK_STRUCTURE_TYPE_PIPELINE_RASTERIZATION_STATE_CREATE_INFO;
+        rasterizer.depthClampEnable = VK_FALSE;
+        rasterizer.rasterizerDiscardEnable = VK_FALSE;
+        rasterizer.polygonMode = desc.polygonMode;
+        rasterizer.lineWidth = 1.0f;
+        rasterizer.cullMode = desc.cullMode;
+        rasterizer.frontFace = desc.frontFace;
+        rasterizer.depthBiasEnable = VK_FALSE;
+
+        multisampling.sType = VK_STRUCTURE_TYPE_PIPELINE_MULTISAMPLE_STATE_CREATE_INFO;
+        multisampling.sampleShadingEnable = VK_FALSE;
+        multisampling.rasterizationSamples = desc.target.samples;
+
+        colorBlendAttachment.colorWriteMask = desc.blend.writeMask;
+        colorBlendAttachment.blendEnable = desc.blend.enable;
+        colorBlendAttachment.srcColorBlendFactor = desc.blend.srcColor;
+        colorBlendAttachment.dstColorBlendFactor = desc.blend.dstColor;
+        colorBlendAttachment.colorBlendOp = desc.blend.colorOp;
+        colorBlendAttachment.srcAlphaBlendFactor = desc.blend.srcAlpha;
+        colorBlendAttachment.dstAlphaBlendFactor = desc.blend.dstAlpha;
+        colorBlendAttachment.alphaBlendOp = desc.blend.alphaOp;
+
+        colorBlending.sType = VK_STRUCTURE_TYPE_PIPELINE_COLOR_BLEND_STATE_CREATE_INFO;
+        colorBlending.logicOpEnable = VK_FALSE;
+        colorBlending.logicOp = VK_LOGIC_OP_COPY;
+        colorBlending.attachmentCount = 1;
+        colorBlending.pAttachments = &colorBlendAttachment;
+
+        depthStencil.sType = VK_STRUCTURE_TYPE_PIPELINE_DEPTH_STENCIL_STATE_CREATE_INFO;
+        depthStencil.depthTestEnable = desc.depth.testEnable;
+        depthStencil.depthWriteEnable = desc.depth.writeEnable;
+        depthStencil.depthCompareOp = desc.depth.compareOp;
+        depthStencil.depthBoundsTestEnable = VK_FALSE;
+        depthStencil.stencilTestEnable = VK_FALSE;
+
+        uint32_t count = 0;
+        dynamicStates[count++] = VK_DYNAMIC_STATE_VIEWPORT;
+        dynamicStates[count++] = VK_DYNAMIC_STATE_SCISSOR;
+#if defined(VK_EXT_extended_dynamic_state)
+        if (extendedDynamicState) {
+            dynamicStates[count++] = VK_DYNAMIC_STATE_CULL_MODE_EXT;
+            dynamicStates[count++] = VK_DYNAMIC_STATE_FRONT_FACE_EXT;
+            dynamicStates[count++] = VK_DYNAMIC_STATE_PRIMITIVE_TOPOLOGY_EXT;
+            dynamicStates[count++] = VK_DYNAMIC_STATE_DEPTH_TEST_ENABLE_EXT;
+            dynamicStates[count++] = VK_DYNAMIC_STATE_DEPTH_WRITE_ENABLE_EXT;
+            dynamicStates[count++] = VK_DYNAMIC_STATE_DEPTH_COMPARE_OP_EXT;
+        }
+#endif
+        dynamic.sType = VK_STRUCTURE_TYPE_PIPELINE_DYNAMIC_STATE_CREATE_INFO;
+        dynamic.dynamicStateCount = count;
+        dynamic.pDynamicStates = dynamicStates;
+
+#if defined(VK_KHR_dynamic_rendering)
+        rendering.sType = VK_STRUCTURE_TYPE_PIPELINE_RENDERING_CREATE_INFO_KHR;
+        rendering.colorAttachmentCount = 1;
+        rendering.pColorAttachmentFormats = &desc.target.colorFormat;
+        rendering.depthAttachmentFormat = desc.target.depthFormat;
+        if (hasStencil(desc.target.depthFormat)) {
+            rendering.stencilAttachmentFormat = desc.target.depthFormat;
+        }
+#endif
+    }
+
+    // Attachment formats for pipelines used with dynamic rendering, i.e. without a render pass
+    const void* renderingInfo(VkRenderPass renderPass) const {
+#if defined(VK_KHR_dynamic_rendering)
+        if (renderPass == VK_NULL_HANDLE) {
+            return &rendering;
+        }
+#endif
+        return nullptr;
+    }
+};
+
+}
+
+bool GraphicsPipelineDesc::operator==(const GraphicsPipelineDesc& other) const {
+    return shaderHash(vertexShader) == shaderHash(other.vertexShader) &&
+        shaderHash(fragmentShader) == shaderHash(other.fragmentShader) &&
+        layout == other.layout &&
+        vertexBindingCount == other.vertexBindingCount &&
+        std::equal(vertexBindings.begin(), vertexBindings.begin() + vertexBindingCount, other.vertexBindings.begin()) &&
+        vertexAttributeCount == other.vertexAttributeCount &&
+        std::equal(vertexAttributes.begin(), vertexAttributes.begin() + vertexAttributeCount, other.vertexAttributes.begin()) &&
+        topology == other.topology &&
+        polygonMode == other.polygonMode &&
+        cullMode == other.cullMode &&
+        frontFace == other.frontFace &&
+        depth == other.depth &&
+        blend == other.blend &&
+        target == other.target;
+}
+
+uint64_t GraphicsPipelineDesc::hash() const {
+    HashBuilder h;
+    hashVertexInput(h, *this);
+    hashPreRasterization(h, *this);
+    hashFragmentShader(h, *this);
+    hashFragmentOutput(h, *this);
+    return h.value;
+}
+
+void GraphicsPipelineCache::init(VkDevice device, PFN_vkGetDeviceProcAddr getDeviceProcAddr, ShaderModuleCache* shaderModules,
+                                 const Options& options) {
+    this->device = device;
+    this->shaderModules = shaderModules;
+    allocationCallbacks = options.allocationCallbacks;
+    useLibraries = options.useLibraries;
+
+    extendedDynamicState = false;
+#if defined(VK_EXT_extended_dynamic_state)
+    if (options.extendedDynamicState) {
+        // Core names on 1.3 devices, the extension aliases otherwise
+        auto load = [device, getDeviceProcAddr] (auto& fp, const char* core, const char* ext) {
+            PFN_vkVoidFunction function = getDeviceProcAddr(device, core);
+            if (function == nullptr) {
+                function = getDeviceProcAddr(device, ext);
+            }
+            fp = reinterpret_cast<std::remove_reference_t<decltype(fp)>>(function);
+            return fp != nullptr;
+        };
+        extendedDynamicState =
+            load(fp_vkCmdSetCullMode, "vkCmdSetCullMode", "vkCmdSetCullModeEXT") &&
+            load(fp_vkCmdSetFrontFace, "vkCmdSetFrontFace", "vkCmdSetFrontFaceEXT") &&
+            load(fp_vkCmdSetPrimitiveTopology, "vkCmdSetPrimitiveTopology", "vkCmdSetPrimitiveTopologyEXT") &&
+            load(fp_vkCmdSetDepthTestEnable, "vkCmdSetDepthTestEnable", "vkCmdSetDepthTestEnableEXT") &&
+            load(fp_vkCmdSetDepthWriteEnable, "vkCmdSetDepthWriteEnable", "vkCmdSetDepthWriteEnableEXT") &&
+            load(fp_vkCmdSetDepthCompareOp, "vkCmdSetDepthCompareOp", "vkCmdSetDepthCompareOpEXT");
+    }
+#endif
+
+    // The driver checks the header and ignores data from another device or driver version
+    cacheFile = options.cacheFile;
+    std::vector<char> initialData;
+    if (!cacheFile.empty()) {
+        std::ifstream file(cacheFile, std::ios::binary);
+        initialData.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+    }
+
+    VkPipelineCacheCreateInfo info = {};
+    info.sType = VK_STRUCTURE_TYPE_PIPELINE_CACHE_CREATE_INFO;
+    info.initialDataSize = initialData.size();
+    info.pInitialData = initialData.empty() ? nullptr : initialData.data();
+    if (vkCreatePipelineCache(device, &info, allocationCallbacks, &driverCache) != VK_SUCCESS) {
+        throw std::runtime_error("failed to create pipeline cache");
+    }
+
+    uint32_t workerCount = options.workerCount;
+    if (workerCount == 0) {
+        workerCount = std::max(std::thread::hardware_concurrency(), 2u) - 1;
+    }
+    stopping = false;
+    for (uint32_t i = 0; i < workerCount; i++) {
+        workers.emplace_back(&GraphicsPipelineCache::workerLoop, this);
+    }
+}
+
+void GraphicsPipelineCache::destroy() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+        // Nobody compiles these anymore, don't leave anyone waiting on them
+        for (const auto& job: jobs) {
+            pipelines[job.desc].pending = false;
+        }
+        jobs.clear();
+    }
+    jobQueued.notify_all();
+    jobFinished.notify_all();
+    for (auto& worker: workers) {
+        worker.join();
+    }
+    workers.clear();
+
+    for (auto& [desc, slot]: pipelines) {
+        if (slot.pipeline != VK_NULL_HANDLE) {
+            vkDestroyPipeline(device, slot.pipeline, allocationCallbacks);
+        }
+    }
+    pipelines.clear();
+
+#if defined(VK_EXT_graphics_pipeline_library)
+    for (auto& [key, library]: libraries) {
+        vkDestroyPipeline(device, library, allocationCallbacks);
+    }
+    libraries.clear();
+#endif
+
+    if (!cacheFile.empty()) {
+        size_t size = 0;
+        std::vector<char> cacheData;
+        if (vkGetPipelineCacheData(device, driverCache, &size, nullptr) == VK_SUCCESS) {
+            cacheData.resize(size);
+        }
+        if (!cacheData.empty() && vkGetPipelineCacheData(device, driverCache, &size, cacheData.data()) == VK_SUCCESS) {
+            std::ofstream file(cacheFile, std::ios::binary | std::ios::trunc);
+            file.write(cacheData.data(), static_cast<std::streamsize>(size));
+            if (!file) {
+                std::cout << "pipeline cache: failed to write " << cacheFile << std::endl;
+            }
+        }
+    }
+
+    vkDestroyPipelineCache(device, driverCache, allocationCallbacks);
+    driverCache = VK_NULL_HANDLE;
+}
+
+size_t GraphicsPipelineCache::size() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return pipelines.size();
+}
+
+GraphicsPipelineDesc GraphicsPipelineCache::key(const GraphicsPipelineDesc& desc) const {
+    if (!extendedDynamicState) {
+        return desc;
+    }
+
+    GraphicsPipelineDesc key = desc;
+    key.cullMode = VK_CULL_MODE_NONE;
+    key.frontFace = VK_FRONT_FACE_COUNTER_CLOCKWISE;
+    key.topology = topologyClass(desc.topology);
+    key.depth = {};
+    return key;
+}
+
+void GraphicsPipelineCache::setDynamicState(VkCommandBuffer commandBuffer, const GraphicsPipelineDesc& desc) const {
+#if defined(VK_EXT_extended_dynamic_state)
+    if (extendedDynamicState) {
+        fp_vkCmdSetCullMode(commandBuffer, desc.cullMode);
+        fp_vkCmdSetFrontFace(commandBuffer, desc.frontFace);
+        fp_vkCmdSetPrimitiveTopology(commandBuffer, desc.topology);
+        fp_vkCmdSetDepthTestEnable(commandBuffer, desc.depth.testEnable);
+        fp_vkCmdSetDepthWriteEnable(commandBuffer, desc.depth.writeEnable);
+        fp_vkCmdSetDepthCompareOp(commandBuffer, desc.depth.compareOp);
+    }
+#endif
+}
+
+VkPipeline GraphicsPipelineCache::find(const GraphicsPipelineDesc& desc) const {
+    std::lock_guard<std::mutex> lock(mutex);
+    auto it = pipelines.find(key(desc));
+    return it != pipelines.end() ? it->second.pipeline : VK_NULL_HANDLE;
+}
+
+VkPipeline GraphicsPipelineCache::get(const GraphicsPipelineDesc& variant, VkRenderPass renderPass) {
+    GraphicsPipelineDesc desc = key(variant);
+    std::unique_lock<std::mutex> lock(mutex);
+    Slot* slot = &pipelines[desc];
+    jobFinished.wait(lock, [slot] { return !slot->pending; });
+    if (slot->error) {
+        std::rethrow_exception(slot->error);
+    }
+    if (slot->pipeline != VK_NULL_HANDLE) {
+        return slot->pipeline;
+    }
+
+    // Not compiled yet: compile here
+    slot->pending = true;
+    lock.unlock();
+    VkPipeline pipeline = VK_NULL_HANDLE;
+    try {
+        pipeline = create(desc, renderPass);
+    } catch (...) {
+        lock.lock();
+        slot->pending = false;
+        slot->error = std::current_exception();
+        jobFinished.notify_all();
+        throw;
+    }
+    lock.lock();
+    slot->pipeline = pipeline;
+    slot->pending = false;
+    jobFinished.notify_all();
+    return pipeline;
+}
+
+GraphicsPipelineCache::Slot& GraphicsPipelineCache::enqueue(const GraphicsPipelineDesc& desc, VkRenderPass renderPass) {
+    Slot& slot = pipelines[desc];
+    if (slot.pipeline == VK_NULL_HANDLE && !slot.pending && !slot.error && !stopping) {
+        slot.pending = true;
+        jobs.push_back({ desc, renderPass });
+        jobQueued.notify_one();
+    }
+    return slot;
+}
+
+VkPipeline GraphicsPipelineCache::request(const GraphicsPipelineDesc& desc, VkRenderPass renderPass) {
+    std::lock_guard<std::mutex> lock(mutex);
+    Slot& slot = enqueue(key(desc), renderPass);
+    if (slot.error) {
+        std::rethrow_exception(slot.error);
+    }
+    return slot.pipeline;
+}
+
+void GraphicsPipelineCache::prewarm(std::span<const GraphicsPipelineDesc> descs, VkRenderPass renderPass) {
+    std::lock_guard<std::mutex> lock(mutex);
+    for (const auto& desc: descs) {
+        enqueue(key(desc), renderPass);
+    }
+}
+
+void GraphicsPipelineCache::workerLoop() {
+    std::unique_lock<std::mutex> lock(mutex);
+    while (true) {
+        jobQueued.wait(lock, [this] { return stopping || !jobs.empty(); });
+        if (stopping) {
+            return;
+        }
+
+        Job job = jobs.front();
+        jobs.pop_front();
+        lock.unlock();
+
+        VkPipeline pipeline = VK_NULL_HANDLE;
+        std::exception_ptr error;
+        try {
+            pipeline = create(job.desc, job.renderPass);
+        } catch (...) {
+            error = std::current_exception();
+        }
+
+        lock.lock();
+        Slot& slot = pipelines[job.desc];
+        slot.pipeline = pipeline;
+        slot.pending = false;
+        slot.error = error;
+        jobFinished.notify_all();
+    }
+}
+
+VkPipeline GraphicsPipelineCache::compile(VkGraphicsPipelineCreateInfo pipeline_info,
+                                          std::initializer_list<const ShaderArchive::Shader*> shaders) {
+    ShaderModuleCache::Stage stages[2];
+    VkPipelineShaderStageCreateInfo shader_stages[2] = {};
+    assert(shaders.size() <= 2);
+
+    // ShaderModuleCache isn't thread safe, stages are filled one pipeline at a time
+    auto fillStages = [&] (bool allowIdentifier) {
+        std::lock_guard<std::mutex> lock(shaderMutex);
+        bool usesIdentifier = false;
+        uint32_t i = 0;
+        for (const auto* shader: shaders) {
+            shaderModules->fillStage(*shader, allowIdentifier, stages[i]);
+            shader_stages[i] = stages[i].info;
+            usesIdentifier = usesIdentifier || stages[i].usesIdentifier;
+            i++;
+        }
+        return usesIdentifier;
+    };
+
+    pipeline_info.stageCount = static_cast<uint32_t>(shaders.size());
+    pipeline_info.pStages = shaders.size() > 0 ? shader_stages : nullptr;
+
+    VkPipeline pipeline = VK_NULL_HANDLE;
+    VkResult result = VK_ERROR_UNKNOWN;
+    [[maybe_unused]] bool usesIdentifier = fillStages(true);
+#if defined(VK_EXT_shader_module_identifier)
+    if (usesIdentifier) {
+        // Stages given by identifier only succeed when the pipeline doesn't need compiling
+        pipeline_info.flags |= VK_PIPELINE_CREATE_FAIL_ON_PIPELINE_COMPILE_REQUIRED_BIT_EXT;
+        result = vkCreateGraphicsPipelines(device, driverCache, 1, &pipeline_info, allocationCallbacks, &pipeline);
+        if (result == VK_PIPELINE_COMPILE_REQUIRED_EXT) {
+            fillStages(false);
+            pipeline_info.flags &= ~VK_PIPELINE_CREATE_FAIL_ON_PIPELINE_COMPILE_REQUIRED_BIT_EXT;
+            result = vkCreateGraphicsPipelines(device, driverCache, 1, &pipeline_info, allocationCallbacks, &pipeline);
+        }
+    } else
+#endif
+    {
+        result = vkCreateGraphicsPipelines(device, driverCache, 1, &pipeline_info, allocationCallbacks, &pipeline);
+    }
+
+    if (result != VK_SUCCESS) {
+        throw std::runtime_error("failed to create pipline");
+    }
+    return pipeline;
+}
+
+VkPipeline GraphicsPipelineCache::create(const GraphicsPipelineDesc& desc, VkRenderPass renderPass) {
+    if (desc.vertexShader == nullptr || desc.fragmentShader == nullptr) {
+        throw std::runtime_error("pipeline description is missing a shader");
+    }
+
+#if defined(VK_EXT_graphics_pipeline_library)
+    if (useLibraries) {
+        return link(desc, renderPass);
+    }
+#endif
+
+    FixedFunctionState state;
+    state.fill(desc, extendedDynamicState);
+
+    VkGraphicsPipelineCreateInfo pipeline_info = {};
+    pipeline_info.sType = VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO;
+    pipeline_info.pNext = state.renderingInfo(renderPass);
+    pipeline_info.pVertexInputState = &state.vertexInput;
+    pipeline_info.pInputAssemblyState = &state.inputAssembly;
+    pipeline_info.pViewportState = &state.viewport;
+    pipeline_info.pRasterizationState = &state.rasterizer;
+    pipeline_info.pMultisampleState = &state.multisampling;
+    pipeline_info.pDepthStencilState = &state.depthStencil;
+    pipeline_info.pColorBlendState = &state.colorBlending;
+    pipeline_info.pDynamicState = &state.dynamic;
+    pipeline_info.layout = desc.layout;
+    pipeline_info.renderPass = renderPass;
+    pipeline_info.subpass = desc.target.subpass;
+    pipeline_info.basePipelineHandle = VK_NULL_HANDLE;
+
+    return compile(pipeline_info, { desc.vertexShader, desc.fragmentShader });
+}
+
+#if defined(VK_EXT_graphics_pipeline_library)
+VkPipeline GraphicsPipelineCache::library(const LibraryKey& key, VkGraphicsPipelineCreateInfo pipeline_info,
+                                          std::initializer_list<const ShaderArchive::Shader*> shaders) {
+    {
+        std::lock_guard<std::mutex> lock(libraryMutex);
+        auto it = libraries.find(key);
+        if (it != libraries.end()) {
+            return it->second;
+        }
+    }
+
+    VkGraphicsPipelineLibraryCreateInfoEXT library_info = {};
+    library_info.sType = VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_LIBRARY_CREATE_INFO_EXT;
+    library_info.flags = key.part;
+    library_info.pNext = pipeline_info.pNext;
+    pipeline_info.pNext = &library_info;
+    pipeline_info.flags |= VK_PIPELINE_CREATE_LIBRARY_BIT_KHR;
+    VkPipeline pipeline = compile(pipeline_info, shaders);
+
+    // Another worker may have built the same part in the meantime, keep the first one
+    std::lock_guard<std::mutex> lock(libraryMutex);
+    auto [it, inserted] = libraries.try_emplace(key, pipeline);
+    if (!inserted) {
+        vkDestroyPipeline(device, pipeline, allocationCallbacks);
+    }
+    return it->second;
+}
+
+VkPipeline GraphicsPipelineCache::link(const GraphicsPipelineDesc& desc, VkRenderPass renderPass) {
+    FixedFunctionState state;
+    state.fill(desc, extendedDynamicState);
+
+    auto partKey = [&desc, renderPass] (VkGraphicsPipelineLibraryFlagsEXT part) {
+        return LibraryKey { part, renderPass == VK_NULL_HANDLE, librarySlice(part, desc) };
+    };
+
+    VkGraphicsPipelineCreateInfo part_info = {};
+    part_info.sType = VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO;
+
+    VkGraphicsPipelineCreateInfo vertex_input_info = part_info;
+    vertex_input_info.pVertexInputState = &state.vertexInput;
+    vertex_input_info.pInputAssemblyState = &state.inputAssembly;
+    vertex_input_info.pDynamicState = &state.dynamic;
+
+    VkGraphicsPipelineCreateInfo pre_rasterization_info = part_info;
+    pre_rasterization_info.pNext = state.renderingInfo(renderPass);
+    pre_rasterization_info.pViewportState = &state.viewport;
+    pre_rasterization_info.pRasterizationState = &state.rasterizer;
+    pre_rasterization_info.pDynamicState = &state.dynamic;
+    pre_rasterization_info.layout = desc.layout;
+    pre_rasterization_info.renderPass = renderPass;
+    pre_rasterization_info.subpass = desc.target.subpass;
+
+    VkGraphicsPipelineCreateInfo fragment_shader_info = part_info;
+    fragment_shader_info.pNext = state.renderingInfo(renderPass);
+    fragment_shader_info.pMultisampleState = &state.multisampling;
+    fragment_shader_info.pDepthStencilState = &state.depthStencil;
+    fragment_shader_info.pDynamicState = &state.dynamic;
+    fragment_shader_info.layout = desc.layout;
+    fragment_shader_info.renderPass = renderPass;
+    fragment_shader_info.subpass = desc.target.subpass;
+
+    VkGraphicsPipelineCreateInfo fragment_output_info = part_info;
+    fragment_output_info.pNext = state.renderingInfo(renderPass);
+    fragment_output_info.pMultisampleState = &state.multisampling;
+    fragment_output_info.pColorBlendState = &state.colorBlending;
+    fragment_output_info.renderPass = renderPass;
+    fragment_output_info.subpass = desc.target.subpass;
+
+    // Parts are shared between every variant that agrees on their slice of the description,
+    // so a new variant usually only pays for the link
+    VkPipeline parts[] = {
+        library(partKey(VK_GRAPHICS_PIPELINE_LIBRARY_VERTEX_INPUT_INTERFACE_BIT_EXT), vertex_input_info, {}),
+        library(partKey(VK_GRAPHICS_PIPELINE_LIBRARY_PRE_RASTERIZATION_SHADERS_BIT_EXT), pre_rasterization_info, { desc.vertexShader }),
+        library(partKey(VK_GRAPHICS_PIPELINE_LIBRARY_FRAGMENT_SHADER_BIT_EXT), fragment_shader_info, { desc.fragmentShader }),
+        library(partKey(VK_GRAPHICS_PIPELINE_LIBRARY_FRAGMENT_OUTPUT_INTERFACE_BIT_EXT), fragment_output_info, {}),
+    };
+
+    VkPipelineLibraryCreateInfoKHR linking_info = {};
+    linking_info.sType = VK_STRUCTURE_TYPE_PIPELINE_LIBRARY_CREATE_INFO_KHR;
+    linking_info.libraryCount = 4;
+    linking_info.pLibraries = parts;
+
+    // Fast link: no VK_PIPELINE_CREATE_LINK_TIME_OPTIMIZATION_BIT_EXT
+    VkGraphicsPipelineCreateInfo pipeline_info = {};
+    pipeline_info.sType = VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO;
+    pipeline_info.pNext = &linking_info;
+    pipeline_info.layout = desc.layout;
+
+    return compile(pipeline_info, {});
+}
+#endif
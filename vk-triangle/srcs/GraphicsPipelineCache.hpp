@@ -0,0 +1,247 @@
+//
+//  GraphicsPipelineCache.hpp
+//  vk-triangle
+//
+//  Created by Kai Chen on 10/18/26.
+//
+
+#ifndef GraphicsPipelineCache_hpp
+#define GraphicsPipelineCache_hpp
+
+#include <vulkan/vulkan.h>
+
+#include <array>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <exception>
+#include <initializer_list>
+#include <mutex>
+#include <span>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include "ShaderArchive.hpp"
+#include "ShaderModuleCache.hpp"
+
+// Everything that distinguishes one graphics pipeline variant from another.
+// Viewport and scissor are always dynamic and aren't part of the description.
+struct GraphicsPipelineDesc {
+    static constexpr uint32_t kMaxVertexBindings = 4;
+    static constexpr uint32_t kMaxVertexAttributes = 8;
+
+    struct VertexBinding {
+        uint32_t binding = 0;
+        uint32_t stride = 0;
+        VkVertexInputRate inputRate = VK_VERTEX_INPUT_RATE_VERTEX;
+        bool operator==(const VertexBinding&) const = default;
+    };
+
+    struct VertexAttribute {
+        uint32_t location = 0;
+        uint32_t binding = 0;
+        VkFormat format = VK_FORMAT_UNDEFINED;
+        uint32_t offset = 0;
+        bool operator==(const VertexAttribute&) const = default;
+    };
+
+    struct Blend {
+        VkBool32 enable = VK_FALSE;
+        VkBlendFactor srcColor = VK_BLEND_FACTOR_ONE;
+        VkBlendFactor dstColor = VK_BLEND_FACTOR_ZERO;
+        VkBlendOp colorOp = VK_BLEND_OP_ADD;
+        VkBlendFactor srcAlpha = VK_BLEND_FACTOR_ONE;
+        VkBlendFactor dstAlpha = VK_BLEND_FACTOR_ZERO;
+        VkBlendOp alphaOp = VK_BLEND_OP_ADD;
+        VkColorComponentFlags writeMask = VK_COLOR_COMPONENT_R_BIT | VK_COLOR_COMPONENT_G_BIT |
+                                          VK_COLOR_COMPONENT_B_BIT | VK_COLOR_COMPONENT_A_BIT;
+        bool operator==(const Blend&) const = default;
+    };
+
+    struct Depth {
+        VkBool32 testEnable = VK_FALSE;
+        VkBool32 writeEnable = VK_FALSE;
+        VkCompareOp compareOp = VK_COMPARE_OP_LESS;
+        bool operator==(const Depth&) const = default;
+    };
+
+    // Render pass compatibility: pipelines can be used with any render pass (or dynamic rendering)
+    // that has these attachments.
+    struct Target {
+        VkFormat colorFormat = VK_FORMAT_UNDEFINED;
+        VkFormat depthFormat = VK_FORMAT_UNDEFINED;
+        VkSampleCountFlagBits samples = VK_SAMPLE_COUNT_1_BIT;
+        uint32_t subpass = 0;
+        bool operator==(const Target&) const = default;
+    };
+
+    // Shaders are compared by the content hash of their SPIR-V.
+    const ShaderArchive::Shader* vertexShader = nullptr;
+    const ShaderArchive::Shader* fragmentShader = nullptr;
+    VkPipelineLayout layout = VK_NULL_HANDLE;
+
+    uint32_t vertexBindingCount = 0;
+    std::array<VertexBinding, kMaxVertexBindings> vertexBindings = {};
+    uint32_t vertexAttributeCount = 0;
+    std::array<VertexAttribute, kMaxVertexAttributes> vertexAttributes = {};
+    VkPrimitiveTopology topology = VK_PRIMITIVE_TOPOLOGY_TRIANGLE_LIST;
+
+    VkPolygonMode polygonMode = VK_POLYGON_MODE_FILL;
+    VkCullModeFlags cullMode = VK_CULL_MODE_BACK_BIT;
+    VkFrontFace frontFace = VK_FRONT_FACE_CLOCKWISE;
+
+    Depth depth;
+    Blend blend;
+    Target target;
+
+    bool operator==(const GraphicsPipelineDesc& other) const;
+    uint64_t hash() const;
+
+    struct Hasher {
+        size_t operator()(const GraphicsPipelineDesc& desc) const { return static_cast<size_t>(desc.hash()); }
+    };
+};
+
+// Compiled pipelines keyed by their description. Each variant is compiled once,
+// later lookups are a single hash map probe.
+//
+// Variants can be compiled on a pool of background threads: request() never blocks and
+// returns VK_NULL_HANDLE until the variant is ready, so the renderer can draw with a fallback
+// pipeline (or skip the draw) instead of hitching. Render passes handed to the cache must stay
+// alive until their pipelines are compiled.
+//
+// With VK_EXT_graphics_pipeline_library the vertex input, pre-rasterization, fragment shader and
+// fragment output parts are compiled as separate libraries, cached on their own and fast-linked
+// into each variant.
+//
+// The driver's pipeline cache is loaded from and saved to Options::cacheFile, so pipelines compiled
+// in an earlier run are found again. That's also what lets stages given by module identifier hit.
+//
+// With extended dynamic state, cull mode, front face, topology (within its class) and depth
+// state are left out of the key and set on the command buffer with setDynamicState(), so
+// descriptions that only differ in those share one pipeline.
+class GraphicsPipelineCache {
+public:
+    struct Options {
+        // Requires the graphicsPipelineLibrary feature.
+        bool useLibraries = false;
+        // Requires Vulkan 1.3 or the extendedDynamicState feature of VK_EXT_extended_dynamic_state.
+        bool extendedDynamicState = false;
+        // 0 uses one worker per hardware thread, minus the render thread.
+        uint32_t workerCount = 0;
+        // Where the driver's pipeline cache is kept between runs, empty keeps it in memory only.
+        std::string cacheFile;
+        // Host memory for the pipelines and the driver's cache, has to outlive the cache.
+        VkAllocationCallbacks* allocationCallbacks = nullptr;
+    };
+
+    void init(VkDevice device, PFN_vkGetDeviceProcAddr getDeviceProcAddr, ShaderModuleCache* shaderModules,
+              const Options& options);
+    // Stops the workers. Variants still queued are dropped and their slots reset, the ones being
+    // compiled are finished first.
+    void destroy();
+
+    // Returns the pipeline for `desc`, compiling it against `renderPass` on a miss.
+    // `renderPass` has to be compatible with `desc.target`, VK_NULL_HANDLE compiles the pipeline
+    // for dynamic rendering into attachments of `desc.target` formats. Waits if the variant is
+    // being compiled in the background, throws if compiling fails, here or in the background.
+    VkPipeline get(const GraphicsPipelineDesc& desc, VkRenderPass renderPass);
+    // Returns the pipeline if it's ready, otherwise queues it for a background compile and
+    // returns VK_NULL_HANDLE. Throws the error of a background compile that failed.
+    VkPipeline request(const GraphicsPipelineDesc& desc, VkRenderPass renderPass);
+    // Queues all `descs` for the workers to compile in parallel and returns right away, for the
+    // variants known to be needed at startup. request() and get() pick them up when they're ready.
+    void prewarm(std::span<const GraphicsPipelineDesc> descs, VkRenderPass renderPass);
+    // Lookup only, VK_NULL_HANDLE when the variant hasn't been compiled.
+    VkPipeline find(const GraphicsPipelineDesc& desc) const;
+
+    // Records the state of `desc` that the pipelines leave dynamic. Call after binding the pipeline.
+    void setDynamicState(VkCommandBuffer commandBuffer, const GraphicsPipelineDesc& desc) const;
+    bool extendedDynamicStateEnabled() const { return extendedDynamicState; }
+
+    size_t size() const;
+
+private:
+    struct Slot {
+        VkPipeline pipeline = VK_NULL_HANDLE;
+        bool pending = false;
+        // Why the compile failed, rethrown to whoever asks for the variant
+        std::exception_ptr error;
+    };
+
+#if defined(VK_EXT_graphics_pipeline_library)
+    // A library part with the slice of the description it's compiled from, the rest of `desc`
+    // is left at its defaults so every variant that agrees on the slice shares the part.
+    struct LibraryKey {
+        VkGraphicsPipelineLibraryFlagsEXT part = 0;
+        // Compiled for dynamic rendering rather than a render pass
+        bool dynamicRendering = false;
+        GraphicsPipelineDesc desc;
+        bool operator==(const LibraryKey&) const = default;
+
+        struct Hasher {
+            size_t operator()(const LibraryKey& key) const {
+                return static_cast<size_t>(key.desc.hash() ^ (uint64_t(key.part) << 1 | key.dynamicRendering));
+            }
+        };
+    };
+#endif
+
+    struct Job {
+        GraphicsPipelineDesc desc;
+        VkRenderPass renderPass;
+    };
+
+    // `desc` with the state that's dynamic reset, so variants differing only in it collapse.
+    GraphicsPipelineDesc key(const GraphicsPipelineDesc& desc) const;
+    VkPipeline create(const GraphicsPipelineDesc& desc, VkRenderPass renderPass);
+    // Creates the pipeline with stages for `shaders`, preferring module identifiers.
+    VkPipeline compile(VkGraphicsPipelineCreateInfo info, std::initializer_list<const ShaderArchive::Shader*> shaders);
+#if defined(VK_EXT_graphics_pipeline_library)
+    VkPipeline link(const GraphicsPipelineDesc& desc, VkRenderPass renderPass);
+    // Returns the cached library for `key`, compiling `info` as a `key.part` library on a miss.
+    VkPipeline library(const LibraryKey& key, VkGraphicsPipelineCreateInfo info,
+                       std::initializer_list<const ShaderArchive::Shader*> shaders);
+#endif
+    // Queues `desc` unless it's ready or already queued, returns its slot. Requires `mutex`.
+    Slot& enqueue(const GraphicsPipelineDesc& desc, VkRenderPass renderPass);
+    void workerLoop();
+
+    VkDevice device = VK_NULL_HANDLE;
+    ShaderModuleCache* shaderModules = nullptr;
+    VkPipelineCache driverCache = VK_NULL_HANDLE;
+    VkAllocationCallbacks* allocationCallbacks = nullptr;
+    std::string cacheFile;
+    bool useLibraries = false;
+    bool extendedDynamicState = false;
+#if defined(VK_EXT_extended_dynamic_state)
+    PFN_vkCmdSetCullModeEXT fp_vkCmdSetCullMode = nullptr;
+    PFN_vkCmdSetFrontFaceEXT fp_vkCmdSetFrontFace = nullptr;
+    PFN_vkCmdSetPrimitiveTopologyEXT fp_vkCmdSetPrimitiveTopology = nullptr;
+    PFN_vkCmdSetDepthTestEnableEXT fp_vkCmdSetDepthTestEnable = nullptr;
+    PFN_vkCmdSetDepthWriteEnableEXT fp_vkCmdSetDepthWriteEnable = nullptr;
+    PFN_vkCmdSetDepthCompareOpEXT fp_vkCmdSetDepthCompareOp = nullptr;
+#endif
+
+    // Guards the slots and the job queue. Pipelines are compiled without holding it.
+    mutable std::mutex mutex;
+    std::condition_variable jobQueued;
+    std::condition_variable jobFinished;
+    std::unordered_map<GraphicsPipelineDesc, Slot, GraphicsPipelineDesc::Hasher> pipelines;
+    std::deque<Job> jobs;
+    std::vector<std::thread> workers;
+    bool stopping = false;
+
+    // ShaderModuleCache isn't thread safe, stages are filled under this lock
+    std::mutex shaderMutex;
+
+#if defined(VK_EXT_graphics_pipeline_library)
+    // Pipeline library parts keyed by the part type and its slice of the description
+    std::mutex libraryMutex;
+    std::unordered_map<LibraryKey, VkPipeline, LibraryKey::Hasher> libraries;
+#endif
+};
+
+#endif /* GraphicsPipelineCache_hpp */
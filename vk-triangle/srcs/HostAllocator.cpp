@@ -0,0 +1,243 @@
+//
+//  HostAllocator.cpp
+//  vk-triangle
+//
+//  Created by Kai Chen on 10/18/26.
+//
+
+#include "HostAllocator.hpp"
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+
+namespace {
+
+const char* scopeName(uint32_t scope) {
+    switch (scope) {
+        case VK_SYSTEM_ALLOCATION_SCOPE_COMMAND: return "command";
+        case VK_SYSTEM_ALLOCATION_SCOPE_OBJECT: return "object";
+        case VK_SYSTEM_ALLOCATION_SCOPE_CACHE: return "cache";
+        case VK_SYSTEM_ALLOCATION_SCOPE_DEVICE: return "device";
+        case VK_SYSTEM_ALLOCATION_SCOPE_INSTANCE: return "instance";
+        default: return "unknown";
+    }
+}
+
+} // namespace
+
+HostAllocator::HostAllocator() {
+    vkCallbacks.pUserData = this;
+    vkCallbacks.pfnAllocation = allocationCallback;
+    vkCallbacks.pfnReallocation = reallocationCallback;
+    vkCallbacks.pfnFree = freeCallback;
+    vkCallbacks.pfnInternalAllocation = internalAllocationCallback;
+    vkCallbacks.pfnInternalFree = internalFreeCallback;
+}
+
+HostAllocator::~HostAllocator() {
+    // Anything still live belongs to an object that wasn't destroyed
+    for (uint32_t scope = 0; scope < kScopeCount; scope++) {
+        if (counters[scope].liveBytes > 0) {
+            std::cout << "host memory: " << counters[scope].liveBytes << " bytes of " << scopeName(scope)
+                      << " scope never freed" << std::endl;
+        }
+    }
+}
+
+HostAllocator::Stats HostAllocator::stats() const {
+    Stats stats;
+    for (uint32_t scope = 0; scope < kScopeCount; scope++) {
+        stats.scopes[scope].allocations = counters[scope].allocations;
+        stats.scopes[scope].reallocations = counters[scope].reallocations;
+        stats.scopes[scope].frees = counters[scope].frees;
+        stats.scopes[scope].liveBytes = counters[scope].liveBytes;
+        stats.scopes[scope].peakBytes = counters[scope].peakBytes;
+        stats.scopes[scope].internalBytes = counters[scope].internalBytes;
+    }
+    stats.arenaBytes = arenaBytes;
+    return stats;
+}
+
+void HostAllocator::report(uint64_t frames) {
+    auto now = stats();
+    frames = std::max<uint64_t>(frames, 1);
+    for (uint32_t scope = 0; scope < kScopeCount; scope++) {
+        const auto& current = now.scopes[scope];
+        const auto& previous = reported.scopes[scope];
+        if (current.allocations == 0 && current.internalBytes == 0) {
+            continue;
+        }
+        std::cout << "host memory: " << scopeName(scope) << " scope "
+                  << static_cast<double>(current.allocations - previous.allocations) / frames << " allocations, "
+                  << static_cast<double>(current.frees - previous.frees) / frames << " frees per frame, "
+                  << current.liveBytes / 1024 << " KiB live (peak " << current.peakBytes / 1024 << " KiB)";
+        if (current.internalBytes > 0) {
+            std::cout << ", " << current.internalBytes / 1024 << " KiB internal";
+        }
+        std::cout << std::endl;
+    }
+    std::cout << "host memory: " << now.arenaBytes / 1024 << " KiB in command and object arenas" << std::endl;
+    reported = now;
+}
+
+HostAllocator::Arena* HostAllocator::arenaFor(VkSystemAllocationScope scope) {
+    switch (scope) {
+        case VK_SYSTEM_ALLOCATION_SCOPE_COMMAND: return &commandArena;
+        case VK_SYSTEM_ALLOCATION_SCOPE_OBJECT: return &objectArena;
+        default: return nullptr;
+    }
+}
+
+void* HostAllocator::alignPast(void* base, size_t alignment) {
+    auto address = reinterpret_cast<uintptr_t>(base) + sizeof(Header);
+    address = (address + alignment - 1) & ~static_cast<uintptr_t>(alignment - 1);
+    return reinterpret_cast<void*>(address);
+}
+
+HostAllocator::Header* HostAllocator::headerOf(void* memory) {
+    return reinterpret_cast<Header*>(static_cast<std::byte*>(memory) - sizeof(Header));
+}
+
+void* HostAllocator::allocate(size_t size, size_t alignment, VkSystemAllocationScope scope) {
+    void* memory = place(size, alignment, scope);
+    if (memory != nullptr) {
+        counters[scope].allocations++;
+        addLive(scope, size);
+    }
+    return memory;
+}
+
+void* HostAllocator::place(size_t size, size_t alignment, VkSystemAllocationScope scope) {
+    if (size == 0) {
+        return nullptr;
+    }
+    alignment = std::max(alignment, alignof(Header));
+    size_t span = sizeof(Header) + alignment - 1 + size;
+
+    Arena* arena = arenaFor(scope);
+    if (arena != nullptr && span <= kChunkSize / 4) {
+        return allocateFromArena(*arena, size, alignment, scope);
+    }
+    void* block = std::malloc(span);
+    if (block == nullptr) {
+        return nullptr;
+    }
+    void* memory = alignPast(block, alignment);
+    *headerOf(memory) = { block, nullptr, size, scope };
+    return memory;
+}
+
+void HostAllocator::addLive(VkSystemAllocationScope scope, size_t size) {
+    auto& counter = counters[scope];
+    size_t live = counter.liveBytes += size;
+    size_t peak = counter.peakBytes;
+    while (live > peak && !counter.peakBytes.compare_exchange_weak(peak, live)) {}
+}
+
+void* HostAllocator::allocateFromArena(Arena& arena, size_t size, size_t alignment, VkSystemAllocationScope scope) {
+    size_t span = sizeof(Header) + alignment - 1 + size;
+
+    std::lock_guard<std::mutex> lock(arena.mutex);
+    Chunk* chunk = arena.current;
+    if (chunk == nullptr || chunk->used + span > kChunkSize) {
+        // Start over in a chunk that has been emptied before adding one
+        chunk = nullptr;
+        for (auto& candidate : arena.chunks) {
+            if (candidate->live == 0) {
+                chunk = candidate.get();
+                break;
+            }
+        }
+        if (chunk == nullptr) {
+            arena.chunks.push_back(std::make_unique<Chunk>());
+            chunk = arena.chunks.back().get();
+            chunk->memory.reset(new std::byte[kChunkSize]);
+            arenaBytes += kChunkSize;
+        }
+        chunk->used = 0;
+        arena.current = chunk;
+    }
+
+    void* memory = alignPast(chunk->memory.get() + chunk->used, alignment);
+    chunk->used = static_cast<size_t>(static_cast<std::byte*>(memory) + size - chunk->memory.get());
+    chunk->live++;
+    *headerOf(memory) = { nullptr, chunk, size, scope };
+    return memory;
+}
+
+void* HostAllocator::reallocate(void* original, size_t size, size_t alignment, VkSystemAllocationScope scope) {
+    if (original == nullptr) {
+        return allocate(size, alignment, scope);
+    }
+    if (size == 0) {
+        free(original);
+        return nullptr;
+    }
+
+    // Chunks don't grow in place, and the scope may change, so it's always a move.
+    // On failure the original stays valid
+    void* memory = place(size, alignment, scope);
+    if (memory == nullptr) {
+        return nullptr;
+    }
+    Header header = *headerOf(original);
+    std::memcpy(memory, original, std::min(size, header.size));
+    release(original);
+    // Counted once, as a reallocation, not as an allocation and a free
+    counters[scope].reallocations++;
+    counters[header.scope].liveBytes -= header.size;
+    addLive(scope, size);
+    return memory;
+}
+
+void HostAllocator::free(void* memory) {
+    if (memory == nullptr) {
+        return;
+    }
+    Header* header = headerOf(memory);
+    counters[header->scope].frees++;
+    counters[header->scope].liveBytes -= header->size;
+    release(memory);
+}
+
+void HostAllocator::release(void* memory) {
+    Header header = *headerOf(memory);
+    if (header.chunk == nullptr) {
+        std::free(header.block);
+        return;
+    }
+    Arena& arena = *arenaFor(header.scope);
+    std::lock_guard<std::mutex> lock(arena.mutex);
+    // The current chunk starts over right away, others wait until the current one is full
+    if (--header.chunk->live == 0 && header.chunk == arena.current) {
+        header.chunk->used = 0;
+    }
+}
+
+VKAPI_ATTR void* VKAPI_CALL HostAllocator::allocationCallback(void* userData, size_t size, size_t alignment,
+                                                              VkSystemAllocationScope scope) {
+    return static_cast<HostAllocator*>(userData)->allocate(size, alignment, scope);
+}
+
+VKAPI_ATTR void* VKAPI_CALL HostAllocator::reallocationCallback(void* userData, void* original, size_t size,
+                                                                size_t alignment, VkSystemAllocationScope scope) {
+    return static_cast<HostAllocator*>(userData)->reallocate(original, size, alignment, scope);
+}
+
+VKAPI_ATTR void VKAPI_CALL HostAllocator::freeCallback(void* userData, void* memory) {
+    static_cast<HostAllocator*>(userData)->free(memory);
+}
+
+VKAPI_ATTR void VKAPI_CALL HostAllocator::internalAllocationCallback(void* userData, size_t size,
+                                                                     VkInternalAllocationType,
+                                                                     VkSystemAllocationScope scope) {
+    static_cast<HostAllocator*>(userData)->counters[scope].internalBytes += size;
+}
+
+VKAPI_ATTR void VKAPI_CALL HostAllocator::internalFreeCallback(void* userData, size_t size,
+                                                               VkInternalAllocationType,
+                                                               VkSystemAllocationScope scope) {
+    static_cast<HostAllocator*>(userData)->counters[scope].internalBytes -= size;
+}
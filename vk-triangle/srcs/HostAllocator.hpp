@@ -0,0 +1,128 @@
+//
+//  HostAllocator.hpp
+//  vk-triangle
+//
+//  Created by Kai Chen on 10/18/26.
+//
+
+#ifndef HostAllocator_hpp
+#define HostAllocator_hpp
+
+#include <vulkan/vulkan.h>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+// Host memory for the driver, handed out through VkAllocationCallbacks, with statistics per
+// VkSystemAllocationScope.
+//
+// Command scope allocations only live during one call and object scope ones as long as their
+// object, so both are bumped out of fixed-size chunks instead of going to malloc one by one.
+// A chunk is reused once everything in it has been freed. Cache, device and instance scope,
+// and anything larger than a quarter chunk, go to malloc.
+class HostAllocator {
+public:
+    static constexpr uint32_t kScopeCount = VK_SYSTEM_ALLOCATION_SCOPE_INSTANCE + 1;
+    static constexpr size_t kChunkSize = 64 * 1024;
+
+    struct ScopeStats {
+        uint64_t allocations = 0;
+        uint64_t reallocations = 0;
+        uint64_t frees = 0;
+        size_t liveBytes = 0;
+        size_t peakBytes = 0;
+        // What the driver reported allocating on its own, ie executable memory
+        size_t internalBytes = 0;
+    };
+
+    struct Stats {
+        ScopeStats scopes[kScopeCount];
+        // Reserved for the command and object scope arenas, used or not
+        size_t arenaBytes = 0;
+    };
+
+    HostAllocator();
+    ~HostAllocator();
+    HostAllocator(const HostAllocator&) = delete;
+    HostAllocator& operator=(const HostAllocator&) = delete;
+
+    // For vkCreate*/vkDestroy* and the vkb builders. The allocator has to outlive every object
+    // created with it.
+    VkAllocationCallbacks* callbacks() { return &vkCallbacks; }
+
+    Stats stats() const;
+    // Prints the allocations since the previous report averaged over `frames`, and what's live now.
+    void report(uint64_t frames);
+
+private:
+    struct Chunk {
+        std::unique_ptr<std::byte[]> memory;
+        size_t used = 0;
+        // Allocations in the chunk not freed yet, the chunk is reused at 0
+        uint32_t live = 0;
+    };
+
+    struct Arena {
+        std::mutex mutex;
+        std::vector<std::unique_ptr<Chunk>> chunks;
+        Chunk* current = nullptr;
+    };
+
+    struct Counters {
+        std::atomic<uint64_t> allocations = 0;
+        std::atomic<uint64_t> reallocations = 0;
+        std::atomic<uint64_t> frees = 0;
+        std::atomic<size_t> liveBytes = 0;
+        std::atomic<size_t> peakBytes = 0;
+        std::atomic<size_t> internalBytes = 0;
+    };
+
+    // In front of every allocation
+    struct Header {
+        // Start of the malloc'ed block, nullptr when it came from `chunk`
+        void* block;
+        Chunk* chunk;
+        size_t size;
+        VkSystemAllocationScope scope;
+    };
+
+    Arena* arenaFor(VkSystemAllocationScope scope);
+    // Where the allocation starts in a block at `base`, leaving room for its header
+    static void* alignPast(void* base, size_t alignment);
+    static Header* headerOf(void* memory);
+    // Counted in the statistics
+    void* allocate(size_t size, size_t alignment, VkSystemAllocationScope scope);
+    void* reallocate(void* original, size_t size, size_t alignment, VkSystemAllocationScope scope);
+    void free(void* memory);
+    // Not counted
+    void* place(size_t size, size_t alignment, VkSystemAllocationScope scope);
+    void release(void* memory);
+    void addLive(VkSystemAllocationScope scope, size_t size);
+    void* allocateFromArena(Arena& arena, size_t size, size_t alignment, VkSystemAllocationScope scope);
+
+    static VKAPI_ATTR void* VKAPI_CALL allocationCallback(void* userData, size_t size, size_t alignment,
+                                                          VkSystemAllocationScope scope);
+    static VKAPI_ATTR void* VKAPI_CALL reallocationCallback(void* userData, void* original, size_t size,
+                                                            size_t alignment, VkSystemAllocationScope scope);
+    static VKAPI_ATTR void VKAPI_CALL freeCallback(void* userData, void* memory);
+    static VKAPI_ATTR void VKAPI_CALL internalAllocationCallback(void* userData, size_t size,
+                                                                 VkInternalAllocationType type,
+                                                                 VkSystemAllocationScope scope);
+    static VKAPI_ATTR void VKAPI_CALL internalFreeCallback(void* userData, size_t size,
+                                                           VkInternalAllocationType type,
+                                                           VkSystemAllocationScope scope);
+
+    VkAllocationCallbacks vkCallbacks = {};
+    Arena commandArena;
+    Arena objectArena;
+    std::atomic<size_t> arenaBytes = 0;
+    Counters counters[kScopeCount];
+    // Totals at the previous report
+    Stats reported;
+};
+
+#endif /* HostAllocator_hpp */
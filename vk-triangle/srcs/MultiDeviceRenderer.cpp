@@ -0,0 +1,649 @@
+//
+//  MultiDeviceRenderer.cpp
+//  vk-triangle
+//
+//  Created by Kai Chen on 10/18/26.
+//
+
+#include "MultiDeviceRenderer.hpp"
+
+#include <cstring>
+#include <iostream>
+#include <stdexcept>
+
+#include "Formats.hpp"
+#include "PipelineBarriers.hpp"
+
+namespace {
+
+uint32_t findMemoryType(const VkPhysicalDeviceMemoryProperties& memoryProperties, uint32_t typeBits,
+                        VkMemoryPropertyFlags properties) {
+    for (uint32_t i = 0; i < memoryProperties.memoryTypeCount; i++) {
+        if ((typeBits & (1u << i)) && (memoryProperties.memoryTypes[i].propertyFlags & properties) == properties) {
+            return i;
+        }
+    }
+    return UINT32_MAX;
+}
+
+// Texels are copied between devices as raw bytes, only 32-bit swapchain formats are handled
+uint32_t texelSize(VkFormat format) {
+    switch (format) {
+        case VK_FORMAT_B8G8R8A8_UNORM:
+        case VK_FORMAT_B8G8R8A8_SRGB:
+        case VK_FORMAT_R8G8B8A8_UNORM:
+        case VK_FORMAT_R8G8B8A8_SRGB:
+        case VK_FORMAT_A2R10G10B10_UNORM_PACK32:
+        case VK_FORMAT_A2B10G10R10_UNORM_PACK32:
+            return 4;
+        default:
+            return 0;
+    }
+}
+
+// Whether `physicalDevice` can render into the attachments of `target` and read the color back
+bool supportsTarget(VkPhysicalDevice physicalDevice, const GraphicsPipelineDesc::Target& target) {
+    VkFormatProperties color;
+    vkGetPhysicalDeviceFormatProperties(physicalDevice, target.colorFormat, &color);
+    VkFormatProperties depth;
+    vkGetPhysicalDeviceFormatProperties(physicalDevice, target.depthFormat, &depth);
+    VkPhysicalDeviceProperties properties;
+    vkGetPhysicalDeviceProperties(physicalDevice, &properties);
+
+    VkFormatFeatureFlags colorFeatures = VK_FORMAT_FEATURE_COLOR_ATTACHMENT_BIT | VK_FORMAT_FEATURE_TRANSFER_SRC_BIT;
+    VkSampleCountFlags samples = properties.limits.framebufferColorSampleCounts & properties.limits.framebufferDepthSampleCounts;
+    return (color.optimalTilingFeatures & colorFeatures) == colorFeatures &&
+           (depth.optimalTilingFeatures & VK_FORMAT_FEATURE_DEPTH_STENCIL_ATTACHMENT_BIT) &&
+           (samples & target.samples);
+}
+
+const VkImageSubresourceRange kColorRange = { VK_IMAGE_ASPECT_COLOR_BIT, 0, 1, 0, 1 };
+
+} // namespace
+
+void MultiDeviceRenderer::init(const vkb::Instance& instance, const vkb::Device& primary, VkExtent2D extent,
+                               const Options& options, DrawFn draw) {
+    this->options = options;
+    this->draw = std::move(draw);
+    this->extent = extent;
+    primaryDevice = primary.device;
+    primaryMemory = primary.physical_device.memory_properties;
+    primaryBand = { { 0, 0 }, extent };
+    if (this->options.cmdPipelineBarrier == nullptr) {
+        this->options.cmdPipelineBarrier = vkCmdPipelineBarrier;
+    }
+    if (this->options.cmdCopyBufferToImage == nullptr) {
+        this->options.cmdCopyBufferToImage = vkCmdCopyBufferToImage;
+    }
+    compositeBarriers = PipelineBarriers(this->options.cmdPipelineBarrier);
+
+    bytesPerPixel = texelSize(options.sceneDesc.target.colorFormat);
+    if (bytesPerPixel == 0) {
+        throw std::runtime_error("multi-GPU compositing needs a color format with 32-bit texels");
+    }
+
+    // Secondaries only render offscreen, they don't have to reach the surface
+    vkb::PhysicalDeviceSelector selector { instance };
+    auto physicalDevices = selector
+        .set_minimum_version(1, 1)
+        .require_present(false)
+        .defer_surface_initialization()
+        .select_devices();
+    if (!physicalDevices) {
+        std::cout << "multi-GPU: " << physicalDevices.error().message() << std::endl;
+        return;
+    }
+
+    for (const auto& physicalDevice: physicalDevices.value()) {
+        if (physicalDevice.physical_device == primary.physical_device.physical_device) {
+            continue;
+        }
+        if (!supportsTarget(physicalDevice, options.sceneDesc.target)) {
+            std::cout << "multi-GPU: skipping " << physicalDevice.name << ", it can't render the scene's attachments" << std::endl;
+            continue;
+        }
+        createWorker(physicalDevice);
+    }
+    if (workers.empty()) {
+        std::cout << "multi-GPU: no other device, rendering on " << primary.physical_device.name << " only" << std::endl;
+        return;
+    }
+
+    assignRegions();
+    for (auto& worker: workers) {
+        createTargets(*worker);
+    }
+    createStaging();
+
+    std::cout << "multi-GPU: " << deviceCount() << " devices, "
+              << (options.mode == Mode::AlternateFrame ? "alternate-frame" : "split-frame") << std::endl;
+}
+
+void MultiDeviceRenderer::destroy() {
+    for (auto& worker: workers) {
+        vkDeviceWaitIdle(worker->device.device);
+        destroyWorker(*worker);
+    }
+    workers.clear();
+    destroyStaging();
+}
+
+void MultiDeviceRenderer::resize(VkExtent2D extent) {
+    this->extent = extent;
+    primaryBand = { { 0, 0 }, extent };
+    if (!active()) {
+        return;
+    }
+
+    // Frames still in flight are dropped, the primary has waited for its own already
+    for (auto& worker: workers) {
+        vkDeviceWaitIdle(worker->device.device);
+        worker->busy = false;
+        destroyTargets(*worker);
+    }
+    assignRegions();
+    for (auto& worker: workers) {
+        createTargets(*worker);
+    }
+    destroyStaging();
+    createStaging();
+}
+
+bool MultiDeviceRenderer::primaryRenders(uint64_t frame) const {
+    return !active() || options.mode == Mode::SplitFrame || owner(frame) == 0;
+}
+
+VkRect2D MultiDeviceRenderer::primaryRegion() const {
+    return primaryBand;
+}
+
+void MultiDeviceRenderer::beginFrame(uint64_t frame) {
+    if (options.mode == Mode::SplitFrame) {
+        for (auto& worker: workers) {
+            // Left over from a frame that was never composited
+            if (worker->busy) {
+                worker->dispatch.waitForFences(1, &worker->fence, VK_TRUE, UINT64_MAX);
+                worker->busy = false;
+            }
+            submit(*worker, frame);
+        }
+        return;
+    }
+
+    // Every idle secondary starts on the next frame it owns, ahead of the primary
+    for (uint32_t i = 0; i < workers.size(); i++) {
+        auto& worker = *workers[i];
+        if (!worker.busy) {
+            submit(worker, frame + (i + 1 + deviceCount() - owner(frame)) % deviceCount());
+        }
+    }
+}
+
+bool MultiDeviceRenderer::composites(uint64_t frame) const {
+    return active() && (options.mode == Mode::SplitFrame || owner(frame) != 0);
+}
+
+void MultiDeviceRenderer::composite(uint64_t frame, uint32_t frameSlot, VkCommandBuffer commandBuffer, VkImage image) {
+    if (!composites(frame)) {
+        return;
+    }
+
+    auto& stage = staging[frameSlot];
+    VkDeviceSize rowPitch = static_cast<VkDeviceSize>(extent.width) * bytesPerPixel;
+
+    // Each secondary's band goes to the same offset in the staging buffer as in the image
+    std::vector<VkBufferImageCopy> copies;
+    auto upload = [&] (Worker& worker) {
+        finish(worker, frame);
+        const auto& region = worker.region;
+        VkDeviceSize offset = static_cast<VkDeviceSize>(region.offset.y) * rowPitch;
+        std::memcpy(static_cast<uint8_t*>(stage.mapped) + offset, worker.readback.mapped, region.extent.height * rowPitch);
+        worker.busy = false;
+
+        VkBufferImageCopy copy = {};
+        copy.bufferOffset = offset;
+        copy.imageSubresource = { VK_IMAGE_ASPECT_COLOR_BIT, 0, 0, 1 };
+        copy.imageOffset = { region.offset.x, region.offset.y, 0 };
+        copy.imageExtent = { region.extent.width, region.extent.height, 1 };
+        copies.push_back(copy);
+    };
+    if (options.mode == Mode::SplitFrame) {
+        for (auto& worker: workers) {
+            upload(*worker);
+        }
+    } else {
+        upload(*workers[owner(frame) - 1]);
+    }
+
+    // The scene submission's semaphore is waited for at the transfer stage, its signal already
+    // made the primary's band (and the acquire) available
+    bool rendered = primaryRenders(frame);
+    auto& barriers = compositeBarriers;
+    barriers.image(image, kColorRange,
+                   VK_PIPELINE_STAGE_TRANSFER_BIT, 0,
+                   VK_PIPELINE_STAGE_TRANSFER_BIT, VK_ACCESS_TRANSFER_WRITE_BIT,
+                   rendered ? VK_IMAGE_LAYOUT_PRESENT_SRC_KHR : VK_IMAGE_LAYOUT_UNDEFINED,
+                   VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL);
+    barriers.flush(commandBuffer);
+
+    options.cmdCopyBufferToImage(commandBuffer, stage.buffer, image, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
+                                 static_cast<uint32_t>(copies.size()), copies.data());
+
+    // Handed over to present by the semaphore
+    barriers.image(image, kColorRange, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_ACCESS_TRANSFER_WRITE_BIT, 0, 0,
+                   VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, VK_IMAGE_LAYOUT_PRESENT_SRC_KHR);
+    barriers.flush(commandBuffer);
+}
+
+bool MultiDeviceRenderer::createWorker(const vkb::PhysicalDevice& physicalDevice) {
+    vkb::DeviceBuilder builder { physicalDevice };
+    builder.set_allocation_callbacks(options.allocationCallbacks);
+    auto device = builder.build();
+    if (!device) {
+        std::cout << "multi-GPU: skipping " << physicalDevice.name << ": " << device.error().message() << std::endl;
+        return false;
+    }
+    auto queue = device.value().get_queue(vkb::QueueType::graphics);
+    if (!queue) {
+        std::cout << "multi-GPU: skipping " << physicalDevice.name << ": " << queue.error().message() << std::endl;
+        vkb::destroy_device(device.value());
+        return false;
+    }
+
+    auto worker = std::make_unique<Worker>();
+    worker->device = device.value();
+    worker->dispatch = worker->device.make_table();
+    worker->barriers = PipelineBarriers(worker->dispatch.fp_vkCmdPipelineBarrier);
+    worker->queue = queue.value();
+    auto vkDevice = worker->device.device;
+
+    VkCommandPoolCreateInfo poolInfo = {};
+    poolInfo.sType = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO;
+    poolInfo.flags = VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT;
+    poolInfo.queueFamilyIndex = worker->device.get_queue_index(vkb::QueueType::graphics).value();
+    if (vkCreateCommandPool(vkDevice, &poolInfo, options.allocationCallbacks, &worker->commandPool) != VK_SUCCESS) {
+        throw std::runtime_error("failed to create command pool for " + physicalDevice.name);
+    }
+
+    VkCommandBufferAllocateInfo allocInfo = {};
+    allocInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
+    allocInfo.commandPool = worker->commandPool;
+    allocInfo.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+    allocInfo.commandBufferCount = 1;
+    if (vkAllocateCommandBuffers(vkDevice, &allocInfo, &worker->commandBuffer) != VK_SUCCESS) {
+        throw std::runtime_error("failed to create command buffer for " + physicalDevice.name);
+    }
+
+    VkFenceCreateInfo fenceInfo = {};
+    fenceInfo.sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO;
+    if (vkCreateFence(vkDevice, &fenceInfo, options.allocationCallbacks, &worker->fence) != VK_SUCCESS) {
+        throw std::runtime_error("failed to create fence for " + physicalDevice.name);
+    }
+
+    const auto& target = options.sceneDesc.target;
+    bool multisampled = target.samples != VK_SAMPLE_COUNT_1_BIT;
+
+    // Same attachments as the primary's render pass, the color ends up in a transfer source
+    VkAttachmentDescription colorAttachment = {};
+    colorAttachment.format = target.colorFormat;
+    colorAttachment.samples = target.samples;
+    colorAttachment.loadOp = VK_ATTACHMENT_LOAD_OP_CLEAR;
+    colorAttachment.storeOp = multisampled ? VK_ATTACHMENT_STORE_OP_DONT_CARE : VK_ATTACHMENT_STORE_OP_STORE;
+    colorAttachment.stencilLoadOp = VK_ATTACHMENT_LOAD_OP_DONT_CARE;
+    colorAttachment.stencilStoreOp = VK_ATTACHMENT_STORE_OP_DONT_CARE;
+    colorAttachment.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+    colorAttachment.finalLayout = VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL;
+
+    VkAttachmentDescription depthAttachment = {};
+    depthAttachment.format = target.depthFormat;
+    depthAttachment.samples = target.samples;
+    depthAttachment.loadOp = VK_ATTACHMENT_LOAD_OP_CLEAR;
+    depthAttachment.storeOp = VK_ATTACHMENT_STORE_OP_DONT_CARE;
+    depthAttachment.stencilLoadOp = VK_ATTACHMENT_LOAD_OP_DONT_CARE;
+    depthAttachment.stencilStoreOp = VK_ATTACHMENT_STORE_OP_DONT_CARE;
+    depthAttachment.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+    depthAttachment.finalLayout = VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL;
+
+    VkAttachmentDescription resolveAttachment = colorAttachment;
+    resolveAttachment.samples = VK_SAMPLE_COUNT_1_BIT;
+    resolveAttachment.loadOp = VK_ATTACHMENT_LOAD_OP_DONT_CARE;
+    resolveAttachment.storeOp = VK_ATTACHMENT_STORE_OP_STORE;
+
+    VkAttachmentReference colorAttachmentRef = { 0, VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL };
+    VkAttachmentReference depthAttachmentRef = { 1, VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL };
+    VkAttachmentReference resolveAttachmentRef = { 2, VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL };
+
+    VkSubpassDescription subpass = {};
+    subpass.pipelineBindPoint = VK_PIPELINE_BIND_POINT_GRAPHICS;
+    subpass.colorAttachmentCount = 1;
+    subpass.pColorAttachments = &colorAttachmentRef;
+    subpass.pDepthStencilAttachment = &depthAttachmentRef;
+    subpass.pResolveAttachments = multisampled ? &resolveAttachmentRef : nullptr;
+
+    // The previous frame's depth writes and readback copy finish before this frame clears
+    VkSubpassDependency dependency = {};
+    dependency.srcSubpass = VK_SUBPASS_EXTERNAL;
+    dependency.dstSubpass = 0;
+    dependency.srcStageMask = VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT | VK_PIPELINE_STAGE_LATE_FRAGMENT_TESTS_BIT |
+                              VK_PIPELINE_STAGE_TRANSFER_BIT;
+    dependency.srcAccessMask = VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_WRITE_BIT;
+    dependency.dstStageMask = VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT | VK_PIPELINE_STAGE_EARLY_FRAGMENT_TESTS_BIT;
+    dependency.dstAccessMask = VK_ACCESS_COLOR_ATTACHMENT_READ_BIT | VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT |
+                               VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_READ_BIT | VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_WRITE_BIT;
+
+    VkAttachmentDescription attachments[] = { colorAttachment, depthAttachment, resolveAttachment };
+
+    VkRenderPassCreateInfo renderPassInfo = {};
+    renderPassInfo.sType = VK_STRUCTURE_TYPE_RENDER_PASS_CREATE_INFO;
+    renderPassInfo.attachmentCount = multisampled ? 3 : 2;
+    renderPassInfo.pAttachments = attachments;
+    renderPassInfo.subpassCount = 1;
+    renderPassInfo.pSubpasses = &subpass;
+    renderPassInfo.dependencyCount = 1;
+    renderPassInfo.pDependencies = &dependency;
+
+    if (vkCreateRenderPass(vkDevice, &renderPassInfo, options.allocationCallbacks, &worker->renderPass) != VK_SUCCESS) {
+        throw std::runtime_error("failed to create render pass for " + physicalDevice.name);
+    }
+
+    VkPipelineLayoutCreateInfo layoutInfo = {};
+    layoutInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO;
+    layoutInfo.pushConstantRangeCount = static_cast<uint32_t>(options.pushConstants.size());
+    layoutInfo.pPushConstantRanges = options.pushConstants.data();
+    if (vkCreatePipelineLayout(vkDevice, &layoutInfo, options.allocationCallbacks, &worker->layout) != VK_SUCCESS) {
+        throw std::runtime_error("failed to create pipeline layout for " + physicalDevice.name);
+    }
+
+    // One compile at startup, a single background worker is plenty
+    worker->shaderModules.init(vkDevice, worker->device.fp_vkGetDeviceProcAddr, false, options.allocationCallbacks);
+    GraphicsPipelineCache::Options pipelineOptions;
+    pipelineOptions.workerCount = 1;
+    pipelineOptions.allocationCallbacks = options.allocationCallbacks;
+    worker->pipelines.init(vkDevice, worker->device.fp_vkGetDeviceProcAddr, &worker->shaderModules, pipelineOptions);
+
+    worker->desc = options.sceneDesc;
+    worker->desc.layout = worker->layout;
+    worker->pipeline = worker->pipelines.get(worker->desc, worker->renderPass);
+
+    std::cout << "multi-GPU: rendering on " << physicalDevice.name << std::endl;
+    workers.push_back(std::move(worker));
+    return true;
+}
+
+void MultiDeviceRenderer::destroyWorker(Worker& worker) {
+    auto device = worker.device.device;
+    destroyTargets(worker);
+    worker.pipelines.destroy();
+    worker.shaderModules.destroy();
+    vkDestroyPipelineLayout(device, worker.layout, options.allocationCallbacks);
+    vkDestroyRenderPass(device, worker.renderPass, options.allocationCallbacks);
+    vkDestroyFence(device, worker.fence, options.allocationCallbacks);
+    vkDestroyCommandPool(device, worker.commandPool, options.allocationCallbacks);
+    vkb::destroy_device(worker.device);
+}
+
+void MultiDeviceRenderer::createTargets(Worker& worker) {
+    auto device = worker.device.device;
+    const auto& memoryProperties = worker.device.physical_device.memory_properties;
+    const auto& target = options.sceneDesc.target;
+
+    // Full size so the viewport matches the primary's, only the band is rendered and read back
+    auto createTarget = [&] (VkFormat format, VkSampleCountFlagBits samples, VkImageUsageFlags usage,
+                             VkImageAspectFlags aspect, Target& result) {
+        VkImageCreateInfo imageInfo = {};
+        imageInfo.sType = VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO;
+        imageInfo.imageType = VK_IMAGE_TYPE_2D;
+        imageInfo.format = format;
+        imageInfo.extent = { extent.width, extent.height, 1 };
+        imageInfo.mipLevels = 1;
+        imageInfo.arrayLayers = 1;
+        imageInfo.samples = samples;
+        imageInfo.tiling = VK_IMAGE_TILING_OPTIMAL;
+        imageInfo.usage = usage;
+        imageInfo.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+        imageInfo.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+        if (vkCreateImage(device, &imageInfo, options.allocationCallbacks, &result.image) != VK_SUCCESS) {
+            throw std::runtime_error("failed to create offscreen image for " + worker.device.physical_device.name);
+        }
+
+        VkMemoryRequirements requirements;
+        vkGetImageMemoryRequirements(device, result.image, &requirements);
+
+        VkMemoryAllocateInfo allocInfo = {};
+        allocInfo.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
+        allocInfo.allocationSize = requirements.size;
+        allocInfo.memoryTypeIndex = findMemoryType(memoryProperties, requirements.memoryTypeBits, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT);
+        if (allocInfo.memoryTypeIndex == UINT32_MAX) {
+            // Software devices have no device local memory
+            allocInfo.memoryTypeIndex = findMemoryType(memoryProperties, requirements.memoryTypeBits, 0);
+        }
+        if (vkAllocateMemory(device, &allocInfo, options.allocationCallbacks, &result.memory) != VK_SUCCESS) {
+            throw std::runtime_error("failed to allocate offscreen image for " + worker.device.physical_device.name);
+        }
+        vkBindImageMemory(device, result.image, result.memory, 0);
+
+        VkImageViewCreateInfo viewInfo = {};
+        viewInfo.sType = VK_STRUCTURE_TYPE_IMAGE_VIEW_CREATE_INFO;
+        viewInfo.image = result.image;
+        viewInfo.viewType = VK_IMAGE_VIEW_TYPE_2D;
+        viewInfo.format = format;
+        viewInfo.subresourceRange = { aspect, 0, 1, 0, 1 };
+        if (vkCreateImageView(device, &viewInfo, options.allocationCallbacks, &result.view) != VK_SUCCESS) {
+            throw std::runtime_error("failed to create offscreen image view for " + worker.device.physical_device.name);
+        }
+    };
+
+    bool multisampled = target.samples != VK_SAMPLE_COUNT_1_BIT;
+    createTarget(target.colorFormat, target.samples,
+                 VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT | (multisampled ? VK_IMAGE_USAGE_TRANSIENT_ATTACHMENT_BIT : VK_IMAGE_USAGE_TRANSFER_SRC_BIT),
+                 VK_IMAGE_ASPECT_COLOR_BIT, worker.color);
+    VkImageAspectFlags depthAspect = VK_IMAGE_ASPECT_DEPTH_BIT;
+    if (hasStencil(target.depthFormat)) {
+        depthAspect |= VK_IMAGE_ASPECT_STENCIL_BIT;
+    }
+    createTarget(target.depthFormat, target.samples,
+                 VK_IMAGE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT | VK_IMAGE_USAGE_TRANSIENT_ATTACHMENT_BIT,
+                 depthAspect, worker.depth);
+    if (multisampled) {
+        createTarget(target.colorFormat, VK_SAMPLE_COUNT_1_BIT, VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT | VK_IMAGE_USAGE_TRANSFER_SRC_BIT,
+                     VK_IMAGE_ASPECT_COLOR_BIT, worker.resolve);
+    }
+
+    VkImageView views[] = { worker.color.view, worker.depth.view, worker.resolve.view };
+
+    VkFramebufferCreateInfo framebufferInfo = {};
+    framebufferInfo.sType = VK_STRUCTURE_TYPE_FRAMEBUFFER_CREATE_INFO;
+    framebufferInfo.renderPass = worker.renderPass;
+    framebufferInfo.attachmentCount = multisampled ? 3 : 2;
+    framebufferInfo.pAttachments = views;
+    framebufferInfo.width = extent.width;
+    framebufferInfo.height = extent.height;
+    framebufferInfo.layers = 1;
+    if (vkCreateFramebuffer(device, &framebufferInfo, options.allocationCallbacks, &worker.framebuffer) != VK_SUCCESS) {
+        throw std::runtime_error("failed to create framebuffer for " + worker.device.physical_device.name);
+    }
+
+    // Cached memory keeps the host reads of the readback fast
+    VkDeviceSize size = static_cast<VkDeviceSize>(worker.region.extent.width) * worker.region.extent.height * bytesPerPixel;
+    worker.readback = createHostBuffer(device, memoryProperties, size, VK_BUFFER_USAGE_TRANSFER_DST_BIT,
+                                       VK_MEMORY_PROPERTY_HOST_CACHED_BIT);
+}
+
+void MultiDeviceRenderer::destroyTargets(Worker& worker) {
+    auto device = worker.device.device;
+    destroyHostBuffer(device, worker.readback);
+    vkDestroyFramebuffer(device, worker.framebuffer, options.allocationCallbacks);
+    worker.framebuffer = VK_NULL_HANDLE;
+    for (auto* target: { &worker.color, &worker.depth, &worker.resolve }) {
+        vkDestroyImageView(device, target->view, options.allocationCallbacks);
+        vkDestroyImage(device, target->image, options.allocationCallbacks);
+        vkFreeMemory(device, target->memory, options.allocationCallbacks);
+        *target = {};
+    }
+}
+
+void MultiDeviceRenderer::createStaging() {
+    VkDeviceSize size = static_cast<VkDeviceSize>(extent.width) * extent.height * bytesPerPixel;
+    staging.resize(options.framesInFlight);
+    for (auto& buffer: staging) {
+        buffer = createHostBuffer(primaryDevice, primaryMemory, size, VK_BUFFER_USAGE_TRANSFER_SRC_BIT, 0);
+    }
+}
+
+void MultiDeviceRenderer::destroyStaging() {
+    for (auto& buffer: staging) {
+        destroyHostBuffer(primaryDevice, buffer);
+    }
+    staging.clear();
+}
+
+void MultiDeviceRenderer::assignRegions() {
+    // Horizontal bands, whole rows keep each band contiguous in the staging buffer
+    auto band = [this] (uint32_t device) -> VkRect2D {
+        if (options.mode == Mode::AlternateFrame) {
+            return { { 0, 0 }, extent };
+        }
+        uint32_t top = extent.height * device / deviceCount();
+        uint32_t bottom = extent.height * (device + 1) / deviceCount();
+        return { { 0, static_cast<int32_t>(top) }, { extent.width, bottom - top } };
+    };
+
+    primaryBand = band(0);
+    for (uint32_t i = 0; i < workers.size(); i++) {
+        workers[i]->region = band(i + 1);
+    }
+}
+
+void MultiDeviceRenderer::submit(Worker& worker, uint64_t frame) {
+    const auto& dispatch = worker.dispatch;
+    auto commandBuffer = worker.commandBuffer;
+    dispatch.resetCommandBuffer(commandBuffer, 0);
+
+    VkCommandBufferBeginInfo beginInfo = {};
+    beginInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+    beginInfo.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+    if (dispatch.beginCommandBuffer(commandBuffer, &beginInfo) != VK_SUCCESS) {
+        throw std::runtime_error("failed to begin command buffer for " + worker.device.physical_device.name);
+    }
+
+    VkClearValue clearValues[] = { options.clearColor, options.clearDepth };
+
+    VkRenderPassBeginInfo renderPassInfo = {};
+    renderPassInfo.sType = VK_STRUCTURE_TYPE_RENDER_PASS_BEGIN_INFO;
+    renderPassInfo.renderPass = worker.renderPass;
+    renderPassInfo.framebuffer = worker.framebuffer;
+    renderPassInfo.renderArea = worker.region;
+    renderPassInfo.clearValueCount = 2;
+    renderPassInfo.pClearValues = clearValues;
+    dispatch.cmdBeginRenderPass(commandBuffer, &renderPassInfo, VK_SUBPASS_CONTENTS_INLINE);
+
+    VkViewport viewport = {};
+    viewport.width = (float)extent.width;
+    viewport.height = (float)extent.height;
+    viewport.minDepth = 0.0f;
+    viewport.maxDepth = 1.0f;
+    dispatch.cmdSetViewport(commandBuffer, 0, 1, &viewport);
+    dispatch.cmdSetScissor(commandBuffer, 0, 1, &worker.region);
+
+    dispatch.cmdBindPipeline(commandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, worker.pipeline);
+    worker.pipelines.setDynamicState(commandBuffer, worker.desc);
+    draw(dispatch, commandBuffer);
+
+    dispatch.cmdEndRenderPass(commandBuffer);
+
+    // Read the band back into host memory
+    VkImage source = worker.resolve.image != VK_NULL_HANDLE ? worker.resolve.image : worker.color.image;
+    auto& barriers = worker.barriers;
+    barriers.image(source, kColorRange,
+                   VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT, VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT,
+                   VK_PIPELINE_STAGE_TRANSFER_BIT, VK_ACCESS_TRANSFER_READ_BIT,
+                   VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL);
+    barriers.flush(commandBuffer);
+
+    VkBufferImageCopy copy = {};
+    copy.imageSubresource = { VK_IMAGE_ASPECT_COLOR_BIT, 0, 0, 1 };
+    copy.imageOffset = { worker.region.offset.x, worker.region.offset.y, 0 };
+    copy.imageExtent = { worker.region.extent.width, worker.region.extent.height, 1 };
+    dispatch.cmdCopyImageToBuffer(commandBuffer, source, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL, worker.readback.buffer, 1, &copy);
+
+    barriers.buffer(worker.readback.buffer, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_ACCESS_TRANSFER_WRITE_BIT,
+                    VK_PIPELINE_STAGE_HOST_BIT, VK_ACCESS_HOST_READ_BIT);
+    barriers.flush(commandBuffer);
+
+    if (dispatch.endCommandBuffer(commandBuffer) != VK_SUCCESS) {
+        throw std::runtime_error("failed to end command buffer for " + worker.device.physical_device.name);
+    }
+
+    VkSubmitInfo submitInfo = {};
+    submitInfo.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+    submitInfo.commandBufferCount = 1;
+    submitInfo.pCommandBuffers = &commandBuffer;
+
+    dispatch.resetFences(1, &worker.fence);
+    if (dispatch.queueSubmit(worker.queue, 1, &submitInfo, worker.fence) != VK_SUCCESS) {
+        throw std::runtime_error("failed to submit to " + worker.device.physical_device.name);
+    }
+
+    worker.frame = frame;
+    worker.busy = true;
+}
+
+void MultiDeviceRenderer::finish(Worker& worker, uint64_t frame) {
+    // A frame the primary never presented (its image wasn't acquired) is dropped
+    if (worker.busy && worker.frame != frame) {
+        worker.dispatch.waitForFences(1, &worker.fence, VK_TRUE, UINT64_MAX);
+        worker.busy = false;
+    }
+    if (!worker.busy) {
+        submit(worker, frame);
+    }
+    worker.dispatch.waitForFences(1, &worker.fence, VK_TRUE, UINT64_MAX);
+}
+
+MultiDeviceRenderer::HostBuffer MultiDeviceRenderer::createHostBuffer(VkDevice device, const VkPhysicalDeviceMemoryProperties& memoryProperties,
+                                                                      VkDeviceSize size, VkBufferUsageFlags usage, VkMemoryPropertyFlags preferred) {
+    HostBuffer result;
+
+    VkBufferCreateInfo bufferInfo = {};
+    bufferInfo.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
+    bufferInfo.size = size;
+    bufferInfo.usage = usage;
+    bufferInfo.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+    if (vkCreateBuffer(device, &bufferInfo, options.allocationCallbacks, &result.buffer) != VK_SUCCESS) {
+        throw std::runtime_error("failed to create host buffer");
+    }
+
+    VkMemoryRequirements requirements;
+    vkGetBufferMemoryRequirements(device, result.buffer, &requirements);
+
+    // Coherent, so neither side has to flush or invalidate
+    VkMemoryPropertyFlags required = VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT;
+    VkMemoryAllocateInfo allocInfo = {};
+    allocInfo.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
+    allocInfo.allocationSize = requirements.size;
+    allocInfo.memoryTypeIndex = findMemoryType(memoryProperties, requirements.memoryTypeBits, required | preferred);
+    if (allocInfo.memoryTypeIndex == UINT32_MAX) {
+        allocInfo.memoryTypeIndex = findMemoryType(memoryProperties, requirements.memoryTypeBits, required);
+    }
+    if (allocInfo.memoryTypeIndex == UINT32_MAX) {
+        throw std::runtime_error("failed to find host visible memory");
+    }
+    if (vkAllocateMemory(device, &allocInfo, options.allocationCallbacks, &result.memory) != VK_SUCCESS) {
+        throw std::runtime_error("failed to allocate host buffer");
+    }
+    vkBindBufferMemory(device, result.buffer, result.memory, 0);
+
+    if (vkMapMemory(device, result.memory, 0, VK_WHOLE_SIZE, 0, &result.mapped) != VK_SUCCESS) {
+        throw std::runtime_error("failed to map host buffer");
+    }
+    return result;
+}
+
+void MultiDeviceRenderer::destroyHostBuffer(VkDevice device, HostBuffer& buffer) {
+    if (buffer.memory != VK_NULL_HANDLE) {
+        vkUnmapMemory(device, buffer.memory);
+    }
+    vkDestroyBuffer(device, buffer.buffer, options.allocationCallbacks);
+    vkFreeMemory(device, buffer.memory, options.allocationCallbacks);
+    buffer = {};
+}
@@ -0,0 +1,175 @@
+//
+//  MultiDeviceRenderer.hpp
+//  vk-triangle
+//
+//  Created by Kai Chen on 10/18/26.
+//
+
+#ifndef MultiDeviceRenderer_hpp
+#define MultiDeviceRenderer_hpp
+
+#include <vulkan/vulkan.h>
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <vector>
+
+#include "VkBootstrap.h"
+#include "GraphicsPipelineCache.hpp"
+#include "PipelineBarriers.hpp"
+#include "ShaderModuleCache.hpp"
+
+// Spreads the frames of one swapchain over every other suitable GPU and composites them into
+// the swapchain image of the presenting (primary) device.
+//
+// Alternate-frame: frames are dealt round-robin to the primary and the secondaries. A secondary
+// starts its next frame as soon as the previous one has been composited, so it renders while
+// the primary presents the frames in between.
+// Split-frame: every frame is cut into horizontal bands, one per device, rendered in parallel.
+//
+// Secondaries render offscreen with their own device, pipelines and attachments, and copy the
+// result into host memory. The primary copies it into a staging buffer of its own and uploads it
+// into the swapchain image. That needs no device groups or external memory, so any mix of
+// devices works (several lavapipe instances included), at the cost of a trip through the host.
+class MultiDeviceRenderer {
+public:
+    enum class Mode {
+        AlternateFrame,
+        SplitFrame,
+    };
+
+    // Records the draws of the scene with the secondary's dispatch table. The pipeline, viewport
+    // and scissor are already set.
+    using DrawFn = std::function<void(const vkb::DispatchTable& dispatch, VkCommandBuffer commandBuffer)>;
+
+    struct Options {
+        Mode mode = Mode::AlternateFrame;
+        // Compiled on every secondary against its offscreen target, with a layout of its own
+        // created from `pushConstants`.
+        GraphicsPipelineDesc sceneDesc;
+        std::vector<VkPushConstantRange> pushConstants;
+        VkClearValue clearColor = {};
+        VkClearValue clearDepth = {};
+        // Staging buffers on the primary, one per frame that can be in flight
+        uint32_t framesInFlight = 2;
+        // Host memory for the secondaries and everything created on them, has to outlive the renderer
+        VkAllocationCallbacks* allocationCallbacks = nullptr;
+        // The primary's entry points composite() records with, from the frame loop's dispatch table.
+        // Null goes through the loader.
+        PFN_vkCmdPipelineBarrier cmdPipelineBarrier = nullptr;
+        PFN_vkCmdCopyBufferToImage cmdCopyBufferToImage = nullptr;
+    };
+
+    // Creates a device on every suitable physical device other than the primary's. Devices that
+    // can't render the scene's formats are skipped; without any secondary the renderer stays
+    // inactive and the primary renders everything. The swapchain images need
+    // VK_IMAGE_USAGE_TRANSFER_DST_BIT.
+    void init(const vkb::Instance& instance, const vkb::Device& primary, VkExtent2D extent,
+              const Options& options, DrawFn draw);
+    // Waits for the secondaries and destroys their devices.
+    void destroy();
+    // Recreates the offscreen targets and staging buffers for a new swapchain extent.
+    void resize(VkExtent2D extent);
+
+    bool active() const { return !workers.empty(); }
+    // The primary included
+    uint32_t deviceCount() const { return static_cast<uint32_t>(workers.size()) + 1; }
+
+    // Whether the primary renders (its band of) `frame`.
+    bool primaryRenders(uint64_t frame) const;
+    // The part of the swapchain image the primary renders.
+    VkRect2D primaryRegion() const;
+
+    // Starts the secondaries on their share of `frame`, or for alternate-frame on the next frame
+    // each of them owns. Call once per frame, before the primary records.
+    void beginFrame(uint64_t frame);
+    // Whether any of `frame` is rendered by a secondary and has to be composited.
+    bool composites(uint64_t frame) const;
+    // Waits for the secondaries' share of `frame` and records its upload into `image`, which is
+    // left in VK_IMAGE_LAYOUT_PRESENT_SRC_KHR. `image` is in PRESENT_SRC if the primary rendered
+    // into it and undefined otherwise. `frameSlot` picks the staging buffer.
+    //
+    // Call after the primary's scene work for `frame` is submitted, so the primary renders while
+    // this waits. `commandBuffer` is submitted on its own, waiting at the transfer stage on a
+    // semaphore signaled by the scene submission.
+    void composite(uint64_t frame, uint32_t frameSlot, VkCommandBuffer commandBuffer, VkImage image);
+
+private:
+    struct Target {
+        VkImage image = VK_NULL_HANDLE;
+        VkDeviceMemory memory = VK_NULL_HANDLE;
+        VkImageView view = VK_NULL_HANDLE;
+    };
+
+    struct HostBuffer {
+        VkBuffer buffer = VK_NULL_HANDLE;
+        VkDeviceMemory memory = VK_NULL_HANDLE;
+        void* mapped = nullptr;
+    };
+
+    struct Worker {
+        vkb::Device device;
+        vkb::DispatchTable dispatch;
+        VkQueue queue = VK_NULL_HANDLE;
+        VkCommandPool commandPool = VK_NULL_HANDLE;
+        VkCommandBuffer commandBuffer = VK_NULL_HANDLE;
+        VkFence fence = VK_NULL_HANDLE;
+
+        ShaderModuleCache shaderModules;
+        GraphicsPipelineCache pipelines;
+        VkPipelineLayout layout = VK_NULL_HANDLE;
+        GraphicsPipelineDesc desc;
+        VkPipeline pipeline = VK_NULL_HANDLE;
+
+        VkRenderPass renderPass = VK_NULL_HANDLE;
+        // `color` is multisampled and resolved into `resolve` with samples > 1
+        Target color;
+        Target depth;
+        Target resolve;
+        VkFramebuffer framebuffer = VK_NULL_HANDLE;
+        HostBuffer readback;
+        // Reused by every submit()
+        PipelineBarriers barriers;
+
+        // Band of the frame this device renders
+        VkRect2D region = {};
+        // The frame being rendered, its result stays in `readback` until it's composited
+        uint64_t frame = 0;
+        bool busy = false;
+    };
+
+    bool createWorker(const vkb::PhysicalDevice& physicalDevice);
+    void destroyWorker(Worker& worker);
+    void createTargets(Worker& worker);
+    void destroyTargets(Worker& worker);
+    void createStaging();
+    void destroyStaging();
+    void assignRegions();
+
+    // The device that renders `frame` in alternate-frame mode, 0 being the primary.
+    uint32_t owner(uint64_t frame) const { return static_cast<uint32_t>(frame % deviceCount()); }
+    void submit(Worker& worker, uint64_t frame);
+    // Waits until `worker` holds `frame` in its readback buffer.
+    void finish(Worker& worker, uint64_t frame);
+
+    HostBuffer createHostBuffer(VkDevice device, const VkPhysicalDeviceMemoryProperties& memoryProperties,
+                                VkDeviceSize size, VkBufferUsageFlags usage, VkMemoryPropertyFlags preferred);
+    void destroyHostBuffer(VkDevice device, HostBuffer& buffer);
+
+    Options options;
+    DrawFn draw;
+    VkExtent2D extent = {};
+    uint32_t bytesPerPixel = 4;
+
+    VkDevice primaryDevice = VK_NULL_HANDLE;
+    VkPhysicalDeviceMemoryProperties primaryMemory = {};
+    VkRect2D primaryBand = {};
+    std::vector<HostBuffer> staging;
+    // Reused by every composite()
+    PipelineBarriers compositeBarriers;
+
+    std::vector<std::unique_ptr<Worker>> workers;
+};
+
+#endif /* MultiDeviceRenderer_hpp */
@@ -0,0 +1,230 @@
+//
+//  PipelineBarriers.cpp
+//  vk-triangle
+//
+//  Created by Kai Chen on 10/18/26.
+//
+
+#include "PipelineBarriers.hpp"
+
+#include <algorithm>
+
+namespace {
+
+bool sameRange(const VkImageSubresourceRange& a, const VkImageSubresourceRange& b) {
+    return a.aspectMask == b.aspectMask && a.baseMipLevel == b.baseMipLevel && a.levelCount == b.levelCount &&
+           a.baseArrayLayer == b.baseArrayLayer && a.layerCount == b.layerCount;
+}
+
+#if defined(VK_KHR_synchronization2)
+struct LegacyBits {
+    VkFlags64 bits;
+    VkFlags legacy;
+};
+
+// Synchronization2 bits past the lower 32, and the legacy bits that cover them
+const LegacyBits kLegacyStages[] = {
+    { VK_PIPELINE_STAGE_2_COPY_BIT_KHR, VK_PIPELINE_STAGE_TRANSFER_BIT },
+    { VK_PIPELINE_STAGE_2_RESOLVE_BIT_KHR, VK_PIPELINE_STAGE_TRANSFER_BIT },
+    { VK_PIPELINE_STAGE_2_BLIT_BIT_KHR, VK_PIPELINE_STAGE_TRANSFER_BIT },
+    { VK_PIPELINE_STAGE_2_CLEAR_BIT_KHR, VK_PIPELINE_STAGE_TRANSFER_BIT },
+    { VK_PIPELINE_STAGE_2_INDEX_INPUT_BIT_KHR, VK_PIPELINE_STAGE_VERTEX_INPUT_BIT },
+    { VK_PIPELINE_STAGE_2_VERTEX_ATTRIBUTE_INPUT_BIT_KHR, VK_PIPELINE_STAGE_VERTEX_INPUT_BIT },
+    { VK_PIPELINE_STAGE_2_PRE_RASTERIZATION_SHADERS_BIT_KHR,
+      VK_PIPELINE_STAGE_VERTEX_SHADER_BIT | VK_PIPELINE_STAGE_TESSELLATION_CONTROL_SHADER_BIT |
+      VK_PIPELINE_STAGE_TESSELLATION_EVALUATION_SHADER_BIT | VK_PIPELINE_STAGE_GEOMETRY_SHADER_BIT },
+};
+
+const LegacyBits kLegacyAccess[] = {
+    { VK_ACCESS_2_SHADER_SAMPLED_READ_BIT_KHR, VK_ACCESS_SHADER_READ_BIT },
+    { VK_ACCESS_2_SHADER_STORAGE_READ_BIT_KHR, VK_ACCESS_SHADER_READ_BIT },
+    { VK_ACCESS_2_SHADER_STORAGE_WRITE_BIT_KHR, VK_ACCESS_SHADER_WRITE_BIT },
+};
+#endif
+
+// The lower 32 bits are the same in both APIs. The bits above them only synchronization2 has are
+// replaced by the broader legacy bits, dropping them would leave the barrier without them.
+VkPipelineStageFlags legacyStages(VkFlags64 stages) {
+    auto legacy = static_cast<VkPipelineStageFlags>(stages & 0xffffffffull);
+#if defined(VK_KHR_synchronization2)
+    for (const auto& entry: kLegacyStages) {
+        legacy |= (stages & entry.bits) != 0 ? entry.legacy : 0;
+    }
+#endif
+    return legacy;
+}
+
+VkAccessFlags legacyAccess(VkFlags64 access) {
+    auto legacy = static_cast<VkAccessFlags>(access & 0xffffffffull);
+#if defined(VK_KHR_synchronization2)
+    for (const auto& entry: kLegacyAccess) {
+        legacy |= (access & entry.bits) != 0 ? entry.legacy : 0;
+    }
+#endif
+    return legacy;
+}
+
+} // namespace
+
+void PipelineBarriers::Masks::merge(const Masks& other) {
+    srcStages |= other.srcStages;
+    srcAccess |= other.srcAccess;
+    dstStages |= other.dstStages;
+    dstAccess |= other.dstAccess;
+}
+
+void PipelineBarriers::image(VkImage image, const VkImageSubresourceRange& range,
+                             StageFlags srcStages, AccessFlags srcAccess, StageFlags dstStages, AccessFlags dstAccess,
+                             VkImageLayout oldLayout, VkImageLayout newLayout) {
+    Masks masks { srcStages, srcAccess, dstStages, dstAccess };
+    auto it = std::find_if(images.begin(), images.end(), [&] (const ImageBarrier& barrier) {
+        return barrier.image == image && sameRange(barrier.range, range) &&
+               barrier.oldLayout == oldLayout && barrier.newLayout == newLayout;
+    });
+    if (it != images.end()) {
+        it->masks.merge(masks);
+        return;
+    }
+    images.push_back({ masks, image, range, oldLayout, newLayout });
+}
+
+void PipelineBarriers::buffer(VkBuffer buffer, StageFlags srcStages, AccessFlags srcAccess, StageFlags dstStages,
+                              AccessFlags dstAccess, VkDeviceSize offset, VkDeviceSize size) {
+    Masks masks { srcStages, srcAccess, dstStages, dstAccess };
+    auto it = std::find_if(buffers.begin(), buffers.end(), [&] (const BufferBarrier& barrier) {
+        return barrier.buffer == buffer && barrier.offset == offset && barrier.size == size;
+    });
+    if (it != buffers.end()) {
+        it->masks.merge(masks);
+        return;
+    }
+    buffers.push_back({ masks, buffer, offset, size });
+}
+
+void PipelineBarriers::memory(StageFlags srcStages, AccessFlags srcAccess, StageFlags dstStages, AccessFlags dstAccess) {
+    memoryMasks.merge({ srcStages, srcAccess, dstStages, dstAccess });
+    hasMemory = true;
+}
+
+void PipelineBarriers::flush(VkCommandBuffer commandBuffer) {
+    if (empty()) {
+        return;
+    }
+
+#if defined(VK_KHR_synchronization2)
+    if (fp_vkCmdPipelineBarrier2 != nullptr) {
+        imageBarriers2.clear();
+        for (const auto& barrier: images) {
+            VkImageMemoryBarrier2KHR imageBarrier = {};
+            imageBarrier.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER_2_KHR;
+            imageBarrier.srcStageMask = barrier.masks.srcStages;
+            imageBarrier.srcAccessMask = barrier.masks.srcAccess;
+            imageBarrier.dstStageMask = barrier.masks.dstStages;
+            imageBarrier.dstAccessMask = barrier.masks.dstAccess;
+            imageBarrier.oldLayout = barrier.oldLayout;
+            imageBarrier.newLayout = barrier.newLayout;
+            imageBarrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+            imageBarrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+            imageBarrier.image = barrier.image;
+            imageBarrier.subresourceRange = barrier.range;
+            imageBarriers2.push_back(imageBarrier);
+        }
+
+        bufferBarriers2.clear();
+        for (const auto& barrier: buffers) {
+            VkBufferMemoryBarrier2KHR bufferBarrier = {};
+            bufferBarrier.sType = VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER_2_KHR;
+            bufferBarrier.srcStageMask = barrier.masks.srcStages;
+            bufferBarrier.srcAccessMask = barrier.masks.srcAccess;
+            bufferBarrier.dstStageMask = barrier.masks.dstStages;
+            bufferBarrier.dstAccessMask = barrier.masks.dstAccess;
+            bufferBarrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+            bufferBarrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+            bufferBarrier.buffer = barrier.buffer;
+            bufferBarrier.offset = barrier.offset;
+            bufferBarrier.size = barrier.size;
+            bufferBarriers2.push_back(bufferBarrier);
+        }
+
+        VkMemoryBarrier2KHR memoryBarrier = {};
+        memoryBarrier.sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER_2_KHR;
+        memoryBarrier.srcStageMask = memoryMasks.srcStages;
+        memoryBarrier.srcAccessMask = memoryMasks.srcAccess;
+        memoryBarrier.dstStageMask = memoryMasks.dstStages;
+        memoryBarrier.dstAccessMask = memoryMasks.dstAccess;
+
+        VkDependencyInfoKHR dependency = {};
+        dependency.sType = VK_STRUCTURE_TYPE_DEPENDENCY_INFO_KHR;
+        dependency.memoryBarrierCount = hasMemory ? 1 : 0;
+        dependency.pMemoryBarriers = &memoryBarrier;
+        dependency.bufferMemoryBarrierCount = static_cast<uint32_t>(bufferBarriers2.size());
+        dependency.pBufferMemoryBarriers = bufferBarriers2.data();
+        dependency.imageMemoryBarrierCount = static_cast<uint32_t>(imageBarriers2.size());
+        dependency.pImageMemoryBarriers = imageBarriers2.data();
+
+        fp_vkCmdPipelineBarrier2(commandBuffer, &dependency);
+    } else {
+        flushLegacy(commandBuffer);
+    }
+#else
+    flushLegacy(commandBuffer);
+#endif
+
+    images.clear();
+    buffers.clear();
+    memoryMasks = {};
+    hasMemory = false;
+}
+
+void PipelineBarriers::flushLegacy(VkCommandBuffer commandBuffer) {
+    // One set of stages for the whole call
+    Masks all = memoryMasks;
+
+    imageBarriers.clear();
+    for (const auto& barrier: images) {
+        all.merge(barrier.masks);
+
+        VkImageMemoryBarrier imageBarrier = {};
+        imageBarrier.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
+        imageBarrier.srcAccessMask = legacyAccess(barrier.masks.srcAccess);
+        imageBarrier.dstAccessMask = legacyAccess(barrier.masks.dstAccess);
+        imageBarrier.oldLayout = barrier.oldLayout;
+        imageBarrier.newLayout = barrier.newLayout;
+        imageBarrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+        imageBarrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+        imageBarrier.image = barrier.image;
+        imageBarrier.subresourceRange = barrier.range;
+        imageBarriers.push_back(imageBarrier);
+    }
+
+    bufferBarriers.clear();
+    for (const auto& barrier: buffers) {
+        all.merge(barrier.masks);
+
+        VkBufferMemoryBarrier bufferBarrier = {};
+        bufferBarrier.sType = VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER;
+        bufferBarrier.srcAccessMask = legacyAccess(barrier.masks.srcAccess);
+        bufferBarrier.dstAccessMask = legacyAccess(barrier.masks.dstAccess);
+        bufferBarrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+        bufferBarrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+        bufferBarrier.buffer = barrier.buffer;
+        bufferBarrier.offset = barrier.offset;
+        bufferBarrier.size = barrier.size;
+        bufferBarriers.push_back(bufferBarrier);
+    }
+
+    VkMemoryBarrier memoryBarrier = {};
+    memoryBarrier.sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
+    memoryBarrier.srcAccessMask = legacyAccess(memoryMasks.srcAccess);
+    memoryBarrier.dstAccessMask = legacyAccess(memoryMasks.dstAccess);
+
+    // No stages is spelled top (source) and bottom (destination) of pipe without synchronization2
+    VkPipelineStageFlags srcStages = legacyStages(all.srcStages);
+    VkPipelineStageFlags dstStages = legacyStages(all.dstStages);
+    fp_vkCmdPipelineBarrier(commandBuffer,
+                            srcStages != 0 ? srcStages : VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT,
+                            dstStages != 0 ? dstStages : VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT,
+                            0, hasMemory ? 1 : 0, &memoryBarrier,
+                            static_cast<uint32_t>(bufferBarriers.size()), bufferBarriers.data(),
+                            static_cast<uint32_t>(imageBarriers.size()), imageBarriers.data());
+}
@@ -0,0 +1,98 @@
+//
+//  PipelineBarriers.hpp
+//  vk-triangle
+//
+//  Created by Kai Chen on 10/18/26.
+//
+
+#ifndef PipelineBarriers_hpp
+#define PipelineBarriers_hpp
+
+#include <vulkan/vulkan.h>
+
+#include <cstdint>
+#include <vector>
+
+// Barriers collected for one point in a command buffer and recorded with a single call.
+//
+// With VK_KHR_synchronization2 every barrier keeps its own stage masks and the batch is recorded
+// with vkCmdPipelineBarrier2, so one barrier doesn't make the others wait for its stages. Without
+// it the batch falls back to vkCmdPipelineBarrier with the union of the stages. Masks use the
+// synchronization2 bits; the ones that exist in both APIs have the same values.
+//
+// Barriers for the same image subresource range and layouts, or the same buffer range, are
+// merged into one.
+class PipelineBarriers {
+public:
+    using StageFlags = VkFlags64;
+    using AccessFlags = VkFlags64;
+
+    // Records with the loader's vkCmdPipelineBarrier.
+    PipelineBarriers() = default;
+    // Records with the device's own entry point, skipping the loader's trampoline.
+    explicit PipelineBarriers(PFN_vkCmdPipelineBarrier cmdPipelineBarrier)
+        : fp_vkCmdPipelineBarrier(cmdPipelineBarrier) {}
+#if defined(VK_KHR_synchronization2)
+    // `cmdPipelineBarrier2` may be null, which records with `cmdPipelineBarrier`.
+    PipelineBarriers(PFN_vkCmdPipelineBarrier cmdPipelineBarrier, PFN_vkCmdPipelineBarrier2KHR cmdPipelineBarrier2)
+        : fp_vkCmdPipelineBarrier(cmdPipelineBarrier), fp_vkCmdPipelineBarrier2(cmdPipelineBarrier2) {}
+#endif
+
+    void image(VkImage image, const VkImageSubresourceRange& range,
+               StageFlags srcStages, AccessFlags srcAccess, StageFlags dstStages, AccessFlags dstAccess,
+               VkImageLayout oldLayout, VkImageLayout newLayout);
+    void buffer(VkBuffer buffer, StageFlags srcStages, AccessFlags srcAccess, StageFlags dstStages, AccessFlags dstAccess,
+                VkDeviceSize offset = 0, VkDeviceSize size = VK_WHOLE_SIZE);
+    // Global memory dependency, all memory barriers of a batch are merged into one.
+    void memory(StageFlags srcStages, AccessFlags srcAccess, StageFlags dstStages, AccessFlags dstAccess);
+
+    // Records the batch, if there's anything in it, and clears it.
+    void flush(VkCommandBuffer commandBuffer);
+
+    bool empty() const { return images.empty() && buffers.empty() && !hasMemory; }
+
+private:
+    struct Masks {
+        StageFlags srcStages = 0;
+        AccessFlags srcAccess = 0;
+        StageFlags dstStages = 0;
+        AccessFlags dstAccess = 0;
+
+        void merge(const Masks& other);
+    };
+
+    struct ImageBarrier {
+        Masks masks;
+        VkImage image;
+        VkImageSubresourceRange range;
+        VkImageLayout oldLayout;
+        VkImageLayout newLayout;
+    };
+
+    struct BufferBarrier {
+        Masks masks;
+        VkBuffer buffer;
+        VkDeviceSize offset;
+        VkDeviceSize size;
+    };
+
+    void flushLegacy(VkCommandBuffer commandBuffer);
+
+    PFN_vkCmdPipelineBarrier fp_vkCmdPipelineBarrier = vkCmdPipelineBarrier;
+#if defined(VK_KHR_synchronization2)
+    PFN_vkCmdPipelineBarrier2KHR fp_vkCmdPipelineBarrier2 = nullptr;
+#endif
+    std::vector<ImageBarrier> images;
+    std::vector<BufferBarrier> buffers;
+    Masks memoryMasks;
+    bool hasMemory = false;
+    // What flush() records, kept so their capacity is reused by every flush instead of allocated each time
+#if defined(VK_KHR_synchronization2)
+    std::vector<VkImageMemoryBarrier2KHR> imageBarriers2;
+    std::vector<VkBufferMemoryBarrier2KHR> bufferBarriers2;
+#endif
+    std::vector<VkImageMemoryBarrier> imageBarriers;
+    std::vector<VkBufferMemoryBarrier> bufferBarriers;
+};
+
+#endif /* PipelineBarriers_hpp */
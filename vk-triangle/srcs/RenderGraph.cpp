@@ -0,0 +1,556 @@
+//
+//  RenderGraph.cpp
+//  vk-triangle
+//
+//  Created by Kai Chen on 10/18/26.
+//
+
+#include "RenderGraph.hpp"
+
+#include <algorithm>
+#include <stdexcept>
+
+namespace {
+
+struct AccessInfo {
+    VkImageLayout layout;
+    VkPipelineStageFlags stages;
+    VkAccessFlags access;
+    VkImageUsageFlags usage;
+    VkBufferUsageFlags bufferUsage;
+};
+
+AccessInfo accessInfo(RenderGraph::Access access) {
+    using Access = RenderGraph::Access;
+    switch (access) {
+        case Access::ColorAttachment:
+            return { VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL, VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT,
+                     VK_ACCESS_COLOR_ATTACHMENT_READ_BIT | VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT,
+                     VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT, 0 };
+        case Access::DepthAttachment:
+            return { VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL,
+                     VK_PIPELINE_STAGE_EARLY_FRAGMENT_TESTS_BIT | VK_PIPELINE_STAGE_LATE_FRAGMENT_TESTS_BIT,
+                     VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_READ_BIT | VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_WRITE_BIT,
+                     VK_IMAGE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT, 0 };
+        case Access::DepthRead:
+            return { VK_IMAGE_LAYOUT_DEPTH_STENCIL_READ_ONLY_OPTIMAL,
+                     VK_PIPELINE_STAGE_EARLY_FRAGMENT_TESTS_BIT | VK_PIPELINE_STAGE_LATE_FRAGMENT_TESTS_BIT,
+                     VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_READ_BIT, VK_IMAGE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT, 0 };
+        case Access::FragmentSampled:
+            return { VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL, VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT,
+                     VK_ACCESS_SHADER_READ_BIT, VK_IMAGE_USAGE_SAMPLED_BIT, VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT };
+        case Access::ComputeSampled:
+            return { VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT,
+                     VK_ACCESS_SHADER_READ_BIT, VK_IMAGE_USAGE_SAMPLED_BIT, VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT };
+        case Access::ComputeStorageRead:
+            return { VK_IMAGE_LAYOUT_GENERAL, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT,
+                     VK_ACCESS_SHADER_READ_BIT, VK_IMAGE_USAGE_STORAGE_BIT, VK_BUFFER_USAGE_STORAGE_BUFFER_BIT };
+        case Access::ComputeStorageWrite:
+            return { VK_IMAGE_LAYOUT_GENERAL, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT,
+                     VK_ACCESS_SHADER_READ_BIT | VK_ACCESS_SHADER_WRITE_BIT, VK_IMAGE_USAGE_STORAGE_BIT,
+                     VK_BUFFER_USAGE_STORAGE_BUFFER_BIT };
+        case Access::IndirectRead:
+            return { VK_IMAGE_LAYOUT_UNDEFINED, VK_PIPELINE_STAGE_DRAW_INDIRECT_BIT,
+                     VK_ACCESS_INDIRECT_COMMAND_READ_BIT, 0, VK_BUFFER_USAGE_INDIRECT_BUFFER_BIT };
+        case Access::VertexRead:
+            return { VK_IMAGE_LAYOUT_UNDEFINED, VK_PIPELINE_STAGE_VERTEX_INPUT_BIT,
+                     VK_ACCESS_VERTEX_ATTRIBUTE_READ_BIT, 0, VK_BUFFER_USAGE_VERTEX_BUFFER_BIT };
+        case Access::TransferRead:
+            return { VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL, VK_PIPELINE_STAGE_TRANSFER_BIT,
+                     VK_ACCESS_TRANSFER_READ_BIT, VK_IMAGE_USAGE_TRANSFER_SRC_BIT, VK_BUFFER_USAGE_TRANSFER_SRC_BIT };
+        case Access::TransferWrite:
+            return { VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, VK_PIPELINE_STAGE_TRANSFER_BIT,
+                     VK_ACCESS_TRANSFER_WRITE_BIT, VK_IMAGE_USAGE_TRANSFER_DST_BIT, VK_BUFFER_USAGE_TRANSFER_DST_BIT };
+    }
+    throw std::runtime_error("unknown render graph access");
+}
+
+// Only writes have to be made available, reads just have to finish before the next write
+const VkAccessFlags kWriteAccess = VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT | VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_WRITE_BIT |
+                                   VK_ACCESS_SHADER_WRITE_BIT | VK_ACCESS_TRANSFER_WRITE_BIT;
+
+// Usages that let an image stay in tile memory
+const VkImageUsageFlags kAttachmentUsage = VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT | VK_IMAGE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT |
+                                           VK_IMAGE_USAGE_INPUT_ATTACHMENT_BIT;
+
+} // namespace
+
+// Synchronization state of one image or buffer while the frame is replayed
+struct RenderGraph::TrackState {
+    VkImageLayout layout = VK_IMAGE_LAYOUT_UNDEFINED;
+    // The last write, and the stages and accesses that already waited for it
+    VkPipelineStageFlags writeStages = 0;
+    VkAccessFlags writeAccess = 0;
+    VkPipelineStageFlags readStages = 0;
+    VkAccessFlags readAccess = 0;
+};
+
+void RenderGraph::PassBuilder::read(Resource resource, Access access) {
+    use(resource, access, true, false);
+}
+
+void RenderGraph::PassBuilder::write(Resource resource, Access access) {
+    use(resource, access, false, true);
+}
+
+void RenderGraph::PassBuilder::sideEffect() {
+    graph.passes[pass].sideEffect = true;
+}
+
+void RenderGraph::PassBuilder::use(Resource resource, Access access, bool read, bool write) {
+    if (resource >= graph.resources.size()) {
+        throw std::runtime_error("render graph pass " + graph.passes[pass].name + " uses an unknown resource");
+    }
+    AccessInfo info = accessInfo(access);
+    if (graph.resources[resource].isBuffer) {
+        info.layout = VK_IMAGE_LAYOUT_UNDEFINED;
+        info.usage = info.bufferUsage;
+    }
+
+    auto& uses = graph.passes[pass].uses;
+    auto it = std::find_if(uses.begin(), uses.end(), [resource] (const Use& use) { return use.resource == resource; });
+    if (it == uses.end()) {
+        uses.push_back({ resource, info.layout, info.stages, info.access, info.usage, read, write });
+        return;
+    }
+    if (it->layout != info.layout) {
+        throw std::runtime_error("render graph pass " + graph.passes[pass].name + " uses " +
+                                 graph.resources[resource].name + " in two layouts");
+    }
+    it->stages |= info.stages;
+    it->access |= info.access;
+    it->usage |= info.usage;
+    it->read |= read;
+    it->write |= write;
+}
+
+void RenderGraph::init(VkDevice device, const VkPhysicalDeviceMemoryProperties& memoryProperties,
+                       VkDeviceSize bufferImageGranularity, VkAllocationCallbacks* allocationCallbacks) {
+    this->device = device;
+    this->allocationCallbacks = allocationCallbacks;
+    this->memoryProperties = memoryProperties;
+    this->bufferImageGranularity = std::max<VkDeviceSize>(bufferImageGranularity, 1);
+}
+
+void RenderGraph::reset() {
+    destroyTransients();
+    passes.clear();
+    resources.clear();
+    barriers.clear();
+    finalBarriers = {};
+    statistics = {};
+}
+
+RenderGraph::Resource RenderGraph::importImage(const std::string& name, VkImageAspectFlags aspect, VkImageLayout initialLayout,
+                                               VkPipelineStageFlags initialStages, VkImageLayout finalLayout) {
+    ResourceNode node;
+    node.name = name;
+    node.imported = true;
+    node.desc.aspect = aspect;
+    node.initialLayout = initialLayout;
+    node.initialStages = initialStages;
+    node.finalLayout = finalLayout;
+    resources.push_back(node);
+    return static_cast<Resource>(resources.size() - 1);
+}
+
+RenderGraph::Resource RenderGraph::importBuffer(const std::string& name) {
+    ResourceNode node;
+    node.name = name;
+    node.imported = true;
+    node.isBuffer = true;
+    resources.push_back(node);
+    return static_cast<Resource>(resources.size() - 1);
+}
+
+RenderGraph::Resource RenderGraph::createImage(const std::string& name, const ImageDesc& desc) {
+    ResourceNode node;
+    node.name = name;
+    node.desc = desc;
+    resources.push_back(node);
+    return static_cast<Resource>(resources.size() - 1);
+}
+
+RenderGraph::Resource RenderGraph::createBuffer(const std::string& name, const BufferDesc& desc) {
+    ResourceNode node;
+    node.name = name;
+    node.isBuffer = true;
+    node.bufferDesc = desc;
+    resources.push_back(node);
+    return static_cast<Resource>(resources.size() - 1);
+}
+
+void RenderGraph::addPass(const std::string& name, const std::function<void(PassBuilder&)>& setup, ExecuteFn execute) {
+    passes.push_back({ name, {}, std::move(execute) });
+    PassBuilder builder(*this, static_cast<uint32_t>(passes.size() - 1));
+    setup(builder);
+}
+
+void RenderGraph::compile() {
+    destroyTransients();
+    statistics = {};
+
+    cull();
+    computeLifetimes();
+    createTransients();
+    scheduleBarriers();
+}
+
+void RenderGraph::cull() {
+    // Walk back from what's visible outside the graph: a pass survives if it writes something
+    // needed, and then everything it reads is needed too
+    std::vector<bool> needed(resources.size(), false);
+    for (size_t i = 0; i < resources.size(); i++) {
+        needed[i] = resources[i].imported;
+    }
+
+    for (size_t p = passes.size(); p-- > 0;) {
+        Pass& pass = passes[p];
+        bool keep = pass.sideEffect;
+        for (const auto& use: pass.uses) {
+            keep = keep || (use.write && needed[use.resource]);
+        }
+        pass.culled = !keep;
+        if (!keep) {
+            statistics.culledPasses++;
+            continue;
+        }
+        for (const auto& use: pass.uses) {
+            if (use.read) {
+                needed[use.resource] = true;
+            }
+        }
+    }
+    statistics.passes = static_cast<uint32_t>(passes.size()) - statistics.culledPasses;
+}
+
+void RenderGraph::computeLifetimes() {
+    for (auto& node: resources) {
+        node.firstUse = UINT32_MAX;
+        node.lastUse = 0;
+        node.usage = 0;
+        node.aliases.clear();
+    }
+    for (uint32_t p = 0; p < passes.size(); p++) {
+        if (passes[p].culled) {
+            continue;
+        }
+        for (const auto& use: passes[p].uses) {
+            auto& node = resources[use.resource];
+            node.firstUse = std::min(node.firstUse, p);
+            node.lastUse = std::max(node.lastUse, p);
+            node.usage |= use.usage;
+        }
+    }
+}
+
+void RenderGraph::scheduleBarriers() {
+    std::vector<TrackState> initial(resources.size());
+    for (Resource r = 0; r < resources.size(); r++) {
+        if (resources[r].imported) {
+            initial[r].layout = resources[r].initialLayout;
+            initial[r].writeStages = resources[r].initialStages;
+        }
+    }
+
+    // Transients are reused every frame: the first use has to wait for the last use of the
+    // previous frame, so replay once to find where the frame leaves them
+    std::vector<TrackState> states = initial;
+    simulate(states, false);
+    for (Resource r = 0; r < resources.size(); r++) {
+        if (!resources[r].imported) {
+            initial[r].writeStages = states[r].writeStages | states[r].readStages;
+            initial[r].writeAccess = states[r].writeAccess;
+        }
+    }
+
+    states = initial;
+    simulate(states, true);
+
+    // Hand imported images over in the layout the next user expects
+    finalBarriers = {};
+    for (Resource r = 0; r < resources.size(); r++) {
+        const auto& node = resources[r];
+        const auto& state = states[r];
+        if (!node.imported || node.isBuffer || node.finalLayout == VK_IMAGE_LAYOUT_UNDEFINED ||
+            node.finalLayout == state.layout) {
+            continue;
+        }
+        // Nothing in this command buffer waits for it, the semaphore signal does
+        finalBarriers.images.push_back({ r, state.writeStages | state.readStages, 0, state.writeAccess, 0,
+                                         state.layout, node.finalLayout });
+        statistics.imageBarriers++;
+    }
+}
+
+void RenderGraph::simulate(std::vector<TrackState>& states, bool emit) {
+    if (emit) {
+        barriers.assign(passes.size(), {});
+    }
+
+    for (uint32_t p = 0; p < passes.size(); p++) {
+        if (passes[p].culled) {
+            continue;
+        }
+        for (const auto& use: passes[p].uses) {
+            const auto& node = resources[use.resource];
+            auto& state = states[use.resource];
+
+            // A transient's contents are discarded at its first use. Its memory was last used by
+            // one of its aliases, earlier in this frame or (like itself) in the previous one
+            bool discard = !node.imported && p == node.firstUse;
+            VkImageLayout oldLayout = discard ? VK_IMAGE_LAYOUT_UNDEFINED : state.layout;
+            bool transition = !node.isBuffer && (discard || oldLayout != use.layout);
+
+            VkPipelineStageFlags srcStages = state.writeStages;
+            VkAccessFlags srcAccess = state.writeAccess;
+            if (use.write || transition) {
+                srcStages |= state.readStages;
+            }
+            if (discard) {
+                srcStages = 0;
+                srcAccess = 0;
+                for (auto alias: node.aliases) {
+                    srcStages |= states[alias].writeStages | states[alias].readStages;
+                    srcAccess |= states[alias].writeAccess;
+                }
+            }
+
+            // Read after read needs nothing, read after write only once per stage and access
+            bool readAfterWrite = state.writeStages != 0 &&
+                                  ((use.stages & ~state.readStages) != 0 || (use.access & ~state.readAccess) != 0);
+            bool hazard = discard ? srcStages != 0 :
+                          use.write ? (state.writeStages | state.readStages) != 0 : readAfterWrite;
+
+            if (emit && (transition || hazard)) {
+                auto& batch = barriers[p];
+                if (node.isBuffer) {
+                    batch.buffers.push_back({ use.resource, srcStages, use.stages, srcAccess, use.access });
+                    statistics.bufferBarriers++;
+                } else {
+                    batch.images.push_back({ use.resource, srcStages, use.stages, srcAccess, use.access, oldLayout, use.layout });
+                    statistics.imageBarriers++;
+                }
+            }
+
+            if (use.write) {
+                state.writeStages = use.stages;
+                state.writeAccess = use.access & kWriteAccess;
+                state.readStages = 0;
+                state.readAccess = 0;
+            } else if (transition) {
+                // Earlier readers finished before the transition, only this one has seen it
+                state.readStages = use.stages;
+                state.readAccess = use.access;
+            } else {
+                state.readStages |= use.stages;
+                state.readAccess |= use.access;
+            }
+            if (!node.isBuffer) {
+                state.layout = use.layout;
+            }
+        }
+    }
+}
+
+uint32_t RenderGraph::findMemoryType(uint32_t typeBits, VkMemoryPropertyFlags properties) const {
+    for (uint32_t i = 0; i < memoryProperties.memoryTypeCount; i++) {
+        if ((typeBits & (1u << i)) && (memoryProperties.memoryTypes[i].propertyFlags & properties) == properties) {
+            return i;
+        }
+    }
+    return UINT32_MAX;
+}
+
+void RenderGraph::createTransients() {
+    std::vector<Resource> transients;
+    std::vector<TransientAllocator::Request> requests;
+
+    for (Resource r = 0; r < resources.size(); r++) {
+        auto& node = resources[r];
+        if (node.imported || node.firstUse == UINT32_MAX) {
+            continue;
+        }
+
+        VkMemoryRequirements requirements;
+        bool lazy = false;
+        if (node.isBuffer) {
+            VkBufferCreateInfo bufferInfo = {};
+            bufferInfo.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
+            bufferInfo.size = node.bufferDesc.size;
+            bufferInfo.usage = node.usage;
+            bufferInfo.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+
+            if (vkCreateBuffer(device, &bufferInfo, allocationCallbacks, &node.buffer) != VK_SUCCESS) {
+                throw std::runtime_error("failed to create render graph buffer " + node.name);
+            }
+            vkGetBufferMemoryRequirements(device, node.buffer, &requirements);
+            statistics.transientBuffers++;
+        } else {
+            VkImageUsageFlags usage = node.usage;
+            // Attachments that are never sampled or copied don't need to leave the tile
+            lazy = (usage & ~kAttachmentUsage) == 0;
+            if (lazy) {
+                usage |= VK_IMAGE_USAGE_TRANSIENT_ATTACHMENT_BIT;
+            }
+
+            VkImageCreateInfo imageInfo = {};
+            imageInfo.sType = VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO;
+            imageInfo.imageType = VK_IMAGE_TYPE_2D;
+            imageInfo.format = node.desc.format;
+            imageInfo.extent = { node.desc.extent.width, node.desc.extent.height, 1 };
+            imageInfo.mipLevels = 1;
+            imageInfo.arrayLayers = 1;
+            imageInfo.samples = node.desc.samples;
+            imageInfo.tiling = VK_IMAGE_TILING_OPTIMAL;
+            imageInfo.usage = usage;
+            imageInfo.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+            imageInfo.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+
+            if (vkCreateImage(device, &imageInfo, allocationCallbacks, &node.image) != VK_SUCCESS) {
+                throw std::runtime_error("failed to create render graph image " + node.name);
+            }
+            vkGetImageMemoryRequirements(device, node.image, &requirements);
+            statistics.transientImages++;
+        }
+
+        uint32_t memoryType = UINT32_MAX;
+        if (lazy) {
+            memoryType = findMemoryType(requirements.memoryTypeBits,
+                                        VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT | VK_MEMORY_PROPERTY_LAZILY_ALLOCATED_BIT);
+        }
+        if (memoryType == UINT32_MAX) {
+            memoryType = findMemoryType(requirements.memoryTypeBits, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT);
+        }
+        if (memoryType == UINT32_MAX) {
+            throw std::runtime_error("failed to find memory type for render graph resource " + node.name);
+        }
+
+        // Buffers and images share blocks, keeping every resource on its own granularity page
+        // keeps linear and optimal resources apart
+        TransientAllocator::Request request;
+        request.size = requirements.size;
+        request.alignment = std::max(requirements.alignment, bufferImageGranularity);
+        request.memoryType = memoryType;
+        request.firstUse = node.firstUse;
+        request.lastUse = node.lastUse;
+        requests.push_back(request);
+        transients.push_back(r);
+    }
+
+    allocator.place(requests);
+
+    for (const auto& block: allocator.blocks()) {
+        VkMemoryAllocateInfo allocInfo = {};
+        allocInfo.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
+        allocInfo.allocationSize = block.size;
+        allocInfo.memoryTypeIndex = block.memoryType;
+
+        VkDeviceMemory memory = VK_NULL_HANDLE;
+        if (vkAllocateMemory(device, &allocInfo, allocationCallbacks, &memory) != VK_SUCCESS) {
+            throw std::runtime_error("failed to allocate render graph memory");
+        }
+        memoryBlocks.push_back(memory);
+    }
+
+    for (size_t i = 0; i < transients.size(); i++) {
+        auto& node = resources[transients[i]];
+        const auto& placement = allocator.placements()[i];
+        for (size_t j = 0; j < transients.size(); j++) {
+            if (allocator.overlaps(i, j)) {
+                node.aliases.push_back(transients[j]);
+            }
+        }
+
+        if (node.isBuffer) {
+            vkBindBufferMemory(device, node.buffer, memoryBlocks[placement.block], placement.offset);
+            continue;
+        }
+        vkBindImageMemory(device, node.image, memoryBlocks[placement.block], placement.offset);
+
+        VkImageViewCreateInfo viewInfo = {};
+        viewInfo.sType = VK_STRUCTURE_TYPE_IMAGE_VIEW_CREATE_INFO;
+        viewInfo.image = node.image;
+        viewInfo.viewType = VK_IMAGE_VIEW_TYPE_2D;
+        viewInfo.format = node.desc.format;
+        viewInfo.subresourceRange = { node.desc.aspect, 0, 1, 0, 1 };
+
+        if (vkCreateImageView(device, &viewInfo, allocationCallbacks, &node.view) != VK_SUCCESS) {
+            throw std::runtime_error("failed to create render graph image view " + node.name);
+        }
+    }
+
+    statistics.memoryBlocks = static_cast<uint32_t>(memoryBlocks.size());
+    statistics.transientBytes = allocator.peakBytes();
+    statistics.naiveBytes = allocator.naiveBytes();
+}
+
+void RenderGraph::destroyTransients() {
+    for (auto& node: resources) {
+        if (node.imported) {
+            continue;
+        }
+        if (node.view != VK_NULL_HANDLE) {
+            vkDestroyImageView(device, node.view, allocationCallbacks);
+        }
+        if (node.image != VK_NULL_HANDLE) {
+            vkDestroyImage(device, node.image, allocationCallbacks);
+        }
+        if (node.buffer != VK_NULL_HANDLE) {
+            vkDestroyBuffer(device, node.buffer, allocationCallbacks);
+        }
+        node.view = VK_NULL_HANDLE;
+        node.image = VK_NULL_HANDLE;
+        node.buffer = VK_NULL_HANDLE;
+    }
+    for (auto memory: memoryBlocks) {
+        vkFreeMemory(device, memory, allocationCallbacks);
+    }
+    memoryBlocks.clear();
+}
+
+void RenderGraph::bindImage(Resource resource, VkImage image, VkImageView view) {
+    resources[resource].image = image;
+    resources[resource].view = view;
+}
+
+void RenderGraph::bindBuffer(Resource resource, VkBuffer buffer) {
+    resources[resource].buffer = buffer;
+}
+
+VkImage RenderGraph::image(Resource resource) const {
+    return resources[resource].image;
+}
+
+VkImageView RenderGraph::view(Resource resource) const {
+    return resources[resource].view;
+}
+
+VkBuffer RenderGraph::buffer(Resource resource) const {
+    return resources[resource].buffer;
+}
+
+void RenderGraph::execute(VkCommandBuffer commandBuffer) const {
+    for (size_t p = 0; p < passes.size(); p++) {
+        if (passes[p].culled) {
+            continue;
+        }
+        recordBarriers(commandBuffer, barriers[p]);
+        passes[p].execute(commandBuffer, *this);
+    }
+    recordBarriers(commandBuffer, finalBarriers);
+}
+
+void RenderGraph::recordBarriers(VkCommandBuffer commandBuffer, const BarrierBatch& batch) const {
+    for (const auto& barrier: batch.images) {
+        VkImageSubresourceRange range = { resources[barrier.resource].desc.aspect, 0, VK_REMAINING_MIP_LEVELS,
+                                          0, VK_REMAINING_ARRAY_LAYERS };
+        pipelineBarriers.image(image(barrier.resource), range, barrier.srcStages, barrier.srcAccess,
+                               barrier.dstStages, barrier.dstAccess, barrier.oldLayout, barrier.newLayout);
+    }
+    for (const auto& barrier: batch.buffers) {
+        pipelineBarriers.buffer(buffer(barrier.resource), barrier.srcStages, barrier.srcAccess,
+                                barrier.dstStages, barrier.dstAccess);
+    }
+    pipelineBarriers.flush(commandBuffer);
+}
@@ -0,0 +1,225 @@
+//
+//  RenderGraph.hpp
+//  vk-triangle
+//
+//  Created by Kai Chen on 10/18/26.
+//
+
+#ifndef RenderGraph_hpp
+#define RenderGraph_hpp
+
+#include <vulkan/vulkan.h>
+
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+#include "PipelineBarriers.hpp"
+#include "TransientAllocator.hpp"
+
+// The passes of a frame and the resources they read and write.
+//
+// Passes are declared in submission order. compile() culls the passes whose results are never
+// used, derives the pipeline barriers and layout transitions between the remaining ones and
+// creates the transient images and buffers. Transients whose lifetimes don't overlap share
+// memory (see TransientAllocator). execute() then records the barriers and the passes.
+//
+// Imported resources (the swapchain image, buffers owned elsewhere) are visible outside the
+// graph: passes writing them are never culled, and their handles are bound before each execute().
+class RenderGraph {
+public:
+    using Resource = uint32_t;
+    static constexpr Resource kInvalid = UINT32_MAX;
+
+    // How a pass uses a resource, each maps to one layout, stage and access mask.
+    enum class Access {
+        ColorAttachment,
+        DepthAttachment,
+        DepthRead,
+        FragmentSampled,
+        ComputeSampled,
+        ComputeStorageRead,
+        ComputeStorageWrite,
+        IndirectRead,
+        VertexRead,
+        TransferRead,
+        TransferWrite,
+    };
+
+    struct ImageDesc {
+        VkFormat format = VK_FORMAT_UNDEFINED;
+        VkExtent2D extent = {};
+        VkSampleCountFlagBits samples = VK_SAMPLE_COUNT_1_BIT;
+        VkImageAspectFlags aspect = VK_IMAGE_ASPECT_COLOR_BIT;
+    };
+
+    struct BufferDesc {
+        VkDeviceSize size = 0;
+    };
+
+    class PassBuilder {
+    public:
+        void read(Resource resource, Access access);
+        void write(Resource resource, Access access);
+        // Keeps the pass even when nothing reads what it writes.
+        void sideEffect();
+
+    private:
+        friend class RenderGraph;
+        PassBuilder(RenderGraph& graph, uint32_t pass) : graph(graph), pass(pass) {}
+        void use(Resource resource, Access access, bool read, bool write);
+
+        RenderGraph& graph;
+        uint32_t pass;
+    };
+
+    using ExecuteFn = std::function<void(VkCommandBuffer commandBuffer, const RenderGraph& graph)>;
+
+    struct Stats {
+        uint32_t passes = 0;
+        uint32_t culledPasses = 0;
+        uint32_t imageBarriers = 0;
+        uint32_t bufferBarriers = 0;
+        uint32_t transientImages = 0;
+        uint32_t transientBuffers = 0;
+        uint32_t memoryBlocks = 0;
+        // Transient memory with aliasing, and what it would take without
+        VkDeviceSize transientBytes = 0;
+        VkDeviceSize naiveBytes = 0;
+    };
+
+    // Transient buffers and images are placed in the same blocks, `bufferImageGranularity`
+    // keeps them apart. `allocationCallbacks` has to outlive the graph.
+    void init(VkDevice device, const VkPhysicalDeviceMemoryProperties& memoryProperties,
+              VkDeviceSize bufferImageGranularity, VkAllocationCallbacks* allocationCallbacks = nullptr);
+    // Records barriers with the device's vkCmdPipelineBarrier instead of the loader's.
+    void useCmdPipelineBarrier(PFN_vkCmdPipelineBarrier cmdPipelineBarrier) { pipelineBarriers = PipelineBarriers(cmdPipelineBarrier); }
+#if defined(VK_KHR_synchronization2)
+    // Records barriers with vkCmdPipelineBarrier2, each with only its own stages.
+    void useSynchronization2(PFN_vkCmdPipelineBarrier cmdPipelineBarrier, PFN_vkCmdPipelineBarrier2KHR cmdPipelineBarrier2) {
+        pipelineBarriers = PipelineBarriers(cmdPipelineBarrier, cmdPipelineBarrier2);
+    }
+#endif
+    // Destroys the transients and forgets every pass and resource.
+    void reset();
+
+    // `initialStages` is where the previous user of the image leaves off (the stage the acquire
+    // semaphore waits at for swapchain images). VK_IMAGE_LAYOUT_UNDEFINED as `finalLayout`
+    // leaves the image in the layout of its last use.
+    Resource importImage(const std::string& name, VkImageAspectFlags aspect, VkImageLayout initialLayout,
+                         VkPipelineStageFlags initialStages, VkImageLayout finalLayout);
+    Resource importBuffer(const std::string& name);
+    Resource createImage(const std::string& name, const ImageDesc& desc);
+    Resource createBuffer(const std::string& name, const BufferDesc& desc);
+
+    void addPass(const std::string& name, const std::function<void(PassBuilder&)>& setup, ExecuteFn execute);
+
+    // Throws if a resource is used with conflicting layouts within one pass.
+    void compile();
+
+    void bindImage(Resource resource, VkImage image, VkImageView view);
+    void bindBuffer(Resource resource, VkBuffer buffer);
+    void execute(VkCommandBuffer commandBuffer) const;
+
+    VkImage image(Resource resource) const;
+    VkImageView view(Resource resource) const;
+    VkBuffer buffer(Resource resource) const;
+    const Stats& stats() const { return statistics; }
+
+private:
+    // Every use of one resource within a pass, merged.
+    struct Use {
+        Resource resource;
+        VkImageLayout layout;
+        VkPipelineStageFlags stages;
+        VkAccessFlags access;
+        // Image or buffer usage
+        VkFlags usage;
+        bool read;
+        bool write;
+    };
+
+    struct Pass {
+        std::string name;
+        std::vector<Use> uses;
+        ExecuteFn execute;
+        bool sideEffect = false;
+        bool culled = false;
+    };
+
+    struct ResourceNode {
+        std::string name;
+        bool imported = false;
+        bool isBuffer = false;
+        ImageDesc desc;
+        BufferDesc bufferDesc;
+        VkFlags usage = 0;
+        VkImageLayout initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+        VkPipelineStageFlags initialStages = 0;
+        VkImageLayout finalLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+        // Passes of the first and last use after culling
+        uint32_t firstUse = UINT32_MAX;
+        uint32_t lastUse = 0;
+        // Transients sharing memory with this one, itself included
+        std::vector<Resource> aliases;
+        VkImage image = VK_NULL_HANDLE;
+        VkImageView view = VK_NULL_HANDLE;
+        VkBuffer buffer = VK_NULL_HANDLE;
+    };
+
+    struct ImageBarrier {
+        Resource resource;
+        VkPipelineStageFlags srcStages;
+        VkPipelineStageFlags dstStages;
+        VkAccessFlags srcAccess;
+        VkAccessFlags dstAccess;
+        VkImageLayout oldLayout;
+        VkImageLayout newLayout;
+    };
+
+    struct BufferBarrier {
+        Resource resource;
+        VkPipelineStageFlags srcStages;
+        VkPipelineStageFlags dstStages;
+        VkAccessFlags srcAccess;
+        VkAccessFlags dstAccess;
+    };
+
+    // Barriers recorded before a pass, or after the last one.
+    struct BarrierBatch {
+        std::vector<ImageBarrier> images;
+        std::vector<BufferBarrier> buffers;
+    };
+
+    struct TrackState;
+
+    void cull();
+    void computeLifetimes();
+    void createTransients();
+    void destroyTransients();
+    void scheduleBarriers();
+    // Replays the frame from `states`, leaving the state after the last pass in them. Barriers
+    // are only recorded when `emit` is set.
+    void simulate(std::vector<TrackState>& states, bool emit);
+    uint32_t findMemoryType(uint32_t typeBits, VkMemoryPropertyFlags properties) const;
+    void recordBarriers(VkCommandBuffer commandBuffer, const BarrierBatch& batch) const;
+
+    VkDevice device = VK_NULL_HANDLE;
+    VkAllocationCallbacks* allocationCallbacks = nullptr;
+    VkPhysicalDeviceMemoryProperties memoryProperties = {};
+    VkDeviceSize bufferImageGranularity = 1;
+    // Reused by every batch execute() records, it's empty between them
+    mutable PipelineBarriers pipelineBarriers;
+
+    std::vector<Pass> passes;
+    std::vector<ResourceNode> resources;
+    TransientAllocator allocator;
+    std::vector<VkDeviceMemory> memoryBlocks;
+    // One batch per pass, plus the final transitions of imported images
+    std::vector<BarrierBatch> barriers;
+    BarrierBatch finalBarriers;
+    Stats statistics;
+};
+
+#endif /* RenderGraph_hpp */
@@ -0,0 +1,199 @@
+//
+//  ShaderArchive.cpp
+//  vk-triangle
+//
+//  Created by Kai Chen on 10/18/26.
+//
+
+#include "ShaderArchive.hpp"
+
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+#include <utility>
+
+#if defined(__linux__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace {
+
+// Generated by the shader build phase, see tools/pack_shaders.py
+alignas(16) const unsigned char embeddedArchive[] = {
+#include "shaders/shaders_pak.inc"
+};
+
+std::string_view fixedString(const char (&field)[ShaderArchive::kNameLength]) {
+    return std::string_view(field, strnlen(field, ShaderArchive::kNameLength));
+}
+
+}
+
+ShaderArchive::ShaderArchive(ShaderArchive&& other) noexcept {
+    *this = std::move(other);
+}
+
+ShaderArchive& ShaderArchive::operator=(ShaderArchive&& other) noexcept {
+    if (this != &other) {
+        release();
+        bytes = std::exchange(other.bytes, nullptr);
+        size = std::exchange(other.size, 0);
+        mapping = std::exchange(other.mapping, nullptr);
+        mappingSize = std::exchange(other.mappingSize, 0);
+        // The heap buffer keeps its address when moved, so the spans in entries stay valid.
+        storage = std::move(other.storage);
+        entries = std::move(other.entries);
+    }
+    return *this;
+}
+
+ShaderArchive::~ShaderArchive() {
+    release();
+}
+
+void ShaderArchive::release() {
+#if defined(__linux__) || defined(__APPLE__)
+    if (mapping != nullptr) {
+        munmap(mapping, mappingSize);
+    }
+#endif
+    mapping = nullptr;
+    mappingSize = 0;
+    bytes = nullptr;
+    size = 0;
+    storage.clear();
+    entries.clear();
+}
+
+ShaderArchive ShaderArchive::loadEmbedded() {
+    ShaderArchive archive;
+    archive.bytes = embeddedArchive;
+    archive.size = sizeof(embeddedArchive);
+    archive.parse();
+    return archive;
+}
+
+ShaderArchive ShaderArchive::loadFile(const std::string& path) {
+    ShaderArchive archive;
+
+#if defined(__linux__) || defined(__APPLE__)
+    int fd = open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        throw std::runtime_error("failed to open shader archive: " + path);
+    }
+
+    struct stat st = {};
+    if (fstat(fd, &st) == 0 && st.st_size > 0) {
+        void* mapped = mmap(nullptr, static_cast<size_t>(st.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+        if (mapped != MAP_FAILED) {
+            archive.mapping = mapped;
+            archive.mappingSize = static_cast<size_t>(st.st_size);
+            archive.bytes = static_cast<const uint8_t*>(mapped);
+            archive.size = archive.mappingSize;
+        }
+    }
+    close(fd);
+#endif
+
+    if (archive.bytes == nullptr) {
+        std::ifstream file(path, std::ios::ate | std::ios::binary);
+        if (!file.is_open()) {
+            throw std::runtime_error("failed to open shader archive: " + path);
+        }
+
+        size_t filesize = (size_t)file.tellg();
+        // uint32_t storage keeps the SPIR-V blobs word aligned
+        archive.storage.resize((filesize + sizeof(uint32_t) - 1) / sizeof(uint32_t));
+        file.seekg(0);
+        file.read(reinterpret_cast<char*>(archive.storage.data()), static_cast<std::streamsize>(filesize));
+
+        archive.bytes = reinterpret_cast<const uint8_t*>(archive.storage.data());
+        archive.size = filesize;
+    }
+
+    archive.parse();
+    return archive;
+}
+
+void ShaderArchive::parse() {
+    if (size < sizeof(Header)) {
+        throw std::runtime_error("shader archive is truncated");
+    }
+
+    Header header;
+    memcpy(&header, bytes, sizeof(Header));
+    if (header.magic != kMagic) {
+        throw std::runtime_error("invalid shader archive magic");
+    }
+    if (header.version != kVersion) {
+        throw std::runtime_error("unsupported shader archive version " + std::to_string(header.version));
+    }
+    if (header.totalSize > size ||
+        header.tocOffset % alignof(TocEntry) != 0 ||
+        header.tocOffset + uint64_t(header.entryCount) * sizeof(TocEntry) > header.totalSize) {
+        throw std::runtime_error("shader archive table of contents is out of range");
+    }
+
+    auto inRange = [&](uint64_t offset, uint64_t length, size_t alignment) {
+        return offset % alignment == 0 && offset + length <= header.totalSize;
+    };
+
+    const auto* toc = reinterpret_cast<const TocEntry*>(bytes + header.tocOffset);
+    entries.reserve(header.entryCount);
+    for (uint32_t i = 0; i < header.entryCount; i++) {
+        const TocEntry& entry = toc[i];
+        if (!inRange(entry.codeOffset, entry.codeSize, kBlobAlignment) ||
+            entry.codeSize % sizeof(uint32_t) != 0 ||
+            !inRange(entry.bindingOffset, uint64_t(entry.bindingCount) * sizeof(BindingRecord), alignof(BindingRecord)) ||
+            !inRange(entry.pushConstantOffset, uint64_t(entry.pushConstantCount) * sizeof(PushConstantRecord), alignof(PushConstantRecord))) {
+            throw std::runtime_error("shader archive entry " + std::to_string(i) + " is out of range");
+        }
+
+        Shader shader = {};
+        shader.name = fixedString(entry.name);
+        shader.entryPoint = fixedString(entry.entryPoint);
+        shader.stage = static_cast<VkShaderStageFlagBits>(entry.stage);
+        shader.code = { reinterpret_cast<const uint32_t*>(bytes + entry.codeOffset), entry.codeSize / sizeof(uint32_t) };
+        shader.contentHash = entry.contentHash;
+        shader.bindings = { reinterpret_cast<const BindingRecord*>(bytes + entry.bindingOffset), entry.bindingCount };
+        shader.pushConstants = { reinterpret_cast<const PushConstantRecord*>(bytes + entry.pushConstantOffset), entry.pushConstantCount };
+
+#if !defined(NDEBUG)
+        if (hash(shader.code.data(), shader.code.size_bytes()) != shader.contentHash) {
+            throw std::runtime_error("shader archive entry " + std::string(shader.name) + " is corrupted");
+        }
+#endif
+
+        entries.push_back(shader);
+    }
+}
+
+const ShaderArchive::Shader* ShaderArchive::find(std::string_view name) const {
+    for (const auto& shader: entries) {
+        if (shader.name == name) {
+            return &shader;
+        }
+    }
+    return nullptr;
+}
+
+const ShaderArchive::Shader& ShaderArchive::get(std::string_view name) const {
+    auto shader = find(name);
+    if (shader == nullptr) {
+        throw std::runtime_error("shader not found in archive: " + std::string(name));
+    }
+    return *shader;
+}
+
+uint64_t ShaderArchive::hash(const void* data, size_t size) {
+    const auto* p = static_cast<const uint8_t*>(data);
+    uint64_t h = 0xcbf29ce484222325ull;
+    for (size_t i = 0; i < size; i++) {
+        h ^= p[i];
+        h *= 0x100000001b3ull;
+    }
+    return h;
+}
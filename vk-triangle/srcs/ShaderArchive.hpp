@@ -0,0 +1,115 @@
+//
+//  ShaderArchive.hpp
+//  vk-triangle
+//
+//  Created by Kai Chen on 10/18/26.
+//
+
+#ifndef ShaderArchive_hpp
+#define ShaderArchive_hpp
+
+#include <vulkan/vulkan.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// Packed shader archive produced by tools/pack_shaders.py.
+//
+// Layout (little endian, offsets relative to the start of the archive):
+//   Header
+//   TocEntry[entryCount]
+//   BindingRecord / PushConstantRecord arrays referenced from the entries
+//   SPIR-V blobs, each aligned to ShaderArchive::kBlobAlignment
+//
+// The archive is either embedded into the executable or loaded from disk
+// with a single mmap (or a single read when mapping isn't available).
+class ShaderArchive {
+public:
+    static constexpr uint32_t kMagic = 0x41534B56; // "VKSA"
+    static constexpr uint32_t kVersion = 1;
+    static constexpr uint32_t kBlobAlignment = 16;
+    static constexpr size_t kNameLength = 32;
+
+    struct Header {
+        uint32_t magic;
+        uint32_t version;
+        uint32_t entryCount;
+        uint32_t tocOffset;
+        uint32_t totalSize;
+        uint32_t reserved[3];
+    };
+
+    struct TocEntry {
+        char name[kNameLength];
+        char entryPoint[kNameLength];
+        uint32_t stage;
+        uint32_t codeOffset;
+        uint32_t codeSize;
+        uint32_t bindingOffset;
+        uint32_t bindingCount;
+        uint32_t pushConstantOffset;
+        uint32_t pushConstantCount;
+        uint32_t reserved;
+        uint64_t contentHash;
+    };
+
+    struct BindingRecord {
+        uint32_t set;
+        uint32_t binding;
+        uint32_t descriptorType;
+        uint32_t descriptorCount;
+    };
+
+    struct PushConstantRecord {
+        uint32_t offset;
+        uint32_t size;
+    };
+
+    // name and entryPoint point into the archive and are null terminated.
+    struct Shader {
+        std::string_view name;
+        std::string_view entryPoint;
+        VkShaderStageFlagBits stage;
+        std::span<const uint32_t> code;
+        uint64_t contentHash;
+        std::span<const BindingRecord> bindings;
+        std::span<const PushConstantRecord> pushConstants;
+    };
+
+    ShaderArchive() = default;
+    ShaderArchive(ShaderArchive&& other) noexcept;
+    ShaderArchive& operator=(ShaderArchive&& other) noexcept;
+    ShaderArchive(const ShaderArchive&) = delete;
+    ShaderArchive& operator=(const ShaderArchive&) = delete;
+    ~ShaderArchive();
+
+    // The archive compiled into the executable by the shader build phase.
+    static ShaderArchive loadEmbedded();
+    // Maps the archive at `path`, falling back to one read into memory.
+    static ShaderArchive loadFile(const std::string& path);
+
+    // Throws if the shader isn't in the archive.
+    const Shader& get(std::string_view name) const;
+    const Shader* find(std::string_view name) const;
+    const std::vector<Shader>& shaders() const { return entries; }
+
+    // FNV-1a 64, matches the hash written by the packer.
+    static uint64_t hash(const void* data, size_t size);
+
+private:
+    void parse();
+    void release();
+
+    const uint8_t* bytes = nullptr;
+    size_t size = 0;
+    void* mapping = nullptr;
+    size_t mappingSize = 0;
+    std::vector<uint32_t> storage;
+    std::vector<Shader> entries;
+};
+
+#endif /* ShaderArchive_hpp */
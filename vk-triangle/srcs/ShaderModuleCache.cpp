@@ -0,0 +1,111 @@
+//
+//  ShaderModuleCache.cpp
+//  vk-triangle
+//
+//  Created by Kai Chen on 10/18/26.
+//
+
+#include "ShaderModuleCache.hpp"
+
+#include <cassert>
+#include <cstring>
+#include <stdexcept>
+
+void ShaderModuleCache::init(VkDevice device, PFN_vkGetDeviceProcAddr getDeviceProcAddr, bool useIdentifiers,
+                             VkAllocationCallbacks* allocationCallbacks) {
+    this->device = device;
+    this->allocationCallbacks = allocationCallbacks;
+    this->useIdentifiers = false;
+#if defined(VK_EXT_shader_module_identifier)
+    if (useIdentifiers) {
+        fp_vkGetShaderModuleIdentifierEXT = reinterpret_cast<PFN_vkGetShaderModuleIdentifierEXT>(
+            getDeviceProcAddr(device, "vkGetShaderModuleIdentifierEXT"));
+        this->useIdentifiers = fp_vkGetShaderModuleIdentifierEXT != nullptr;
+    }
+#endif
+}
+
+void ShaderModuleCache::destroy() {
+    releaseModules();
+    entries.clear();
+}
+
+void ShaderModuleCache::releaseModules() {
+    for (auto& [hash, entry]: entries) {
+        if (entry.module != VK_NULL_HANDLE) {
+            vkDestroyShaderModule(device, entry.module, allocationCallbacks);
+            entry.module = VK_NULL_HANDLE;
+        }
+    }
+}
+
+ShaderModuleCache::Entry& ShaderModuleCache::lookup(std::span<const uint32_t> code, uint64_t hash) {
+    auto [it, inserted] = entries.try_emplace(hash);
+    Entry& entry = it->second;
+    if (inserted) {
+        entry.code = code;
+    } else {
+        assert(entry.code.size() == code.size() &&
+               (entry.code.data() == code.data() || memcmp(entry.code.data(), code.data(), code.size_bytes()) == 0) &&
+               "shader module hash collision");
+    }
+    return entry;
+}
+
+void ShaderModuleCache::createModule(Entry& entry) {
+    VkShaderModuleCreateInfo createInfo = {};
+    createInfo.sType = VK_STRUCTURE_TYPE_SHADER_MODULE_CREATE_INFO;
+    createInfo.codeSize = entry.code.size_bytes();
+    createInfo.pCode = entry.code.data();
+
+    if (vkCreateShaderModule(device, &createInfo, allocationCallbacks, &entry.module) != VK_SUCCESS) {
+        throw std::runtime_error("failed to create shader module");
+    }
+
+#if defined(VK_EXT_shader_module_identifier)
+    if (useIdentifiers && entry.identifier.empty()) {
+        VkShaderModuleIdentifierEXT identifier = {};
+        identifier.sType = VK_STRUCTURE_TYPE_SHADER_MODULE_IDENTIFIER_EXT;
+        fp_vkGetShaderModuleIdentifierEXT(device, entry.module, &identifier);
+        entry.identifier.assign(identifier.identifier, identifier.identifier + identifier.identifierSize);
+    }
+#endif
+}
+
+VkShaderModule ShaderModuleCache::get(std::span<const uint32_t> code) {
+    return get(ShaderArchive::Shader { .code = code, .contentHash = ShaderArchive::hash(code.data(), code.size_bytes()) });
+}
+
+VkShaderModule ShaderModuleCache::get(const ShaderArchive::Shader& shader) {
+    Entry& entry = lookup(shader.code, shader.contentHash);
+    if (entry.module == VK_NULL_HANDLE) {
+        createModule(entry);
+    }
+    return entry.module;
+}
+
+void ShaderModuleCache::fillStage(const ShaderArchive::Shader& shader, bool allowIdentifier, Stage& stage) {
+    Entry& entry = lookup(shader.code, shader.contentHash);
+
+    stage = {};
+    stage.info.sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO;
+    stage.info.stage = shader.stage;
+    stage.info.pName = shader.entryPoint.data();
+
+#if defined(VK_EXT_shader_module_identifier)
+    if (allowIdentifier && useIdentifiers && entry.module == VK_NULL_HANDLE && !entry.identifier.empty()) {
+        stage.identifierInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_MODULE_IDENTIFIER_CREATE_INFO_EXT;
+        stage.identifierInfo.identifierSize = static_cast<uint32_t>(entry.identifier.size());
+        stage.identifierInfo.pIdentifier = entry.identifier.data();
+        stage.info.pNext = &stage.identifierInfo;
+        stage.info.module = VK_NULL_HANDLE;
+        stage.usesIdentifier = true;
+        return;
+    }
+#endif
+
+    if (entry.module == VK_NULL_HANDLE) {
+        createModule(entry);
+    }
+    stage.info.module = entry.module;
+}
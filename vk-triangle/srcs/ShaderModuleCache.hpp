@@ -0,0 +1,77 @@
+//
+//  ShaderModuleCache.hpp
+//  vk-triangle
+//
+//  Created by Kai Chen on 10/18/26.
+//
+
+#ifndef ShaderModuleCache_hpp
+#define ShaderModuleCache_hpp
+
+#include <vulkan/vulkan.h>
+
+#include <cstdint>
+#include <span>
+#include <unordered_map>
+#include <vector>
+
+#include "ShaderArchive.hpp"
+
+// Shader modules shared by every pipeline of a device, keyed by a hash of the SPIR-V words.
+//
+// With VK_EXT_shader_module_identifier the cache also records the identifier of each module.
+// Once the modules have been released, stages are described by identifier only, so pipelines
+// that hit the pipeline cache are created without handing any SPIR-V to the driver.
+class ShaderModuleCache {
+public:
+    // A stage description that stays valid while the pipeline is created.
+    struct Stage {
+        VkPipelineShaderStageCreateInfo info = {};
+#if defined(VK_EXT_shader_module_identifier)
+        VkPipelineShaderStageModuleIdentifierCreateInfoEXT identifierInfo = {};
+#endif
+        // The stage references its module by identifier, the pipeline must be created with
+        // VK_PIPELINE_CREATE_FAIL_ON_PIPELINE_COMPILE_REQUIRED_BIT and retried without identifiers
+        // if it returns VK_PIPELINE_COMPILE_REQUIRED.
+        bool usesIdentifier = false;
+    };
+
+    // `allocationCallbacks` has to outlive the cache.
+    void init(VkDevice device, PFN_vkGetDeviceProcAddr getDeviceProcAddr, bool useIdentifiers,
+              VkAllocationCallbacks* allocationCallbacks = nullptr);
+    void destroy();
+
+    // Returns the module for `code`, creating it on first use. The code must outlive the cache.
+    VkShaderModule get(std::span<const uint32_t> code);
+    VkShaderModule get(const ShaderArchive::Shader& shader);
+
+    // Fills `stage` for `shader`, preferring the module identifier when `allowIdentifier` is set
+    // and the module has been released.
+    void fillStage(const ShaderArchive::Shader& shader, bool allowIdentifier, Stage& stage);
+
+    // Destroys the VkShaderModules. Modules are recreated on demand; identifiers are kept.
+    void releaseModules();
+
+    bool identifiersEnabled() const { return useIdentifiers; }
+    size_t size() const { return entries.size(); }
+
+private:
+    struct Entry {
+        std::span<const uint32_t> code;
+        VkShaderModule module = VK_NULL_HANDLE;
+        std::vector<uint8_t> identifier;
+    };
+
+    Entry& lookup(std::span<const uint32_t> code, uint64_t hash);
+    void createModule(Entry& entry);
+
+    VkDevice device = VK_NULL_HANDLE;
+    VkAllocationCallbacks* allocationCallbacks = nullptr;
+    bool useIdentifiers = false;
+#if defined(VK_EXT_shader_module_identifier)
+    PFN_vkGetShaderModuleIdentifierEXT fp_vkGetShaderModuleIdentifierEXT = nullptr;
+#endif
+    std::unordered_map<uint64_t, Entry> entries;
+};
+
+#endif /* ShaderModuleCache_hpp */
@@ -0,0 +1,92 @@
+//
+//  TransientAllocator.cpp
+//  vk-triangle
+//
+//  Created by Kai Chen on 10/18/26.
+//
+
+#include "TransientAllocator.hpp"
+
+#include <algorithm>
+#include <numeric>
+
+namespace {
+
+VkDeviceSize alignUp(VkDeviceSize value, VkDeviceSize alignment) {
+    return alignment > 1 ? (value + alignment - 1) / alignment * alignment : value;
+}
+
+} // namespace
+
+void TransientAllocator::place(std::span<const Request> requests) {
+    this->requests.assign(requests.begin(), requests.end());
+    placed.assign(requests.size(), {});
+    memoryBlocks.clear();
+    naive = 0;
+
+    // Largest first leaves the small requests to fill the gaps between them
+    std::vector<size_t> order(requests.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(), [&requests] (size_t a, size_t b) {
+        return requests[a].size > requests[b].size;
+    });
+
+    struct Range {
+        VkDeviceSize begin;
+        VkDeviceSize end;
+    };
+    std::vector<size_t> done;
+    std::vector<Range> busy;
+
+    for (auto i: order) {
+        const auto& request = requests[i];
+        naive += alignUp(request.size, request.alignment);
+
+        auto block = std::find_if(memoryBlocks.begin(), memoryBlocks.end(), [&request] (const Block& block) {
+            return block.memoryType == request.memoryType;
+        });
+        if (block == memoryBlocks.end()) {
+            memoryBlocks.push_back({ request.memoryType, 0 });
+            block = memoryBlocks.end() - 1;
+        }
+        auto blockIndex = static_cast<uint32_t>(block - memoryBlocks.begin());
+
+        // Ranges in this block that are live at the same time as the request
+        busy.clear();
+        for (auto j: done) {
+            const auto& other = requests[j];
+            if (placed[j].block == blockIndex && other.firstUse <= request.lastUse && request.firstUse <= other.lastUse) {
+                busy.push_back({ placed[j].offset, placed[j].offset + other.size });
+            }
+        }
+        std::sort(busy.begin(), busy.end(), [] (const Range& a, const Range& b) { return a.begin < b.begin; });
+
+        // First fit: the lowest aligned offset between the busy ranges
+        VkDeviceSize offset = 0;
+        for (const auto& range: busy) {
+            if (offset + request.size <= range.begin) {
+                break;
+            }
+            offset = std::max(offset, alignUp(range.end, request.alignment));
+        }
+
+        placed[i] = { blockIndex, offset };
+        block->size = std::max(block->size, offset + request.size);
+        done.push_back(i);
+    }
+}
+
+bool TransientAllocator::overlaps(size_t a, size_t b) const {
+    if (placed[a].block != placed[b].block) {
+        return false;
+    }
+    return placed[a].offset < placed[b].offset + requests[b].size && placed[b].offset < placed[a].offset + requests[a].size;
+}
+
+VkDeviceSize TransientAllocator::peakBytes() const {
+    VkDeviceSize total = 0;
+    for (const auto& block: memoryBlocks) {
+        total += block.size;
+    }
+    return total;
+}
@@ -0,0 +1,64 @@
+//
+//  TransientAllocator.hpp
+//  vk-triangle
+//
+//  Created by Kai Chen on 10/18/26.
+//
+
+#ifndef TransientAllocator_hpp
+#define TransientAllocator_hpp
+
+#include <vulkan/vulkan.h>
+
+#include <cstdint>
+#include <span>
+#include <vector>
+
+// Places the transient resources of a frame into shared memory blocks, one per memory type.
+//
+// Each request is live from its first to its last pass (inclusive). Requests whose lifetimes
+// don't overlap may be placed at overlapping offsets, so the block only has to be as large as
+// the most memory live at any one point of the frame instead of the sum of all requests.
+// Placement only computes offsets, the caller allocates the blocks and binds the resources.
+class TransientAllocator {
+public:
+    struct Request {
+        VkDeviceSize size = 0;
+        VkDeviceSize alignment = 1;
+        uint32_t memoryType = 0;
+        uint32_t firstUse = 0;
+        uint32_t lastUse = 0;
+    };
+
+    struct Placement {
+        // Index into blocks()
+        uint32_t block = 0;
+        VkDeviceSize offset = 0;
+    };
+
+    struct Block {
+        uint32_t memoryType = 0;
+        VkDeviceSize size = 0;
+    };
+
+    // Replaces any previous placement. Placements are indexed like `requests`.
+    void place(std::span<const Request> requests);
+
+    const std::vector<Placement>& placements() const { return placed; }
+    const std::vector<Block>& blocks() const { return memoryBlocks; }
+    // Whether requests `a` and `b` share any bytes.
+    bool overlaps(size_t a, size_t b) const;
+
+    // Memory with aliasing, the sum of the block sizes
+    VkDeviceSize peakBytes() const;
+    // Memory without aliasing, every request in its own allocation
+    VkDeviceSize naiveBytes() const { return naive; }
+
+private:
+    std::vector<Request> requests;
+    std::vector<Placement> placed;
+    std::vector<Block> memoryBlocks;
+    VkDeviceSize naive = 0;
+};
+
+#endif /* TransientAllocator_hpp */
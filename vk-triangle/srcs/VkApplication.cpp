@@ -9,30 +9,115 @@
 
 #include <iostream>
 #include <string>
-#include <fstream>
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstdlib>
+#include <filesystem>
+#include <limits>
+
+#include "DeviceBenchmark.hpp"
+#include "Formats.hpp"
 
 #define GLFW_INCLUDE_VULKAN
 #include <GLFW/glfw3.h>
 
 const int MAX_FRAMES_IN_FLIGHT = 2;
+// Clamped to what the device supports, VK_SAMPLE_COUNT_1_BIT renders straight to the swapchain
+const VkSampleCountFlagBits MSAA_SAMPLES = VK_SAMPLE_COUNT_4_BIT;
+// Depth is cleared to 0 and compared with GREATER_OR_EQUAL, which spreads float precision evenly over the depth range
+const bool REVERSED_Z = true;
+// Lay down depth first with color writes off, then shade only the visible fragments with an EQUAL depth test
+const bool DEPTH_PREPASS = false;
+// Each window gets its own surface and swapchain, all of them are drawn by one command buffer and presented together
+const uint32_t WINDOW_COUNT = 1;
+// Let every other GPU render a share of the first window's frames, composited on the presenting device
+const bool MULTI_GPU = false;
+const MultiDeviceRenderer::Mode MULTI_GPU_MODE = MultiDeviceRenderer::Mode::AlternateFrame;
+// Pick the device that draws the scene fastest in a short benchmark instead of the first suitable one.
+// Results are kept per device and driver version in DEVICE_SCORE_CACHE, in the user's cache directory
+const bool BENCHMARK_DEVICES = false;
+const char* const DEVICE_SCORE_CACHE = "device-scores.txt";
+// The driver's pipeline cache, kept between runs so pipelines (including ones given by shader module identifier) hit.
+// The file is in the user's cache directory
+const char* const PIPELINE_CACHE_FILE = "pipeline-cache.bin";
+// Time this many command recording calls through the loader and through the dispatch table at startup, 0 skips it
+const uint32_t DISPATCH_BENCHMARK_CALLS = 0;
+// Give the driver its host memory from HostAllocator instead of malloc, and print what it allocated
+// every HOST_ALLOCATION_REPORT_FRAMES frames (0 only warns about leaks on exit)
+const bool TRACK_HOST_ALLOCATIONS = false;
+const uint32_t HOST_ALLOCATION_REPORT_FRAMES = 600;
+// Stack memory for the vkb builders' temporary arrays during device bring-up, anything past it goes to the heap
+const size_t BRINGUP_SCRATCH_SIZE = 16 * 1024;
+
+namespace {
+
+// Where a file kept between runs goes: the user's cache directory ($XDG_CACHE_HOME, ~/Library/Caches
+// on macOS, ~/.cache elsewhere), so it doesn't depend on where the app is launched from. The directory
+// is created if it's missing. Empty when there's nowhere to put it, which keeps the cache in memory.
+std::string cachePath(const char* name) {
+    std::filesystem::path directory;
+    const char* xdgCache = std::getenv("XDG_CACHE_HOME");
+    const char* home = std::getenv("HOME");
+    if (xdgCache != nullptr && *xdgCache != '\0') {
+        directory = xdgCache;
+    } else if (home != nullptr && *home != '\0') {
+#if defined(__APPLE__)
+        directory = std::filesystem::path(home) / "Library" / "Caches";
+#else
+        directory = std::filesystem::path(home) / ".cache";
+#endif
+    } else {
+        return {};
+    }
+    directory /= "vk-triangle";
+
+    std::error_code error;
+    std::filesystem::create_directories(directory, error);
+    if (error) {
+        std::cout << "cache: can't create " << directory.string() << ": " << error.message() << std::endl;
+        return {};
+    }
+    return (directory / name).string();
+}
+
+} // namespace
 
 void VkApplication::run() {
-    initWindow();
+    initWindows();
     initVulkan();
     mainLoop();
     cleanup();
 }
 
-void VkApplication::initWindow() {
+void VkApplication::initWindows() {
     glfwInit();
     glfwWindowHint(GLFW_CLIENT_API, GLFW_NO_API);
     glfwWindowHint(GLFW_RESIZABLE, GLFW_FALSE);
     
-    window = glfwCreateWindow(800, 600, "Vulkan Triangle", nullptr, nullptr);
+    windows.resize(WINDOW_COUNT);
+    for (uint32_t i = 0; i < WINDOW_COUNT; i++) {
+        std::string title = "Vulkan Triangle";
+        if (WINDOW_COUNT > 1) {
+            title += " " + std::to_string(i + 1);
+        }
+        windows[i].handle = glfwCreateWindow(800, 600, title.c_str(), nullptr, nullptr);
+        if (windows[i].handle == nullptr) {
+            throw std::runtime_error("failed to create window " + std::to_string(i));
+        }
+        // Side by side instead of stacked on top of each other
+        glfwSetWindowPos(windows[i].handle, 40 + static_cast<int>(i) * 820, 40);
+    }
 }
 
 void VkApplication::mainLoop() {
-    while (!glfwWindowShouldClose(window)) {
+    // Closing any of the windows ends the app
+    auto shouldClose = [this] () {
+        return std::any_of(windows.begin(), windows.end(), [] (const Window& window) {
+            return glfwWindowShouldClose(window.handle);
+        });
+    };
+    while (!shouldClose()) {
         glfwPollEvents();
         drawFrame();
     }
@@ -43,61 +128,91 @@ void VkApplication::cleanup() {
     auto device = vkbDevice.device;
     
     for (size_t i = 0; i < MAX_FRAMES_IN_FLIGHT; i++) {
-        vkDestroySemaphore(device, data.finishedSemaphores[i], nullptr);
-        vkDestroySemaphore(device, data.availableSemaphores[i], nullptr);
-        vkDestroyFence(device, data.inflightFences[i], nullptr);
+        vkDestroySemaphore(device, data.sceneSemaphores[i], allocator());
+        vkDestroySemaphore(device, data.finishedSemaphores[i], allocator());
+        vkDestroyFence(device, data.inflightFences[i], allocator());
+        for (auto& window: windows) {
+            vkDestroySemaphore(device, window.availableSemaphores[i], allocator());
+        }
     }
 
-    vkDestroyCommandPool(device, data.commandPool, nullptr);
+    vkDestroyCommandPool(device, data.commandPool, allocator());
     
-    for (auto framebuffer: data.framebuffers) {
-        vkDestroyFramebuffer(device, framebuffer, nullptr);
+    multiGpu.destroy();
+    
+    for (auto& window: windows) {
+        destroyFramebuffers(window);
     }
     
-    vkDestroyPipeline(device, data.graphicsPipeline, nullptr);
-    vkDestroyPipelineLayout(device, data.pipelineLayout, nullptr);
-    vkDestroyRenderPass(device, data.renderPass, nullptr);
+    pipelines.destroy();
+    vkDestroyPipelineLayout(device, data.pipelineLayout, allocator());
+    shaderModules.destroy();
+    vkDestroyRenderPass(device, data.renderPass, allocator());
     
-    for (auto imageView: data.imageViews) {
-        vkDestroyImageView(device, imageView, nullptr);
+    for (auto& window: windows) {
+        destroyRenderTargets(window);
+        window.swapchain.destroy_image_views(window.imageViews);
+        vkb::destroy_swapchain(window.swapchain);
     }
-    
-    vkb::destroy_swapchain(vkbSwapchain);
     vkb::destroy_device(vkbDevice);
-    vkb::destroy_surface(vkbInstance, vkSurface);
+    for (auto& window: windows) {
+        vkb::destroy_surface(vkbInstance, window.surface);
+    }
     vkb::destroy_instance(vkbInstance);
     
-    glfwDestroyWindow(window);
+    for (auto& window: windows) {
+        glfwDestroyWindow(window.handle);
+    }
     glfwTerminate();
 }
 
 void VkApplication::initVulkan() {
+    // Ahead of the device, the device benchmark draws with these shaders
+    shaderArchive = ShaderArchive::loadEmbedded();
     createDevice();
-    createSwapchain();
+    for (auto& window: windows) {
+        createSwapchain(window);
+    }
     initQueues();
     createRenderPass();
+    loadShaders();
     createGraphicsPipeline();
-    createFramebuffers();
+    for (auto& window: windows) {
+        createRenderTargets(window);
+        createFramebuffers(window);
+    }
     createCommandPool();
     createCommandBuffers();
     createSyncObjects();
+    if (DISPATCH_BENCHMARK_CALLS > 0) {
+        benchmarkDispatch();
+    }
+    if (MULTI_GPU) {
+        initMultiGpu();
+    }
+    
+    // Pipelines from here on are created from module identifiers, the SPIR-V isn't needed by the driver anymore
+    if (shaderModules.identifiersEnabled()) {
+        shaderModules.releaseModules();
+    }
 }
 
 void VkApplication::createDevice() {
+    alignas(std::max_align_t) std::byte scratch[BRINGUP_SCRATCH_SIZE];
+    vkb::ScratchArena scratchArena { scratch, sizeof(scratch) };
+    
     vkb::InstanceBuilder builder;
     auto instance = builder
+        .set_allocation_callbacks(allocator())
+        .set_scratch_arena(&scratchArena)
         .set_app_name("Vulkan Triangle")
+        .set_minimum_instance_version(1, 1)
+        .require_api_version(1, 3)
 //        .use_default_debug_messenger()
         .request_validation_layers()
-        .set_debug_callback([] (VkDebugUtilsMessageSeverityFlagBitsEXT messageSeverity,
-                                VkDebugUtilsMessageTypeFlagsEXT messageType,
-                                const VkDebugUtilsMessengerCallbackDataEXT* pCallbackData,
-                                void* pUserData) -> VkBool32 {
-            auto severity = vkb::to_string_message_severity(messageSeverity);
-            auto type = vkb::to_string_message_type(messageType);
-            std::cout << "[" << severity << ": " << type << "] "<< pCallbackData->pMessage << std::endl;
-            return VK_FALSE;
-        })
+        // Queued from inside the driver calls and printed by the log's own thread
+        .set_debug_callback(DebugLog::callback)
+        .set_debug_callback_user_data_pointer(&debugLog)
         .build();
     if (!instance) {
         std::cout << instance.error().message() << std::endl;
@@ -106,24 +221,199 @@ void VkApplication::createDevice() {
     
     vkbInstance = instance.value();
     
-    // Create surface
-    if (glfwCreateWindowSurface(vkbInstance.instance, window, nullptr, &vkSurface) != VK_SUCCESS) {
-        throw std::runtime_error("failed to create window surface");
+    // Create surfaces
+    for (auto& window: windows) {
+        if (glfwCreateWindowSurface(vkbInstance.instance, window.handle, allocator(), &window.surface) != VK_SUCCESS) {
+            throw std::runtime_error("failed to create window surface");
+        }
     }
     
+    // A frame is the scene's triangle over every window, twice with the depth pre-pass
+    DeviceBenchmark::Workload workload;
+    workload.triangles = WINDOW_COUNT * (DEPTH_PREPASS ? 2 : 1);
+    workload.pixels = 800.0 * 600.0 * workload.triangles;
+    DeviceBenchmark benchmark { shaderArchive, cachePath(DEVICE_SCORE_CACHE), workload, allocator() };
+    
     // Physical device
-    vkb::PhysicalDeviceSelector seletor(vkbInstance);
-    auto physDevice = seletor
-        .set_surface(vkSurface)
-        .set_minimum_version(1, 1)
-        .select();
+    auto selectDevice = [this, &benchmark, &scratchArena] (bool requireVulkan13) {
+        vkb::PhysicalDeviceSelector seletor(vkbInstance);
+        seletor
+            .set_scratch_arena(&scratchArena)
+            .set_surface(windows.front().surface)
+            .set_minimum_version(1, 1);
+        if (BENCHMARK_DEVICES) {
+            seletor.set_device_scorer([&benchmark] (const vkb::PhysicalDevice& physicalDevice) {
+                return benchmark.score(physicalDevice);
+            });
+        }
+#if defined(VK_EXT_shader_module_identifier)
+        seletor.add_desired_extension(VK_EXT_SHADER_MODULE_IDENTIFIER_EXTENSION_NAME);
+#endif
+#if defined(VK_EXT_graphics_pipeline_library)
+        seletor
+            .add_desired_extension(VK_KHR_PIPELINE_LIBRARY_EXTENSION_NAME)
+            .add_desired_extension(VK_EXT_GRAPHICS_PIPELINE_LIBRARY_EXTENSION_NAME);
+#endif
+#if defined(VKB_VK_API_VERSION_1_3)
+        if (requireVulkan13) {
+            VkPhysicalDeviceVulkan13Features features13 = {};
+            features13.dynamicRendering = VK_TRUE;
+            features13.synchronization2 = VK_TRUE;
+            // Required by every 1.3 implementation
+            features13.pipelineCreationCacheControl = VK_TRUE;
+            seletor
+                .set_minimum_version(1, 3)
+                .set_required_features_13(features13);
+        }
+#endif
+        // Core in 1.3
+        if (!requireVulkan13) {
+#if defined(VK_KHR_dynamic_rendering)
+            // With the extensions it requires, the resolve modes of the MSAA resolve come from depth_stencil_resolve
+            seletor
+                .add_desired_extension(VK_KHR_CREATE_RENDERPASS_2_EXTENSION_NAME)
+                .add_desired_extension(VK_KHR_DEPTH_STENCIL_RESOLVE_EXTENSION_NAME)
+                .add_desired_extension(VK_KHR_DYNAMIC_RENDERING_EXTENSION_NAME);
+#endif
+#if defined(VK_EXT_extended_dynamic_state)
+            seletor.add_desired_extension(VK_EXT_EXTENDED_DYNAMIC_STATE_EXTENSION_NAME);
+#endif
+#if defined(VK_KHR_synchronization2)
+            seletor.add_desired_extension(VK_KHR_SYNCHRONIZATION_2_EXTENSION_NAME);
+#endif
+#if defined(VK_EXT_shader_module_identifier)
+            seletor.add_desired_extension(VK_EXT_PIPELINE_CREATION_CACHE_CONTROL_EXTENSION_NAME);
+#endif
+        }
+        return seletor.select();
+    };
+    
+    // Prefer a 1.3 device with core dynamic rendering, otherwise take any 1.1 device (MoltenVK)
+    // and use VK_KHR_dynamic_rendering if it has it, or render passes if it doesn't
+    bool vulkan13 = false;
+#if defined(VKB_VK_API_VERSION_1_3)
+    auto physDevice = selectDevice(true);
+    vulkan13 = physDevice.has_value();
+    if (!vulkan13) {
+        physDevice = selectDevice(false);
+    }
+#else
+    auto physDevice = selectDevice(false);
+#endif
     if (!physDevice) {
         std::cout << physDevice.error().message() << std::endl;
         throw std::runtime_error(physDevice.error().message());
     }
+    benchmark.save();
+    
+    // Desired extensions are enabled when supported, their features still have to be queried and enabled
+    auto extensions = physDevice.value().get_extensions();
+    auto hasExtension = [&extensions] (const char* name) {
+        return std::find(extensions.begin(), extensions.end(), name) != extensions.end();
+    };
     
-    // Device
     vkb::DeviceBuilder deviceBuilder { physDevice.value() };
+    deviceBuilder.set_allocation_callbacks(allocator());
+    deviceBuilder.set_scratch_arena(&scratchArena);
+    
+#if defined(VK_EXT_shader_module_identifier)
+    VkPhysicalDevicePipelineCreationCacheControlFeaturesEXT cacheControlFeatures = {};
+    cacheControlFeatures.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PIPELINE_CREATION_CACHE_CONTROL_FEATURES_EXT;
+    VkPhysicalDeviceShaderModuleIdentifierFeaturesEXT identifierFeatures = {};
+    identifierFeatures.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_MODULE_IDENTIFIER_FEATURES_EXT;
+    // Cache control is core in 1.3 and enabled through the 1.3 features, the extension struct can't be chained next to them
+    if ((vulkan13 || hasExtension(VK_EXT_PIPELINE_CREATION_CACHE_CONTROL_EXTENSION_NAME)) &&
+        hasExtension(VK_EXT_SHADER_MODULE_IDENTIFIER_EXTENSION_NAME)) {
+        identifierFeatures.pNext = vulkan13 ? nullptr : &cacheControlFeatures;
+        VkPhysicalDeviceFeatures2 features = {};
+        features.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FEATURES_2;
+        features.pNext = &identifierFeatures;
+        vkGetPhysicalDeviceFeatures2(physDevice.value(), &features);
+        identifierFeatures.pNext = nullptr;
+        
+        support.shaderModuleIdentifier = identifierFeatures.shaderModuleIdentifier &&
+            (vulkan13 || cacheControlFeatures.pipelineCreationCacheControl);
+        if (support.shaderModuleIdentifier) {
+            deviceBuilder.add_pNext(&identifierFeatures);
+            if (!vulkan13) {
+                deviceBuilder.add_pNext(&cacheControlFeatures);
+            }
+        }
+    }
+#endif
+    
+    support.dynamicRendering = vulkan13;
+#if defined(VK_KHR_dynamic_rendering)
+    VkPhysicalDeviceDynamicRenderingFeaturesKHR dynamicRenderingFeatures = {};
+    dynamicRenderingFeatures.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DYNAMIC_RENDERING_FEATURES_KHR;
+    // Without everything it depends on it stays off and frames use render passes
+    if (!vulkan13 && hasExtension(VK_KHR_DYNAMIC_RENDERING_EXTENSION_NAME) &&
+        hasExtension(VK_KHR_DEPTH_STENCIL_RESOLVE_EXTENSION_NAME) &&
+        hasExtension(VK_KHR_CREATE_RENDERPASS_2_EXTENSION_NAME)) {
+        VkPhysicalDeviceFeatures2 features = {};
+        features.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FEATURES_2;
+        features.pNext = &dynamicRenderingFeatures;
+        vkGetPhysicalDeviceFeatures2(physDevice.value(), &features);
+        
+        support.dynamicRendering = dynamicRenderingFeatures.dynamicRendering;
+        if (support.dynamicRendering) {
+            deviceBuilder.add_pNext(&dynamicRenderingFeatures);
+        }
+    }
+#endif
+    
+    support.extendedDynamicState = vulkan13;
+#if defined(VK_EXT_extended_dynamic_state)
+    VkPhysicalDeviceExtendedDynamicStateFeaturesEXT dynamicStateFeatures = {};
+    dynamicStateFeatures.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_EXTENDED_DYNAMIC_STATE_FEATURES_EXT;
+    if (!vulkan13 && hasExtension(VK_EXT_EXTENDED_DYNAMIC_STATE_EXTENSION_NAME)) {
+        VkPhysicalDeviceFeatures2 features = {};
+        features.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FEATURES_2;
+        features.pNext = &dynamicStateFeatures;
+        vkGetPhysicalDeviceFeatures2(physDevice.value(), &features);
+        
+        support.extendedDynamicState = dynamicStateFeatures.extendedDynamicState;
+        if (support.extendedDynamicState) {
+            deviceBuilder.add_pNext(&dynamicStateFeatures);
+        }
+    }
+#endif
+    
+    support.synchronization2 = vulkan13;
+#if defined(VK_KHR_synchronization2)
+    VkPhysicalDeviceSynchronization2FeaturesKHR synchronization2Features = {};
+    synchronization2Features.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SYNCHRONIZATION_2_FEATURES_KHR;
+    if (!vulkan13 && hasExtension(VK_KHR_SYNCHRONIZATION_2_EXTENSION_NAME)) {
+        VkPhysicalDeviceFeatures2 features = {};
+        features.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FEATURES_2;
+        features.pNext = &synchronization2Features;
+        vkGetPhysicalDeviceFeatures2(physDevice.value(), &features);
+        
+        support.synchronization2 = synchronization2Features.synchronization2;
+        if (support.synchronization2) {
+            deviceBuilder.add_pNext(&synchronization2Features);
+        }
+    }
+#endif
+    
+#if defined(VK_EXT_graphics_pipeline_library)
+    VkPhysicalDeviceGraphicsPipelineLibraryFeaturesEXT libraryFeatures = {};
+    libraryFeatures.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_GRAPHICS_PIPELINE_LIBRARY_FEATURES_EXT;
+    if (hasExtension(VK_KHR_PIPELINE_LIBRARY_EXTENSION_NAME) &&
+        hasExtension(VK_EXT_GRAPHICS_PIPELINE_LIBRARY_EXTENSION_NAME)) {
+        VkPhysicalDeviceFeatures2 features = {};
+        features.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FEATURES_2;
+        features.pNext = &libraryFeatures;
+        vkGetPhysicalDeviceFeatures2(physDevice.value(), &features);
+        
+        support.graphicsPipelineLibrary = libraryFeatures.graphicsPipelineLibrary;
+        if (support.graphicsPipelineLibrary) {
+            deviceBuilder.add_pNext(&libraryFeatures);
+        }
+    }
+#endif
+    
+    // Device
     auto device = deviceBuilder.build();
     if (!device) {
         std::cout << device.error().message() << std::endl;
@@ -131,21 +421,87 @@ void VkApplication::createDevice() {
     }
     
     vkbDevice = device.value();
+    dispatch = FrameDispatch { vkbDevice.device, vkbDevice.fp_vkGetDeviceProcAddr };
+    
+    if (scratchArena.heap_allocations() > 0) {
+        std::cout << "bring-up: " << scratchArena.heap_allocations() << " builder allocations didn't fit in "
+                  << BRINGUP_SCRATCH_SIZE << " bytes of scratch (peak " << scratchArena.peak() << " bytes)" << std::endl;
+    }
+    
+    // The device is picked for the first window, the present queue has to reach the others too
+    auto presentIndex = vkbDevice.get_queue_index(vkb::QueueType::present).value();
+    for (size_t i = 1; i < windows.size(); i++) {
+        VkBool32 supported = VK_FALSE;
+        vkGetPhysicalDeviceSurfaceSupportKHR(vkbDevice.physical_device, presentIndex, windows[i].surface, &supported);
+        if (!supported) {
+            throw std::runtime_error("present queue can't present to window " + std::to_string(i));
+        }
+    }
+    
+    // Highest supported count up to MSAA_SAMPLES
+    auto& limits = vkbDevice.physical_device.properties.limits;
+    VkSampleCountFlags supportedSamples = limits.framebufferColorSampleCounts & limits.framebufferDepthSampleCounts;
+    data.samples = VK_SAMPLE_COUNT_1_BIT;
+    for (VkSampleCountFlags count = MSAA_SAMPLES; count > VK_SAMPLE_COUNT_1_BIT; count >>= 1) {
+        if (supportedSamples & count) {
+            data.samples = static_cast<VkSampleCountFlagBits>(count);
+            break;
+        }
+    }
+    
+    data.depthFormat = findDepthFormat();
     
+#if defined(VK_KHR_dynamic_rendering)
+    if (support.dynamicRendering) {
+        auto gdpa = vkbDevice.fp_vkGetDeviceProcAddr;
+        fp_vkCmdBeginRendering = reinterpret_cast<PFN_vkCmdBeginRenderingKHR>(
+            gdpa(vkbDevice.device, vulkan13 ? "vkCmdBeginRendering" : "vkCmdBeginRenderingKHR"));
+        fp_vkCmdEndRendering = reinterpret_cast<PFN_vkCmdEndRenderingKHR>(
+            gdpa(vkbDevice.device, vulkan13 ? "vkCmdEndRendering" : "vkCmdEndRenderingKHR"));
+        support.dynamicRendering = fp_vkCmdBeginRendering != nullptr && fp_vkCmdEndRendering != nullptr;
+    }
+#else
+    support.dynamicRendering = false;
+#endif
+    
+#if defined(VK_KHR_synchronization2)
+    if (support.synchronization2) {
+        fp_vkCmdPipelineBarrier2 = reinterpret_cast<PFN_vkCmdPipelineBarrier2KHR>(
+            vkbDevice.fp_vkGetDeviceProcAddr(vkbDevice.device, vulkan13 ? "vkCmdPipelineBarrier2" : "vkCmdPipelineBarrier2KHR"));
+        support.synchronization2 = fp_vkCmdPipelineBarrier2 != nullptr;
+    }
+#else
+    support.synchronization2 = false;
+#endif
 }
 
-void VkApplication::createSwapchain() {
-    vkb::SwapchainBuilder builder { vkbDevice };
-    auto swapchain = builder
-        .set_old_swapchain(vkbSwapchain)
-        .build();
+void VkApplication::createSwapchain(Window& window) {
+    vkb::SwapchainBuilder builder { vkbDevice, window.surface };
+    builder.set_old_swapchain(window.swapchain);
+    builder.set_allocation_callbacks(allocator());
+    // Frames rendered on other GPUs are uploaded into the first window's images
+    if (MULTI_GPU && &window == &windows.front()) {
+        builder.set_image_usage_flags(VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT | VK_IMAGE_USAGE_TRANSFER_DST_BIT);
+    }
+    // Later windows ask for the format of the first, the render pass and pipelines are shared
+    if (data.colorFormat != VK_FORMAT_UNDEFINED) {
+        builder.set_desired_format({ data.colorFormat, windows.front().swapchain.color_space });
+    }
+    auto swapchain = builder.build();
     if (!swapchain) {
         std::cout << swapchain.error().message() << " " << swapchain.vk_result() << std::endl;
         throw std::runtime_error(swapchain.error().message() + " " + std::to_string(swapchain.vk_result()));
     }
         
-    vkb::destroy_swapchain(vkbSwapchain);
-    vkbSwapchain = swapchain.value();
+    vkb::destroy_swapchain(window.swapchain);
+    window.swapchain = swapchain.value();
+    
+    if (data.colorFormat == VK_FORMAT_UNDEFINED) {
+        data.colorFormat = window.swapchain.image_format;
+    } else if (window.swapchain.image_format != data.colorFormat) {
+        throw std::runtime_error("swapchain format " + std::to_string(window.swapchain.image_format) +
+                                 " differs from the other windows");
+    }
 }
 
 void VkApplication::initQueues() {
@@ -165,239 +521,334 @@ void VkApplication::initQueues() {
 }
 
 void VkApplication::createRenderPass() {
+    // Dynamic rendering renders straight to the image views, no render pass or framebuffers
+    if (support.dynamicRendering) {
+        data.renderPass = VK_NULL_HANDLE;
+        return;
+    }
+    
+    bool multisampled = data.samples != VK_SAMPLE_COUNT_1_BIT;
+    
     VkAttachmentDescription colorAttachment = {};
-    colorAttachment.format = vkbSwapchain.image_format;
-    colorAttachment.samples = VK_SAMPLE_COUNT_1_BIT;
+    colorAttachment.format = data.colorFormat;
+    colorAttachment.samples = data.samples;
     colorAttachment.loadOp = VK_ATTACHMENT_LOAD_OP_CLEAR;
-    colorAttachment.storeOp = VK_ATTACHMENT_STORE_OP_STORE;
+    colorAttachment.storeOp = multisampled ? VK_ATTACHMENT_STORE_OP_DONT_CARE : VK_ATTACHMENT_STORE_OP_STORE;
     colorAttachment.stencilLoadOp = VK_ATTACHMENT_LOAD_OP_DONT_CARE;
     colorAttachment.stencilStoreOp = VK_ATTACHMENT_STORE_OP_DONT_CARE;
     colorAttachment.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
-    colorAttachment.finalLayout = VK_IMAGE_LAYOUT_PRESENT_SRC_KHR;
+    colorAttachment.finalLayout = multisampled ? VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL : VK_IMAGE_LAYOUT_PRESENT_SRC_KHR;
+    
+    // The multisampled samples never leave the tile, only the resolved swapchain image is stored
+    VkAttachmentDescription resolveAttachment = {};
+    resolveAttachment.format = data.colorFormat;
+    resolveAttachment.samples = VK_SAMPLE_COUNT_1_BIT;
+    resolveAttachment.loadOp = VK_ATTACHMENT_LOAD_OP_DONT_CARE;
+    resolveAttachment.storeOp = VK_ATTACHMENT_STORE_OP_STORE;
+    resolveAttachment.stencilLoadOp = VK_ATTACHMENT_LOAD_OP_DONT_CARE;
+    resolveAttachment.stencilStoreOp = VK_ATTACHMENT_STORE_OP_DONT_CARE;
+    resolveAttachment.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+    resolveAttachment.finalLayout = VK_IMAGE_LAYOUT_PRESENT_SRC_KHR;
+    
+    // Depth is only needed while rendering, it's never stored
+    VkAttachmentDescription depthAttachment = {};
+    depthAttachment.format = data.depthFormat;
+    depthAttachment.samples = data.samples;
+    depthAttachment.loadOp = VK_ATTACHMENT_LOAD_OP_CLEAR;
+    depthAttachment.storeOp = VK_ATTACHMENT_STORE_OP_DONT_CARE;
+    depthAttachment.stencilLoadOp = VK_ATTACHMENT_LOAD_OP_DONT_CARE;
+    depthAttachment.stencilStoreOp = VK_ATTACHMENT_STORE_OP_DONT_CARE;
+    depthAttachment.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+    depthAttachment.finalLayout = VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL;
     
     VkAttachmentReference colorAttachmentRef = {};
     colorAttachmentRef.attachment = 0;
     colorAttachmentRef.layout = VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL;
     
+    VkAttachmentReference depthAttachmentRef = {};
+    depthAttachmentRef.attachment = 1;
+    depthAttachmentRef.layout = VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL;
+    
+    VkAttachmentReference resolveAttachmentRef = {};
+    resolveAttachmentRef.attachment = 2;
+    resolveAttachmentRef.layout = VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL;
+    
     VkSubpassDescription subpass = {};
     subpass.pipelineBindPoint = VK_PIPELINE_BIND_POINT_GRAPHICS;
     subpass.colorAttachmentCount = 1;
     subpass.pColorAttachments = &colorAttachmentRef;
+    subpass.pDepthStencilAttachment = &depthAttachmentRef;
+    subpass.pResolveAttachments = multisampled ? &resolveAttachmentRef : nullptr;
     
     VkSubpassDependency dependency = {};
     dependency.srcSubpass = VK_SUBPASS_EXTERNAL;
     dependency.dstSubpass = 0;
-    dependency.srcStageMask = VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT;
-    dependency.srcAccessMask = 0;
-    dependency.dstStageMask = VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT;
-    dependency.dstAccessMask = VK_ACCESS_COLOR_ATTACHMENT_READ_BIT | VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT;
+    dependency.srcStageMask = VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT | VK_PIPELINE_STAGE_LATE_FRAGMENT_TESTS_BIT;
+    dependency.srcAccessMask = VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_WRITE_BIT;
+    dependency.dstStageMask = VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT | VK_PIPELINE_STAGE_EARLY_FRAGMENT_TESTS_BIT;
+    dependency.dstAccessMask = VK_ACCESS_COLOR_ATTACHMENT_READ_BIT | VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT |
+                               VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_READ_BIT | VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_WRITE_BIT;
+    
+    VkAttachmentDescription attachments[] = { colorAttachment, depthAttachment, resolveAttachment };
     
     VkRenderPassCreateInfo renderPassInfo = {};
     renderPassInfo.sType = VK_STRUCTURE_TYPE_RENDER_PASS_CREATE_INFO;
-    renderPassInfo.attachmentCount = 1;
-    renderPassInfo.pAttachments = &colorAttachment;
+    renderPassInfo.attachmentCount = multisampled ? 3 : 2;
+    renderPassInfo.pAttachments = attachments;
     renderPassInfo.subpassCount = 1;
     renderPassInfo.pSubpasses = &subpass;
     renderPassInfo.dependencyCount = 1;
     renderPassInfo.pDependencies = &dependency;
     
-    if (vkCreateRenderPass(vkbDevice.device, &renderPassInfo, nullptr, &data.renderPass) != VK_SUCCESS) {
+    if (vkCreateRenderPass(vkbDevice.device, &renderPassInfo, allocator(), &data.renderPass) != VK_SUCCESS) {
         throw std::runtime_error("failed to create render pass");
     }
 }
 
-std::vector<char> VkApplication::readFile(const std::string &filename) {
-    std::ifstream file(filename, std::ios::ate | std::ios::binary);
-    if (!file.is_open()) {
-        throw std::runtime_error("failed to open file: " + filename) ;
+void VkApplication::loadShaders() {
+    shaderModules.init(vkbDevice.device, vkbDevice.fp_vkGetDeviceProcAddr, support.shaderModuleIdentifier, allocator());
+    
+    GraphicsPipelineCache::Options options;
+    options.useLibraries = support.graphicsPipelineLibrary;
+    options.extendedDynamicState = support.extendedDynamicState;
+    options.cacheFile = cachePath(PIPELINE_CACHE_FILE);
+    options.allocationCallbacks = allocator();
+    pipelines.init(vkbDevice.device, vkbDevice.fp_vkGetDeviceProcAddr, &shaderModules, options);
+}
+
+void VkApplication::createGraphicsPipeline() {
+    const auto& vertShader = shaderArchive.get("vert");
+    const auto& fragShader = shaderArchive.get("frag");
+    
+    // Push constant ranges come from the reflection data stored in the archive
+    auto& push_constant_ranges = data.pushConstantRanges;
+    push_constant_ranges.clear();
+    for (const auto* shader: { &vertShader, &fragShader }) {
+        for (const auto& record: shader->pushConstants) {
+            push_constant_ranges.push_back({ static_cast<VkShaderStageFlags>(shader->stage), record.offset, record.size });
+        }
     }
     
-    size_t filesize = (size_t)file.tellg();
-    std::vector<char> buffer(filesize);
-    file.seekg(0);
-    file.read(buffer.data(), static_cast<std::streamsize>(filesize));
+    VkPipelineLayoutCreateInfo pipeline_layout_info = {};
+    pipeline_layout_info.sType = VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO;
+    pipeline_layout_info.setLayoutCount = 0;
+    pipeline_layout_info.pushConstantRangeCount = static_cast<uint32_t>(push_constant_ranges.size());
+    pipeline_layout_info.pPushConstantRanges = push_constant_ranges.data();
     
-    file.close();
+    if (vkCreatePipelineLayout(vkbDevice.device, &pipeline_layout_info, allocator(), &data.pipelineLayout) != VK_SUCCESS) {
+        std::cout << "failed to create pipeline layout" << std::endl;
+        throw std::runtime_error("failed to create pipeline layout");
+    }
     
-    return buffer;
+    GraphicsPipelineDesc desc;
+    desc.vertexShader = &vertShader;
+    desc.fragmentShader = &fragShader;
+    desc.layout = data.pipelineLayout;
+    desc.target.colorFormat = data.colorFormat;
+    desc.target.samples = data.samples;
+    desc.target.depthFormat = data.depthFormat;
+    desc.depth.testEnable = VK_TRUE;
+    desc.depth.writeEnable = VK_TRUE;
+    desc.depth.compareOp = REVERSED_Z ? VK_COMPARE_OP_GREATER_OR_EQUAL : VK_COMPARE_OP_LESS_OR_EQUAL;
+    
+    // Single pass with depth writes, compiled up front. It's all the scene needs without the pre-pass,
+    // and one pipeline instead of two stands in for the pre-pass pair while they compile
+    data.fallbackDesc = desc;
+    data.pipelineDesc = desc;
+    data.prepassDesc = desc;
+    data.graphicsPipeline = pipelines.get(data.fallbackDesc, data.renderPass);
+    data.scenePipeline = data.graphicsPipeline;
+    data.sceneDesc = &data.fallbackDesc;
+    data.prepassPipeline = VK_NULL_HANDLE;
+    data.pipelinePending = false;
+    
+    if (DEPTH_PREPASS) {
+        data.prepassDesc.blend.writeMask = 0;
+        data.pipelineDesc.depth.writeEnable = VK_FALSE;
+        data.pipelineDesc.depth.compareOp = VK_COMPARE_OP_EQUAL;
+        
+        // Queued on the workers, the first frames draw the fallback until both are ready
+        const GraphicsPipelineDesc prewarmList[] = { data.pipelineDesc, data.prepassDesc };
+        pipelines.prewarm(prewarmList, data.renderPass);
+        data.pipelinePending = true;
+    }
 }
 
-VkShaderModule VkApplication::createShaderModule(const std::vector<char>& code) {
-    VkShaderModuleCreateInfo createInfo = {};
-    createInfo.sType = VK_STRUCTURE_TYPE_SHADER_MODULE_CREATE_INFO;
-    createInfo.codeSize = code.size();
-    createInfo.pCode = reinterpret_cast<const uint32_t*>(code.data());
-    
-    VkShaderModule shaderModule;
-    if (vkCreateShaderModule(vkbDevice.device, &createInfo, nullptr, &shaderModule) != VK_SUCCESS) {
-        return VK_NULL_HANDLE;
+uint32_t VkApplication::findMemoryType(uint32_t typeBits, VkMemoryPropertyFlags properties) {
+    const auto& memoryProperties = vkbDevice.physical_device.memory_properties;
+    for (uint32_t i = 0; i < memoryProperties.memoryTypeCount; i++) {
+        if ((typeBits & (1u << i)) && (memoryProperties.memoryTypes[i].propertyFlags & properties) == properties) {
+            return i;
+        }
     }
-    
-    return shaderModule;
+    return UINT32_MAX;
 }
 
-void VkApplication::createGraphicsPipeline() {
-    auto vertCode = readFile("shaders/vert.spv");
-    auto fragCode = readFile("shaders/frag.spv");
-    
-    VkShaderModule vertModule = createShaderModule(vertCode);
-    VkShaderModule fragModule = createShaderModule(fragCode);
+void VkApplication::createAttachment(VkFormat format, VkExtent2D extent, VkSampleCountFlagBits samples, VkImageUsageFlags usage,
+                                     VkImageAspectFlags aspect, Attachment& attachment) {
+    auto device = vkbDevice.device;
     
-    if (VK_NULL_HANDLE == vertModule || VK_NULL_HANDLE == fragModule) {
-        std::cout << "failed to create shader module" << std::endl;
-        throw std::runtime_error("failed to create shader module");
+    VkImageCreateInfo imageInfo = {};
+    imageInfo.sType = VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO;
+    imageInfo.imageType = VK_IMAGE_TYPE_2D;
+    imageInfo.format = format;
+    imageInfo.extent = { extent.width, extent.height, 1 };
+    imageInfo.mipLevels = 1;
+    imageInfo.arrayLayers = 1;
+    imageInfo.samples = samples;
+    imageInfo.tiling = VK_IMAGE_TILING_OPTIMAL;
+    imageInfo.usage = usage;
+    imageInfo.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+    imageInfo.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+    
+    if (vkCreateImage(device, &imageInfo, allocator(), &attachment.image) != VK_SUCCESS) {
+        throw std::runtime_error("failed to create attachment image");
     }
     
-    VkPipelineShaderStageCreateInfo vert_stage_info = {};
-    vert_stage_info.sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO;
-    vert_stage_info.stage = VK_SHADER_STAGE_VERTEX_BIT;
-    vert_stage_info.module = vertModule;
-    vert_stage_info.pName = "main";
-    
-    VkPipelineShaderStageCreateInfo frag_stage_info = {};
-    frag_stage_info.sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO;
-    frag_stage_info.stage = VK_SHADER_STAGE_FRAGMENT_BIT;
-    frag_stage_info.module = fragModule;
-    frag_stage_info.pName = "main";
-    
-    VkPipelineShaderStageCreateInfo shader_stages[] = { vert_stage_info, frag_stage_info };
-    
-    VkPipelineVertexInputStateCreateInfo vertex_input_info = {};
-    vertex_input_info.sType = VK_STRUCTURE_TYPE_PIPELINE_VERTEX_INPUT_STATE_CREATE_INFO;
-    vertex_input_info.vertexBindingDescriptionCount = 0;
-    vertex_input_info.vertexAttributeDescriptionCount = 0;
-    
-    VkPipelineInputAssemblyStateCreateInfo input_assembly = {};
-    input_assembly.sType = VK_STRUCTURE_TYPE_PIPELINE_INPUT_ASSEMBLY_STATE_CREATE_INFO;
-    input_assembly.topology = VK_PRIMITIVE_TOPOLOGY_TRIANGLE_LIST;
-    input_assembly.primitiveRestartEnable = VK_FALSE;
+    VkMemoryRequirements requirements;
+    vkGetImageMemoryRequirements(device, attachment.image, &requirements);
     
-    VkViewport viewport = {};
-    viewport.x = 0.0f;
-    viewport.y = 0.0f;
-    viewport.width = (float)vkbSwapchain.extent.width;
-    viewport.height = (float)vkbSwapchain.extent.height;
-    viewport.minDepth = 0.0f;
-    viewport.maxDepth = 1.0f;
-    
-    VkRect2D scissor = {};
-    scissor.offset = { 0, 0 };
-    scissor.extent = vkbSwapchain.extent;
-    
-    VkPipelineViewportStateCreateInfo viewport_state = {};
-    viewport_state.sType = VK_STRUCTURE_TYPE_PIPELINE_VIEWPORT_STATE_CREATE_INFO;
-    viewport_state.viewportCount = 1;
-    viewport_state.pViewports = &viewport;
-    viewport_state.scissorCount = 1;
-    viewport_state.pScissors = &scissor;
-    
-    VkPipelineRasterizationStateCreateInfo rasterizer = {};
-    rasterizer.sType = VK_STRUCTURE_TYPE_PIPELINE_RASTERIZATION_STATE_CREATE_INFO;
-    rasterizer.depthClampEnable = VK_FALSE;
-    rasterizer.rasterizerDiscardEnable = VK_FALSE;
-    rasterizer.polygonMode = VK_POLYGON_MODE_FILL;
-    rasterizer.lineWidth = 1.0f;
-    rasterizer.cullMode = VK_CULL_MODE_BACK_BIT;
-    rasterizer.frontFace = VK_FRONT_FACE_CLOCKWISE;
-    rasterizer.depthBiasEnable = VK_FALSE;
-    
-    VkPipelineMultisampleStateCreateInfo multisampling = {};
-    multisampling.sType = VK_STRUCTURE_TYPE_PIPELINE_MULTISAMPLE_STATE_CREATE_INFO;
-    multisampling.sampleShadingEnable = VK_FALSE;
-    multisampling.rasterizationSamples = VK_SAMPLE_COUNT_1_BIT;
-    
-    VkPipelineColorBlendAttachmentState colorBlendAttachment = {};
-    colorBlendAttachment.colorWriteMask = VK_COLOR_COMPONENT_R_BIT | VK_COLOR_COMPONENT_G_BIT |
-    VK_COLOR_COMPONENT_B_BIT | VK_COLOR_COMPONENT_A_BIT;
-    colorBlendAttachment.blendEnable = VK_FALSE;
-    
-    VkPipelineColorBlendStateCreateInfo color_blending = {};
-    color_blending.sType = VK_STRUCTURE_TYPE_PIPELINE_COLOR_BLEND_STATE_CREATE_INFO;
-    color_blending.logicOpEnable = VK_FALSE;
-    color_blending.logicOp = VK_LOGIC_OP_COPY;
-    color_blending.attachmentCount = 1;
-    color_blending.pAttachments = &colorBlendAttachment;
-    color_blending.blendConstants[0] = 0.0f;
-    color_blending.blendConstants[1] = 0.0f;
-    color_blending.blendConstants[2] = 0.0f;
-    color_blending.blendConstants[3] = 0.0f;
+    // Transient attachments prefer lazily allocated memory, tile based GPUs then never back them at all
+    uint32_t memoryType = UINT32_MAX;
+    if (usage & VK_IMAGE_USAGE_TRANSIENT_ATTACHMENT_BIT) {
+        memoryType = findMemoryType(requirements.memoryTypeBits,
+                                    VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT | VK_MEMORY_PROPERTY_LAZILY_ALLOCATED_BIT);
+    }
+    if (memoryType == UINT32_MAX) {
+        memoryType = findMemoryType(requirements.memoryTypeBits, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT);
+    }
+    if (memoryType == UINT32_MAX) {
+        throw std::runtime_error("failed to find memory type for attachment");
+    }
     
-    VkPipelineLayoutCreateInfo pipeline_layout_info = {};
-    pipeline_layout_info.sType = VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO;
-    pipeline_layout_info.setLayoutCount = 0;
-    pipeline_layout_info.pushConstantRangeCount = 0;
+    VkMemoryAllocateInfo allocInfo = {};
+    allocInfo.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
+    allocInfo.allocationSize = requirements.size;
+    allocInfo.memoryTypeIndex = memoryType;
     
-    if (vkCreatePipelineLayout(vkbDevice.device, &pipeline_layout_info, nullptr, &data.pipelineLayout) != VK_SUCCESS) {
-        std::cout << "failed to create pipeline layout" << std::endl;
-        throw std::runtime_error("failed to create pipeline layout");
+    if (vkAllocateMemory(device, &allocInfo, allocator(), &attachment.memory) != VK_SUCCESS) {
+        throw std::runtime_error("failed to allocate attachment memory");
     }
+    vkBindImageMemory(device, attachment.image, attachment.memory, 0);
     
-    std::vector<VkDynamicState> dynamic_states = { VK_DYNAMIC_STATE_VIEWPORT, VK_DYNAMIC_STATE_SCISSOR };
+    VkImageViewCreateInfo viewInfo = {};
+    viewInfo.sType = VK_STRUCTURE_TYPE_IMAGE_VIEW_CREATE_INFO;
+    viewInfo.image = attachment.image;
+    viewInfo.viewType = VK_IMAGE_VIEW_TYPE_2D;
+    viewInfo.format = format;
+    viewInfo.subresourceRange = { aspect, 0, 1, 0, 1 };
     
-    VkPipelineDynamicStateCreateInfo dynamic_info = {};
-    dynamic_info.sType = VK_STRUCTURE_TYPE_PIPELINE_DYNAMIC_STATE_CREATE_INFO;
-    dynamic_info.dynamicStateCount = static_cast<uint32_t> (dynamic_states.size ());
-    dynamic_info.pDynamicStates = dynamic_states.data ();
-    
-    VkGraphicsPipelineCreateInfo pipeline_info = {};
-    pipeline_info.sType = VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO;
-    pipeline_info.stageCount = 2;
-    pipeline_info.pStages = shader_stages;
-    pipeline_info.pVertexInputState = &vertex_input_info;
-    pipeline_info.pInputAssemblyState = &input_assembly;
-    pipeline_info.pViewportState = &viewport_state;
-    pipeline_info.pRasterizationState = &rasterizer;
-    pipeline_info.pMultisampleState = &multisampling;
-    pipeline_info.pColorBlendState = &color_blending;
-    pipeline_info.pDynamicState = &dynamic_info;
-    pipeline_info.layout = data.pipelineLayout;
-    pipeline_info.renderPass = data.renderPass;
-    pipeline_info.subpass = 0;
-    pipeline_info.basePipelineHandle = VK_NULL_HANDLE;
+    if (vkCreateImageView(device, &viewInfo, allocator(), &attachment.view) != VK_SUCCESS) {
+        throw std::runtime_error("failed to create attachment image view");
+    }
+}
+
+void VkApplication::destroyAttachment(Attachment& attachment) {
+    auto device = vkbDevice.device;
+    vkDestroyImageView(device, attachment.view, allocator());
+    vkDestroyImage(device, attachment.image, allocator());
+    vkFreeMemory(device, attachment.memory, allocator());
+    attachment = {};
+}
+
+VkFormat VkApplication::findDepthFormat() {
+    // 32-bit float first, reversed-Z needs the float precision
+    const VkFormat candidates[] = {
+        VK_FORMAT_D32_SFLOAT, VK_FORMAT_D32_SFLOAT_S8_UINT, VK_FORMAT_D24_UNORM_S8_UINT, VK_FORMAT_D16_UNORM
+    };
+    for (auto format: candidates) {
+        VkFormatProperties properties;
+        vkGetPhysicalDeviceFormatProperties(vkbDevice.physical_device, format, &properties);
+        if (properties.optimalTilingFeatures & VK_FORMAT_FEATURE_DEPTH_STENCIL_ATTACHMENT_BIT) {
+            return format;
+        }
+    }
+    throw std::runtime_error("failed to find a depth format");
+}
+
+void VkApplication::createRenderTargets(Window& window) {
+    window.renderArea = { { 0, 0 }, window.swapchain.extent };
     
-    if (vkCreateGraphicsPipelines(vkbDevice.device, VK_NULL_HANDLE, 1, &pipeline_info, nullptr, &data.graphicsPipeline) != VK_SUCCESS) {
-        std::cout << "failed to create pipline" << std::endl;
-        throw std::runtime_error("failed to create pipline");
+    // With dynamic rendering the frame graph owns the attachments and schedules their barriers
+    if (support.dynamicRendering) {
+        buildFrameGraph(window);
+        return;
     }
     
-    vkDestroyShaderModule(vkbDevice.device, fragModule, nullptr);
-    vkDestroyShaderModule(vkbDevice.device, vertModule, nullptr);
+    VkImageAspectFlags depthAspect = VK_IMAGE_ASPECT_DEPTH_BIT;
+    if (hasStencil(data.depthFormat)) {
+        depthAspect |= VK_IMAGE_ASPECT_STENCIL_BIT;
+    }
+    createAttachment(data.depthFormat, window.swapchain.extent, data.samples,
+                     VK_IMAGE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT | VK_IMAGE_USAGE_TRANSIENT_ATTACHMENT_BIT,
+                     depthAspect, window.depthTarget);
+    
+    if (data.samples != VK_SAMPLE_COUNT_1_BIT) {
+        createAttachment(data.colorFormat, window.swapchain.extent, data.samples,
+                         VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT | VK_IMAGE_USAGE_TRANSIENT_ATTACHMENT_BIT,
+                         VK_IMAGE_ASPECT_COLOR_BIT, window.colorTarget);
+    }
 }
 
-void VkApplication::createFramebuffers() {
-    data.images = vkbSwapchain.get_images().value();
-    data.imageViews = vkbSwapchain.get_image_views().value();
+void VkApplication::destroyRenderTargets(Window& window) {
+    window.frameGraph.reset();
+    if (window.colorTarget.image != VK_NULL_HANDLE) {
+        destroyAttachment(window.colorTarget);
+    }
+    if (window.depthTarget.image != VK_NULL_HANDLE) {
+        destroyAttachment(window.depthTarget);
+    }
+}
+
+void VkApplication::createFramebuffers(Window& window) {
+    window.images = window.swapchain.get_images().value();
+    window.imageViews = window.swapchain.get_image_views().value();
+    
+    if (support.dynamicRendering) {
+        return;
+    }
     
-    data.framebuffers.resize(data.imageViews.size());
-    for (size_t i = 0; i < data.imageViews.size(); i++) {
-        VkImageView attachments[] = { data.imageViews[i] };
+    window.framebuffers.resize(window.imageViews.size());
+    for (size_t i = 0; i < window.imageViews.size(); i++) {
+        VkImageView singleSampled[] = { window.imageViews[i], window.depthTarget.view };
+        VkImageView multisampled[] = { window.colorTarget.view, window.depthTarget.view, window.imageViews[i] };
+        bool resolve = window.colorTarget.view != VK_NULL_HANDLE;
         
         VkFramebufferCreateInfo info = {};
         info.sType = VK_STRUCTURE_TYPE_FRAMEBUFFER_CREATE_INFO;
         info.renderPass = data.renderPass;
-        info.attachmentCount = 1;
-        info.pAttachments = attachments;
-        info.width = vkbSwapchain.extent.width;
-        info.height = vkbSwapchain.extent.height;
+        info.attachmentCount = resolve ? 3 : 2;
+        info.pAttachments = resolve ? multisampled : singleSampled;
+        info.width = window.swapchain.extent.width;
+        info.height = window.swapchain.extent.height;
         info.layers = 1;
         
-        if (vkCreateFramebuffer(vkbDevice.device, &info, nullptr, &data.framebuffers[i]) != VK_SUCCESS) {
+        if (vkCreateFramebuffer(vkbDevice.device, &info, allocator(), &window.framebuffers[i]) != VK_SUCCESS) {
             throw std::runtime_error("failed to create framebuffer at index: " + std::to_string(i));
         }
     }
 }
 
+void VkApplication::destroyFramebuffers(Window& window) {
+    for (auto framebuffer: window.framebuffers) {
+        vkDestroyFramebuffer(vkbDevice.device, framebuffer, allocator());
+    }
+    window.framebuffers.clear();
+}
+
 void VkApplication::createCommandPool() {
     VkCommandPoolCreateInfo info = {};
     info.sType = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO;
+    // Command buffers are reset and recorded again every frame
+    info.flags = VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT;
     info.queueFamilyIndex = vkbDevice.get_queue_index(vkb::QueueType::graphics).value();
-    if (vkCreateCommandPool(vkbDevice.device, &info, nullptr, &data.commandPool) != VK_SUCCESS) {
+    if (vkCreateCommandPool(vkbDevice.device, &info, allocator(), &data.commandPool) != VK_SUCCESS) {
         throw std::runtime_error("failed to create command pool");
     }
 }
 
 void VkApplication::createCommandBuffers() {
-    data.commandBuffers.resize(data.framebuffers.size());
+    data.commandBuffers.resize(MAX_FRAMES_IN_FLIGHT);
     
     VkCommandBufferAllocateInfo allocInfo = {};
     allocInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
@@ -409,54 +860,222 @@ void VkApplication::createCommandBuffers() {
         throw std::runtime_error("failed to create command buffers");
     }
     
-    for (size_t i = 0; i < data.commandBuffers.size(); i++) {
-        VkCommandBufferBeginInfo beginInfo = {};
-        beginInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
-        if (vkBeginCommandBuffer(data.commandBuffers[i], &beginInfo) != VK_SUCCESS) {
-            throw std::runtime_error("failed to begin command buffer at [" + std::to_string(i) + "]");
+    data.compositeCommandBuffers.resize(MAX_FRAMES_IN_FLIGHT);
+    if (vkAllocateCommandBuffers(vkbDevice.device, &allocInfo, data.compositeCommandBuffers.data()) != VK_SUCCESS) {
+        throw std::runtime_error("failed to create command buffers");
+    }
+}
+
+void VkApplication::selectScenePipelines() {
+    if (!data.pipelinePending) {
+        return;
+    }
+    
+    // Never compile on the render thread: record the fallback until the variants are ready
+    auto scenePipeline = pipelines.request(data.pipelineDesc, data.renderPass);
+    auto prepassPipeline = pipelines.request(data.prepassDesc, data.renderPass);
+    data.pipelinePending = scenePipeline == VK_NULL_HANDLE || prepassPipeline == VK_NULL_HANDLE;
+    if (data.pipelinePending) {
+        data.scenePipeline = data.graphicsPipeline;
+        data.sceneDesc = &data.fallbackDesc;
+        data.prepassPipeline = VK_NULL_HANDLE;
+    } else {
+        data.scenePipeline = scenePipeline;
+        data.sceneDesc = &data.pipelineDesc;
+        data.prepassPipeline = prepassPipeline;
+    }
+}
+
+void VkApplication::recordFrame(VkCommandBuffer commandBuffer) {
+    VkCommandBufferBeginInfo beginInfo = {};
+    beginInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+    beginInfo.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+    if (dispatch.beginCommandBuffer(commandBuffer, &beginInfo) != VK_SUCCESS) {
+        throw std::runtime_error("failed to begin command buffer");
+    }
+    
+    // Every window that acquired an image is drawn into the same command buffer
+    for (auto& window: windows) {
+        if (window.imageIndex == UINT32_MAX) {
+            continue;
+        }
+        // Rendered by another GPU altogether
+        if (&window == &windows.front() && !multiGpu.primaryRenders(data.frameNumber)) {
+            continue;
         }
         
-        VkRenderPassBeginInfo renderPassInfo = {};
-        renderPassInfo.sType = VK_STRUCTURE_TYPE_RENDER_PASS_BEGIN_INFO;
-        renderPassInfo.renderPass = data.renderPass;
-        renderPassInfo.framebuffer = data.framebuffers[i];
-        renderPassInfo.renderArea.offset = { 0, 0 };
-        renderPassInfo.renderArea.extent = vkbSwapchain.extent;
-        
-        VkClearValue clearColor { { { 0.0f, 0.0f, 0.0f, 1.0f } } };
-        renderPassInfo.clearValueCount = 1;
-        renderPassInfo.pClearValues = &clearColor;
-        
-        VkViewport viewport = {};
-        viewport.x = 0.0f;
-        viewport.y = 0.0f;
-        viewport.width = (float)vkbSwapchain.extent.width;
-        viewport.height = (float)vkbSwapchain.extent.height;
-        viewport.minDepth = 0.0f;
-        viewport.maxDepth = 1.0f;
-        
-        VkRect2D scissor = {};
-        scissor.offset = { 0, 0 };
-        scissor.extent = vkbSwapchain.extent;
+        if (support.dynamicRendering) {
+            // The frame graph records the layout transitions around the passes
+            window.frameGraph.bindImage(window.backbuffer, window.images[window.imageIndex], window.imageViews[window.imageIndex]);
+            window.frameGraph.execute(commandBuffer);
+        } else {
+            beginRenderPass(commandBuffer, window);
+            recordScene(commandBuffer, window.swapchain.extent, window.renderArea);
+            dispatch.cmdEndRenderPass(commandBuffer);
+        }
+    }
+    
+    if (dispatch.endCommandBuffer(commandBuffer) != VK_SUCCESS) {
+        throw std::runtime_error("failed to end command buffer");
+    }
+}
+
+void VkApplication::recordScene(VkCommandBuffer commandBuffer, VkExtent2D extent, VkRect2D scissor) {
+    VkViewport viewport = {};
+    viewport.x = 0.0f;
+    viewport.y = 0.0f;
+    viewport.width = (float)extent.width;
+    viewport.height = (float)extent.height;
+    viewport.minDepth = 0.0f;
+    viewport.maxDepth = 1.0f;
+    
+    dispatch.cmdSetViewport(commandBuffer, 0, 1, &viewport);
+    dispatch.cmdSetScissor(commandBuffer, 0, 1, &scissor);
+    
+    auto draw = [this, commandBuffer] (VkPipeline pipeline, const GraphicsPipelineDesc& desc) {
+        dispatch.cmdBindPipeline(commandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, pipeline);
+        pipelines.setDynamicState(commandBuffer, desc);
+        drawGeometry(dispatch, commandBuffer);
+    };
+    if (data.prepassPipeline != VK_NULL_HANDLE) {
+        draw(data.prepassPipeline, data.prepassDesc);
+    }
+    if (data.scenePipeline != VK_NULL_HANDLE) {
+        draw(data.scenePipeline, *data.sceneDesc);
+    }
+}
+
+template <typename Dispatch>
+void VkApplication::drawGeometry(const Dispatch& dispatch, VkCommandBuffer commandBuffer) {
+    dispatch.cmdDraw(commandBuffer, 3, 1, 0, 0);
+}
+
+VkClearValue VkApplication::depthClearValue() {
+    VkClearValue clearDepth = {};
+    clearDepth.depthStencil = { REVERSED_Z ? 0.0f : 1.0f, 0 };
+    return clearDepth;
+}
+
+void VkApplication::beginRenderPass(VkCommandBuffer commandBuffer, const Window& window) {
+    VkClearValue clearColor { { { 0.0f, 0.0f, 0.0f, 1.0f } } };
+    
+    VkRenderPassBeginInfo renderPassInfo = {};
+    renderPassInfo.sType = VK_STRUCTURE_TYPE_RENDER_PASS_BEGIN_INFO;
+    renderPassInfo.renderPass = data.renderPass;
+    renderPassInfo.framebuffer = window.framebuffers[window.imageIndex];
+    renderPassInfo.renderArea.offset = { 0, 0 };
+    renderPassInfo.renderArea.extent = window.swapchain.extent;
+    
+    VkClearValue clearValues[] = { clearColor, depthClearValue() };
+    renderPassInfo.clearValueCount = 2;
+    renderPassInfo.pClearValues = clearValues;
+    
+    dispatch.cmdBeginRenderPass(commandBuffer, &renderPassInfo, VK_SUBPASS_CONTENTS_INLINE);
+}
+
+void VkApplication::buildFrameGraph(Window& window) {
+#if defined(VK_KHR_dynamic_rendering)
+    auto& graph = window.frameGraph;
+    auto extent = window.swapchain.extent;
+    graph.reset();
+    graph.init(vkbDevice.device, vkbDevice.physical_device.memory_properties,
+               vkbDevice.physical_device.properties.limits.bufferImageGranularity, allocator());
+    auto cmdPipelineBarrier = dispatch.get<vkb::dispatch::CmdPipelineBarrier>();
+    graph.useCmdPipelineBarrier(cmdPipelineBarrier);
+#if defined(VK_KHR_synchronization2)
+    if (support.synchronization2) {
+        graph.useSynchronization2(cmdPipelineBarrier, fp_vkCmdPipelineBarrier2);
+    }
+#endif
+    
+    // Acquired at the stage drawFrame() waits for the semaphore at, handed over to present
+    auto backbuffer = graph.importImage("backbuffer", VK_IMAGE_ASPECT_COLOR_BIT, VK_IMAGE_LAYOUT_UNDEFINED,
+                                        VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT, VK_IMAGE_LAYOUT_PRESENT_SRC_KHR);
+    window.backbuffer = backbuffer;
+    
+    RenderGraph::ImageDesc depthDesc;
+    depthDesc.format = data.depthFormat;
+    depthDesc.extent = extent;
+    depthDesc.samples = data.samples;
+    depthDesc.aspect = VK_IMAGE_ASPECT_DEPTH_BIT;
+    if (hasStencil(data.depthFormat)) {
+        depthDesc.aspect |= VK_IMAGE_ASPECT_STENCIL_BIT;
+    }
+    auto depth = graph.createImage("depth", depthDesc);
+    
+    // Multisampled color is resolved into the backbuffer at the end of rendering
+    auto color = backbuffer;
+    if (data.samples != VK_SAMPLE_COUNT_1_BIT) {
+        RenderGraph::ImageDesc colorDesc;
+        colorDesc.format = data.colorFormat;
+        colorDesc.extent = extent;
+        colorDesc.samples = data.samples;
+        color = graph.createImage("color", colorDesc);
+    }
+    
+    graph.addPass("scene", [&] (RenderGraph::PassBuilder& pass) {
+        pass.write(color, RenderGraph::Access::ColorAttachment);
+        pass.write(depth, RenderGraph::Access::DepthAttachment);
+        if (color != backbuffer) {
+            pass.write(backbuffer, RenderGraph::Access::ColorAttachment);
+        }
+    }, [this, &window, backbuffer, color, depth, extent] (VkCommandBuffer commandBuffer, const RenderGraph& graph) {
+        VkRenderingAttachmentInfoKHR colorAttachment = {};
+        colorAttachment.sType = VK_STRUCTURE_TYPE_RENDERING_ATTACHMENT_INFO_KHR;
+        colorAttachment.imageView = graph.view(color);
+        colorAttachment.imageLayout = VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL;
+        colorAttachment.loadOp = VK_ATTACHMENT_LOAD_OP_CLEAR;
+        colorAttachment.storeOp = VK_ATTACHMENT_STORE_OP_STORE;
+        colorAttachment.clearValue = { { { 0.0f, 0.0f, 0.0f, 1.0f } } };
+        if (color != backbuffer) {
+            // The multisampled samples never leave the tile, only the resolved image is stored
+            colorAttachment.storeOp = VK_ATTACHMENT_STORE_OP_DONT_CARE;
+            colorAttachment.resolveMode = VK_RESOLVE_MODE_AVERAGE_BIT_KHR;
+            colorAttachment.resolveImageView = graph.view(backbuffer);
+            colorAttachment.resolveImageLayout = VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL;
+        }
         
-        vkCmdSetViewport(data.commandBuffers[i], 0, 1, &viewport);
-        vkCmdSetScissor(data.commandBuffers[i], 0, 1, &scissor);
-        vkCmdBeginRenderPass(data.commandBuffers[i], &renderPassInfo, VK_SUBPASS_CONTENTS_INLINE);
-        vkCmdBindPipeline(data.commandBuffers[i], VK_PIPELINE_BIND_POINT_GRAPHICS, data.graphicsPipeline);
-        vkCmdDraw(data.commandBuffers[i], 3, 1, 0, 0);
-        vkCmdEndRenderPass(data.commandBuffers[i]);
+        VkRenderingAttachmentInfoKHR depthAttachment = {};
+        depthAttachment.sType = VK_STRUCTURE_TYPE_RENDERING_ATTACHMENT_INFO_KHR;
+        depthAttachment.imageView = graph.view(depth);
+        depthAttachment.imageLayout = VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL;
+        depthAttachment.loadOp = VK_ATTACHMENT_LOAD_OP_CLEAR;
+        depthAttachment.storeOp = VK_ATTACHMENT_STORE_OP_DONT_CARE;
+        depthAttachment.clearValue = depthClearValue();
         
-        if (vkEndCommandBuffer(data.commandBuffers[i]) != VK_SUCCESS) {
-            throw std::runtime_error("failed to end command buffer at [" + std::to_string(i) + "]");
+        VkRenderingInfoKHR renderingInfo = {};
+        renderingInfo.sType = VK_STRUCTURE_TYPE_RENDERING_INFO_KHR;
+        renderingInfo.renderArea.offset = { 0, 0 };
+        renderingInfo.renderArea.extent = extent;
+        renderingInfo.layerCount = 1;
+        renderingInfo.colorAttachmentCount = 1;
+        renderingInfo.pColorAttachments = &colorAttachment;
+        renderingInfo.pDepthAttachment = &depthAttachment;
+        if (hasStencil(data.depthFormat)) {
+            renderingInfo.pStencilAttachment = &depthAttachment;
         }
-    }
+        
+        fp_vkCmdBeginRendering(commandBuffer, &renderingInfo);
+        recordScene(commandBuffer, extent, window.renderArea);
+        fp_vkCmdEndRendering(commandBuffer);
+    });
+    
+    graph.compile();
+    
+#if defined(DEBUG) && DEBUG
+    // Rebuilt with every swapchain, debug builds only
+    const auto& stats = graph.stats();
+    std::cout << "frame graph: " << stats.passes << " passes (" << stats.culledPasses << " culled), "
+              << stats.imageBarriers + stats.bufferBarriers << " barriers, transient memory "
+              << stats.transientBytes / 1024 << " KiB (" << stats.naiveBytes / 1024 << " KiB without aliasing)" << std::endl;
+#endif
+#endif
 }
 
 void VkApplication::createSyncObjects() {
-    data.availableSemaphores.resize(MAX_FRAMES_IN_FLIGHT);
+    data.sceneSemaphores.resize(MAX_FRAMES_IN_FLIGHT);
     data.finishedSemaphores.resize(MAX_FRAMES_IN_FLIGHT);
     data.inflightFences.resize(MAX_FRAMES_IN_FLIGHT);
-    data.imageInflight.resize(vkbSwapchain.image_count, VK_NULL_HANDLE);
     
     VkSemaphoreCreateInfo semaphore = {};
     semaphore.sType = VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO;
@@ -467,91 +1086,247 @@ void VkApplication::createSyncObjects() {
         
     auto device = vkbDevice.device;
     for (size_t i = 0; i < MAX_FRAMES_IN_FLIGHT; i++) {
-        if (vkCreateSemaphore(device, &semaphore, nullptr, &data.availableSemaphores[i]) != VK_SUCCESS ||
-            vkCreateSemaphore(device, &semaphore, nullptr, &data.finishedSemaphores[i]) != VK_SUCCESS ||
-            vkCreateFence(device, &fence, nullptr, &data.inflightFences[i]) != VK_SUCCESS) {
+        if (vkCreateSemaphore(device, &semaphore, allocator(), &data.sceneSemaphores[i]) != VK_SUCCESS ||
+            vkCreateSemaphore(device, &semaphore, allocator(), &data.finishedSemaphores[i]) != VK_SUCCESS ||
+            vkCreateFence(device, &fence, allocator(), &data.inflightFences[i]) != VK_SUCCESS) {
             throw std::runtime_error("failed to create sync objects");
         }
     }
+    
+    // Each swapchain is acquired with its own semaphore, the submit waits on all of them
+    for (auto& window: windows) {
+        window.availableSemaphores.resize(MAX_FRAMES_IN_FLIGHT);
+        for (size_t i = 0; i < MAX_FRAMES_IN_FLIGHT; i++) {
+            if (vkCreateSemaphore(device, &semaphore, allocator(), &window.availableSemaphores[i]) != VK_SUCCESS) {
+                throw std::runtime_error("failed to create sync objects");
+            }
+        }
+    }
 }
 
-void VkApplication::recreateSwapchain() {
-    auto device = vkbDevice.device;
-    vkDeviceWaitIdle(device);
-    vkDestroyCommandPool(device, data.commandPool, nullptr);
+void VkApplication::initMultiGpu() {
+    MultiDeviceRenderer::Options options;
+    options.mode = MULTI_GPU_MODE;
+    // The single pass variant, it doesn't depend on anything compiled in the background
+    options.sceneDesc = data.fallbackDesc;
+    options.pushConstants = data.pushConstantRanges;
+    options.clearColor = { { { 0.0f, 0.0f, 0.0f, 1.0f } } };
+    options.clearDepth = depthClearValue();
+    options.framesInFlight = MAX_FRAMES_IN_FLIGHT;
+    options.allocationCallbacks = allocator();
+    options.cmdPipelineBarrier = dispatch.get<vkb::dispatch::CmdPipelineBarrier>();
+    options.cmdCopyBufferToImage = dispatch.get<vkb::dispatch::CmdCopyBufferToImage>();
+    
+    auto& window = windows.front();
+    multiGpu.init(vkbInstance, vkbDevice, window.swapchain.extent, options, drawGeometry<vkb::DispatchTable>);
+    window.renderArea = multiGpu.primaryRegion();
+}
+
+void VkApplication::benchmarkDispatch() {
+    // vkCmdSetScissor stands in for a draw: it's valid outside a render pass and dispatched the same way
+    auto commandBuffer = data.commandBuffers[0];
+    VkRect2D scissor = { { 0, 0 }, windows.front().swapchain.extent };
+    auto record = [&] (auto&& setScissor) {
+        double best = std::numeric_limits<double>::max();
+        for (int run = 0; run < 3; run++) {
+            VkCommandBufferBeginInfo beginInfo = {};
+            beginInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+            beginInfo.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+            dispatch.resetCommandBuffer(commandBuffer, 0);
+            if (dispatch.beginCommandBuffer(commandBuffer, &beginInfo) != VK_SUCCESS) {
+                throw std::runtime_error("failed to begin command buffer");
+            }
+            
+            auto start = std::chrono::steady_clock::now();
+            for (uint32_t i = 0; i < DISPATCH_BENCHMARK_CALLS; i++) {
+                setScissor(commandBuffer, scissor);
+            }
+            std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - start;
+            best = std::min(best, elapsed.count() / DISPATCH_BENCHMARK_CALLS);
+            
+            dispatch.endCommandBuffer(commandBuffer);
+        }
+        return best;
+    };
+    
+    double loader = record([] (VkCommandBuffer commandBuffer, const VkRect2D& scissor) {
+        vkCmdSetScissor(commandBuffer, 0, 1, &scissor);
+    });
+    double table = record([this] (VkCommandBuffer commandBuffer, const VkRect2D& scissor) {
+        dispatch.cmdSetScissor(commandBuffer, 0, 1, &scissor);
+    });
+    dispatch.resetCommandBuffer(commandBuffer, 0);
+    
+    std::cout << "dispatch: " << DISPATCH_BENCHMARK_CALLS << " calls, loader " << loader << " ns/call, dispatch table "
+              << table << " ns/call, " << (loader - table) * DISPATCH_BENCHMARK_CALLS / 1e6 << " ms saved" << std::endl;
+    
+    // Startup cost of the tables: the full one with every entry point up front or resolved on first use,
+    // and the frame loop's subset
+    auto eagerStart = std::chrono::steady_clock::now();
+    auto eager = vkbDevice.make_table();
+    std::chrono::duration<double, std::micro> eagerTime = std::chrono::steady_clock::now() - eagerStart;
+    auto lazyStart = std::chrono::steady_clock::now();
+    vkb::DispatchTable lazy { vkbDevice.device, vkbDevice.fp_vkGetDeviceProcAddr, vkb::lazy_resolve };
+    std::chrono::duration<double, std::micro> lazyTime = std::chrono::steady_clock::now() - lazyStart;
+    auto subsetStart = std::chrono::steady_clock::now();
+    FrameDispatch subset { vkbDevice.device, vkbDevice.fp_vkGetDeviceProcAddr };
+    std::chrono::duration<double, std::micro> subsetTime = std::chrono::steady_clock::now() - subsetStart;
+    std::cout << "dispatch: table created in " << lazyTime.count() << " us resolving on first use, "
+              << eagerTime.count() << " us resolving every entry point" << std::endl;
+    std::cout << "dispatch: frame subset of " << FrameDispatch::size() << " entry points created in " << subsetTime.count()
+              << " us, " << sizeof(FrameDispatch) << " bytes instead of " << sizeof(vkb::DispatchTable) << std::endl;
+}
+
+void VkApplication::recreateSwapchain(Window& window) {
+    vkDeviceWaitIdle(vkbDevice.device);
     
-    for (auto framebuffer: data.framebuffers) {
-        vkDestroyFramebuffer(device, framebuffer, nullptr);
-    }
+    destroyFramebuffers(window);
+    window.swapchain.destroy_image_views(window.imageViews);
+    destroyRenderTargets(window);
     
-    vkbSwapchain.destroy_image_views(data.imageViews);
+    createSwapchain(window);
+    createRenderTargets(window);
+    createFramebuffers(window);
     
-    createSwapchain();
-    createFramebuffers();
-    createCommandPool();
-    createCommandBuffers();
+    if (MULTI_GPU && &window == &windows.front()) {
+        multiGpu.resize(window.swapchain.extent);
+        window.renderArea = multiGpu.primaryRegion();
+    }
 }
 
 void VkApplication::drawFrame() {
-    auto device = vkbDevice.device;
-    
-    vkWaitForFences(device, 1, &data.inflightFences[data.currentFrame], VK_TRUE, UINT64_MAX);
-    
-    uint32_t imageIndex = 0;
-    VkResult result = vkAcquireNextImageKHR(device, vkbSwapchain.swapchain, UINT64_MAX, data.availableSemaphores[data.currentFrame], VK_NULL_HANDLE, &imageIndex);
-    
-    if (VK_ERROR_OUT_OF_DATE_KHR == result) {
-        recreateSwapchain();
+    dispatch.waitForFences(1, &data.inflightFences[data.currentFrame], VK_TRUE, UINT64_MAX);
+    
+    // A window whose swapchain is out of date is rebuilt and sits this frame out
+    std::array<VkSemaphore, WINDOW_COUNT> waitSemaphores;
+    std::array<VkPipelineStageFlags, WINDOW_COUNT> waitStages;
+    std::array<VkSwapchainKHR, WINDOW_COUNT> swapchains;
+    std::array<uint32_t, WINDOW_COUNT> imageIndices;
+    std::array<Window*, WINDOW_COUNT> presented;
+    uint32_t presentCount = 0;
+    for (auto& window: windows) {
+        window.imageIndex = UINT32_MAX;
+        
+        uint32_t imageIndex = 0;
+        VkResult result = dispatch.acquireNextImageKHR(window.swapchain.swapchain, UINT64_MAX, window.availableSemaphores[data.currentFrame], VK_NULL_HANDLE, &imageIndex);
+        
+        if (VK_ERROR_OUT_OF_DATE_KHR == result) {
+            recreateSwapchain(window);
+            continue;
+        } else if (VK_SUCCESS != result && VK_SUBOPTIMAL_KHR != result) {
+            throw std::runtime_error("failed to acquire swapchain image. Error " + std::to_string(result));
+        }
+        
+        window.imageIndex = imageIndex;
+        waitSemaphores[presentCount] = window.availableSemaphores[data.currentFrame];
+        waitStages[presentCount] = VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT;
+        swapchains[presentCount] = window.swapchain.swapchain;
+        imageIndices[presentCount] = imageIndex;
+        presented[presentCount] = &window;
+        presentCount++;
+    }
+    if (presentCount == 0) {
         return;
-    } else if (VK_SUCCESS != result && VK_SUBOPTIMAL_KHR != result) {
-        throw std::runtime_error("failed to acquire swapchain image. Error " + std::to_string(result));
     }
     
-    if (data.imageInflight[imageIndex] != VK_NULL_HANDLE) {
-        vkWaitForFences(device, 1, &data.imageInflight[imageIndex], VK_TRUE, UINT64_MAX);
-    }
-    data.imageInflight[imageIndex] = data.inflightFences[data.currentFrame];
+    // Recorded every frame, the frame's fence has already retired its previous use
+    auto commandBuffer = data.commandBuffers[data.currentFrame];
+    dispatch.resetCommandBuffer(commandBuffer, 0);
+    selectScenePipelines();
+    multiGpu.beginFrame(data.frameNumber);
+    recordFrame(commandBuffer);
     
     VkSubmitInfo submitInfo = {};
     submitInfo.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
     
-    VkSemaphore waitSemaphores[] = { data.availableSemaphores[data.currentFrame] };
-    VkPipelineStageFlags waitStages[] = { VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT };
-    submitInfo.waitSemaphoreCount = 1;
-    submitInfo.pWaitSemaphores = waitSemaphores;
-    submitInfo.pWaitDstStageMask = waitStages;
+    submitInfo.waitSemaphoreCount = presentCount;
+    submitInfo.pWaitSemaphores = waitSemaphores.data();
+    submitInfo.pWaitDstStageMask = waitStages.data();
     
     submitInfo.commandBufferCount = 1;
-    submitInfo.pCommandBuffers = &data.commandBuffers[imageIndex];
+    submitInfo.pCommandBuffers = &commandBuffer;
     
+    // With bands or frames of the first window rendered on other GPUs the scene goes first, so the
+    // primary renders while we wait for the secondaries, and their upload follows in a second submit
+    bool compositing = windows.front().imageIndex != UINT32_MAX && multiGpu.composites(data.frameNumber);
     VkSemaphore signalSemaphores[] = { data.finishedSemaphores[data.currentFrame] };
     submitInfo.signalSemaphoreCount = 1;
-    submitInfo.pSignalSemaphores = signalSemaphores;
+    submitInfo.pSignalSemaphores = compositing ? &data.sceneSemaphores[data.currentFrame] : signalSemaphores;
     
-    vkResetFences(device, 1, &data.inflightFences[data.currentFrame]);
+    dispatch.resetFences(1, &data.inflightFences[data.currentFrame]);
     
-    if (vkQueueSubmit(data.graphicsQueue, 1, &submitInfo, data.inflightFences[data.currentFrame]) != VK_SUCCESS) {
+    // The fence goes on the last submit, it waits for everything submitted before it as well
+    VkFence sceneFence = compositing ? VK_NULL_HANDLE : data.inflightFences[data.currentFrame];
+    if (dispatch.queueSubmit(data.graphicsQueue, 1, &submitInfo, sceneFence) != VK_SUCCESS) {
         throw std::runtime_error("failed to submit draw command buffer");
     }
     
+    if (compositing) {
+        auto& window = windows.front();
+        auto compositeBuffer = data.compositeCommandBuffers[data.currentFrame];
+        dispatch.resetCommandBuffer(compositeBuffer, 0);
+        
+        VkCommandBufferBeginInfo beginInfo = {};
+        beginInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+        beginInfo.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+        if (dispatch.beginCommandBuffer(compositeBuffer, &beginInfo) != VK_SUCCESS) {
+            throw std::runtime_error("failed to begin command buffer");
+        }
+        multiGpu.composite(data.frameNumber, static_cast<uint32_t>(data.currentFrame), compositeBuffer,
+                           window.images[window.imageIndex]);
+        if (dispatch.endCommandBuffer(compositeBuffer) != VK_SUCCESS) {
+            throw std::runtime_error("failed to end command buffer");
+        }
+        
+        VkPipelineStageFlags compositeStage = VK_PIPELINE_STAGE_TRANSFER_BIT;
+        VkSubmitInfo compositeInfo = {};
+        compositeInfo.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+        compositeInfo.waitSemaphoreCount = 1;
+        compositeInfo.pWaitSemaphores = &data.sceneSemaphores[data.currentFrame];
+        compositeInfo.pWaitDstStageMask = &compositeStage;
+        compositeInfo.commandBufferCount = 1;
+        compositeInfo.pCommandBuffers = &compositeBuffer;
+        compositeInfo.signalSemaphoreCount = 1;
+        compositeInfo.pSignalSemaphores = signalSemaphores;
+        if (dispatch.queueSubmit(data.graphicsQueue, 1, &compositeInfo, data.inflightFences[data.currentFrame]) != VK_SUCCESS) {
+            throw std::runtime_error("failed to submit composite command buffer");
+        }
+    }
+    
+    // One present for all the swapchains, the last submit signals one semaphore for all of them
+    std::array<VkResult, WINDOW_COUNT> results;
+    
     VkPresentInfoKHR present = {};
     present.sType = VK_STRUCTURE_TYPE_PRESENT_INFO_KHR;
     present.waitSemaphoreCount = 1;
     present.pWaitSemaphores = signalSemaphores;
     
-    VkSwapchainKHR swapchains[] = { vkbSwapchain };
-    present.swapchainCount = 1;
-    present.pSwapchains = swapchains;
-    
-    present.pImageIndices = &imageIndex;
+    present.swapchainCount = presentCount;
+    present.pSwapchains = swapchains.data();
+    present.pImageIndices = imageIndices.data();
+    present.pResults = results.data();
     
-    result = vkQueuePresentKHR(data.presentQueue, &present);
-    if (result == VK_ERROR_OUT_OF_DATE_KHR || result == VK_SUBOPTIMAL_KHR) {
-        recreateSwapchain();
-        return;
-    } else if (result != VK_SUCCESS) {
+    VkResult result = dispatch.queuePresentKHR(data.presentQueue, &present);
+    if (result != VK_SUCCESS && result != VK_ERROR_OUT_OF_DATE_KHR && result != VK_SUBOPTIMAL_KHR) {
         throw std::runtime_error("failed to present swapchain image");
     }
     
+    for (uint32_t i = 0; i < presentCount; i++) {
+        if (results[i] == VK_ERROR_OUT_OF_DATE_KHR || results[i] == VK_SUBOPTIMAL_KHR) {
+            recreateSwapchain(*presented[i]);
+        } else if (results[i] != VK_SUCCESS) {
+            throw std::runtime_error("failed to present swapchain image");
+        }
+    }
+    
     data.currentFrame = (data.currentFrame + 1) % MAX_FRAMES_IN_FLIGHT;
+    data.frameNumber++;
+    
+    if (TRACK_HOST_ALLOCATIONS && HOST_ALLOCATION_REPORT_FRAMES > 0 && data.frameNumber % HOST_ALLOCATION_REPORT_FRAMES == 0) {
+        hostAllocator.report(HOST_ALLOCATION_REPORT_FRAMES);
+    }
+}
+
+VkAllocationCallbacks* VkApplication::allocator() {
+    return TRACK_HOST_ALLOCATIONS ? hostAllocator.callbacks() : nullptr;
 }
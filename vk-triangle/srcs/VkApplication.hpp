@@ -13,6 +13,14 @@
 
 #include <vector>
 #include "VkBootstrap.h"
+#include "VkBootstrapDispatchSubset.h"
+#include "ShaderArchive.hpp"
+#include "ShaderModuleCache.hpp"
+#include "GraphicsPipelineCache.hpp"
+#include "RenderGraph.hpp"
+#include "MultiDeviceRenderer.hpp"
+#include "HostAllocator.hpp"
+#include "DebugLog.hpp"
 
 class VkApplication {
 public:
@@ -20,55 +28,168 @@ public:
     
 private:
     
-    GLFWwindow *window = nullptr;
+    // Declared first so it outlives everything allocated from it
+    HostAllocator hostAllocator;
+    // Outlives the instance's debug messenger, which feeds it
+    DebugLog debugLog;
     vkb::Instance vkbInstance;
-    VkSurfaceKHR vkSurface;
     vkb::Device vkbDevice;
-    vkb::Swapchain vkbSwapchain;
+    // The device level entry points the frame loop calls, resolved up front so the per-frame calls
+    // skip the loader's trampolines and share a few cache lines
+    using FrameDispatch = vkb::DispatchSubset<
+        vkb::dispatch::WaitForFences, vkb::dispatch::ResetFences, vkb::dispatch::AcquireNextImageKHR,
+        vkb::dispatch::ResetCommandBuffer, vkb::dispatch::BeginCommandBuffer, vkb::dispatch::EndCommandBuffer,
+        vkb::dispatch::CmdBeginRenderPass, vkb::dispatch::CmdEndRenderPass, vkb::dispatch::CmdSetViewport,
+        vkb::dispatch::CmdSetScissor, vkb::dispatch::CmdBindPipeline, vkb::dispatch::CmdDraw,
+        vkb::dispatch::CmdPipelineBarrier, vkb::dispatch::CmdCopyBufferToImage,
+        vkb::dispatch::QueueSubmit, vkb::dispatch::QueuePresentKHR>;
+    FrameDispatch dispatch;
+    ShaderArchive shaderArchive;
+    ShaderModuleCache shaderModules;
+    GraphicsPipelineCache pipelines;
+    // Other GPUs rendering a share of the first window's frames
+    MultiDeviceRenderer multiGpu;
     
-    struct RenderData {
-        VkQueue graphicsQueue;
-        VkQueue presentQueue;
+    // Optional device functionality detected in createDevice()
+    struct DeviceSupport {
+        bool shaderModuleIdentifier = false;
+        bool graphicsPipelineLibrary = false;
+        // Core 1.3 or VK_KHR_dynamic_rendering, replaces the render pass and framebuffers
+        bool dynamicRendering = false;
+        // Core 1.3 or VK_EXT_extended_dynamic_state, cull/front face/topology/depth toggles share pipelines
+        bool extendedDynamicState = false;
+        // Core 1.3 or VK_KHR_synchronization2, barriers keep their own stage masks
+        bool synchronization2 = false;
+    } support;
+    
+#if defined(VK_KHR_dynamic_rendering)
+    PFN_vkCmdBeginRenderingKHR fp_vkCmdBeginRendering = nullptr;
+    PFN_vkCmdEndRenderingKHR fp_vkCmdEndRendering = nullptr;
+#endif
+#if defined(VK_KHR_synchronization2)
+    PFN_vkCmdPipelineBarrier2KHR fp_vkCmdPipelineBarrier2 = nullptr;
+#endif
+    
+    // An image with its own memory and a view, sized to the swapchain
+    struct Attachment {
+        VkImage image = VK_NULL_HANDLE;
+        VkDeviceMemory memory = VK_NULL_HANDLE;
+        VkImageView view = VK_NULL_HANDLE;
+    };
+    
+    // One output with its own surface, swapchain and render targets. Every window is drawn
+    // from the same device and command buffer, and all of them are presented with one call.
+    struct Window {
+        GLFWwindow *handle = nullptr;
+        VkSurfaceKHR surface = VK_NULL_HANDLE;
+        vkb::Swapchain swapchain;
         
         std::vector<VkImage> images;
         std::vector<VkImageView> imageViews;
         std::vector<VkFramebuffer> framebuffers;
         
+        // Render pass attachments. The multisampled color is resolved into the swapchain image
+        // and only used with samples > 1
+        Attachment colorTarget;
+        Attachment depthTarget;
+        // Passes and transient attachments of a frame, used with dynamic rendering
+        RenderGraph frameGraph;
+        RenderGraph::Resource backbuffer = RenderGraph::kInvalid;
+        // Part of the swapchain image drawn on this device, the rest comes from multiGpu
+        VkRect2D renderArea = {};
+        
+        // One per frame in flight, signaled by the acquire
+        std::vector<VkSemaphore> availableSemaphores;
+        // Acquired for the frame being drawn, UINT32_MAX when the window sits the frame out
+        uint32_t imageIndex = UINT32_MAX;
+    };
+    
+    struct RenderData {
+        VkQueue graphicsQueue;
+        VkQueue presentQueue;
+        
+        // Shared by all swapchains, the render pass and pipelines are built for it
+        VkFormat colorFormat = VK_FORMAT_UNDEFINED;
+        VkSampleCountFlagBits samples = VK_SAMPLE_COUNT_1_BIT;
+        VkFormat depthFormat = VK_FORMAT_UNDEFINED;
+        
         VkRenderPass renderPass;
         VkPipelineLayout pipelineLayout;
+        // Reflected from the shaders, the secondary GPUs build their layouts from them too
+        std::vector<VkPushConstantRange> pushConstantRanges;
+        // Always compiled from `fallbackDesc`, stands in while the pre-pass variants compile in the background
         VkPipeline graphicsPipeline;
+        GraphicsPipelineDesc fallbackDesc;
+        GraphicsPipelineDesc pipelineDesc;
+        // Depth only variant drawn before `pipelineDesc` when DEPTH_PREPASS is set
+        GraphicsPipelineDesc prepassDesc;
+        // The pre-pass variants are still compiling
+        bool pipelinePending = false;
+        // What recordScene() draws with, picked when a frame is recorded
+        VkPipeline scenePipeline = VK_NULL_HANDLE;
+        VkPipeline prepassPipeline = VK_NULL_HANDLE;
+        const GraphicsPipelineDesc* sceneDesc = nullptr;
         
         VkCommandPool commandPool;
+        // One per frame in flight, re-recorded every frame for all the windows
         std::vector<VkCommandBuffer> commandBuffers;
+        // Uploads of what the multi-GPU secondaries rendered, submitted after the scene
+        std::vector<VkCommandBuffer> compositeCommandBuffers;
         
-        std::vector<VkSemaphore> availableSemaphores;
+        // Signaled by the scene submission for the composite submission to wait on
+        std::vector<VkSemaphore> sceneSemaphores;
         std::vector<VkSemaphore> finishedSemaphores;
         std::vector<VkFence> inflightFences;
-        std::vector<VkFence> imageInflight;
         
         size_t currentFrame = 0;
+        // Frames drawn so far, alternate-frame multi-GPU deals them out by number
+        uint64_t frameNumber = 0;
         
     } data;
+    std::vector<Window> windows;
     
-    void initWindow();
+    void initWindows();
     void initVulkan();
     void mainLoop();
     void cleanup();
     
     void createDevice();
-    void createSwapchain();
+    void createSwapchain(Window& window);
     void initQueues();
     void createRenderPass();
     void createGraphicsPipeline();
-    std::vector<char> readFile(const std::string& filename);
-    VkShaderModule createShaderModule(const std::vector<char>& code);
-    void createFramebuffers();
+    void loadShaders();
+    VkFormat findDepthFormat();
+    void createRenderTargets(Window& window);
+    void destroyRenderTargets(Window& window);
+    void createFramebuffers(Window& window);
+    void destroyFramebuffers(Window& window);
     void createCommandPool();
     void createCommandBuffers();
     void createSyncObjects();
+    void initMultiGpu();
+    
+    uint32_t findMemoryType(uint32_t typeBits, VkMemoryPropertyFlags properties);
+    void createAttachment(VkFormat format, VkExtent2D extent, VkSampleCountFlagBits samples, VkImageUsageFlags usage,
+                          VkImageAspectFlags aspect, Attachment& attachment);
+    void destroyAttachment(Attachment& attachment);
+    
+    void buildFrameGraph(Window& window);
+    void selectScenePipelines();
+    void recordFrame(VkCommandBuffer commandBuffer);
+    void recordScene(VkCommandBuffer commandBuffer, VkExtent2D extent, VkRect2D scissor);
+    // Takes the frame's dispatch subset or a full vkb::DispatchTable (the secondaries in multiGpu)
+    template <typename Dispatch> static void drawGeometry(const Dispatch& dispatch, VkCommandBuffer commandBuffer);
+    void beginRenderPass(VkCommandBuffer commandBuffer, const Window& window);
+    static VkClearValue depthClearValue();
+    
+    void benchmarkDispatch();
     
-    void recreateSwapchain();
+    void recreateSwapchain(Window& window);
     void drawFrame();
+    // Host allocation callbacks for the instance, device, swapchains and the objects created here,
+    // nullptr unless TRACK_HOST_ALLOCATIONS
+    VkAllocationCallbacks* allocator();
 };
 
 #endif /* VkApplication_hpp */
@@ -31,7 +31,11 @@
 #endif
 
 #include <mutex>
+#include <future>
+#include <map>
+#include <forward_list>
 #include <algorithm>
+#include <new>
 
 namespace vkb {
 
@@ -200,8 +204,20 @@ VulkanFunctions& vulkan_functions() {
 	return v;
 }
 
+struct SystemInfoCache {
+	std::mutex mutex;
+	PFN_vkGetInstanceProcAddr fp_vkGetInstanceProcAddr = nullptr;
+	std::shared_ptr<const SystemInfo> snapshot;
+};
+
+SystemInfoCache& system_info_cache() {
+	static SystemInfoCache cache;
+	return cache;
+}
+
 // Helper for robustly executing the two-call pattern
-template <typename T, typename F, typename... Ts> auto get_vector(std::vector<T>& out, F&& f, Ts&&... ts) -> VkResult {
+template <typename T, typename Alloc, typename F, typename... Ts>
+auto get_vector(std::vector<T, Alloc>& out, F&& f, Ts&&... ts) -> VkResult {
 	uint32_t count = 0;
 	VkResult err;
 	do {
@@ -227,6 +243,39 @@ template <typename T, typename F, typename... Ts> auto get_vector_noerror(F&& f,
 }
 } // namespace detail
 
+// ---- Scratch Arena ---- //
+
+ScratchArena::ScratchArena(void* buffer, size_t size) noexcept : buffer(static_cast<std::byte*>(buffer)), capacity(size) {}
+
+void* ScratchArena::allocate(size_t size, size_t alignment) {
+	uintptr_t base = reinterpret_cast<uintptr_t>(buffer);
+	size_t start = ((base + offset + alignment - 1) & ~static_cast<uintptr_t>(alignment - 1)) - base;
+	if (buffer != nullptr && start + size <= capacity) {
+		offset = start + size;
+		peak_offset = std::max(peak_offset, offset);
+		live_allocations++;
+		return buffer + start;
+	}
+	heap_allocation_count++;
+	return ::operator new(size, std::align_val_t{ alignment });
+}
+
+void ScratchArena::deallocate(void* memory, size_t size, size_t alignment) noexcept {
+	uintptr_t address = reinterpret_cast<uintptr_t>(memory);
+	uintptr_t base = reinterpret_cast<uintptr_t>(buffer);
+	if (buffer == nullptr || address < base || address >= base + capacity) {
+		::operator delete(memory, std::align_val_t{ alignment });
+		return;
+	}
+	// Only the latest allocation can be popped, earlier ones wait until everything is back
+	live_allocations--;
+	if (live_allocations == 0) {
+		offset = 0;
+	} else if (address + size == base + offset) {
+		offset = address - base;
+	}
+}
+
 const char* to_string_message_severity(VkDebugUtilsMessageSeverityFlagBitsEXT s) {
 	switch (s) {
 		case VK_DEBUG_UTILS_MESSAGE_SEVERITY_VERBOSE_BIT_EXT:
@@ -301,7 +350,8 @@ bool check_layer_supported(std::vector<VkLayerProperties> const& available_layer
 	return false;
 }
 
-bool check_layers_supported(std::vector<VkLayerProperties> const& available_layers, std::vector<const char*> const& layer_names) {
+template <typename Alloc>
+bool check_layers_supported(std::vector<VkLayerProperties> const& available_layers, std::vector<const char*, Alloc> const& layer_names) {
 	bool all_found = true;
 	for (const auto& layer_name : layer_names) {
 		bool found = check_layer_supported(available_layers, layer_name);
@@ -310,18 +360,55 @@ bool check_layers_supported(std::vector<VkLayerProperties> const& available_laye
 	return all_found;
 }
 
-bool check_extension_supported(std::vector<VkExtensionProperties> const& available_extensions, const char* extension_name) {
-	if (!extension_name) return false;
-	for (const auto& extension_properties : available_extensions) {
-		if (strcmp(extension_name, extension_properties.extensionName) == 0) {
-			return true;
-		}
+struct ExtensionNamePool {
+	std::mutex mutex;
+	std::forward_list<std::string> storage;
+	std::unordered_set<std::string_view> names;
+
+	// Needs the mutex held
+	const char* intern(const char* name) {
+		auto interned = names.find(name);
+		if (interned != names.end()) return interned->data();
+		storage.emplace_front(name);
+		names.insert(storage.front());
+		return storage.front().c_str();
 	}
-	return false;
+};
+
+ExtensionNamePool& extension_name_pool() {
+	static ExtensionNamePool pool;
+	return pool;
+}
+
+const char* intern_extension_name(const char* name) {
+	auto& pool = extension_name_pool();
+	std::lock_guard<std::mutex> lg(pool.mutex);
+	return pool.intern(name);
+}
+
+ExtensionSet::ExtensionSet(std::vector<VkExtensionProperties> const& properties) {
+	auto set = std::make_shared<std::unordered_set<std::string_view>>();
+	set->reserve(properties.size());
+	auto& pool = extension_name_pool();
+	std::lock_guard<std::mutex> lg(pool.mutex);
+	for (const auto& extension_properties : properties) {
+		set->insert(pool.intern(extension_properties.extensionName));
+	}
+	names = std::move(set);
 }
 
-bool check_extensions_supported(
-    std::vector<VkExtensionProperties> const& available_extensions, std::vector<const char*> const& extension_names) {
+const char* ExtensionSet::find(const char* name) const {
+	if (!name || !names) return nullptr;
+	auto found = names->find(name);
+	return found != names->end() ? found->data() : nullptr;
+}
+
+bool check_extension_supported(ExtensionSet const& available_extensions, const char* extension_name) {
+	return available_extensions.contains(extension_name);
+}
+
+template <typename Alloc>
+bool check_extensions_supported(ExtensionSet const& available_extensions, std::vector<const char*, Alloc> const& extension_names) {
 	bool all_found = true;
 	for (const auto& extension_name : extension_names) {
 		bool found = check_extension_supported(available_extensions, extension_name);
@@ -330,7 +417,8 @@ bool check_extensions_supported(
 	return all_found;
 }
 
-template <typename T> void setup_pNext_chain(T& structure, std::vector<VkBaseOutStructure*> const& structs) {
+template <typename T, typename Alloc>
+void setup_pNext_chain(T& structure, std::vector<VkBaseOutStructure*, Alloc> const& structs) {
 	structure.pNext = nullptr;
 	if (structs.size() <= 0) return;
 	for (size_t i = 0; i < structs.size() - 1; i++) {
@@ -462,6 +550,30 @@ Result<SystemInfo> SystemInfo::get_system_info(PFN_vkGetInstanceProcAddr fp_vkGe
 	return SystemInfo();
 }
 
+Result<std::shared_ptr<const SystemInfo>> SystemInfo::get_cached_system_info() {
+	return get_cached_system_info(nullptr);
+}
+
+Result<std::shared_ptr<const SystemInfo>> SystemInfo::get_cached_system_info(PFN_vkGetInstanceProcAddr fp_vkGetInstanceProcAddr) {
+	// Cheap, and the caller relies on the pre-instance functions matching fp_vkGetInstanceProcAddr
+	if (!detail::vulkan_functions().init_vulkan_funcs(fp_vkGetInstanceProcAddr)) {
+		return make_error_code(InstanceError::vulkan_unavailable);
+	}
+	auto& cache = detail::system_info_cache();
+	std::lock_guard<std::mutex> lg(cache.mutex);
+	if (!cache.snapshot || cache.fp_vkGetInstanceProcAddr != fp_vkGetInstanceProcAddr) {
+		cache.snapshot = std::shared_ptr<const SystemInfo>(new SystemInfo());
+		cache.fp_vkGetInstanceProcAddr = fp_vkGetInstanceProcAddr;
+	}
+	return cache.snapshot;
+}
+
+void SystemInfo::invalidate_cache() {
+	auto& cache = detail::system_info_cache();
+	std::lock_guard<std::mutex> lg(cache.mutex);
+	cache.snapshot.reset();
+}
+
 SystemInfo::SystemInfo() {
 	auto available_layers_ret = detail::get_vector<VkLayerProperties>(
 	    this->available_layers, detail::vulkan_functions().fp_vkEnumerateInstanceLayerProperties);
@@ -498,10 +610,12 @@ SystemInfo::SystemInfo() {
 			}
 		}
 	}
+
+	extension_set = detail::ExtensionSet(this->available_extensions);
 }
 bool SystemInfo::is_extension_available(const char* extension_name) const {
 	if (!extension_name) return false;
-	return detail::check_extension_supported(available_extensions, extension_name);
+	return detail::check_extension_supported(extension_set, extension_name);
 }
 bool SystemInfo::is_layer_available(const char* layer_name) const {
 	if (!layer_name) return false;
@@ -534,9 +648,9 @@ InstanceBuilder::InstanceBuilder() {}
 
 Result<Instance> InstanceBuilder::build() const {
 
-	auto sys_info_ret = SystemInfo::get_system_info(info.fp_vkGetInstanceProcAddr);
+	auto sys_info_ret = SystemInfo::get_cached_system_info(info.fp_vkGetInstanceProcAddr);
 	if (!sys_info_ret) return sys_info_ret.error();
-	auto system = sys_info_ret.value();
+	auto const& system = *sys_info_ret.value();
 
 	uint32_t instance_version = VKB_VK_API_VERSION_1_0;
 
@@ -577,16 +691,18 @@ Result<Instance> InstanceBuilder::build() const {
 	app_info.engineVersion = info.engine_version;
 	app_info.apiVersion = api_version;
 
-	std::vector<const char*> extensions;
-	std::vector<const char*> layers;
+	// Reserved up front with room for what's added below, so each list is allocated once
+	detail::ScratchVector<const char*> extensions{ info.scratch_arena };
+	detail::ScratchVector<const char*> layers{ info.scratch_arena };
+	extensions.reserve(info.extensions.size() + 7);
+	layers.reserve(info.layers.size() + 1);
 
-	for (auto& ext : info.extensions)
-		extensions.push_back(ext);
+	extensions.insert(extensions.end(), info.extensions.begin(), info.extensions.end());
 	if (info.debug_callback != nullptr && system.debug_utils_available) {
 		extensions.push_back(VK_EXT_DEBUG_UTILS_EXTENSION_NAME);
 	}
 	bool supports_properties2_ext =
-	    detail::check_extension_supported(system.available_extensions, VK_KHR_GET_PHYSICAL_DEVICE_PROPERTIES_2_EXTENSION_NAME);
+	    detail::check_extension_supported(system.extension_set, VK_KHR_GET_PHYSICAL_DEVICE_PROPERTIES_2_EXTENSION_NAME);
 
 	if (supports_properties2_ext && api_version < VKB_VK_API_VERSION_1_1) {
 		extensions.push_back(VK_KHR_GET_PHYSICAL_DEVICE_PROPERTIES_2_EXTENSION_NAME);
@@ -594,7 +710,7 @@ Result<Instance> InstanceBuilder::build() const {
 
 #if defined(VK_KHR_portability_enumeration)
 	bool portability_enumeration_support =
-	    detail::check_extension_supported(system.available_extensions, VK_KHR_PORTABILITY_ENUMERATION_EXTENSION_NAME);
+	    detail::check_extension_supported(system.extension_set, VK_KHR_PORTABILITY_ENUMERATION_EXTENSION_NAME);
 	if (portability_enumeration_support) {
 		extensions.push_back(VK_KHR_PORTABILITY_ENUMERATION_EXTENSION_NAME);
 	}
@@ -603,7 +719,7 @@ Result<Instance> InstanceBuilder::build() const {
 #endif
 	if (!info.headless_context) {
 		auto check_add_window_ext = [&](const char* name) -> bool {
-			if (!detail::check_extension_supported(system.available_extensions, name)) return false;
+			if (!detail::check_extension_supported(system.extension_set, name)) return false;
 			extensions.push_back(name);
 			return true;
 		};
@@ -625,13 +741,12 @@ Result<Instance> InstanceBuilder::build() const {
 		if (!khr_surface_added || !added_window_exts)
 			return make_error_code(InstanceError::windowing_extensions_not_present);
 	}
-	bool all_extensions_supported = detail::check_extensions_supported(system.available_extensions, extensions);
+	bool all_extensions_supported = detail::check_extensions_supported(system.extension_set, extensions);
 	if (!all_extensions_supported) {
 		return make_error_code(InstanceError::requested_extensions_not_present);
 	}
 
-	for (auto& layer : info.layers)
-		layers.push_back(layer);
+	layers.insert(layers.end(), info.layers.begin(), info.layers.end());
 
 	if (info.enable_validation_layers || (info.request_validation_layers && system.validation_layers_available)) {
 		layers.push_back(detail::validation_layer_name);
@@ -641,7 +756,8 @@ Result<Instance> InstanceBuilder::build() const {
 		return make_error_code(InstanceError::requested_layers_not_present);
 	}
 
-	std::vector<VkBaseOutStructure*> pNext_chain;
+	detail::ScratchVector<VkBaseOutStructure*> pNext_chain{ info.scratch_arena };
+	pNext_chain.reserve(3);
 
 	VkDebugUtilsMessengerCreateInfoEXT messengerCreateInfo = {};
 	if (info.use_debug_messenger) {
@@ -716,6 +832,7 @@ Result<Instance> InstanceBuilder::build() const {
 
 	instance.headless = info.headless_context;
 	instance.supports_properties2_ext = supports_properties2_ext;
+	instance.layers.assign(layers.begin(), layers.end());
 	instance.allocation_callbacks = info.allocation_callbacks;
 	instance.instance_version = instance_version;
 	instance.api_version = api_version;
@@ -842,6 +959,10 @@ InstanceBuilder& InstanceBuilder::set_allocation_callbacks(VkAllocationCallbacks
 	info.allocation_callbacks = callbacks;
 	return *this;
 }
+InstanceBuilder& InstanceBuilder::set_scratch_arena(ScratchArena* arena) {
+	info.scratch_arena = arena;
+	return *this;
+}
 
 void destroy_debug_messenger(VkInstance const instance, VkDebugUtilsMessengerEXT const messenger);
 
@@ -850,15 +971,12 @@ void destroy_debug_messenger(VkInstance const instance, VkDebugUtilsMessengerEXT
 
 namespace detail {
 
-std::vector<std::string> check_device_extension_support(
-    std::vector<std::string> const& available_extensions, std::vector<std::string> const& desired_extensions) {
-	std::vector<std::string> extensions_to_enable;
-	for (const auto& avail_ext : available_extensions) {
-		for (auto& req_ext : desired_extensions) {
-			if (avail_ext == req_ext) {
-				extensions_to_enable.push_back(req_ext);
-				break;
-			}
+std::vector<const char*> check_device_extension_support(
+    ExtensionSet const& available_extensions, std::vector<const char*> const& desired_extensions) {
+	std::vector<const char*> extensions_to_enable;
+	for (const auto& req_ext : desired_extensions) {
+		if (available_extensions.contains(req_ext)) {
+			extensions_to_enable.push_back(req_ext);
 		}
 	}
 	return extensions_to_enable;
@@ -982,8 +1100,27 @@ uint32_t get_present_queue_index(
 	}
 	return QUEUE_INDEX_MAX_VALUE;
 }
+
+// Details of every physical device queried so far, for all selectors. Keyed by the device UUID and
+// whatever else changes the queried details: the instance version, VK_KHR_get_physical_device_properties2,
+// the sTypes of the extended features chain and the enabled instance layers.
+struct PhysicalDeviceCache {
+	std::mutex mutex;
+	std::map<std::string, PhysicalDevice> details;
+};
+
+PhysicalDeviceCache& physical_device_cache() {
+	static PhysicalDeviceCache cache;
+	return cache;
+}
 } // namespace detail
 
+void PhysicalDeviceSelector::invalidate_cache() {
+	auto& cache = detail::physical_device_cache();
+	std::lock_guard<std::mutex> lg(cache.mutex);
+	cache.details.clear();
+}
+
 PhysicalDevice PhysicalDeviceSelector::populate_device_details(VkPhysicalDevice vk_phys_device,
     std::vector<detail::GenericFeaturesPNextNode> const& src_extended_features_chain) const {
 	PhysicalDevice physical_device{};
@@ -991,23 +1128,61 @@ PhysicalDevice PhysicalDeviceSelector::populate_device_details(VkPhysicalDevice
 	physical_device.surface = instance_info.surface;
 	physical_device.defer_surface_initialization = criteria.defer_surface_initialization;
 	physical_device.instance_version = instance_info.version;
-	auto queue_families = detail::get_vector_noerror<VkQueueFamilyProperties>(
-	    detail::vulkan_functions().fp_vkGetPhysicalDeviceQueueFamilyProperties, vk_phys_device);
-	physical_device.queue_families = queue_families;
 
+	// The UUID and the API version the cache lookup needs, everything else is queried after a miss
 	detail::vulkan_functions().fp_vkGetPhysicalDeviceProperties(vk_phys_device, &physical_device.properties);
-	detail::vulkan_functions().fp_vkGetPhysicalDeviceFeatures(vk_phys_device, &physical_device.features);
-	detail::vulkan_functions().fp_vkGetPhysicalDeviceMemoryProperties(vk_phys_device, &physical_device.memory_properties);
 
 	physical_device.name = physical_device.properties.deviceName;
 
+#if defined(VKB_VK_API_VERSION_1_1)
+	if (instance_info.version >= VKB_VK_API_VERSION_1_1 && physical_device.properties.apiVersion >= VKB_VK_API_VERSION_1_1) {
+		VkPhysicalDeviceIDProperties id_properties{};
+		id_properties.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_ID_PROPERTIES;
+		VkPhysicalDeviceProperties2 properties2{};
+		properties2.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PROPERTIES_2;
+		properties2.pNext = &id_properties;
+		detail::vulkan_functions().fp_vkGetPhysicalDeviceProperties2(vk_phys_device, &properties2);
+		memcpy(physical_device.device_uuid, id_properties.deviceUUID, VK_UUID_SIZE);
+	}
+#endif
+
+	// Without a UUID (Vulkan 1.0) there's no key that holds across instances, query every time
+	std::string cache_key;
+	const uint8_t no_uuid[VK_UUID_SIZE]{};
+	if (memcmp(physical_device.device_uuid, no_uuid, VK_UUID_SIZE) != 0) {
+		cache_key.assign(reinterpret_cast<const char*>(physical_device.device_uuid), VK_UUID_SIZE);
+		cache_key.append(reinterpret_cast<const char*>(&instance_info.version), sizeof(instance_info.version));
+		cache_key.push_back(instance_info.supports_properties2_ext ? 1 : 0);
+		for (const auto& node : src_extended_features_chain) {
+			cache_key.append(reinterpret_cast<const char*>(&node.sType), sizeof(node.sType));
+		}
+		// Layers can add device extensions
+		for (const auto& layer : instance_info.layers) {
+			cache_key.append(layer.c_str(), layer.size() + 1);
+		}
+
+		auto& cache = detail::physical_device_cache();
+		std::lock_guard<std::mutex> lg(cache.mutex);
+		auto cached = cache.details.find(cache_key);
+		if (cached != cache.details.end()) {
+			PhysicalDevice cached_device = cached->second;
+			cached_device.physical_device = vk_phys_device;
+			cached_device.surface = instance_info.surface;
+			cached_device.defer_surface_initialization = criteria.defer_surface_initialization;
+			return cached_device;
+		}
+	}
+
+	physical_device.queue_families = detail::get_vector_noerror<VkQueueFamilyProperties>(
+	    detail::vulkan_functions().fp_vkGetPhysicalDeviceQueueFamilyProperties, vk_phys_device);
+	detail::vulkan_functions().fp_vkGetPhysicalDeviceFeatures(vk_phys_device, &physical_device.features);
+	detail::vulkan_functions().fp_vkGetPhysicalDeviceMemoryProperties(vk_phys_device, &physical_device.memory_properties);
+
 	std::vector<VkExtensionProperties> available_extensions;
 	auto available_extensions_ret = detail::get_vector<VkExtensionProperties>(
 	    available_extensions, detail::vulkan_functions().fp_vkEnumerateDeviceExtensionProperties, vk_phys_device, nullptr);
 	if (available_extensions_ret != VK_SUCCESS) return physical_device;
-	for (const auto& ext : available_extensions) {
-		physical_device.extensions.push_back(&ext.extensionName[0]);
-	}
+	physical_device.available_extensions = detail::ExtensionSet(available_extensions);
 
 #if defined(VKB_VK_API_VERSION_1_1)
 	physical_device.features2.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FEATURES_2;
@@ -1015,9 +1190,11 @@ PhysicalDevice PhysicalDeviceSelector::populate_device_details(VkPhysicalDevice
 	physical_device.features2.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FEATURES_2_KHR;
 #endif
 
-	auto fill_chain = src_extended_features_chain;
-
-	if (!fill_chain.empty() && (instance_info.version >= VKB_VK_API_VERSION_1_1 || instance_info.supports_properties2_ext)) {
+	if (!src_extended_features_chain.empty() &&
+	    (instance_info.version >= VKB_VK_API_VERSION_1_1 || instance_info.supports_properties2_ext)) {
+		// Filled in place rather than in a copy that's copied again afterwards
+		physical_device.extended_features_chain = src_extended_features_chain;
+		auto& fill_chain = physical_device.extended_features_chain;
 
 		detail::GenericFeaturesPNextNode* prev = nullptr;
 		for (auto& extension : fill_chain) {
@@ -1047,7 +1224,12 @@ PhysicalDevice PhysicalDeviceSelector::populate_device_details(VkPhysicalDevice
 			detail::vulkan_functions().fp_vkGetPhysicalDeviceFeatures2KHR(vk_phys_device, &local_features_khr);
 		}
 #endif
-		physical_device.extended_features_chain = fill_chain;
+	}
+
+	if (!cache_key.empty()) {
+		auto& cache = detail::physical_device_cache();
+		std::lock_guard<std::mutex> lg(cache.mutex);
+		cache.details[cache_key] = physical_device;
 	}
 
 	return physical_device;
@@ -1080,11 +1262,11 @@ PhysicalDevice::Suitable PhysicalDeviceSelector::is_device_suitable(PhysicalDevi
 	if (criteria.require_present && !present_queue && !criteria.defer_surface_initialization)
 		return PhysicalDevice::Suitable::no;
 
-	auto required_extensions_supported = detail::check_device_extension_support(pd.extensions, criteria.required_extensions);
+	auto required_extensions_supported = detail::check_device_extension_support(pd.available_extensions, criteria.required_extensions);
 	if (required_extensions_supported.size() != criteria.required_extensions.size())
 		return PhysicalDevice::Suitable::no;
 
-	auto desired_extensions_supported = detail::check_device_extension_support(pd.extensions, criteria.desired_extensions);
+	auto desired_extensions_supported = detail::check_device_extension_support(pd.available_extensions, criteria.desired_extensions);
 	if (desired_extensions_supported.size() != criteria.desired_extensions.size())
 		suitable = PhysicalDevice::Suitable::partial;
 
@@ -1134,6 +1316,7 @@ PhysicalDeviceSelector::PhysicalDeviceSelector(Instance const& instance, VkSurfa
 	instance_info.instance = instance.instance;
 	instance_info.version = instance.instance_version;
 	instance_info.supports_properties2_ext = instance.supports_properties2_ext;
+	instance_info.layers = instance.layers;
 	instance_info.surface = surface;
 	criteria.require_present = !instance.headless;
 	criteria.required_version = instance.api_version;
@@ -1159,7 +1342,7 @@ Result<std::vector<PhysicalDevice>> PhysicalDeviceSelector::select_impl(DeviceSe
 	}
 
 	// Get the VkPhysicalDevice handles on the system
-	std::vector<VkPhysicalDevice> vk_physical_devices;
+	detail::ScratchVector<VkPhysicalDevice> vk_physical_devices{ criteria.scratch_arena };
 
 	auto vk_physical_devices_ret = detail::get_vector<VkPhysicalDevice>(
 	    vk_physical_devices, detail::vulkan_functions().fp_vkEnumeratePhysicalDevices, instance_info.instance);
@@ -1173,20 +1356,17 @@ Result<std::vector<PhysicalDevice>> PhysicalDeviceSelector::select_impl(DeviceSe
 	auto fill_out_phys_dev_with_criteria = [&](PhysicalDevice& phys_dev) {
 		phys_dev.features = criteria.required_features;
 		phys_dev.extended_features_chain = criteria.extended_features_chain;
-		bool portability_ext_available = false;
-		for (const auto& ext : phys_dev.extensions)
-			if (criteria.enable_portability_subset && ext == "VK_KHR_portability_subset")
-				portability_ext_available = true;
+		const char* portability_ext =
+		    criteria.enable_portability_subset ? phys_dev.available_extensions.find("VK_KHR_portability_subset") : nullptr;
 
-		auto desired_extensions_supported = detail::check_device_extension_support(phys_dev.extensions, criteria.desired_extensions);
+		auto desired_extensions_supported =
+		    detail::check_device_extension_support(phys_dev.available_extensions, criteria.desired_extensions);
 
-		phys_dev.extensions.clear();
-		phys_dev.extensions.insert(
-		    phys_dev.extensions.end(), criteria.required_extensions.begin(), criteria.required_extensions.end());
+		phys_dev.extensions = criteria.required_extensions;
 		phys_dev.extensions.insert(
 		    phys_dev.extensions.end(), desired_extensions_supported.begin(), desired_extensions_supported.end());
-		if (portability_ext_available) {
-			phys_dev.extensions.push_back("VK_KHR_portability_subset");
+		if (portability_ext != nullptr) {
+			phys_dev.extensions.push_back(portability_ext);
 		}
 	};
 
@@ -1197,13 +1377,23 @@ Result<std::vector<PhysicalDevice>> PhysicalDeviceSelector::select_impl(DeviceSe
 		return std::vector<PhysicalDevice>{ physical_device };
 	}
 
-	// Populate their details and check their suitability
-	std::vector<PhysicalDevice> physical_devices;
+	// Populate their details, one thread per device as the queries don't depend on each other,
+	// then check their suitability
+	detail::ScratchVector<std::future<PhysicalDevice>> populated_devices{ criteria.scratch_arena };
+	populated_devices.reserve(vk_physical_devices.size());
+	auto launch = vk_physical_devices.size() > 1 ? std::launch::async : std::launch::deferred;
 	for (auto& vk_physical_device : vk_physical_devices) {
-		PhysicalDevice phys_dev = populate_device_details(vk_physical_device, criteria.extended_features_chain);
+		populated_devices.push_back(std::async(launch, [this, vk_physical_device] {
+			return populate_device_details(vk_physical_device, criteria.extended_features_chain);
+		}));
+	}
+	std::vector<PhysicalDevice> physical_devices;
+	physical_devices.reserve(populated_devices.size());
+	for (auto& populated_device : populated_devices) {
+		PhysicalDevice phys_dev = populated_device.get();
 		phys_dev.suitable = is_device_suitable(phys_dev);
 		if (phys_dev.suitable != PhysicalDevice::Suitable::no) {
-			physical_devices.push_back(phys_dev);
+			physical_devices.push_back(std::move(phys_dev));
 		}
 	}
 
@@ -1222,6 +1412,19 @@ Result<std::vector<PhysicalDevice>> PhysicalDeviceSelector::select_impl(DeviceSe
 		fill_out_phys_dev_with_criteria(physical_device);
 	}
 
+	// Rank each suitability class by score, the partition above stays in place
+	if (criteria.scorer) {
+		for (auto& physical_device : physical_devices) {
+			physical_device.score = criteria.scorer(physical_device);
+		}
+		auto by_score = [](PhysicalDevice const& a, PhysicalDevice const& b) { return a.score > b.score; };
+		auto fully_suitable_end = std::find_if(physical_devices.begin(), physical_devices.end(), [](auto const& pd) {
+			return pd.suitable != PhysicalDevice::Suitable::yes;
+		});
+		std::stable_sort(physical_devices.begin(), fully_suitable_end, by_score);
+		std::stable_sort(fully_suitable_end, physical_devices.end(), by_score);
+	}
+
 	return physical_devices;
 }
 
@@ -1303,22 +1506,22 @@ PhysicalDeviceSelector& PhysicalDeviceSelector::desired_device_memory_size(VkDev
 	return *this;
 }
 PhysicalDeviceSelector& PhysicalDeviceSelector::add_required_extension(const char* extension) {
-	criteria.required_extensions.push_back(extension);
+	criteria.required_extensions.push_back(detail::intern_extension_name(extension));
 	return *this;
 }
 PhysicalDeviceSelector& PhysicalDeviceSelector::add_required_extensions(std::vector<const char*> extensions) {
 	for (const auto& ext : extensions) {
-		criteria.required_extensions.push_back(ext);
+		criteria.required_extensions.push_back(detail::intern_extension_name(ext));
 	}
 	return *this;
 }
 PhysicalDeviceSelector& PhysicalDeviceSelector::add_desired_extension(const char* extension) {
-	criteria.desired_extensions.push_back(extension);
+	criteria.desired_extensions.push_back(detail::intern_extension_name(extension));
 	return *this;
 }
 PhysicalDeviceSelector& PhysicalDeviceSelector::add_desired_extensions(std::vector<const char*> extensions) {
 	for (const auto& ext : extensions) {
-		criteria.desired_extensions.push_back(ext);
+		criteria.desired_extensions.push_back(detail::intern_extension_name(ext));
 	}
 	return *this;
 }
@@ -1367,6 +1570,14 @@ PhysicalDeviceSelector& PhysicalDeviceSelector::select_first_device_unconditiona
 	criteria.use_first_gpu_unconditionally = unconditionally;
 	return *this;
 }
+PhysicalDeviceSelector& PhysicalDeviceSelector::set_device_scorer(std::function<double(PhysicalDevice const&)> scorer) {
+	criteria.scorer = std::move(scorer);
+	return *this;
+}
+PhysicalDeviceSelector& PhysicalDeviceSelector::set_scratch_arena(ScratchArena* arena) {
+	criteria.scratch_arena = arena;
+	return *this;
+}
 
 // PhysicalDevice
 bool PhysicalDevice::has_dedicated_compute_queue() const {
@@ -1382,7 +1593,10 @@ bool PhysicalDevice::has_separate_transfer_queue() const {
 	return detail::get_separate_queue_index(queue_families, VK_QUEUE_TRANSFER_BIT, VK_QUEUE_COMPUTE_BIT) != detail::QUEUE_INDEX_MAX_VALUE;
 }
 std::vector<VkQueueFamilyProperties> PhysicalDevice::get_queue_families() const { return queue_families; }
-std::vector<std::string> PhysicalDevice::get_extensions() const { return extensions; }
+std::vector<std::string> PhysicalDevice::get_extensions() const {
+	return std::vector<std::string>(extensions.begin(), extensions.end());
+}
+bool PhysicalDevice::is_extension_present(const char* extension) const { return available_extensions.contains(extension); }
 PhysicalDevice::operator VkPhysicalDevice() const { return this->physical_device; }
 
 // ---- Queues ---- //
@@ -1464,35 +1678,40 @@ DeviceBuilder::DeviceBuilder(PhysicalDevice phys_device) { physical_device = phy
 
 Result<Device> DeviceBuilder::build() const {
 
-	std::vector<CustomQueueDescription> queue_descriptions;
-	queue_descriptions.insert(queue_descriptions.end(), info.queue_descriptions.begin(), info.queue_descriptions.end());
-
-	if (queue_descriptions.size() == 0) {
-		for (uint32_t i = 0; i < physical_device.queue_families.size(); i++) {
-			queue_descriptions.push_back(CustomQueueDescription{ i, 1, std::vector<float>{ 1.0f } });
-		}
-	}
+	// Without custom queues, one queue per family, all pointing at the same priority
+	static const float default_queue_priority = 1.0f;
 
-	std::vector<VkDeviceQueueCreateInfo> queueCreateInfos;
-	for (auto& desc : queue_descriptions) {
+	detail::ScratchVector<VkDeviceQueueCreateInfo> queueCreateInfos{ info.scratch_arena };
+	auto add_queue_create_info = [&](uint32_t index, uint32_t count, const float* priorities) {
 		VkDeviceQueueCreateInfo queue_create_info = {};
 		queue_create_info.sType = VK_STRUCTURE_TYPE_DEVICE_QUEUE_CREATE_INFO;
-		queue_create_info.queueFamilyIndex = desc.index;
-		queue_create_info.queueCount = desc.count;
-		queue_create_info.pQueuePriorities = desc.priorities.data();
+		queue_create_info.queueFamilyIndex = index;
+		queue_create_info.queueCount = count;
+		queue_create_info.pQueuePriorities = priorities;
 		queueCreateInfos.push_back(queue_create_info);
+	};
+	if (info.queue_descriptions.size() == 0) {
+		queueCreateInfos.reserve(physical_device.queue_families.size());
+		for (uint32_t i = 0; i < physical_device.queue_families.size(); i++) {
+			add_queue_create_info(i, 1, &default_queue_priority);
+		}
+	} else {
+		queueCreateInfos.reserve(info.queue_descriptions.size());
+		for (auto& desc : info.queue_descriptions) {
+			add_queue_create_info(desc.index, desc.count, desc.priorities.data());
+		}
 	}
 
-	std::vector<const char*> extensions;
-	for (const auto& ext : physical_device.extensions) {
-		extensions.push_back(ext.c_str());
-	}
+	detail::ScratchVector<const char*> extensions{ info.scratch_arena };
+	extensions.reserve(physical_device.extensions.size() + 1);
+	extensions.insert(extensions.end(), physical_device.extensions.begin(), physical_device.extensions.end());
 	if (physical_device.surface != VK_NULL_HANDLE || physical_device.defer_surface_initialization)
 		extensions.push_back({ VK_KHR_SWAPCHAIN_EXTENSION_NAME });
 
 	bool has_phys_dev_features_2 = false;
 	bool user_defined_phys_dev_features_2 = false;
-	std::vector<VkBaseOutStructure*> final_pnext_chain;
+	detail::ScratchVector<VkBaseOutStructure*> final_pnext_chain{ info.scratch_arena };
+	final_pnext_chain.reserve(1 + physical_device.extended_features_chain.size() + info.pNext_chain.size());
 	VkDeviceCreateInfo device_create_info = {};
 
 #if defined(VKB_VK_API_VERSION_1_1)
@@ -1503,7 +1722,9 @@ Result<Device> DeviceBuilder::build() const {
 		}
 	}
 
-	auto physical_device_extension_features_copy = physical_device.extended_features_chain;
+	detail::ScratchVector<detail::GenericFeaturesPNextNode> physical_device_extension_features_copy{ info.scratch_arena };
+	physical_device_extension_features_copy.assign(
+	    physical_device.extended_features_chain.begin(), physical_device.extended_features_chain.end());
 	VkPhysicalDeviceFeatures2 local_features2{};
 	local_features2.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FEATURES_2;
 
@@ -1569,6 +1790,10 @@ DeviceBuilder& DeviceBuilder::set_allocation_callbacks(VkAllocationCallbacks* ca
 	info.allocation_callbacks = callbacks;
 	return *this;
 }
+DeviceBuilder& DeviceBuilder::set_scratch_arena(ScratchArena* arena) {
+	info.scratch_arena = arena;
+	return *this;
+}
 
 // ---- Swapchain ---- //
 
@@ -1744,10 +1969,23 @@ Result<Swapchain> SwapchainBuilder::build() const {
 	auto desired_present_modes = info.desired_present_modes;
 	if (desired_present_modes.size() == 0) add_desired_present_modes(desired_present_modes);
 
-	auto surface_support_ret = detail::query_surface_support_details(info.physical_device, info.surface);
-	if (!surface_support_ret.has_value())
-		return Error{ SwapchainError::failed_query_surface_support_details, surface_support_ret.vk_result() };
-	auto surface_support = surface_support_ret.value();
+	// Rebuilding for the same surface, the formats and present modes stay, only the capabilities (extent) change
+	auto const& rebuilt = info.rebuilt_swapchain;
+	bool reuse_surface_support = rebuilt.swapchain != VK_NULL_HANDLE && rebuilt.device == info.device &&
+	                             rebuilt.surface == info.surface && !rebuilt.surface_formats.empty();
+	detail::SurfaceSupportDetails surface_support{};
+	if (reuse_surface_support) {
+		VkResult res = detail::vulkan_functions().fp_vkGetPhysicalDeviceSurfaceCapabilitiesKHR(
+		    info.physical_device, info.surface, &surface_support.capabilities);
+		if (res != VK_SUCCESS) return Error{ SwapchainError::failed_query_surface_support_details, res };
+		surface_support.formats = rebuilt.surface_formats;
+		surface_support.present_modes = rebuilt.present_modes;
+	} else {
+		auto surface_support_ret = detail::query_surface_support_details(info.physical_device, info.surface);
+		if (!surface_support_ret.has_value())
+			return Error{ SwapchainError::failed_query_surface_support_details, surface_support_ret.vk_result() };
+		surface_support = surface_support_ret.value();
+	}
 
 	uint32_t image_count = info.min_image_count;
 	if (info.required_min_image_count >= 1) {
@@ -1817,9 +2055,22 @@ Result<Swapchain> SwapchainBuilder::build() const {
 	swapchain_create_info.clipped = info.clipped;
 	swapchain_create_info.oldSwapchain = info.old_swapchain;
 	Swapchain swapchain{};
-	PFN_vkCreateSwapchainKHR swapchain_create_proc;
-	detail::vulkan_functions().get_device_proc_addr(info.device, swapchain_create_proc, "vkCreateSwapchainKHR");
-	auto res = swapchain_create_proc(info.device, &swapchain_create_info, info.allocation_callbacks, &swapchain.swapchain);
+	if (reuse_surface_support) {
+		swapchain.internal_table = rebuilt.internal_table;
+	} else {
+		detail::vulkan_functions().get_device_proc_addr(
+		    info.device, swapchain.internal_table.fp_vkCreateSwapchainKHR, "vkCreateSwapchainKHR");
+		detail::vulkan_functions().get_device_proc_addr(
+		    info.device, swapchain.internal_table.fp_vkGetSwapchainImagesKHR, "vkGetSwapchainImagesKHR");
+		detail::vulkan_functions().get_device_proc_addr(
+		    info.device, swapchain.internal_table.fp_vkCreateImageView, "vkCreateImageView");
+		detail::vulkan_functions().get_device_proc_addr(
+		    info.device, swapchain.internal_table.fp_vkDestroyImageView, "vkDestroyImageView");
+		detail::vulkan_functions().get_device_proc_addr(
+		    info.device, swapchain.internal_table.fp_vkDestroySwapchainKHR, "vkDestroySwapchainKHR");
+	}
+	auto res = swapchain.internal_table.fp_vkCreateSwapchainKHR(
+	    info.device, &swapchain_create_info, info.allocation_callbacks, &swapchain.swapchain);
 
 	if (res != VK_SUCCESS) {
 		return Error{ SwapchainError::failed_create_swapchain, res };
@@ -1829,12 +2080,9 @@ Result<Swapchain> SwapchainBuilder::build() const {
 	swapchain.color_space = surface_format.colorSpace;
 	swapchain.image_usage_flags = info.image_usage_flags;
 	swapchain.extent = extent;
-	detail::vulkan_functions().get_device_proc_addr(
-	    info.device, swapchain.internal_table.fp_vkGetSwapchainImagesKHR, "vkGetSwapchainImagesKHR");
-	detail::vulkan_functions().get_device_proc_addr(info.device, swapchain.internal_table.fp_vkCreateImageView, "vkCreateImageView");
-	detail::vulkan_functions().get_device_proc_addr(info.device, swapchain.internal_table.fp_vkDestroyImageView, "vkDestroyImageView");
-	detail::vulkan_functions().get_device_proc_addr(
-	    info.device, swapchain.internal_table.fp_vkDestroySwapchainKHR, "vkDestroySwapchainKHR");
+	swapchain.surface = info.surface;
+	swapchain.surface_formats = std::move(surface_support.formats);
+	swapchain.present_modes = std::move(surface_support.present_modes);
 	auto images = swapchain.get_images();
 	if (!images) {
 		return Error{ SwapchainError::failed_get_swapchain_images };
@@ -1847,6 +2095,8 @@ Result<Swapchain> SwapchainBuilder::build() const {
 	return swapchain;
 }
 Result<std::vector<VkImage>> Swapchain::get_images() {
+	if (!images.empty()) return images;
+
 	std::vector<VkImage> swapchain_images;
 
 	auto swapchain_images_ret =
@@ -1854,6 +2104,7 @@ Result<std::vector<VkImage>> Swapchain::get_images() {
 	if (swapchain_images_ret != VK_SUCCESS) {
 		return Error{ SwapchainError::failed_get_swapchain_images, swapchain_images_ret };
 	}
+	images = swapchain_images;
 	return swapchain_images;
 }
 Result<std::vector<VkImageView>> Swapchain::get_image_views() { return get_image_views(nullptr); }
@@ -1914,10 +2165,12 @@ void Swapchain::destroy_image_views(std::vector<VkImageView> const& image_views)
 Swapchain::operator VkSwapchainKHR() const { return this->swapchain; }
 SwapchainBuilder& SwapchainBuilder::set_old_swapchain(VkSwapchainKHR old_swapchain) {
 	info.old_swapchain = old_swapchain;
+	info.rebuilt_swapchain = Swapchain{};
 	return *this;
 }
 SwapchainBuilder& SwapchainBuilder::set_old_swapchain(Swapchain const& swapchain) {
 	info.old_swapchain = swapchain.swapchain;
+	info.rebuilt_swapchain = swapchain;
 	return *this;
 }
 SwapchainBuilder& SwapchainBuilder::set_desired_extent(uint32_t width, uint32_t height) {
@@ -17,12 +17,17 @@
 #pragma once
 
 #include <cassert>
+#include <cstddef>
 #include <cstdio>
 #include <cstring>
 
+#include <functional>
+#include <memory>
 #include <vector>
 #include <string>
+#include <string_view>
 #include <system_error>
+#include <unordered_set>
 
 #include <vulkan/vulkan.h>
 
@@ -157,7 +162,62 @@ template <typename T> class Result {
 	bool m_init;
 };
 
+// Scratch memory for the temporary arrays the builders use during build() and select(): layer and extension
+// names, queue create infos, pNext chains and the copies of the extension feature structs. They're bumped out of
+// the caller's buffer, so bring-up doesn't go to the heap for them as long as the buffer is large enough. Once it
+// runs out they fall back to the heap, which is counted by heap_allocations(). What the calls return, and the
+// shared state and thread of select()'s per-device std::async workers, still come from the heap.
+// Memory is given back in reverse order of allocation, which is how a build() releases its temporaries, so one
+// arena can be handed to every builder in turn. Not thread safe.
+class ScratchArena {
+	public:
+	ScratchArena(void* buffer, size_t size) noexcept;
+	ScratchArena(ScratchArena const&) = delete;
+	ScratchArena& operator=(ScratchArena const&) = delete;
+
+	void* allocate(size_t size, size_t alignment);
+	void deallocate(void* memory, size_t size, size_t alignment) noexcept;
+
+	// Bytes of the buffer in use right now, and at most so far
+	size_t used() const noexcept { return offset; }
+	size_t peak() const noexcept { return peak_offset; }
+	// Allocations that didn't fit in the buffer
+	size_t heap_allocations() const noexcept { return heap_allocation_count; }
+
+	private:
+	std::byte* buffer;
+	size_t capacity;
+	size_t offset = 0;
+	size_t peak_offset = 0;
+	size_t live_allocations = 0;
+	size_t heap_allocation_count = 0;
+};
+
 namespace detail {
+// Standard allocator over a ScratchArena, or the heap when there's no arena
+template <typename T> struct ScratchAllocator {
+	using value_type = T;
+
+	ScratchAllocator(ScratchArena* arena = nullptr) noexcept : arena(arena) {}
+	template <typename U> ScratchAllocator(ScratchAllocator<U> const& other) noexcept : arena(other.arena) {}
+
+	T* allocate(size_t count) {
+		if (arena == nullptr) return std::allocator<T>{}.allocate(count);
+		return static_cast<T*>(arena->allocate(count * sizeof(T), alignof(T)));
+	}
+	void deallocate(T* memory, size_t count) noexcept {
+		if (arena == nullptr) return std::allocator<T>{}.deallocate(memory, count);
+		arena->deallocate(memory, count * sizeof(T), alignof(T));
+	}
+
+	friend bool operator==(ScratchAllocator const& a, ScratchAllocator const& b) noexcept { return a.arena == b.arena; }
+	friend bool operator!=(ScratchAllocator const& a, ScratchAllocator const& b) noexcept { return a.arena != b.arena; }
+
+	ScratchArena* arena;
+};
+
+template <typename T> using ScratchVector = std::vector<T, ScratchAllocator<T>>;
+
 struct GenericFeaturesPNextNode {
 
 	static const uint32_t field_capacity = 256;
@@ -176,6 +236,24 @@ struct GenericFeaturesPNextNode {
 	VkBool32 fields[field_capacity];
 };
 
+// Stores an extension name once per process. The same name always gives back the same pointer, valid until exit.
+const char* intern_extension_name(const char* name);
+
+// The extensions an instance or device supports, looked up by hash. The names are interned, and copies share
+// one table, so building it doesn't copy every name into a string of its own.
+class ExtensionSet {
+	public:
+	ExtensionSet() = default;
+	explicit ExtensionSet(std::vector<VkExtensionProperties> const& properties);
+
+	bool contains(const char* name) const { return find(name) != nullptr; }
+	// The interned name, nullptr if it isn't in the set
+	const char* find(const char* name) const;
+
+	private:
+	std::shared_ptr<const std::unordered_set<std::string_view>> names;
+};
+
 } // namespace detail
 
 enum class InstanceError {
@@ -242,6 +320,16 @@ struct SystemInfo {
 	static Result<SystemInfo> get_system_info();
 	static Result<SystemInfo> get_system_info(PFN_vkGetInstanceProcAddr fp_vkGetInstanceProcAddr);
 
+	// Same information, but enumerated once per process and shared by every caller, InstanceBuilder::build()
+	// included. Safe to call from several threads, the first caller enumerates while the others wait.
+	// A different fp_vkGetInstanceProcAddr than the snapshot was taken with enumerates again.
+	static Result<std::shared_ptr<const SystemInfo>> get_cached_system_info();
+	static Result<std::shared_ptr<const SystemInfo>> get_cached_system_info(PFN_vkGetInstanceProcAddr fp_vkGetInstanceProcAddr);
+	// Drops the cached snapshot, the next call enumerates again. Needed when the available layers change
+	// during the run, ie after changing VK_INSTANCE_LAYERS or installing a layer. Snapshots already handed
+	// out stay valid.
+	static void invalidate_cache();
+
 	// Returns true if a layer is available
 	bool is_layer_available(const char* layer_name) const;
 	// Returns true if an extension is available
@@ -251,6 +339,11 @@ struct SystemInfo {
 	std::vector<VkExtensionProperties> available_extensions;
 	bool validation_layers_available = false;
 	bool debug_utils_available = false;
+
+	private:
+	// available_extensions by name
+	detail::ExtensionSet extension_set;
+	friend class InstanceBuilder;
 };
 
 // Forward declared - check VkBoostrap.cpp for implementations
@@ -289,6 +382,7 @@ struct Instance {
 	bool supports_properties2_ext = false;
 	uint32_t instance_version = VKB_VK_API_VERSION_1_0;
 	uint32_t api_version = VKB_VK_API_VERSION_1_0;
+	std::vector<std::string> layers;
 
 	friend class InstanceBuilder;
 	friend class PhysicalDeviceSelector;
@@ -409,6 +503,9 @@ class InstanceBuilder {
 	// Provide custom allocation callbacks.
 	InstanceBuilder& set_allocation_callbacks(VkAllocationCallbacks* callbacks);
 
+	// Take build()'s temporary arrays from `arena` instead of the heap. The arena must outlive build().
+	InstanceBuilder& set_scratch_arena(ScratchArena* arena);
+
 	private:
 	struct InstanceInfo {
 		// VkApplicationInfo
@@ -442,6 +539,7 @@ class InstanceBuilder {
 
 		// Custom allocator
 		VkAllocationCallbacks* allocation_callbacks = VK_NULL_HANDLE;
+		ScratchArena* scratch_arena = nullptr;
 
 		bool request_validation_layers = false;
 		bool enable_validation_layers = false;
@@ -474,6 +572,12 @@ struct PhysicalDevice {
 	VkPhysicalDeviceProperties properties{};
 	VkPhysicalDeviceMemoryProperties memory_properties{};
 
+	// VkPhysicalDeviceIDProperties::deviceUUID, stays the same across runs so it can key per-device caches.
+	// All zero when the instance or the device doesn't support Vulkan 1.1.
+	uint8_t device_uuid[VK_UUID_SIZE]{};
+	// What the selector's device scorer returned for this device, 0 when no scorer was set.
+	double score = 0.0;
+
 	// Has a queue family that supports compute operations but not graphics nor transfer.
 	bool has_dedicated_compute_queue() const;
 	// Has a queue family that supports transfer operations but not graphics nor compute.
@@ -489,6 +593,8 @@ struct PhysicalDevice {
 
 	// Query the list of extensions which should be enabled
 	std::vector<std::string> get_extensions() const;
+	// Returns true if the device supports `extension`, whether or not it will be enabled
+	bool is_extension_present(const char* extension) const;
 
 	// A conversion function which allows this PhysicalDevice to be used
 	// in places where VkPhysicalDevice would have been used.
@@ -496,7 +602,9 @@ struct PhysicalDevice {
 
 	private:
 	uint32_t instance_version = VKB_VK_API_VERSION_1_0;
-	std::vector<std::string> extensions;
+	detail::ExtensionSet available_extensions;
+	// Interned names of the extensions to enable
+	std::vector<const char*> extensions;
 	std::vector<VkQueueFamilyProperties> queue_families;
 	std::vector<detail::GenericFeaturesPNextNode> extended_features_chain;
 #if defined(VKB_VK_API_VERSION_1_1)
@@ -523,6 +631,8 @@ enum class DeviceSelectionMode {
 // Enumerates the physical devices on the system, and based on the added criteria, returns a physical device or list of physical devies
 // A device is considered suitable if it meets all the 'required' and 'desired' criteria.
 // A device is considered partially suitable if it meets only the 'required' criteria.
+// The details of each device are queried concurrently and kept per device UUID for the rest of the process, so
+// selecting again, with this or another selector, only queries the properties and devices not seen before.
 class PhysicalDeviceSelector {
 	public:
 	// Requires a vkb::Instance to construct, needed to pass instance creation info.
@@ -623,6 +733,20 @@ class PhysicalDeviceSelector {
 	// Only use when: The first gpu in the list may be set by global user preferences and an application may wish to respect it.
 	PhysicalDeviceSelector& select_first_device_unconditionally(bool unconditionally = true);
 
+	// Order the suitable devices by the score `scorer` gives them, highest first, instead of enumeration order.
+	// Fully suitable devices still come before partially suitable ones. The scorer is called once per device after it
+	// has been made ready for device creation, so it may build a Device from it, e.g. to run a benchmark.
+	PhysicalDeviceSelector& set_device_scorer(std::function<double(PhysicalDevice const&)> scorer);
+
+	// Take select()'s temporary arrays from `arena` instead of the heap. The arena must outlive select().
+	// Device details are queried on worker threads, which don't use the arena, and each worker's std::async
+	// state and thread are heap allocations the arena can't cover.
+	PhysicalDeviceSelector& set_scratch_arena(ScratchArena* arena);
+
+	// Drops the device details select() caches for every selector, the next call queries them again.
+	// Needed when a device's driver or the available layers change during the run.
+	static void invalidate_cache();
+
 	private:
 	struct InstanceInfo {
 		VkInstance instance = VK_NULL_HANDLE;
@@ -630,6 +754,7 @@ class PhysicalDeviceSelector {
 		uint32_t version = VKB_VK_API_VERSION_1_0;
 		bool headless = false;
 		bool supports_properties2_ext = false;
+		std::vector<std::string> layers;
 	} instance_info;
 
 	// We copy the extension features stored in the selector criteria under the prose of a
@@ -647,8 +772,9 @@ class PhysicalDeviceSelector {
 		VkDeviceSize required_mem_size = 0;
 		VkDeviceSize desired_mem_size = 0;
 
-		std::vector<std::string> required_extensions;
-		std::vector<std::string> desired_extensions;
+		// Interned names
+		std::vector<const char*> required_extensions;
+		std::vector<const char*> desired_extensions;
 
 		uint32_t required_version = VKB_VK_API_VERSION_1_0;
 		uint32_t desired_version = VKB_VK_API_VERSION_1_0;
@@ -661,6 +787,8 @@ class PhysicalDeviceSelector {
 		bool defer_surface_initialization = false;
 		bool use_first_gpu_unconditionally = false;
 		bool enable_portability_subset = true;
+		std::function<double(PhysicalDevice const&)> scorer;
+		ScratchArena* scratch_arena = nullptr;
 	} criteria;
 
 	PhysicalDevice populate_device_details(VkPhysicalDevice phys_device,
@@ -745,6 +873,9 @@ class DeviceBuilder {
 	// Provide custom allocation callbacks.
 	DeviceBuilder& set_allocation_callbacks(VkAllocationCallbacks* callbacks);
 
+	// Take build()'s temporary arrays from `arena` instead of the heap. The arena must outlive build().
+	DeviceBuilder& set_scratch_arena(ScratchArena* arena);
+
 	private:
 	PhysicalDevice physical_device;
 	struct DeviceInfo {
@@ -752,6 +883,7 @@ class DeviceBuilder {
 		std::vector<VkBaseOutStructure*> pNext_chain;
 		std::vector<CustomQueueDescription> queue_descriptions;
 		VkAllocationCallbacks* allocation_callbacks = VK_NULL_HANDLE;
+		ScratchArena* scratch_arena = nullptr;
 	} info;
 };
 
@@ -770,7 +902,8 @@ struct Swapchain {
 	uint32_t instance_version = VKB_VK_API_VERSION_1_0;
 	VkAllocationCallbacks* allocation_callbacks = VK_NULL_HANDLE;
 
-	// Returns a vector of VkImage handles to the swapchain.
+	// Returns a vector of VkImage handles to the swapchain. They are queried once and kept, the images
+	// of a swapchain never change.
 	Result<std::vector<VkImage>> get_images();
 
 	// Returns a vector of VkImageView's to the VkImage's of the swapchain.
@@ -786,11 +919,17 @@ struct Swapchain {
 
 	private:
 	struct {
+		PFN_vkCreateSwapchainKHR fp_vkCreateSwapchainKHR = nullptr;
 		PFN_vkGetSwapchainImagesKHR fp_vkGetSwapchainImagesKHR = nullptr;
 		PFN_vkCreateImageView fp_vkCreateImageView = nullptr;
 		PFN_vkDestroyImageView fp_vkDestroyImageView = nullptr;
 		PFN_vkDestroySwapchainKHR fp_vkDestroySwapchainKHR = nullptr;
 	} internal_table;
+	// What the swapchain was built for, a rebuild passing it to set_old_swapchain() reuses the formats and present modes
+	VkSurfaceKHR surface = VK_NULL_HANDLE;
+	std::vector<VkSurfaceFormatKHR> surface_formats;
+	std::vector<VkPresentModeKHR> present_modes;
+	std::vector<VkImage> images;
 	friend class SwapchainBuilder;
 	friend void destroy_swapchain(Swapchain const& swapchain);
 };
@@ -817,6 +956,8 @@ class SwapchainBuilder {
 	// Set the oldSwapchain member of VkSwapchainCreateInfoKHR.
 	// For use in rebuilding a swapchain.
 	SwapchainBuilder& set_old_swapchain(VkSwapchainKHR old_swapchain);
+	// Also reuses the surface formats, present modes and function pointers of `swapchain` if it was built for the
+	// same device and surface, so a rebuild, ie after a resize, only queries the surface capabilities again.
 	SwapchainBuilder& set_old_swapchain(Swapchain const& swapchain);
 
 
@@ -934,6 +1075,8 @@ class SwapchainBuilder {
 		std::vector<VkPresentModeKHR> desired_present_modes;
 		bool clipped = true;
 		VkSwapchainKHR old_swapchain = VK_NULL_HANDLE;
+		// Passed to set_old_swapchain(Swapchain const&), surface details and function pointers are taken from it
+		Swapchain rebuilt_swapchain;
 		VkAllocationCallbacks* allocation_callbacks = VK_NULL_HANDLE;
 	} info;
 };
@@ -22,10 +22,20 @@
 
 #pragma once
 
+#include <atomic>
+#include <cstddef>
+#include <memory>
+
 #include <vulkan/vulkan.h>
 
 namespace vkb {
 
+// Passed to the DispatchTable constructor to resolve entry points on first use
+struct lazy_resolve_t {
+	explicit lazy_resolve_t() = default;
+};
+inline constexpr lazy_resolve_t lazy_resolve {};
+
 struct DispatchTable {
 	DispatchTable() = default;
 	DispatchTable(VkDevice device, PFN_vkGetDeviceProcAddr procAddr) : device(device), populated(true) {
@@ -1271,2231 +1281,2237 @@ struct DispatchTable {
 		fp_vkCmdEndRenderingKHR = reinterpret_cast<PFN_vkCmdEndRenderingKHR>(procAddr(device, "vkCmdEndRenderingKHR"));
 #endif
 	}
+	// Resolves each entry point the first time its wrapper is called, which makes creating the table nearly free.
+	// The fp_ members stay null. Copies share what's resolved and may be used from any thread.
+	DispatchTable(VkDevice device, PFN_vkGetDeviceProcAddr procAddr, lazy_resolve_t)
+	: device(device), populated(true), lazy(std::make_shared<LazyEntryPoints>()) {
+		lazy->procAddr = procAddr;
+	}
 	void getDeviceQueue(uint32_t queueFamilyIndex, uint32_t queueIndex, VkQueue* pQueue) const noexcept {
-		fp_vkGetDeviceQueue(device, queueFamilyIndex, queueIndex, pQueue);
+		load(fp_vkGetDeviceQueue, 0, "vkGetDeviceQueue")(device, queueFamilyIndex, queueIndex, pQueue);
 	}
 	VkResult queueSubmit(VkQueue queue, uint32_t submitCount, const VkSubmitInfo* pSubmits, VkFence fence) const noexcept {
-		return fp_vkQueueSubmit(queue, submitCount, pSubmits, fence);
+		return load(fp_vkQueueSubmit, 1, "vkQueueSubmit")(queue, submitCount, pSubmits, fence);
 	}
 	VkResult queueWaitIdle(VkQueue queue) const noexcept {
-		return fp_vkQueueWaitIdle(queue);
+		return load(fp_vkQueueWaitIdle, 2, "vkQueueWaitIdle")(queue);
 	}
 	VkResult deviceWaitIdle() const noexcept {
-		return fp_vkDeviceWaitIdle(device);
+		return load(fp_vkDeviceWaitIdle, 3, "vkDeviceWaitIdle")(device);
 	}
 	VkResult allocateMemory(const VkMemoryAllocateInfo* pAllocateInfo, const VkAllocationCallbacks* pAllocator, VkDeviceMemory* pMemory) const noexcept {
-		return fp_vkAllocateMemory(device, pAllocateInfo, pAllocator, pMemory);
+		return load(fp_vkAllocateMemory, 4, "vkAllocateMemory")(device, pAllocateInfo, pAllocator, pMemory);
 	}
 	void freeMemory(VkDeviceMemory memory, const VkAllocationCallbacks* pAllocator) const noexcept {
-		fp_vkFreeMemory(device, memory, pAllocator);
+		load(fp_vkFreeMemory, 5, "vkFreeMemory")(device, memory, pAllocator);
 	}
 	VkResult mapMemory(VkDeviceMemory memory, VkDeviceSize offset, VkDeviceSize size, VkMemoryMapFlags flags, void** ppData) const noexcept {
-		return fp_vkMapMemory(device, memory, offset, size, flags, ppData);
+		return load(fp_vkMapMemory, 6, "vkMapMemory")(device, memory, offset, size, flags, ppData);
 	}
 	void unmapMemory(VkDeviceMemory memory) const noexcept {
-		fp_vkUnmapMemory(device, memory);
+		load(fp_vkUnmapMemory, 7, "vkUnmapMemory")(device, memory);
 	}
 	VkResult flushMappedMemoryRanges(uint32_t memoryRangeCount, const VkMappedMemoryRange* pMemoryRanges) const noexcept {
-		return fp_vkFlushMappedMemoryRanges(device, memoryRangeCount, pMemoryRanges);
+		return load(fp_vkFlushMappedMemoryRanges, 8, "vkFlushMappedMemoryRanges")(device, memoryRangeCount, pMemoryRanges);
 	}
 	VkResult invalidateMappedMemoryRanges(uint32_t memoryRangeCount, const VkMappedMemoryRange* pMemoryRanges) const noexcept {
-		return fp_vkInvalidateMappedMemoryRanges(device, memoryRangeCount, pMemoryRanges);
+		return load(fp_vkInvalidateMappedMemoryRanges, 9, "vkInvalidateMappedMemoryRanges")(device, memoryRangeCount, pMemoryRanges);
 	}
 	void getDeviceMemoryCommitment(VkDeviceMemory memory, VkDeviceSize* pCommittedMemoryInBytes) const noexcept {
-		fp_vkGetDeviceMemoryCommitment(device, memory, pCommittedMemoryInBytes);
+		load(fp_vkGetDeviceMemoryCommitment, 10, "vkGetDeviceMemoryCommitment")(device, memory, pCommittedMemoryInBytes);
 	}
 	void getBufferMemoryRequirements(VkBuffer buffer, VkMemoryRequirements* pMemoryRequirements) const noexcept {
-		fp_vkGetBufferMemoryRequirements(device, buffer, pMemoryRequirements);
+		load(fp_vkGetBufferMemoryRequirements, 11, "vkGetBufferMemoryRequirements")(device, buffer, pMemoryRequirements);
 	}
 	VkResult bindBufferMemory(VkBuffer buffer, VkDeviceMemory memory, VkDeviceSize memoryOffset) const noexcept {
-		return fp_vkBindBufferMemory(device, buffer, memory, memoryOffset);
+		return load(fp_vkBindBufferMemory, 12, "vkBindBufferMemory")(device, buffer, memory, memoryOffset);
 	}
 	void getImageMemoryRequirements(VkImage image, VkMemoryRequirements* pMemoryRequirements) const noexcept {
-		fp_vkGetImageMemoryRequirements(device, image, pMemoryRequirements);
+		load(fp_vkGetImageMemoryRequirements, 13, "vkGetImageMemoryRequirements")(device, image, pMemoryRequirements);
 	}
 	VkResult bindImageMemory(VkImage image, VkDeviceMemory memory, VkDeviceSize memoryOffset) const noexcept {
-		return fp_vkBindImageMemory(device, image, memory, memoryOffset);
+		return load(fp_vkBindImageMemory, 14, "vkBindImageMemory")(device, image, memory, memoryOffset);
 	}
 	void getImageSparseMemoryRequirements(VkImage image, uint32_t* pSparseMemoryRequirementCount, VkSparseImageMemoryRequirements* pSparseMemoryRequirements) const noexcept {
-		fp_vkGetImageSparseMemoryRequirements(device, image, pSparseMemoryRequirementCount, pSparseMemoryRequirements);
+		load(fp_vkGetImageSparseMemoryRequirements, 15, "vkGetImageSparseMemoryRequirements")(device, image, pSparseMemoryRequirementCount, pSparseMemoryRequirements);
 	}
 	VkResult queueBindSparse(VkQueue queue, uint32_t bindInfoCount, const VkBindSparseInfo* pBindInfo, VkFence fence) const noexcept {
-		return fp_vkQueueBindSparse(queue, bindInfoCount, pBindInfo, fence);
+		return load(fp_vkQueueBindSparse, 16, "vkQueueBindSparse")(queue, bindInfoCount, pBindInfo, fence);
 	}
 	VkResult createFence(const VkFenceCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkFence* pFence) const noexcept {
-		return fp_vkCreateFence(device, pCreateInfo, pAllocator, pFence);
+		return load(fp_vkCreateFence, 17, "vkCreateFence")(device, pCreateInfo, pAllocator, pFence);
 	}
 	void destroyFence(VkFence fence, const VkAllocationCallbacks* pAllocator) const noexcept {
-		fp_vkDestroyFence(device, fence, pAllocator);
+		load(fp_vkDestroyFence, 18, "vkDestroyFence")(device, fence, pAllocator);
 	}
 	VkResult resetFences(uint32_t fenceCount, const VkFence* pFences) const noexcept {
-		return fp_vkResetFences(device, fenceCount, pFences);
+		return load(fp_vkResetFences, 19, "vkResetFences")(device, fenceCount, pFences);
 	}
 	VkResult getFenceStatus(VkFence fence) const noexcept {
-		return fp_vkGetFenceStatus(device, fence);
+		return load(fp_vkGetFenceStatus, 20, "vkGetFenceStatus")(device, fence);
 	}
 	VkResult waitForFences(uint32_t fenceCount, const VkFence* pFences, VkBool32 waitAll, uint64_t timeout) const noexcept {
-		return fp_vkWaitForFences(device, fenceCount, pFences, waitAll, timeout);
+		return load(fp_vkWaitForFences, 21, "vkWaitForFences")(device, fenceCount, pFences, waitAll, timeout);
 	}
 	VkResult createSemaphore(const VkSemaphoreCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkSemaphore* pSemaphore) const noexcept {
-		return fp_vkCreateSemaphore(device, pCreateInfo, pAllocator, pSemaphore);
+		return load(fp_vkCreateSemaphore, 22, "vkCreateSemaphore")(device, pCreateInfo, pAllocator, pSemaphore);
 	}
 	void destroySemaphore(VkSemaphore semaphore, const VkAllocationCallbacks* pAllocator) const noexcept {
-		fp_vkDestroySemaphore(device, semaphore, pAllocator);
+		load(fp_vkDestroySemaphore, 23, "vkDestroySemaphore")(device, semaphore, pAllocator);
 	}
 	VkResult createEvent(const VkEventCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkEvent* pEvent) const noexcept {
-		return fp_vkCreateEvent(device, pCreateInfo, pAllocator, pEvent);
+		return load(fp_vkCreateEvent, 24, "vkCreateEvent")(device, pCreateInfo, pAllocator, pEvent);
 	}
 	void destroyEvent(VkEvent event, const VkAllocationCallbacks* pAllocator) const noexcept {
-		fp_vkDestroyEvent(device, event, pAllocator);
+		load(fp_vkDestroyEvent, 25, "vkDestroyEvent")(device, event, pAllocator);
 	}
 	VkResult getEventStatus(VkEvent event) const noexcept {
-		return fp_vkGetEventStatus(device, event);
+		return load(fp_vkGetEventStatus, 26, "vkGetEventStatus")(device, event);
 	}
 	VkResult setEvent(VkEvent event) const noexcept {
-		return fp_vkSetEvent(device, event);
+		return load(fp_vkSetEvent, 27, "vkSetEvent")(device, event);
 	}
 	VkResult resetEvent(VkEvent event) const noexcept {
-		return fp_vkResetEvent(device, event);
+		return load(fp_vkResetEvent, 28, "vkResetEvent")(device, event);
 	}
 	VkResult createQueryPool(const VkQueryPoolCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkQueryPool* pQueryPool) const noexcept {
-		return fp_vkCreateQueryPool(device, pCreateInfo, pAllocator, pQueryPool);
+		return load(fp_vkCreateQueryPool, 29, "vkCreateQueryPool")(device, pCreateInfo, pAllocator, pQueryPool);
 	}
 	void destroyQueryPool(VkQueryPool queryPool, const VkAllocationCallbacks* pAllocator) const noexcept {
-		fp_vkDestroyQueryPool(device, queryPool, pAllocator);
+		load(fp_vkDestroyQueryPool, 30, "vkDestroyQueryPool")(device, queryPool, pAllocator);
 	}
 	VkResult getQueryPoolResults(VkQueryPool queryPool, uint32_t firstQuery, uint32_t queryCount, size_t dataSize, void* pData, VkDeviceSize stride, VkQueryResultFlags flags) const noexcept {
-		return fp_vkGetQueryPoolResults(device, queryPool, firstQuery, queryCount, dataSize, pData, stride, flags);
+		return load(fp_vkGetQueryPoolResults, 31, "vkGetQueryPoolResults")(device, queryPool, firstQuery, queryCount, dataSize, pData, stride, flags);
 	}
 #if (defined(VK_VERSION_1_2))
 	void resetQueryPool(VkQueryPool queryPool, uint32_t firstQuery, uint32_t queryCount) const noexcept {
-		fp_vkResetQueryPool(device, queryPool, firstQuery, queryCount);
+		load(fp_vkResetQueryPool, 32, "vkResetQueryPool")(device, queryPool, firstQuery, queryCount);
 	}
 #endif
 	VkResult createBuffer(const VkBufferCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkBuffer* pBuffer) const noexcept {
-		return fp_vkCreateBuffer(device, pCreateInfo, pAllocator, pBuffer);
+		return load(fp_vkCreateBuffer, 33, "vkCreateBuffer")(device, pCreateInfo, pAllocator, pBuffer);
 	}
 	void destroyBuffer(VkBuffer buffer, const VkAllocationCallbacks* pAllocator) const noexcept {
-		fp_vkDestroyBuffer(device, buffer, pAllocator);
+		load(fp_vkDestroyBuffer, 34, "vkDestroyBuffer")(device, buffer, pAllocator);
 	}
 	VkResult createBufferView(const VkBufferViewCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkBufferView* pView) const noexcept {
-		return fp_vkCreateBufferView(device, pCreateInfo, pAllocator, pView);
+		return load(fp_vkCreateBufferView, 35, "vkCreateBufferView")(device, pCreateInfo, pAllocator, pView);
 	}
 	void destroyBufferView(VkBufferView bufferView, const VkAllocationCallbacks* pAllocator) const noexcept {
-		fp_vkDestroyBufferView(device, bufferView, pAllocator);
+		load(fp_vkDestroyBufferView, 36, "vkDestroyBufferView")(device, bufferView, pAllocator);
 	}
 	VkResult createImage(const VkImageCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkImage* pImage) const noexcept {
-		return fp_vkCreateImage(device, pCreateInfo, pAllocator, pImage);
+		return load(fp_vkCreateImage, 37, "vkCreateImage")(device, pCreateInfo, pAllocator, pImage);
 	}
 	void destroyImage(VkImage image, const VkAllocationCallbacks* pAllocator) const noexcept {
-		fp_vkDestroyImage(device, image, pAllocator);
+		load(fp_vkDestroyImage, 38, "vkDestroyImage")(device, image, pAllocator);
 	}
 	void getImageSubresourceLayout(VkImage image, const VkImageSubresource* pSubresource, VkSubresourceLayout* pLayout) const noexcept {
-		fp_vkGetImageSubresourceLayout(device, image, pSubresource, pLayout);
+		load(fp_vkGetImageSubresourceLayout, 39, "vkGetImageSubresourceLayout")(device, image, pSubresource, pLayout);
 	}
 	VkResult createImageView(const VkImageViewCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkImageView* pView) const noexcept {
-		return fp_vkCreateImageView(device, pCreateInfo, pAllocator, pView);
+		return load(fp_vkCreateImageView, 40, "vkCreateImageView")(device, pCreateInfo, pAllocator, pView);
 	}
 	void destroyImageView(VkImageView imageView, const VkAllocationCallbacks* pAllocator) const noexcept {
-		fp_vkDestroyImageView(device, imageView, pAllocator);
+		load(fp_vkDestroyImageView, 41, "vkDestroyImageView")(device, imageView, pAllocator);
 	}
 	VkResult createShaderModule(const VkShaderModuleCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkShaderModule* pShaderModule) const noexcept {
-		return fp_vkCreateShaderModule(device, pCreateInfo, pAllocator, pShaderModule);
+		return load(fp_vkCreateShaderModule, 42, "vkCreateShaderModule")(device, pCreateInfo, pAllocator, pShaderModule);
 	}
 	void destroyShaderModule(VkShaderModule shaderModule, const VkAllocationCallbacks* pAllocator) const noexcept {
-		fp_vkDestroyShaderModule(device, shaderModule, pAllocator);
+		load(fp_vkDestroyShaderModule, 43, "vkDestroyShaderModule")(device, shaderModule, pAllocator);
 	}
 	VkResult createPipelineCache(const VkPipelineCacheCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkPipelineCache* pPipelineCache) const noexcept {
-		return fp_vkCreatePipelineCache(device, pCreateInfo, pAllocator, pPipelineCache);
+		return load(fp_vkCreatePipelineCache, 44, "vkCreatePipelineCache")(device, pCreateInfo, pAllocator, pPipelineCache);
 	}
 	void destroyPipelineCache(VkPipelineCache pipelineCache, const VkAllocationCallbacks* pAllocator) const noexcept {
-		fp_vkDestroyPipelineCache(device, pipelineCache, pAllocator);
+		load(fp_vkDestroyPipelineCache, 45, "vkDestroyPipelineCache")(device, pipelineCache, pAllocator);
 	}
 	VkResult getPipelineCacheData(VkPipelineCache pipelineCache, size_t* pDataSize, void* pData) const noexcept {
-		return fp_vkGetPipelineCacheData(device, pipelineCache, pDataSize, pData);
+		return load(fp_vkGetPipelineCacheData, 46, "vkGetPipelineCacheData")(device, pipelineCache, pDataSize, pData);
 	}
 	VkResult mergePipelineCaches(VkPipelineCache dstCache, uint32_t srcCacheCount, const VkPipelineCache* pSrcCaches) const noexcept {
-		return fp_vkMergePipelineCaches(device, dstCache, srcCacheCount, pSrcCaches);
+		return load(fp_vkMergePipelineCaches, 47, "vkMergePipelineCaches")(device, dstCache, srcCacheCount, pSrcCaches);
 	}
 	VkResult createGraphicsPipelines(VkPipelineCache pipelineCache, uint32_t createInfoCount, const VkGraphicsPipelineCreateInfo* pCreateInfos, const VkAllocationCallbacks* pAllocator, VkPipeline* pPipelines) const noexcept {
-		return fp_vkCreateGraphicsPipelines(device, pipelineCache, createInfoCount, pCreateInfos, pAllocator, pPipelines);
+		return load(fp_vkCreateGraphicsPipelines, 48, "vkCreateGraphicsPipelines")(device, pipelineCache, createInfoCount, pCreateInfos, pAllocator, pPipelines);
 	}
 	VkResult createComputePipelines(VkPipelineCache pipelineCache, uint32_t createInfoCount, const VkComputePipelineCreateInfo* pCreateInfos, const VkAllocationCallbacks* pAllocator, VkPipeline* pPipelines) const noexcept {
-		return fp_vkCreateComputePipelines(device, pipelineCache, createInfoCount, pCreateInfos, pAllocator, pPipelines);
+		return load(fp_vkCreateComputePipelines, 49, "vkCreateComputePipelines")(device, pipelineCache, createInfoCount, pCreateInfos, pAllocator, pPipelines);
 	}
 #if (defined(VK_HUAWEI_subpass_shading))
 	VkResult getDeviceSubpassShadingMaxWorkgroupSizeHUAWEI(VkRenderPass renderpass, VkExtent2D* pMaxWorkgroupSize) const noexcept {
-		return fp_vkGetDeviceSubpassShadingMaxWorkgroupSizeHUAWEI(device, renderpass, pMaxWorkgroupSize);
+		return load(fp_vkGetDeviceSubpassShadingMaxWorkgroupSizeHUAWEI, 50, "vkGetDeviceSubpassShadingMaxWorkgroupSizeHUAWEI")(device, renderpass, pMaxWorkgroupSize);
 	}
 #endif
 	void destroyPipeline(VkPipeline pipeline, const VkAllocationCallbacks* pAllocator) const noexcept {
-		fp_vkDestroyPipeline(device, pipeline, pAllocator);
+		load(fp_vkDestroyPipeline, 51, "vkDestroyPipeline")(device, pipeline, pAllocator);
 	}
 	VkResult createPipelineLayout(const VkPipelineLayoutCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkPipelineLayout* pPipelineLayout) const noexcept {
-		return fp_vkCreatePipelineLayout(device, pCreateInfo, pAllocator, pPipelineLayout);
+		return load(fp_vkCreatePipelineLayout, 52, "vkCreatePipelineLayout")(device, pCreateInfo, pAllocator, pPipelineLayout);
 	}
 	void destroyPipelineLayout(VkPipelineLayout pipelineLayout, const VkAllocationCallbacks* pAllocator) const noexcept {
-		fp_vkDestroyPipelineLayout(device, pipelineLayout, pAllocator);
+		load(fp_vkDestroyPipelineLayout, 53, "vkDestroyPipelineLayout")(device, pipelineLayout, pAllocator);
 	}
 	VkResult createSampler(const VkSamplerCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkSampler* pSampler) const noexcept {
-		return fp_vkCreateSampler(device, pCreateInfo, pAllocator, pSampler);
+		return load(fp_vkCreateSampler, 54, "vkCreateSampler")(device, pCreateInfo, pAllocator, pSampler);
 	}
 	void destroySampler(VkSampler sampler, const VkAllocationCallbacks* pAllocator) const noexcept {
-		fp_vkDestroySampler(device, sampler, pAllocator);
+		load(fp_vkDestroySampler, 55, "vkDestroySampler")(device, sampler, pAllocator);
 	}
 	VkResult createDescriptorSetLayout(const VkDescriptorSetLayoutCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkDescriptorSetLayout* pSetLayout) const noexcept {
-		return fp_vkCreateDescriptorSetLayout(device, pCreateInfo, pAllocator, pSetLayout);
+		return load(fp_vkCreateDescriptorSetLayout, 56, "vkCreateDescriptorSetLayout")(device, pCreateInfo, pAllocator, pSetLayout);
 	}
 	void destroyDescriptorSetLayout(VkDescriptorSetLayout descriptorSetLayout, const VkAllocationCallbacks* pAllocator) const noexcept {
-		fp_vkDestroyDescriptorSetLayout(device, descriptorSetLayout, pAllocator);
+		load(fp_vkDestroyDescriptorSetLayout, 57, "vkDestroyDescriptorSetLayout")(device, descriptorSetLayout, pAllocator);
 	}
 	VkResult createDescriptorPool(const VkDescriptorPoolCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkDescriptorPool* pDescriptorPool) const noexcept {
-		return fp_vkCreateDescriptorPool(device, pCreateInfo, pAllocator, pDescriptorPool);
+		return load(fp_vkCreateDescriptorPool, 58, "vkCreateDescriptorPool")(device, pCreateInfo, pAllocator, pDescriptorPool);
 	}
 	void destroyDescriptorPool(VkDescriptorPool descriptorPool, const VkAllocationCallbacks* pAllocator) const noexcept {
-		fp_vkDestroyDescriptorPool(device, descriptorPool, pAllocator);
+		load(fp_vkDestroyDescriptorPool, 59, "vkDestroyDescriptorPool")(device, descriptorPool, pAllocator);
 	}
 	VkResult resetDescriptorPool(VkDescriptorPool descriptorPool, VkDescriptorPoolResetFlags flags) const noexcept {
-		return fp_vkResetDescriptorPool(device, descriptorPool, flags);
+		return load(fp_vkResetDescriptorPool, 60, "vkResetDescriptorPool")(device, descriptorPool, flags);
 	}
 	VkResult allocateDescriptorSets(const VkDescriptorSetAllocateInfo* pAllocateInfo, VkDescriptorSet* pDescriptorSets) const noexcept {
-		return fp_vkAllocateDescriptorSets(device, pAllocateInfo, pDescriptorSets);
+		return load(fp_vkAllocateDescriptorSets, 61, "vkAllocateDescriptorSets")(device, pAllocateInfo, pDescriptorSets);
 	}
 	VkResult freeDescriptorSets(VkDescriptorPool descriptorPool, uint32_t descriptorSetCount, const VkDescriptorSet* pDescriptorSets) const noexcept {
-		return fp_vkFreeDescriptorSets(device, descriptorPool, descriptorSetCount, pDescriptorSets);
+		return load(fp_vkFreeDescriptorSets, 62, "vkFreeDescriptorSets")(device, descriptorPool, descriptorSetCount, pDescriptorSets);
 	}
 	void updateDescriptorSets(uint32_t descriptorWriteCount, const VkWriteDescriptorSet* pDescriptorWrites, uint32_t descriptorCopyCount, const VkCopyDescriptorSet* pDescriptorCopies) const noexcept {
-		fp_vkUpdateDescriptorSets(device, descriptorWriteCount, pDescriptorWrites, descriptorCopyCount, pDescriptorCopies);
+		load(fp_vkUpdateDescriptorSets, 63, "vkUpdateDescriptorSets")(device, descriptorWriteCount, pDescriptorWrites, descriptorCopyCount, pDescriptorCopies);
 	}
 	VkResult createFramebuffer(const VkFramebufferCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkFramebuffer* pFramebuffer) const noexcept {
-		return fp_vkCreateFramebuffer(device, pCreateInfo, pAllocator, pFramebuffer);
+		return load(fp_vkCreateFramebuffer, 64, "vkCreateFramebuffer")(device, pCreateInfo, pAllocator, pFramebuffer);
 	}
 	void destroyFramebuffer(VkFramebuffer framebuffer, const VkAllocationCallbacks* pAllocator) const noexcept {
-		fp_vkDestroyFramebuffer(device, framebuffer, pAllocator);
+		load(fp_vkDestroyFramebuffer, 65, "vkDestroyFramebuffer")(device, framebuffer, pAllocator);
 	}
 	VkResult createRenderPass(const VkRenderPassCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkRenderPass* pRenderPass) const noexcept {
-		return fp_vkCreateRenderPass(device, pCreateInfo, pAllocator, pRenderPass);
+		return load(fp_vkCreateRenderPass, 66, "vkCreateRenderPass")(device, pCreateInfo, pAllocator, pRenderPass);
 	}
 	void destroyRenderPass(VkRenderPass renderPass, const VkAllocationCallbacks* pAllocator) const noexcept {
-		fp_vkDestroyRenderPass(device, renderPass, pAllocator);
+		load(fp_vkDestroyRenderPass, 67, "vkDestroyRenderPass")(device, renderPass, pAllocator);
 	}
 	void getRenderAreaGranularity(VkRenderPass renderPass, VkExtent2D* pGranularity) const noexcept {
-		fp_vkGetRenderAreaGranularity(device, renderPass, pGranularity);
+		load(fp_vkGetRenderAreaGranularity, 68, "vkGetRenderAreaGranularity")(device, renderPass, pGranularity);
 	}
 	VkResult createCommandPool(const VkCommandPoolCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkCommandPool* pCommandPool) const noexcept {
-		return fp_vkCreateCommandPool(device, pCreateInfo, pAllocator, pCommandPool);
+		return load(fp_vkCreateCommandPool, 69, "vkCreateCommandPool")(device, pCreateInfo, pAllocator, pCommandPool);
 	}
 	void destroyCommandPool(VkCommandPool commandPool, const VkAllocationCallbacks* pAllocator) const noexcept {
-		fp_vkDestroyCommandPool(device, commandPool, pAllocator);
+		load(fp_vkDestroyCommandPool, 70, "vkDestroyCommandPool")(device, commandPool, pAllocator);
 	}
 	VkResult resetCommandPool(VkCommandPool commandPool, VkCommandPoolResetFlags flags) const noexcept {
-		return fp_vkResetCommandPool(device, commandPool, flags);
+		return load(fp_vkResetCommandPool, 71, "vkResetCommandPool")(device, commandPool, flags);
 	}
 	VkResult allocateCommandBuffers(const VkCommandBufferAllocateInfo* pAllocateInfo, VkCommandBuffer* pCommandBuffers) const noexcept {
-		return fp_vkAllocateCommandBuffers(device, pAllocateInfo, pCommandBuffers);
+		return load(fp_vkAllocateCommandBuffers, 72, "vkAllocateCommandBuffers")(device, pAllocateInfo, pCommandBuffers);
 	}
 	void freeCommandBuffers(VkCommandPool commandPool, uint32_t commandBufferCount, const VkCommandBuffer* pCommandBuffers) const noexcept {
-		fp_vkFreeCommandBuffers(device, commandPool, commandBufferCount, pCommandBuffers);
+		load(fp_vkFreeCommandBuffers, 73, "vkFreeCommandBuffers")(device, commandPool, commandBufferCount, pCommandBuffers);
 	}
 	VkResult beginCommandBuffer(VkCommandBuffer commandBuffer, const VkCommandBufferBeginInfo* pBeginInfo) const noexcept {
-		return fp_vkBeginCommandBuffer(commandBuffer, pBeginInfo);
+		return load(fp_vkBeginCommandBuffer, 74, "vkBeginCommandBuffer")(commandBuffer, pBeginInfo);
 	}
 	VkResult endCommandBuffer(VkCommandBuffer commandBuffer) const noexcept {
-		return fp_vkEndCommandBuffer(commandBuffer);
+		return load(fp_vkEndCommandBuffer, 75, "vkEndCommandBuffer")(commandBuffer);
 	}
 	VkResult resetCommandBuffer(VkCommandBuffer commandBuffer, VkCommandBufferResetFlags flags) const noexcept {
-		return fp_vkResetCommandBuffer(commandBuffer, flags);
+		return load(fp_vkResetCommandBuffer, 76, "vkResetCommandBuffer")(commandBuffer, flags);
 	}
 	void cmdBindPipeline(VkCommandBuffer commandBuffer, VkPipelineBindPoint pipelineBindPoint, VkPipeline pipeline) const noexcept {
-		fp_vkCmdBindPipeline(commandBuffer, pipelineBindPoint, pipeline);
+		load(fp_vkCmdBindPipeline, 77, "vkCmdBindPipeline")(commandBuffer, pipelineBindPoint, pipeline);
 	}
 	void cmdSetViewport(VkCommandBuffer commandBuffer, uint32_t firstViewport, uint32_t viewportCount, const VkViewport* pViewports) const noexcept {
-		fp_vkCmdSetViewport(commandBuffer, firstViewport, viewportCount, pViewports);
+		load(fp_vkCmdSetViewport, 78, "vkCmdSetViewport")(commandBuffer, firstViewport, viewportCount, pViewports);
 	}
 	void cmdSetScissor(VkCommandBuffer commandBuffer, uint32_t firstScissor, uint32_t scissorCount, const VkRect2D* pScissors) const noexcept {
-		fp_vkCmdSetScissor(commandBuffer, firstScissor, scissorCount, pScissors);
+		load(fp_vkCmdSetScissor, 79, "vkCmdSetScissor")(commandBuffer, firstScissor, scissorCount, pScissors);
 	}
 	void cmdSetLineWidth(VkCommandBuffer commandBuffer, float lineWidth) const noexcept {
-		fp_vkCmdSetLineWidth(commandBuffer, lineWidth);
+		load(fp_vkCmdSetLineWidth, 80, "vkCmdSetLineWidth")(commandBuffer, lineWidth);
 	}
 	void cmdSetDepthBias(VkCommandBuffer commandBuffer, float depthBiasConstantFactor, float depthBiasClamp, float depthBiasSlopeFactor) const noexcept {
-		fp_vkCmdSetDepthBias(commandBuffer, depthBiasConstantFactor, depthBiasClamp, depthBiasSlopeFactor);
+		load(fp_vkCmdSetDepthBias, 81, "vkCmdSetDepthBias")(commandBuffer, depthBiasConstantFactor, depthBiasClamp, depthBiasSlopeFactor);
 	}
 	void cmdSetBlendConstants(VkCommandBuffer commandBuffer, float blendConstants[4]) const noexcept {
-		fp_vkCmdSetBlendConstants(commandBuffer, blendConstants);
+		load(fp_vkCmdSetBlendConstants, 82, "vkCmdSetBlendConstants")(commandBuffer, blendConstants);
 	}
 	void cmdSetDepthBounds(VkCommandBuffer commandBuffer, float minDepthBounds, float maxDepthBounds) const noexcept {
-		fp_vkCmdSetDepthBounds(commandBuffer, minDepthBounds, maxDepthBounds);
+		load(fp_vkCmdSetDepthBounds, 83, "vkCmdSetDepthBounds")(commandBuffer, minDepthBounds, maxDepthBounds);
 	}
 	void cmdSetStencilCompareMask(VkCommandBuffer commandBuffer, VkStencilFaceFlags faceMask, uint32_t compareMask) const noexcept {
-		fp_vkCmdSetStencilCompareMask(commandBuffer, faceMask, compareMask);
+		load(fp_vkCmdSetStencilCompareMask, 84, "vkCmdSetStencilCompareMask")(commandBuffer, faceMask, compareMask);
 	}
 	void cmdSetStencilWriteMask(VkCommandBuffer commandBuffer, VkStencilFaceFlags faceMask, uint32_t writeMask) const noexcept {
-		fp_vkCmdSetStencilWriteMask(commandBuffer, faceMask, writeMask);
+		load(fp_vkCmdSetStencilWriteMask, 85, "vkCmdSetStencilWriteMask")(commandBuffer, faceMask, writeMask);
 	}
 	void cmdSetStencilReference(VkCommandBuffer commandBuffer, VkStencilFaceFlags faceMask, uint32_t reference) const noexcept {
-		fp_vkCmdSetStencilReference(commandBuffer, faceMask, reference);
+		load(fp_vkCmdSetStencilReference, 86, "vkCmdSetStencilReference")(commandBuffer, faceMask, reference);
 	}
 	void cmdBindDescriptorSets(VkCommandBuffer commandBuffer, VkPipelineBindPoint pipelineBindPoint, VkPipelineLayout layout, uint32_t firstSet, uint32_t descriptorSetCount, const VkDescriptorSet* pDescriptorSets, uint32_t dynamicOffsetCount, const uint32_t* pDynamicOffsets) const noexcept {
-		fp_vkCmdBindDescriptorSets(commandBuffer, pipelineBindPoint, layout, firstSet, descriptorSetCount, pDescriptorSets, dynamicOffsetCount, pDynamicOffsets);
+		load(fp_vkCmdBindDescriptorSets, 87, "vkCmdBindDescriptorSets")(commandBuffer, pipelineBindPoint, layout, firstSet, descriptorSetCount, pDescriptorSets, dynamicOffsetCount, pDynamicOffsets);
 	}
 	void cmdBindIndexBuffer(VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset, VkIndexType indexType) const noexcept {
-		fp_vkCmdBindIndexBuffer(commandBuffer, buffer, offset, indexType);
+		load(fp_vkCmdBindIndexBuffer, 88, "vkCmdBindIndexBuffer")(commandBuffer, buffer, offset, indexType);
 	}
 	void cmdBindVertexBuffers(VkCommandBuffer commandBuffer, uint32_t firstBinding, uint32_t bindingCount, const VkBuffer* pBuffers, const VkDeviceSize* pOffsets) const noexcept {
-		fp_vkCmdBindVertexBuffers(commandBuffer, firstBinding, bindingCount, pBuffers, pOffsets);
+		load(fp_vkCmdBindVertexBuffers, 89, "vkCmdBindVertexBuffers")(commandBuffer, firstBinding, bindingCount, pBuffers, pOffsets);
 	}
 	void cmdDraw(VkCommandBuffer commandBuffer, uint32_t vertexCount, uint32_t instanceCount, uint32_t firstVertex, uint32_t firstInstance) const noexcept {
-		fp_vkCmdDraw(commandBuffer, vertexCount, instanceCount, firstVertex, firstInstance);
+		load(fp_vkCmdDraw, 90, "vkCmdDraw")(commandBuffer, vertexCount, instanceCount, firstVertex, firstInstance);
 	}
 	void cmdDrawIndexed(VkCommandBuffer commandBuffer, uint32_t indexCount, uint32_t instanceCount, uint32_t firstIndex, int32_t vertexOffset, uint32_t firstInstance) const noexcept {
-		fp_vkCmdDrawIndexed(commandBuffer, indexCount, instanceCount, firstIndex, vertexOffset, firstInstance);
+		load(fp_vkCmdDrawIndexed, 91, "vkCmdDrawIndexed")(commandBuffer, indexCount, instanceCount, firstIndex, vertexOffset, firstInstance);
 	}
 #if (defined(VK_EXT_multi_draw))
 	void cmdDrawMultiEXT(VkCommandBuffer commandBuffer, uint32_t drawCount, const VkMultiDrawInfoEXT* pVertexInfo, uint32_t instanceCount, uint32_t firstInstance, uint32_t stride) const noexcept {
-		fp_vkCmdDrawMultiEXT(commandBuffer, drawCount, pVertexInfo, instanceCount, firstInstance, stride);
+		load(fp_vkCmdDrawMultiEXT, 92, "vkCmdDrawMultiEXT")(commandBuffer, drawCount, pVertexInfo, instanceCount, firstInstance, stride);
 	}
 #endif
 #if (defined(VK_EXT_multi_draw))
 	void cmdDrawMultiIndexedEXT(VkCommandBuffer commandBuffer, uint32_t drawCount, const VkMultiDrawIndexedInfoEXT* pIndexInfo, uint32_t instanceCount, uint32_t firstInstance, uint32_t stride, const int32_t* pVertexOffset) const noexcept {
-		fp_vkCmdDrawMultiIndexedEXT(commandBuffer, drawCount, pIndexInfo, instanceCount, firstInstance, stride, pVertexOffset);
+		load(fp_vkCmdDrawMultiIndexedEXT, 93, "vkCmdDrawMultiIndexedEXT")(commandBuffer, drawCount, pIndexInfo, instanceCount, firstInstance, stride, pVertexOffset);
 	}
 #endif
 	void cmdDrawIndirect(VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset, uint32_t drawCount, uint32_t stride) const noexcept {
-		fp_vkCmdDrawIndirect(commandBuffer, buffer, offset, drawCount, stride);
+		load(fp_vkCmdDrawIndirect, 94, "vkCmdDrawIndirect")(commandBuffer, buffer, offset, drawCount, stride);
 	}
 	void cmdDrawIndexedIndirect(VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset, uint32_t drawCount, uint32_t stride) const noexcept {
-		fp_vkCmdDrawIndexedIndirect(commandBuffer, buffer, offset, drawCount, stride);
+		load(fp_vkCmdDrawIndexedIndirect, 95, "vkCmdDrawIndexedIndirect")(commandBuffer, buffer, offset, drawCount, stride);
 	}
 	void cmdDispatch(VkCommandBuffer commandBuffer, uint32_t groupCountX, uint32_t groupCountY, uint32_t groupCountZ) const noexcept {
-		fp_vkCmdDispatch(commandBuffer, groupCountX, groupCountY, groupCountZ);
+		load(fp_vkCmdDispatch, 96, "vkCmdDispatch")(commandBuffer, groupCountX, groupCountY, groupCountZ);
 	}
 	void cmdDispatchIndirect(VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset) const noexcept {
-		fp_vkCmdDispatchIndirect(commandBuffer, buffer, offset);
+		load(fp_vkCmdDispatchIndirect, 97, "vkCmdDispatchIndirect")(commandBuffer, buffer, offset);
 	}
 #if (defined(VK_HUAWEI_subpass_shading))
 	void cmdSubpassShadingHUAWEI(VkCommandBuffer commandBuffer) const noexcept {
-		fp_vkCmdSubpassShadingHUAWEI(commandBuffer);
+		load(fp_vkCmdSubpassShadingHUAWEI, 98, "vkCmdSubpassShadingHUAWEI")(commandBuffer);
 	}
 #endif
 	void cmdCopyBuffer(VkCommandBuffer commandBuffer, VkBuffer srcBuffer, VkBuffer dstBuffer, uint32_t regionCount, const VkBufferCopy* pRegions) const noexcept {
-		fp_vkCmdCopyBuffer(commandBuffer, srcBuffer, dstBuffer, regionCount, pRegions);
+		load(fp_vkCmdCopyBuffer, 99, "vkCmdCopyBuffer")(commandBuffer, srcBuffer, dstBuffer, regionCount, pRegions);
 	}
 	void cmdCopyImage(VkCommandBuffer commandBuffer, VkImage srcImage, VkImageLayout srcImageLayout, VkImage dstImage, VkImageLayout dstImageLayout, uint32_t regionCount, const VkImageCopy* pRegions) const noexcept {
-		fp_vkCmdCopyImage(commandBuffer, srcImage, srcImageLayout, dstImage, dstImageLayout, regionCount, pRegions);
+		load(fp_vkCmdCopyImage, 100, "vkCmdCopyImage")(commandBuffer, srcImage, srcImageLayout, dstImage, dstImageLayout, regionCount, pRegions);
 	}
 	void cmdBlitImage(VkCommandBuffer commandBuffer, VkImage srcImage, VkImageLayout srcImageLayout, VkImage dstImage, VkImageLayout dstImageLayout, uint32_t regionCount, const VkImageBlit* pRegions, VkFilter filter) const noexcept {
-		fp_vkCmdBlitImage(commandBuffer, srcImage, srcImageLayout, dstImage, dstImageLayout, regionCount, pRegions, filter);
+		load(fp_vkCmdBlitImage, 101, "vkCmdBlitImage")(commandBuffer, srcImage, srcImageLayout, dstImage, dstImageLayout, regionCount, pRegions, filter);
 	}
 	void cmdCopyBufferToImage(VkCommandBuffer commandBuffer, VkBuffer srcBuffer, VkImage dstImage, VkImageLayout dstImageLayout, uint32_t regionCount, const VkBufferImageCopy* pRegions) const noexcept {
-		fp_vkCmdCopyBufferToImage(commandBuffer, srcBuffer, dstImage, dstImageLayout, regionCount, pRegions);
+		load(fp_vkCmdCopyBufferToImage, 102, "vkCmdCopyBufferToImage")(commandBuffer, srcBuffer, dstImage, dstImageLayout, regionCount, pRegions);
 	}
 	void cmdCopyImageToBuffer(VkCommandBuffer commandBuffer, VkImage srcImage, VkImageLayout srcImageLayout, VkBuffer dstBuffer, uint32_t regionCount, const VkBufferImageCopy* pRegions) const noexcept {
-		fp_vkCmdCopyImageToBuffer(commandBuffer, srcImage, srcImageLayout, dstBuffer, regionCount, pRegions);
+		load(fp_vkCmdCopyImageToBuffer, 103, "vkCmdCopyImageToBuffer")(commandBuffer, srcImage, srcImageLayout, dstBuffer, regionCount, pRegions);
 	}
 	void cmdUpdateBuffer(VkCommandBuffer commandBuffer, VkBuffer dstBuffer, VkDeviceSize dstOffset, VkDeviceSize dataSize, const void* pData) const noexcept {
-		fp_vkCmdUpdateBuffer(commandBuffer, dstBuffer, dstOffset, dataSize, pData);
+		load(fp_vkCmdUpdateBuffer, 104, "vkCmdUpdateBuffer")(commandBuffer, dstBuffer, dstOffset, dataSize, pData);
 	}
 	void cmdFillBuffer(VkCommandBuffer commandBuffer, VkBuffer dstBuffer, VkDeviceSize dstOffset, VkDeviceSize size, uint32_t data) const noexcept {
-		fp_vkCmdFillBuffer(commandBuffer, dstBuffer, dstOffset, size, data);
+		load(fp_vkCmdFillBuffer, 105, "vkCmdFillBuffer")(commandBuffer, dstBuffer, dstOffset, size, data);
 	}
 	void cmdClearColorImage(VkCommandBuffer commandBuffer, VkImage image, VkImageLayout imageLayout, const VkClearColorValue* pColor, uint32_t rangeCount, const VkImageSubresourceRange* pRanges) const noexcept {
-		fp_vkCmdClearColorImage(commandBuffer, image, imageLayout, pColor, rangeCount, pRanges);
+		load(fp_vkCmdClearColorImage, 106, "vkCmdClearColorImage")(commandBuffer, image, imageLayout, pColor, rangeCount, pRanges);
 	}
 	void cmdClearDepthStencilImage(VkCommandBuffer commandBuffer, VkImage image, VkImageLayout imageLayout, const VkClearDepthStencilValue* pDepthStencil, uint32_t rangeCount, const VkImageSubresourceRange* pRanges) const noexcept {
-		fp_vkCmdClearDepthStencilImage(commandBuffer, image, imageLayout, pDepthStencil, rangeCount, pRanges);
+		load(fp_vkCmdClearDepthStencilImage, 107, "vkCmdClearDepthStencilImage")(commandBuffer, image, imageLayout, pDepthStencil, rangeCount, pRanges);
 	}
 	void cmdClearAttachments(VkCommandBuffer commandBuffer, uint32_t attachmentCount, const VkClearAttachment* pAttachments, uint32_t rectCount, const VkClearRect* pRects) const noexcept {
-		fp_vkCmdClearAttachments(commandBuffer, attachmentCount, pAttachments, rectCount, pRects);
+		load(fp_vkCmdClearAttachments, 108, "vkCmdClearAttachments")(commandBuffer, attachmentCount, pAttachments, rectCount, pRects);
 	}
 	void cmdResolveImage(VkCommandBuffer commandBuffer, VkImage srcImage, VkImageLayout srcImageLayout, VkImage dstImage, VkImageLayout dstImageLayout, uint32_t regionCount, const VkImageResolve* pRegions) const noexcept {
-		fp_vkCmdResolveImage(commandBuffer, srcImage, srcImageLayout, dstImage, dstImageLayout, regionCount, pRegions);
+		load(fp_vkCmdResolveImage, 109, "vkCmdResolveImage")(commandBuffer, srcImage, srcImageLayout, dstImage, dstImageLayout, regionCount, pRegions);
 	}
 	void cmdSetEvent(VkCommandBuffer commandBuffer, VkEvent event, VkPipelineStageFlags stageMask) const noexcept {
-		fp_vkCmdSetEvent(commandBuffer, event, stageMask);
+		load(fp_vkCmdSetEvent, 110, "vkCmdSetEvent")(commandBuffer, event, stageMask);
 	}
 	void cmdResetEvent(VkCommandBuffer commandBuffer, VkEvent event, VkPipelineStageFlags stageMask) const noexcept {
-		fp_vkCmdResetEvent(commandBuffer, event, stageMask);
+		load(fp_vkCmdResetEvent, 111, "vkCmdResetEvent")(commandBuffer, event, stageMask);
 	}
 	void cmdWaitEvents(VkCommandBuffer commandBuffer, uint32_t eventCount, const VkEvent* pEvents, VkPipelineStageFlags srcStageMask, VkPipelineStageFlags dstStageMask, uint32_t memoryBarrierCount, const VkMemoryBarrier* pMemoryBarriers, uint32_t bufferMemoryBarrierCount, const VkBufferMemoryBarrier* pBufferMemoryBarriers, uint32_t imageMemoryBarrierCount, const VkImageMemoryBarrier* pImageMemoryBarriers) const noexcept {
-		fp_vkCmdWaitEvents(commandBuffer, eventCount, pEvents, srcStageMask, dstStageMask, memoryBarrierCount, pMemoryBarriers, bufferMemoryBarrierCount, pBufferMemoryBarriers, imageMemoryBarrierCount, pImageMemoryBarriers);
+		load(fp_vkCmdWaitEvents, 112, "vkCmdWaitEvents")(commandBuffer, eventCount, pEvents, srcStageMask, dstStageMask, memoryBarrierCount, pMemoryBarriers, bufferMemoryBarrierCount, pBufferMemoryBarriers, imageMemoryBarrierCount, pImageMemoryBarriers);
 	}
 	void cmdPipelineBarrier(VkCommandBuffer commandBuffer, VkPipelineStageFlags srcStageMask, VkPipelineStageFlags dstStageMask, VkDependencyFlags dependencyFlags, uint32_t memoryBarrierCount, const VkMemoryBarrier* pMemoryBarriers, uint32_t bufferMemoryBarrierCount, const VkBufferMemoryBarrier* pBufferMemoryBarriers, uint32_t imageMemoryBarrierCount, const VkImageMemoryBarrier* pImageMemoryBarriers) const noexcept {
-		fp_vkCmdPipelineBarrier(commandBuffer, srcStageMask, dstStageMask, dependencyFlags, memoryBarrierCount, pMemoryBarriers, bufferMemoryBarrierCount, pBufferMemoryBarriers, imageMemoryBarrierCount, pImageMemoryBarriers);
+		load(fp_vkCmdPipelineBarrier, 113, "vkCmdPipelineBarrier")(commandBuffer, srcStageMask, dstStageMask, dependencyFlags, memoryBarrierCount, pMemoryBarriers, bufferMemoryBarrierCount, pBufferMemoryBarriers, imageMemoryBarrierCount, pImageMemoryBarriers);
 	}
 	void cmdBeginQuery(VkCommandBuffer commandBuffer, VkQueryPool queryPool, uint32_t query, VkQueryControlFlags flags) const noexcept {
-		fp_vkCmdBeginQuery(commandBuffer, queryPool, query, flags);
+		load(fp_vkCmdBeginQuery, 114, "vkCmdBeginQuery")(commandBuffer, queryPool, query, flags);
 	}
 	void cmdEndQuery(VkCommandBuffer commandBuffer, VkQueryPool queryPool, uint32_t query) const noexcept {
-		fp_vkCmdEndQuery(commandBuffer, queryPool, query);
+		load(fp_vkCmdEndQuery, 115, "vkCmdEndQuery")(commandBuffer, queryPool, query);
 	}
 #if (defined(VK_EXT_conditional_rendering))
 	void cmdBeginConditionalRenderingEXT(VkCommandBuffer commandBuffer, const VkConditionalRenderingBeginInfoEXT* pConditionalRenderingBegin) const noexcept {
-		fp_vkCmdBeginConditionalRenderingEXT(commandBuffer, pConditionalRenderingBegin);
+		load(fp_vkCmdBeginConditionalRenderingEXT, 116, "vkCmdBeginConditionalRenderingEXT")(commandBuffer, pConditionalRenderingBegin);
 	}
 #endif
 #if (defined(VK_EXT_conditional_rendering))
 	void cmdEndConditionalRenderingEXT(VkCommandBuffer commandBuffer) const noexcept {
-		fp_vkCmdEndConditionalRenderingEXT(commandBuffer);
+		load(fp_vkCmdEndConditionalRenderingEXT, 117, "vkCmdEndConditionalRenderingEXT")(commandBuffer);
 	}
 #endif
 	void cmdResetQueryPool(VkCommandBuffer commandBuffer, VkQueryPool queryPool, uint32_t firstQuery, uint32_t queryCount) const noexcept {
-		fp_vkCmdResetQueryPool(commandBuffer, queryPool, firstQuery, queryCount);
+		load(fp_vkCmdResetQueryPool, 118, "vkCmdResetQueryPool")(commandBuffer, queryPool, firstQuery, queryCount);
 	}
 	void cmdWriteTimestamp(VkCommandBuffer commandBuffer, VkPipelineStageFlagBits pipelineStage, VkQueryPool queryPool, uint32_t query) const noexcept {
-		fp_vkCmdWriteTimestamp(commandBuffer, pipelineStage, queryPool, query);
+		load(fp_vkCmdWriteTimestamp, 119, "vkCmdWriteTimestamp")(commandBuffer, pipelineStage, queryPool, query);
 	}
 	void cmdCopyQueryPoolResults(VkCommandBuffer commandBuffer, VkQueryPool queryPool, uint32_t firstQuery, uint32_t queryCount, VkBuffer dstBuffer, VkDeviceSize dstOffset, VkDeviceSize stride, VkQueryResultFlags flags) const noexcept {
-		fp_vkCmdCopyQueryPoolResults(commandBuffer, queryPool, firstQuery, queryCount, dstBuffer, dstOffset, stride, flags);
+		load(fp_vkCmdCopyQueryPoolResults, 120, "vkCmdCopyQueryPoolResults")(commandBuffer, queryPool, firstQuery, queryCount, dstBuffer, dstOffset, stride, flags);
 	}
 	void cmdPushConstants(VkCommandBuffer commandBuffer, VkPipelineLayout layout, VkShaderStageFlags stageFlags, uint32_t offset, uint32_t size, const void* pValues) const noexcept {
-		fp_vkCmdPushConstants(commandBuffer, layout, stageFlags, offset, size, pValues);
+		load(fp_vkCmdPushConstants, 121, "vkCmdPushConstants")(commandBuffer, layout, stageFlags, offset, size, pValues);
 	}
 	void cmdBeginRenderPass(VkCommandBuffer commandBuffer, const VkRenderPassBeginInfo* pRenderPassBegin, VkSubpassContents contents) const noexcept {
-		fp_vkCmdBeginRenderPass(commandBuffer, pRenderPassBegin, contents);
+		load(fp_vkCmdBeginRenderPass, 122, "vkCmdBeginRenderPass")(commandBuffer, pRenderPassBegin, contents);
 	}
 	void cmdNextSubpass(VkCommandBuffer commandBuffer, VkSubpassContents contents) const noexcept {
-		fp_vkCmdNextSubpass(commandBuffer, contents);
+		load(fp_vkCmdNextSubpass, 123, "vkCmdNextSubpass")(commandBuffer, contents);
 	}
 	void cmdEndRenderPass(VkCommandBuffer commandBuffer) const noexcept {
-		fp_vkCmdEndRenderPass(commandBuffer);
+		load(fp_vkCmdEndRenderPass, 124, "vkCmdEndRenderPass")(commandBuffer);
 	}
 	void cmdExecuteCommands(VkCommandBuffer commandBuffer, uint32_t commandBufferCount, const VkCommandBuffer* pCommandBuffers) const noexcept {
-		fp_vkCmdExecuteCommands(commandBuffer, commandBufferCount, pCommandBuffers);
+		load(fp_vkCmdExecuteCommands, 125, "vkCmdExecuteCommands")(commandBuffer, commandBufferCount, pCommandBuffers);
 	}
 #if (defined(VK_KHR_display_swapchain))
 	VkResult createSharedSwapchainsKHR(uint32_t swapchainCount, const VkSwapchainCreateInfoKHR* pCreateInfos, const VkAllocationCallbacks* pAllocator, VkSwapchainKHR* pSwapchains) const noexcept {
-		return fp_vkCreateSharedSwapchainsKHR(device, swapchainCount, pCreateInfos, pAllocator, pSwapchains);
+		return load(fp_vkCreateSharedSwapchainsKHR, 126, "vkCreateSharedSwapchainsKHR")(device, swapchainCount, pCreateInfos, pAllocator, pSwapchains);
 	}
 #endif
 #if (defined(VK_KHR_swapchain))
 	VkResult createSwapchainKHR(const VkSwapchainCreateInfoKHR* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkSwapchainKHR* pSwapchain) const noexcept {
-		return fp_vkCreateSwapchainKHR(device, pCreateInfo, pAllocator, pSwapchain);
+		return load(fp_vkCreateSwapchainKHR, 127, "vkCreateSwapchainKHR")(device, pCreateInfo, pAllocator, pSwapchain);
 	}
 #endif
 #if (defined(VK_KHR_swapchain))
 	void destroySwapchainKHR(VkSwapchainKHR swapchain, const VkAllocationCallbacks* pAllocator) const noexcept {
-		fp_vkDestroySwapchainKHR(device, swapchain, pAllocator);
+		load(fp_vkDestroySwapchainKHR, 128, "vkDestroySwapchainKHR")(device, swapchain, pAllocator);
 	}
 #endif
 #if (defined(VK_KHR_swapchain))
 	VkResult getSwapchainImagesKHR(VkSwapchainKHR swapchain, uint32_t* pSwapchainImageCount, VkImage* pSwapchainImages) const noexcept {
-		return fp_vkGetSwapchainImagesKHR(device, swapchain, pSwapchainImageCount, pSwapchainImages);
+		return load(fp_vkGetSwapchainImagesKHR, 129, "vkGetSwapchainImagesKHR")(device, swapchain, pSwapchainImageCount, pSwapchainImages);
 	}
 #endif
 #if (defined(VK_KHR_swapchain))
 	VkResult acquireNextImageKHR(VkSwapchainKHR swapchain, uint64_t timeout, VkSemaphore semaphore, VkFence fence, uint32_t* pImageIndex) const noexcept {
-		return fp_vkAcquireNextImageKHR(device, swapchain, timeout, semaphore, fence, pImageIndex);
+		return load(fp_vkAcquireNextImageKHR, 130, "vkAcquireNextImageKHR")(device, swapchain, timeout, semaphore, fence, pImageIndex);
 	}
 #endif
 #if (defined(VK_KHR_swapchain))
 	VkResult queuePresentKHR(VkQueue queue, const VkPresentInfoKHR* pPresentInfo) const noexcept {
-		return fp_vkQueuePresentKHR(queue, pPresentInfo);
+		return load(fp_vkQueuePresentKHR, 131, "vkQueuePresentKHR")(queue, pPresentInfo);
 	}
 #endif
 #if (defined(VK_EXT_debug_marker))
 	VkResult debugMarkerSetObjectNameEXT(const VkDebugMarkerObjectNameInfoEXT* pNameInfo) const noexcept {
-		return fp_vkDebugMarkerSetObjectNameEXT(device, pNameInfo);
+		return load(fp_vkDebugMarkerSetObjectNameEXT, 132, "vkDebugMarkerSetObjectNameEXT")(device, pNameInfo);
 	}
 #endif
 #if (defined(VK_EXT_debug_marker))
 	VkResult debugMarkerSetObjectTagEXT(const VkDebugMarkerObjectTagInfoEXT* pTagInfo) const noexcept {
-		return fp_vkDebugMarkerSetObjectTagEXT(device, pTagInfo);
+		return load(fp_vkDebugMarkerSetObjectTagEXT, 133, "vkDebugMarkerSetObjectTagEXT")(device, pTagInfo);
 	}
 #endif
 #if (defined(VK_EXT_debug_marker))
 	void cmdDebugMarkerBeginEXT(VkCommandBuffer commandBuffer, const VkDebugMarkerMarkerInfoEXT* pMarkerInfo) const noexcept {
-		fp_vkCmdDebugMarkerBeginEXT(commandBuffer, pMarkerInfo);
+		load(fp_vkCmdDebugMarkerBeginEXT, 134, "vkCmdDebugMarkerBeginEXT")(commandBuffer, pMarkerInfo);
 	}
 #endif
 #if (defined(VK_EXT_debug_marker))
 	void cmdDebugMarkerEndEXT(VkCommandBuffer commandBuffer) const noexcept {
-		fp_vkCmdDebugMarkerEndEXT(commandBuffer);
+		load(fp_vkCmdDebugMarkerEndEXT, 135, "vkCmdDebugMarkerEndEXT")(commandBuffer);
 	}
 #endif
 #if (defined(VK_EXT_debug_marker))
 	void cmdDebugMarkerInsertEXT(VkCommandBuffer commandBuffer, const VkDebugMarkerMarkerInfoEXT* pMarkerInfo) const noexcept {
-		fp_vkCmdDebugMarkerInsertEXT(commandBuffer, pMarkerInfo);
+		load(fp_vkCmdDebugMarkerInsertEXT, 136, "vkCmdDebugMarkerInsertEXT")(commandBuffer, pMarkerInfo);
 	}
 #endif
 #if (defined(VK_NV_external_memory_win32))
 	VkResult getMemoryWin32HandleNV(VkDeviceMemory memory, VkExternalMemoryHandleTypeFlagsNV handleType, HANDLE* pHandle) const noexcept {
-		return fp_vkGetMemoryWin32HandleNV(device, memory, handleType, pHandle);
+		return load(fp_vkGetMemoryWin32HandleNV, 137, "vkGetMemoryWin32HandleNV")(device, memory, handleType, pHandle);
 	}
 #endif
 #if (defined(VK_NV_device_generated_commands))
 	void cmdExecuteGeneratedCommandsNV(VkCommandBuffer commandBuffer, VkBool32 isPreprocessed, const VkGeneratedCommandsInfoNV* pGeneratedCommandsInfo) const noexcept {
-		fp_vkCmdExecuteGeneratedCommandsNV(commandBuffer, isPreprocessed, pGeneratedCommandsInfo);
+		load(fp_vkCmdExecuteGeneratedCommandsNV, 138, "vkCmdExecuteGeneratedCommandsNV")(commandBuffer, isPreprocessed, pGeneratedCommandsInfo);
 	}
 #endif
 #if (defined(VK_NV_device_generated_commands))
 	void cmdPreprocessGeneratedCommandsNV(VkCommandBuffer commandBuffer, const VkGeneratedCommandsInfoNV* pGeneratedCommandsInfo) const noexcept {
-		fp_vkCmdPreprocessGeneratedCommandsNV(commandBuffer, pGeneratedCommandsInfo);
+		load(fp_vkCmdPreprocessGeneratedCommandsNV, 139, "vkCmdPreprocessGeneratedCommandsNV")(commandBuffer, pGeneratedCommandsInfo);
 	}
 #endif
 #if (defined(VK_NV_device_generated_commands))
 	void cmdBindPipelineShaderGroupNV(VkCommandBuffer commandBuffer, VkPipelineBindPoint pipelineBindPoint, VkPipeline pipeline, uint32_t groupIndex) const noexcept {
-		fp_vkCmdBindPipelineShaderGroupNV(commandBuffer, pipelineBindPoint, pipeline, groupIndex);
+		load(fp_vkCmdBindPipelineShaderGroupNV, 140, "vkCmdBindPipelineShaderGroupNV")(commandBuffer, pipelineBindPoint, pipeline, groupIndex);
 	}
 #endif
 #if (defined(VK_NV_device_generated_commands))
 	void getGeneratedCommandsMemoryRequirementsNV(const VkGeneratedCommandsMemoryRequirementsInfoNV* pInfo, VkMemoryRequirements2KHR* pMemoryRequirements) const noexcept {
-		fp_vkGetGeneratedCommandsMemoryRequirementsNV(device, pInfo, pMemoryRequirements);
+		load(fp_vkGetGeneratedCommandsMemoryRequirementsNV, 141, "vkGetGeneratedCommandsMemoryRequirementsNV")(device, pInfo, pMemoryRequirements);
 	}
 #endif
 #if (defined(VK_NV_device_generated_commands))
 	VkResult createIndirectCommandsLayoutNV(const VkIndirectCommandsLayoutCreateInfoNV* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkIndirectCommandsLayoutNV* pIndirectCommandsLayout) const noexcept {
-		return fp_vkCreateIndirectCommandsLayoutNV(device, pCreateInfo, pAllocator, pIndirectCommandsLayout);
+		return load(fp_vkCreateIndirectCommandsLayoutNV, 142, "vkCreateIndirectCommandsLayoutNV")(device, pCreateInfo, pAllocator, pIndirectCommandsLayout);
 	}
 #endif
 #if (defined(VK_NV_device_generated_commands))
 	void destroyIndirectCommandsLayoutNV(VkIndirectCommandsLayoutNV indirectCommandsLayout, const VkAllocationCallbacks* pAllocator) const noexcept {
-		fp_vkDestroyIndirectCommandsLayoutNV(device, indirectCommandsLayout, pAllocator);
+		load(fp_vkDestroyIndirectCommandsLayoutNV, 143, "vkDestroyIndirectCommandsLayoutNV")(device, indirectCommandsLayout, pAllocator);
 	}
 #endif
 #if (defined(VK_KHR_push_descriptor))
 	void cmdPushDescriptorSetKHR(VkCommandBuffer commandBuffer, VkPipelineBindPoint pipelineBindPoint, VkPipelineLayout layout, uint32_t set, uint32_t descriptorWriteCount, const VkWriteDescriptorSet* pDescriptorWrites) const noexcept {
-		fp_vkCmdPushDescriptorSetKHR(commandBuffer, pipelineBindPoint, layout, set, descriptorWriteCount, pDescriptorWrites);
+		load(fp_vkCmdPushDescriptorSetKHR, 144, "vkCmdPushDescriptorSetKHR")(commandBuffer, pipelineBindPoint, layout, set, descriptorWriteCount, pDescriptorWrites);
 	}
 #endif
 #if (defined(VK_VERSION_1_1))
 	void trimCommandPool(VkCommandPool commandPool, VkCommandPoolTrimFlagsKHR flags) const noexcept {
-		fp_vkTrimCommandPool(device, commandPool, flags);
+		load(fp_vkTrimCommandPool, 145, "vkTrimCommandPool")(device, commandPool, flags);
 	}
 #endif
 #if (defined(VK_KHR_external_memory_win32))
 	VkResult getMemoryWin32HandleKHR(const VkMemoryGetWin32HandleInfoKHR* pGetWin32HandleInfo, HANDLE* pHandle) const noexcept {
-		return fp_vkGetMemoryWin32HandleKHR(device, pGetWin32HandleInfo, pHandle);
+		return load(fp_vkGetMemoryWin32HandleKHR, 146, "vkGetMemoryWin32HandleKHR")(device, pGetWin32HandleInfo, pHandle);
 	}
 #endif
 #if (defined(VK_KHR_external_memory_win32))
 	VkResult getMemoryWin32HandlePropertiesKHR(VkExternalMemoryHandleTypeFlagBitsKHR handleType, HANDLE handle, VkMemoryWin32HandlePropertiesKHR* pMemoryWin32HandleProperties) const noexcept {
-		return fp_vkGetMemoryWin32HandlePropertiesKHR(device, handleType, handle, pMemoryWin32HandleProperties);
+		return load(fp_vkGetMemoryWin32HandlePropertiesKHR, 147, "vkGetMemoryWin32HandlePropertiesKHR")(device, handleType, handle, pMemoryWin32HandleProperties);
 	}
 #endif
 #if (defined(VK_KHR_external_memory_fd))
 	VkResult getMemoryFdKHR(const VkMemoryGetFdInfoKHR* pGetFdInfo, int* pFd) const noexcept {
-		return fp_vkGetMemoryFdKHR(device, pGetFdInfo, pFd);
+		return load(fp_vkGetMemoryFdKHR, 148, "vkGetMemoryFdKHR")(device, pGetFdInfo, pFd);
 	}
 #endif
 #if (defined(VK_KHR_external_memory_fd))
 	VkResult getMemoryFdPropertiesKHR(VkExternalMemoryHandleTypeFlagBitsKHR handleType, int fd, VkMemoryFdPropertiesKHR* pMemoryFdProperties) const noexcept {
-		return fp_vkGetMemoryFdPropertiesKHR(device, handleType, fd, pMemoryFdProperties);
+		return load(fp_vkGetMemoryFdPropertiesKHR, 149, "vkGetMemoryFdPropertiesKHR")(device, handleType, fd, pMemoryFdProperties);
 	}
 #endif
 #if (defined(VK_FUCHSIA_external_memory))
 	VkResult getMemoryZirconHandleFUCHSIA(const VkMemoryGetZirconHandleInfoFUCHSIA* pGetZirconHandleInfo, zx_handle_t* pZirconHandle) const noexcept {
-		return fp_vkGetMemoryZirconHandleFUCHSIA(device, pGetZirconHandleInfo, pZirconHandle);
+		return load(fp_vkGetMemoryZirconHandleFUCHSIA, 150, "vkGetMemoryZirconHandleFUCHSIA")(device, pGetZirconHandleInfo, pZirconHandle);
 	}
 #endif
 #if (defined(VK_FUCHSIA_external_memory))
 	VkResult getMemoryZirconHandlePropertiesFUCHSIA(VkExternalMemoryHandleTypeFlagBitsKHR handleType, zx_handle_t zirconHandle, VkMemoryZirconHandlePropertiesFUCHSIA* pMemoryZirconHandleProperties) const noexcept {
-		return fp_vkGetMemoryZirconHandlePropertiesFUCHSIA(device, handleType, zirconHandle, pMemoryZirconHandleProperties);
+		return load(fp_vkGetMemoryZirconHandlePropertiesFUCHSIA, 151, "vkGetMemoryZirconHandlePropertiesFUCHSIA")(device, handleType, zirconHandle, pMemoryZirconHandleProperties);
 	}
 #endif
 #if (defined(VK_NV_external_memory_rdma))
 	VkResult getMemoryRemoteAddressNV(const VkMemoryGetRemoteAddressInfoNV* pMemoryGetRemoteAddressInfo, VkRemoteAddressNV* pAddress) const noexcept {
-		return fp_vkGetMemoryRemoteAddressNV(device, pMemoryGetRemoteAddressInfo, pAddress);
+		return load(fp_vkGetMemoryRemoteAddressNV, 152, "vkGetMemoryRemoteAddressNV")(device, pMemoryGetRemoteAddressInfo, pAddress);
 	}
 #endif
 #if (defined(VK_KHR_external_semaphore_win32))
 	VkResult getSemaphoreWin32HandleKHR(const VkSemaphoreGetWin32HandleInfoKHR* pGetWin32HandleInfo, HANDLE* pHandle) const noexcept {
-		return fp_vkGetSemaphoreWin32HandleKHR(device, pGetWin32HandleInfo, pHandle);
+		return load(fp_vkGetSemaphoreWin32HandleKHR, 153, "vkGetSemaphoreWin32HandleKHR")(device, pGetWin32HandleInfo, pHandle);
 	}
 #endif
 #if (defined(VK_KHR_external_semaphore_win32))
 	VkResult importSemaphoreWin32HandleKHR(const VkImportSemaphoreWin32HandleInfoKHR* pImportSemaphoreWin32HandleInfo) const noexcept {
-		return fp_vkImportSemaphoreWin32HandleKHR(device, pImportSemaphoreWin32HandleInfo);
+		return load(fp_vkImportSemaphoreWin32HandleKHR, 154, "vkImportSemaphoreWin32HandleKHR")(device, pImportSemaphoreWin32HandleInfo);
 	}
 #endif
 #if (defined(VK_KHR_external_semaphore_fd))
 	VkResult getSemaphoreFdKHR(const VkSemaphoreGetFdInfoKHR* pGetFdInfo, int* pFd) const noexcept {
-		return fp_vkGetSemaphoreFdKHR(device, pGetFdInfo, pFd);
+		return load(fp_vkGetSemaphoreFdKHR, 155, "vkGetSemaphoreFdKHR")(device, pGetFdInfo, pFd);
 	}
 #endif
 #if (defined(VK_KHR_external_semaphore_fd))
 	VkResult importSemaphoreFdKHR(const VkImportSemaphoreFdInfoKHR* pImportSemaphoreFdInfo) const noexcept {
-		return fp_vkImportSemaphoreFdKHR(device, pImportSemaphoreFdInfo);
+		return load(fp_vkImportSemaphoreFdKHR, 156, "vkImportSemaphoreFdKHR")(device, pImportSemaphoreFdInfo);
 	}
 #endif
 #if (defined(VK_FUCHSIA_external_semaphore))
 	VkResult getSemaphoreZirconHandleFUCHSIA(const VkSemaphoreGetZirconHandleInfoFUCHSIA* pGetZirconHandleInfo, zx_handle_t* pZirconHandle) const noexcept {
-		return fp_vkGetSemaphoreZirconHandleFUCHSIA(device, pGetZirconHandleInfo, pZirconHandle);
+		return load(fp_vkGetSemaphoreZirconHandleFUCHSIA, 157, "vkGetSemaphoreZirconHandleFUCHSIA")(device, pGetZirconHandleInfo, pZirconHandle);
 	}
 #endif
 #if (defined(VK_FUCHSIA_external_semaphore))
 	VkResult importSemaphoreZirconHandleFUCHSIA(const VkImportSemaphoreZirconHandleInfoFUCHSIA* pImportSemaphoreZirconHandleInfo) const noexcept {
-		return fp_vkImportSemaphoreZirconHandleFUCHSIA(device, pImportSemaphoreZirconHandleInfo);
+		return load(fp_vkImportSemaphoreZirconHandleFUCHSIA, 158, "vkImportSemaphoreZirconHandleFUCHSIA")(device, pImportSemaphoreZirconHandleInfo);
 	}
 #endif
 #if (defined(VK_KHR_external_fence_win32))
 	VkResult getFenceWin32HandleKHR(const VkFenceGetWin32HandleInfoKHR* pGetWin32HandleInfo, HANDLE* pHandle) const noexcept {
-		return fp_vkGetFenceWin32HandleKHR(device, pGetWin32HandleInfo, pHandle);
+		return load(fp_vkGetFenceWin32HandleKHR, 159, "vkGetFenceWin32HandleKHR")(device, pGetWin32HandleInfo, pHandle);
 	}
 #endif
 #if (defined(VK_KHR_external_fence_win32))
 	VkResult importFenceWin32HandleKHR(const VkImportFenceWin32HandleInfoKHR* pImportFenceWin32HandleInfo) const noexcept {
-		return fp_vkImportFenceWin32HandleKHR(device, pImportFenceWin32HandleInfo);
+		return load(fp_vkImportFenceWin32HandleKHR, 160, "vkImportFenceWin32HandleKHR")(device, pImportFenceWin32HandleInfo);
 	}
 #endif
 #if (defined(VK_KHR_external_fence_fd))
 	VkResult getFenceFdKHR(const VkFenceGetFdInfoKHR* pGetFdInfo, int* pFd) const noexcept {
-		return fp_vkGetFenceFdKHR(device, pGetFdInfo, pFd);
+		return load(fp_vkGetFenceFdKHR, 161, "vkGetFenceFdKHR")(device, pGetFdInfo, pFd);
 	}
 #endif
 #if (defined(VK_KHR_external_fence_fd))
 	VkResult importFenceFdKHR(const VkImportFenceFdInfoKHR* pImportFenceFdInfo) const noexcept {
-		return fp_vkImportFenceFdKHR(device, pImportFenceFdInfo);
+		return load(fp_vkImportFenceFdKHR, 162, "vkImportFenceFdKHR")(device, pImportFenceFdInfo);
 	}
 #endif
 #if (defined(VK_EXT_display_control))
 	VkResult displayPowerControlEXT(VkDisplayKHR display, const VkDisplayPowerInfoEXT* pDisplayPowerInfo) const noexcept {
-		return fp_vkDisplayPowerControlEXT(device, display, pDisplayPowerInfo);
+		return load(fp_vkDisplayPowerControlEXT, 163, "vkDisplayPowerControlEXT")(device, display, pDisplayPowerInfo);
 	}
 #endif
 #if (defined(VK_EXT_display_control))
 	VkResult registerDeviceEventEXT(const VkDeviceEventInfoEXT* pDeviceEventInfo, const VkAllocationCallbacks* pAllocator, VkFence* pFence) const noexcept {
-		return fp_vkRegisterDeviceEventEXT(device, pDeviceEventInfo, pAllocator, pFence);
+		return load(fp_vkRegisterDeviceEventEXT, 164, "vkRegisterDeviceEventEXT")(device, pDeviceEventInfo, pAllocator, pFence);
 	}
 #endif
 #if (defined(VK_EXT_display_control))
 	VkResult registerDisplayEventEXT(VkDisplayKHR display, const VkDisplayEventInfoEXT* pDisplayEventInfo, const VkAllocationCallbacks* pAllocator, VkFence* pFence) const noexcept {
-		return fp_vkRegisterDisplayEventEXT(device, display, pDisplayEventInfo, pAllocator, pFence);
+		return load(fp_vkRegisterDisplayEventEXT, 165, "vkRegisterDisplayEventEXT")(device, display, pDisplayEventInfo, pAllocator, pFence);
 	}
 #endif
 #if (defined(VK_EXT_display_control))
 	VkResult getSwapchainCounterEXT(VkSwapchainKHR swapchain, VkSurfaceCounterFlagBitsEXT counter, uint64_t* pCounterValue) const noexcept {
-		return fp_vkGetSwapchainCounterEXT(device, swapchain, counter, pCounterValue);
+		return load(fp_vkGetSwapchainCounterEXT, 166, "vkGetSwapchainCounterEXT")(device, swapchain, counter, pCounterValue);
 	}
 #endif
 #if (defined(VK_VERSION_1_1))
 	void getDeviceGroupPeerMemoryFeatures(uint32_t heapIndex, uint32_t localDeviceIndex, uint32_t remoteDeviceIndex, VkPeerMemoryFeatureFlagsKHR* pPeerMemoryFeatures) const noexcept {
-		fp_vkGetDeviceGroupPeerMemoryFeatures(device, heapIndex, localDeviceIndex, remoteDeviceIndex, pPeerMemoryFeatures);
+		load(fp_vkGetDeviceGroupPeerMemoryFeatures, 167, "vkGetDeviceGroupPeerMemoryFeatures")(device, heapIndex, localDeviceIndex, remoteDeviceIndex, pPeerMemoryFeatures);
 	}
 #endif
 #if (defined(VK_VERSION_1_1))
 	VkResult bindBufferMemory2(uint32_t bindInfoCount, const VkBindBufferMemoryInfoKHR* pBindInfos) const noexcept {
-		return fp_vkBindBufferMemory2(device, bindInfoCount, pBindInfos);
+		return load(fp_vkBindBufferMemory2, 168, "vkBindBufferMemory2")(device, bindInfoCount, pBindInfos);
 	}
 #endif
 #if (defined(VK_VERSION_1_1))
 	VkResult bindImageMemory2(uint32_t bindInfoCount, const VkBindImageMemoryInfoKHR* pBindInfos) const noexcept {
-		return fp_vkBindImageMemory2(device, bindInfoCount, pBindInfos);
+		return load(fp_vkBindImageMemory2, 169, "vkBindImageMemory2")(device, bindInfoCount, pBindInfos);
 	}
 #endif
 #if (defined(VK_VERSION_1_1))
 	void cmdSetDeviceMask(VkCommandBuffer commandBuffer, uint32_t deviceMask) const noexcept {
-		fp_vkCmdSetDeviceMask(commandBuffer, deviceMask);
+		load(fp_vkCmdSetDeviceMask, 170, "vkCmdSetDeviceMask")(commandBuffer, deviceMask);
 	}
 #endif
 #if (defined(VK_KHR_swapchain) && defined(VK_VERSION_1_1)) || (defined(VK_KHR_device_group) && defined(VK_KHR_surface))
 	VkResult getDeviceGroupPresentCapabilitiesKHR(VkDeviceGroupPresentCapabilitiesKHR* pDeviceGroupPresentCapabilities) const noexcept {
-		return fp_vkGetDeviceGroupPresentCapabilitiesKHR(device, pDeviceGroupPresentCapabilities);
+		return load(fp_vkGetDeviceGroupPresentCapabilitiesKHR, 171, "vkGetDeviceGroupPresentCapabilitiesKHR")(device, pDeviceGroupPresentCapabilities);
 	}
 #endif
 #if (defined(VK_KHR_swapchain) && defined(VK_VERSION_1_1)) || (defined(VK_KHR_device_group) && defined(VK_KHR_surface))
 	VkResult getDeviceGroupSurfacePresentModesKHR(VkSurfaceKHR surface, VkDeviceGroupPresentModeFlagsKHR* pModes) const noexcept {
-		return fp_vkGetDeviceGroupSurfacePresentModesKHR(device, surface, pModes);
+		return load(fp_vkGetDeviceGroupSurfacePresentModesKHR, 172, "vkGetDeviceGroupSurfacePresentModesKHR")(device, surface, pModes);
 	}
 #endif
 #if (defined(VK_KHR_swapchain) && defined(VK_VERSION_1_1)) || (defined(VK_KHR_device_group) && defined(VK_KHR_swapchain))
 	VkResult acquireNextImage2KHR(const VkAcquireNextImageInfoKHR* pAcquireInfo, uint32_t* pImageIndex) const noexcept {
-		return fp_vkAcquireNextImage2KHR(device, pAcquireInfo, pImageIndex);
+		return load(fp_vkAcquireNextImage2KHR, 173, "vkAcquireNextImage2KHR")(device, pAcquireInfo, pImageIndex);
 	}
 #endif
 #if (defined(VK_VERSION_1_1))
 	void cmdDispatchBase(VkCommandBuffer commandBuffer, uint32_t baseGroupX, uint32_t baseGroupY, uint32_t baseGroupZ, uint32_t groupCountX, uint32_t groupCountY, uint32_t groupCountZ) const noexcept {
-		fp_vkCmdDispatchBase(commandBuffer, baseGroupX, baseGroupY, baseGroupZ, groupCountX, groupCountY, groupCountZ);
+		load(fp_vkCmdDispatchBase, 174, "vkCmdDispatchBase")(commandBuffer, baseGroupX, baseGroupY, baseGroupZ, groupCountX, groupCountY, groupCountZ);
 	}
 #endif
 #if (defined(VK_VERSION_1_1))
 	VkResult createDescriptorUpdateTemplate(const VkDescriptorUpdateTemplateCreateInfoKHR* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkDescriptorUpdateTemplateKHR* pDescriptorUpdateTemplate) const noexcept {
-		return fp_vkCreateDescriptorUpdateTemplate(device, pCreateInfo, pAllocator, pDescriptorUpdateTemplate);
+		return load(fp_vkCreateDescriptorUpdateTemplate, 175, "vkCreateDescriptorUpdateTemplate")(device, pCreateInfo, pAllocator, pDescriptorUpdateTemplate);
 	}
 #endif
 #if (defined(VK_VERSION_1_1))
 	void destroyDescriptorUpdateTemplate(VkDescriptorUpdateTemplateKHR descriptorUpdateTemplate, const VkAllocationCallbacks* pAllocator) const noexcept {
-		fp_vkDestroyDescriptorUpdateTemplate(device, descriptorUpdateTemplate, pAllocator);
+		load(fp_vkDestroyDescriptorUpdateTemplate, 176, "vkDestroyDescriptorUpdateTemplate")(device, descriptorUpdateTemplate, pAllocator);
 	}
 #endif
 #if (defined(VK_VERSION_1_1))
 	void updateDescriptorSetWithTemplate(VkDescriptorSet descriptorSet, VkDescriptorUpdateTemplateKHR descriptorUpdateTemplate, const void* pData) const noexcept {
-		fp_vkUpdateDescriptorSetWithTemplate(device, descriptorSet, descriptorUpdateTemplate, pData);
+		load(fp_vkUpdateDescriptorSetWithTemplate, 177, "vkUpdateDescriptorSetWithTemplate")(device, descriptorSet, descriptorUpdateTemplate, pData);
 	}
 #endif
 #if (defined(VK_KHR_push_descriptor) && defined(VK_VERSION_1_1)) || (defined(VK_KHR_push_descriptor) && defined(VK_KHR_descriptor_update_template)) || (defined(VK_KHR_descriptor_update_template) && defined(VK_KHR_push_descriptor))
 	void cmdPushDescriptorSetWithTemplateKHR(VkCommandBuffer commandBuffer, VkDescriptorUpdateTemplateKHR descriptorUpdateTemplate, VkPipelineLayout layout, uint32_t set, const void* pData) const noexcept {
-		fp_vkCmdPushDescriptorSetWithTemplateKHR(commandBuffer, descriptorUpdateTemplate, layout, set, pData);
+		load(fp_vkCmdPushDescriptorSetWithTemplateKHR, 178, "vkCmdPushDescriptorSetWithTemplateKHR")(commandBuffer, descriptorUpdateTemplate, layout, set, pData);
 	}
 #endif
 #if (defined(VK_EXT_hdr_metadata))
 	void setHdrMetadataEXT(uint32_t swapchainCount, const VkSwapchainKHR* pSwapchains, const VkHdrMetadataEXT* pMetadata) const noexcept {
-		fp_vkSetHdrMetadataEXT(device, swapchainCount, pSwapchains, pMetadata);
+		load(fp_vkSetHdrMetadataEXT, 179, "vkSetHdrMetadataEXT")(device, swapchainCount, pSwapchains, pMetadata);
 	}
 #endif
 #if (defined(VK_KHR_shared_presentable_image))
 	VkResult getSwapchainStatusKHR(VkSwapchainKHR swapchain) const noexcept {
-		return fp_vkGetSwapchainStatusKHR(device, swapchain);
+		return load(fp_vkGetSwapchainStatusKHR, 180, "vkGetSwapchainStatusKHR")(device, swapchain);
 	}
 #endif
 #if (defined(VK_GOOGLE_display_timing))
 	VkResult getRefreshCycleDurationGOOGLE(VkSwapchainKHR swapchain, VkRefreshCycleDurationGOOGLE* pDisplayTimingProperties) const noexcept {
-		return fp_vkGetRefreshCycleDurationGOOGLE(device, swapchain, pDisplayTimingProperties);
+		return load(fp_vkGetRefreshCycleDurationGOOGLE, 181, "vkGetRefreshCycleDurationGOOGLE")(device, swapchain, pDisplayTimingProperties);
 	}
 #endif
 #if (defined(VK_GOOGLE_display_timing))
 	VkResult getPastPresentationTimingGOOGLE(VkSwapchainKHR swapchain, uint32_t* pPresentationTimingCount, VkPastPresentationTimingGOOGLE* pPresentationTimings) const noexcept {
-		return fp_vkGetPastPresentationTimingGOOGLE(device, swapchain, pPresentationTimingCount, pPresentationTimings);
+		return load(fp_vkGetPastPresentationTimingGOOGLE, 182, "vkGetPastPresentationTimingGOOGLE")(device, swapchain, pPresentationTimingCount, pPresentationTimings);
 	}
 #endif
 #if (defined(VK_NV_clip_space_w_scaling))
 	void cmdSetViewportWScalingNV(VkCommandBuffer commandBuffer, uint32_t firstViewport, uint32_t viewportCount, const VkViewportWScalingNV* pViewportWScalings) const noexcept {
-		fp_vkCmdSetViewportWScalingNV(commandBuffer, firstViewport, viewportCount, pViewportWScalings);
+		load(fp_vkCmdSetViewportWScalingNV, 183, "vkCmdSetViewportWScalingNV")(commandBuffer, firstViewport, viewportCount, pViewportWScalings);
 	}
 #endif
 #if (defined(VK_EXT_discard_rectangles))
 	void cmdSetDiscardRectangleEXT(VkCommandBuffer commandBuffer, uint32_t firstDiscardRectangle, uint32_t discardRectangleCount, const VkRect2D* pDiscardRectangles) const noexcept {
-		fp_vkCmdSetDiscardRectangleEXT(commandBuffer, firstDiscardRectangle, discardRectangleCount, pDiscardRectangles);
+		load(fp_vkCmdSetDiscardRectangleEXT, 184, "vkCmdSetDiscardRectangleEXT")(commandBuffer, firstDiscardRectangle, discardRectangleCount, pDiscardRectangles);
 	}
 #endif
 #if (defined(VK_EXT_sample_locations))
 	void cmdSetSampleLocationsEXT(VkCommandBuffer commandBuffer, const VkSampleLocationsInfoEXT* pSampleLocationsInfo) const noexcept {
-		fp_vkCmdSetSampleLocationsEXT(commandBuffer, pSampleLocationsInfo);
+		load(fp_vkCmdSetSampleLocationsEXT, 185, "vkCmdSetSampleLocationsEXT")(commandBuffer, pSampleLocationsInfo);
 	}
 #endif
 #if (defined(VK_VERSION_1_1))
 	void getBufferMemoryRequirements2(const VkBufferMemoryRequirementsInfo2KHR* pInfo, VkMemoryRequirements2KHR* pMemoryRequirements) const noexcept {
-		fp_vkGetBufferMemoryRequirements2(device, pInfo, pMemoryRequirements);
+		load(fp_vkGetBufferMemoryRequirements2, 186, "vkGetBufferMemoryRequirements2")(device, pInfo, pMemoryRequirements);
 	}
 #endif
 #if (defined(VK_VERSION_1_1))
 	void getImageMemoryRequirements2(const VkImageMemoryRequirementsInfo2KHR* pInfo, VkMemoryRequirements2KHR* pMemoryRequirements) const noexcept {
-		fp_vkGetImageMemoryRequirements2(device, pInfo, pMemoryRequirements);
+		load(fp_vkGetImageMemoryRequirements2, 187, "vkGetImageMemoryRequirements2")(device, pInfo, pMemoryRequirements);
 	}
 #endif
 #if (defined(VK_VERSION_1_1))
 	void getImageSparseMemoryRequirements2(const VkImageSparseMemoryRequirementsInfo2KHR* pInfo, uint32_t* pSparseMemoryRequirementCount, VkSparseImageMemoryRequirements2KHR* pSparseMemoryRequirements) const noexcept {
-		fp_vkGetImageSparseMemoryRequirements2(device, pInfo, pSparseMemoryRequirementCount, pSparseMemoryRequirements);
+		load(fp_vkGetImageSparseMemoryRequirements2, 188, "vkGetImageSparseMemoryRequirements2")(device, pInfo, pSparseMemoryRequirementCount, pSparseMemoryRequirements);
 	}
 #endif
 #if (defined(VK_VERSION_1_3))
 	void getDeviceBufferMemoryRequirements(const VkDeviceBufferMemoryRequirementsKHR* pInfo, VkMemoryRequirements2KHR* pMemoryRequirements) const noexcept {
-		fp_vkGetDeviceBufferMemoryRequirements(device, pInfo, pMemoryRequirements);
+		load(fp_vkGetDeviceBufferMemoryRequirements, 189, "vkGetDeviceBufferMemoryRequirements")(device, pInfo, pMemoryRequirements);
 	}
 #endif
 #if (defined(VK_VERSION_1_3))
 	void getDeviceImageMemoryRequirements(const VkDeviceImageMemoryRequirementsKHR* pInfo, VkMemoryRequirements2KHR* pMemoryRequirements) const noexcept {
-		fp_vkGetDeviceImageMemoryRequirements(device, pInfo, pMemoryRequirements);
+		load(fp_vkGetDeviceImageMemoryRequirements, 190, "vkGetDeviceImageMemoryRequirements")(device, pInfo, pMemoryRequirements);
 	}
 #endif
 #if (defined(VK_VERSION_1_3))
 	void getDeviceImageSparseMemoryRequirements(const VkDeviceImageMemoryRequirementsKHR* pInfo, uint32_t* pSparseMemoryRequirementCount, VkSparseImageMemoryRequirements2KHR* pSparseMemoryRequirements) const noexcept {
-		fp_vkGetDeviceImageSparseMemoryRequirements(device, pInfo, pSparseMemoryRequirementCount, pSparseMemoryRequirements);
+		load(fp_vkGetDeviceImageSparseMemoryRequirements, 191, "vkGetDeviceImageSparseMemoryRequirements")(device, pInfo, pSparseMemoryRequirementCount, pSparseMemoryRequirements);
 	}
 #endif
 #if (defined(VK_VERSION_1_1))
 	VkResult createSamplerYcbcrConversion(const VkSamplerYcbcrConversionCreateInfoKHR* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkSamplerYcbcrConversionKHR* pYcbcrConversion) const noexcept {
-		return fp_vkCreateSamplerYcbcrConversion(device, pCreateInfo, pAllocator, pYcbcrConversion);
+		return load(fp_vkCreateSamplerYcbcrConversion, 192, "vkCreateSamplerYcbcrConversion")(device, pCreateInfo, pAllocator, pYcbcrConversion);
 	}
 #endif
 #if (defined(VK_VERSION_1_1))
 	void destroySamplerYcbcrConversion(VkSamplerYcbcrConversionKHR ycbcrConversion, const VkAllocationCallbacks* pAllocator) const noexcept {
-		fp_vkDestroySamplerYcbcrConversion(device, ycbcrConversion, pAllocator);
+		load(fp_vkDestroySamplerYcbcrConversion, 193, "vkDestroySamplerYcbcrConversion")(device, ycbcrConversion, pAllocator);
 	}
 #endif
 #if (defined(VK_VERSION_1_1))
 	void getDeviceQueue2(const VkDeviceQueueInfo2* pQueueInfo, VkQueue* pQueue) const noexcept {
-		fp_vkGetDeviceQueue2(device, pQueueInfo, pQueue);
+		load(fp_vkGetDeviceQueue2, 194, "vkGetDeviceQueue2")(device, pQueueInfo, pQueue);
 	}
 #endif
 #if (defined(VK_EXT_validation_cache))
 	VkResult createValidationCacheEXT(const VkValidationCacheCreateInfoEXT* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkValidationCacheEXT* pValidationCache) const noexcept {
-		return fp_vkCreateValidationCacheEXT(device, pCreateInfo, pAllocator, pValidationCache);
+		return load(fp_vkCreateValidationCacheEXT, 195, "vkCreateValidationCacheEXT")(device, pCreateInfo, pAllocator, pValidationCache);
 	}
 #endif
 #if (defined(VK_EXT_validation_cache))
 	void destroyValidationCacheEXT(VkValidationCacheEXT validationCache, const VkAllocationCallbacks* pAllocator) const noexcept {
-		fp_vkDestroyValidationCacheEXT(device, validationCache, pAllocator);
+		load(fp_vkDestroyValidationCacheEXT, 196, "vkDestroyValidationCacheEXT")(device, validationCache, pAllocator);
 	}
 #endif
 #if (defined(VK_EXT_validation_cache))
 	VkResult getValidationCacheDataEXT(VkValidationCacheEXT validationCache, size_t* pDataSize, void* pData) const noexcept {
-		return fp_vkGetValidationCacheDataEXT(device, validationCache, pDataSize, pData);
+		return load(fp_vkGetValidationCacheDataEXT, 197, "vkGetValidationCacheDataEXT")(device, validationCache, pDataSize, pData);
 	}
 #endif
 #if (defined(VK_EXT_validation_cache))
 	VkResult mergeValidationCachesEXT(VkValidationCacheEXT dstCache, uint32_t srcCacheCount, const VkValidationCacheEXT* pSrcCaches) const noexcept {
-		return fp_vkMergeValidationCachesEXT(device, dstCache, srcCacheCount, pSrcCaches);
+		return load(fp_vkMergeValidationCachesEXT, 198, "vkMergeValidationCachesEXT")(device, dstCache, srcCacheCount, pSrcCaches);
 	}
 #endif
 #if (defined(VK_VERSION_1_1))
 	void getDescriptorSetLayoutSupport(const VkDescriptorSetLayoutCreateInfo* pCreateInfo, VkDescriptorSetLayoutSupportKHR* pSupport) const noexcept {
-		fp_vkGetDescriptorSetLayoutSupport(device, pCreateInfo, pSupport);
+		load(fp_vkGetDescriptorSetLayoutSupport, 199, "vkGetDescriptorSetLayoutSupport")(device, pCreateInfo, pSupport);
 	}
 #endif
 #if (defined(VK_ANDROID_native_buffer))
 	VkResult getSwapchainGrallocUsageANDROID(VkFormat format, VkImageUsageFlags imageUsage, int* grallocUsage) const noexcept {
-		return fp_vkGetSwapchainGrallocUsageANDROID(device, format, imageUsage, grallocUsage);
+		return load(fp_vkGetSwapchainGrallocUsageANDROID, 200, "vkGetSwapchainGrallocUsageANDROID")(device, format, imageUsage, grallocUsage);
 	}
 #endif
 #if (defined(VK_ANDROID_native_buffer))
 	VkResult getSwapchainGrallocUsage2ANDROID(VkFormat format, VkImageUsageFlags imageUsage, VkSwapchainImageUsageFlagsANDROID swapchainImageUsage, uint64_t* grallocConsumerUsage, uint64_t* grallocProducerUsage) const noexcept {
-		return fp_vkGetSwapchainGrallocUsage2ANDROID(device, format, imageUsage, swapchainImageUsage, grallocConsumerUsage, grallocProducerUsage);
+		return load(fp_vkGetSwapchainGrallocUsage2ANDROID, 201, "vkGetSwapchainGrallocUsage2ANDROID")(device, format, imageUsage, swapchainImageUsage, grallocConsumerUsage, grallocProducerUsage);
 	}
 #endif
 #if (defined(VK_ANDROID_native_buffer))
 	VkResult acquireImageANDROID(VkImage image, int nativeFenceFd, VkSemaphore semaphore, VkFence fence) const noexcept {
-		return fp_vkAcquireImageANDROID(device, image, nativeFenceFd, semaphore, fence);
+		return load(fp_vkAcquireImageANDROID, 202, "vkAcquireImageANDROID")(device, image, nativeFenceFd, semaphore, fence);
 	}
 #endif
 #if (defined(VK_ANDROID_native_buffer))
 	VkResult queueSignalReleaseImageANDROID(VkQueue queue, uint32_t waitSemaphoreCount, const VkSemaphore* pWaitSemaphores, VkImage image, int* pNativeFenceFd) const noexcept {
-		return fp_vkQueueSignalReleaseImageANDROID(queue, waitSemaphoreCount, pWaitSemaphores, image, pNativeFenceFd);
+		return load(fp_vkQueueSignalReleaseImageANDROID, 203, "vkQueueSignalReleaseImageANDROID")(queue, waitSemaphoreCount, pWaitSemaphores, image, pNativeFenceFd);
 	}
 #endif
 #if (defined(VK_AMD_shader_info))
 	VkResult getShaderInfoAMD(VkPipeline pipeline, VkShaderStageFlagBits shaderStage, VkShaderInfoTypeAMD infoType, size_t* pInfoSize, void* pInfo) const noexcept {
-		return fp_vkGetShaderInfoAMD(device, pipeline, shaderStage, infoType, pInfoSize, pInfo);
+		return load(fp_vkGetShaderInfoAMD, 204, "vkGetShaderInfoAMD")(device, pipeline, shaderStage, infoType, pInfoSize, pInfo);
 	}
 #endif
 #if (defined(VK_AMD_display_native_hdr))
 	void setLocalDimmingAMD(VkSwapchainKHR swapChain, VkBool32 localDimmingEnable) const noexcept {
-		fp_vkSetLocalDimmingAMD(device, swapChain, localDimmingEnable);
+		load(fp_vkSetLocalDimmingAMD, 205, "vkSetLocalDimmingAMD")(device, swapChain, localDimmingEnable);
 	}
 #endif
 #if (defined(VK_EXT_calibrated_timestamps))
 	VkResult getCalibratedTimestampsEXT(uint32_t timestampCount, const VkCalibratedTimestampInfoEXT* pTimestampInfos, uint64_t* pTimestamps, uint64_t* pMaxDeviation) const noexcept {
-		return fp_vkGetCalibratedTimestampsEXT(device, timestampCount, pTimestampInfos, pTimestamps, pMaxDeviation);
+		return load(fp_vkGetCalibratedTimestampsEXT, 206, "vkGetCalibratedTimestampsEXT")(device, timestampCount, pTimestampInfos, pTimestamps, pMaxDeviation);
 	}
 #endif
 #if (defined(VK_EXT_debug_utils))
 	VkResult setDebugUtilsObjectNameEXT(const VkDebugUtilsObjectNameInfoEXT* pNameInfo) const noexcept {
-		return fp_vkSetDebugUtilsObjectNameEXT(device, pNameInfo);
+		return load(fp_vkSetDebugUtilsObjectNameEXT, 207, "vkSetDebugUtilsObjectNameEXT")(device, pNameInfo);
 	}
 #endif
 #if (defined(VK_EXT_debug_utils))
 	VkResult setDebugUtilsObjectTagEXT(const VkDebugUtilsObjectTagInfoEXT* pTagInfo) const noexcept {
-		return fp_vkSetDebugUtilsObjectTagEXT(device, pTagInfo);
+		return load(fp_vkSetDebugUtilsObjectTagEXT, 208, "vkSetDebugUtilsObjectTagEXT")(device, pTagInfo);
 	}
 #endif
 #if (defined(VK_EXT_debug_utils))
 	void queueBeginDebugUtilsLabelEXT(VkQueue queue, const VkDebugUtilsLabelEXT* pLabelInfo) const noexcept {
-		fp_vkQueueBeginDebugUtilsLabelEXT(queue, pLabelInfo);
+		load(fp_vkQueueBeginDebugUtilsLabelEXT, 209, "vkQueueBeginDebugUtilsLabelEXT")(queue, pLabelInfo);
 	}
 #endif
 #if (defined(VK_EXT_debug_utils))
 	void queueEndDebugUtilsLabelEXT(VkQueue queue) const noexcept {
-		fp_vkQueueEndDebugUtilsLabelEXT(queue);
+		load(fp_vkQueueEndDebugUtilsLabelEXT, 210, "vkQueueEndDebugUtilsLabelEXT")(queue);
 	}
 #endif
 #if (defined(VK_EXT_debug_utils))
 	void queueInsertDebugUtilsLabelEXT(VkQueue queue, const VkDebugUtilsLabelEXT* pLabelInfo) const noexcept {
-		fp_vkQueueInsertDebugUtilsLabelEXT(queue, pLabelInfo);
+		load(fp_vkQueueInsertDebugUtilsLabelEXT, 211, "vkQueueInsertDebugUtilsLabelEXT")(queue, pLabelInfo);
 	}
 #endif
 #if (defined(VK_EXT_debug_utils))
 	void cmdBeginDebugUtilsLabelEXT(VkCommandBuffer commandBuffer, const VkDebugUtilsLabelEXT* pLabelInfo) const noexcept {
-		fp_vkCmdBeginDebugUtilsLabelEXT(commandBuffer, pLabelInfo);
+		load(fp_vkCmdBeginDebugUtilsLabelEXT, 212, "vkCmdBeginDebugUtilsLabelEXT")(commandBuffer, pLabelInfo);
 	}
 #endif
 #if (defined(VK_EXT_debug_utils))
 	void cmdEndDebugUtilsLabelEXT(VkCommandBuffer commandBuffer) const noexcept {
-		fp_vkCmdEndDebugUtilsLabelEXT(commandBuffer);
+		load(fp_vkCmdEndDebugUtilsLabelEXT, 213, "vkCmdEndDebugUtilsLabelEXT")(commandBuffer);
 	}
 #endif
 #if (defined(VK_EXT_debug_utils))
 	void cmdInsertDebugUtilsLabelEXT(VkCommandBuffer commandBuffer, const VkDebugUtilsLabelEXT* pLabelInfo) const noexcept {
-		fp_vkCmdInsertDebugUtilsLabelEXT(commandBuffer, pLabelInfo);
+		load(fp_vkCmdInsertDebugUtilsLabelEXT, 214, "vkCmdInsertDebugUtilsLabelEXT")(commandBuffer, pLabelInfo);
 	}
 #endif
 #if (defined(VK_EXT_external_memory_host))
 	VkResult getMemoryHostPointerPropertiesEXT(VkExternalMemoryHandleTypeFlagBitsKHR handleType, const void* pHostPointer, VkMemoryHostPointerPropertiesEXT* pMemoryHostPointerProperties) const noexcept {
-		return fp_vkGetMemoryHostPointerPropertiesEXT(device, handleType, pHostPointer, pMemoryHostPointerProperties);
+		return load(fp_vkGetMemoryHostPointerPropertiesEXT, 215, "vkGetMemoryHostPointerPropertiesEXT")(device, handleType, pHostPointer, pMemoryHostPointerProperties);
 	}
 #endif
 #if (defined(VK_AMD_buffer_marker))
 	void cmdWriteBufferMarkerAMD(VkCommandBuffer commandBuffer, VkPipelineStageFlagBits pipelineStage, VkBuffer dstBuffer, VkDeviceSize dstOffset, uint32_t marker) const noexcept {
-		fp_vkCmdWriteBufferMarkerAMD(commandBuffer, pipelineStage, dstBuffer, dstOffset, marker);
+		load(fp_vkCmdWriteBufferMarkerAMD, 216, "vkCmdWriteBufferMarkerAMD")(commandBuffer, pipelineStage, dstBuffer, dstOffset, marker);
 	}
 #endif
 #if (defined(VK_VERSION_1_2))
 	VkResult createRenderPass2(const VkRenderPassCreateInfo2KHR* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkRenderPass* pRenderPass) const noexcept {
-		return fp_vkCreateRenderPass2(device, pCreateInfo, pAllocator, pRenderPass);
+		return load(fp_vkCreateRenderPass2, 217, "vkCreateRenderPass2")(device, pCreateInfo, pAllocator, pRenderPass);
 	}
 #endif
 #if (defined(VK_VERSION_1_2))
 	void cmdBeginRenderPass2(VkCommandBuffer commandBuffer, const VkRenderPassBeginInfo* pRenderPassBegin, const VkSubpassBeginInfoKHR* pSubpassBeginInfo) const noexcept {
-		fp_vkCmdBeginRenderPass2(commandBuffer, pRenderPassBegin, pSubpassBeginInfo);
+		load(fp_vkCmdBeginRenderPass2, 218, "vkCmdBeginRenderPass2")(commandBuffer, pRenderPassBegin, pSubpassBeginInfo);
 	}
 #endif
 #if (defined(VK_VERSION_1_2))
 	void cmdNextSubpass2(VkCommandBuffer commandBuffer, const VkSubpassBeginInfoKHR* pSubpassBeginInfo, const VkSubpassEndInfoKHR* pSubpassEndInfo) const noexcept {
-		fp_vkCmdNextSubpass2(commandBuffer, pSubpassBeginInfo, pSubpassEndInfo);
+		load(fp_vkCmdNextSubpass2, 219, "vkCmdNextSubpass2")(commandBuffer, pSubpassBeginInfo, pSubpassEndInfo);
 	}
 #endif
 #if (defined(VK_VERSION_1_2))
 	void cmdEndRenderPass2(VkCommandBuffer commandBuffer, const VkSubpassEndInfoKHR* pSubpassEndInfo) const noexcept {
-		fp_vkCmdEndRenderPass2(commandBuffer, pSubpassEndInfo);
+		load(fp_vkCmdEndRenderPass2, 220, "vkCmdEndRenderPass2")(commandBuffer, pSubpassEndInfo);
 	}
 #endif
 #if (defined(VK_VERSION_1_2))
 	VkResult getSemaphoreCounterValue(VkSemaphore semaphore, uint64_t* pValue) const noexcept {
-		return fp_vkGetSemaphoreCounterValue(device, semaphore, pValue);
+		return load(fp_vkGetSemaphoreCounterValue, 221, "vkGetSemaphoreCounterValue")(device, semaphore, pValue);
 	}
 #endif
 #if (defined(VK_VERSION_1_2))
 	VkResult waitSemaphores(const VkSemaphoreWaitInfoKHR* pWaitInfo, uint64_t timeout) const noexcept {
-		return fp_vkWaitSemaphores(device, pWaitInfo, timeout);
+		return load(fp_vkWaitSemaphores, 222, "vkWaitSemaphores")(device, pWaitInfo, timeout);
 	}
 #endif
 #if (defined(VK_VERSION_1_2))
 	VkResult signalSemaphore(const VkSemaphoreSignalInfoKHR* pSignalInfo) const noexcept {
-		return fp_vkSignalSemaphore(device, pSignalInfo);
+		return load(fp_vkSignalSemaphore, 223, "vkSignalSemaphore")(device, pSignalInfo);
 	}
 #endif
 #if (defined(VK_ANDROID_external_memory_android_hardware_buffer))
 	VkResult getAndroidHardwareBufferPropertiesANDROID(const struct AHardwareBuffer* buffer, VkAndroidHardwareBufferPropertiesANDROID* pProperties) const noexcept {
-		return fp_vkGetAndroidHardwareBufferPropertiesANDROID(device, buffer, pProperties);
+		return load(fp_vkGetAndroidHardwareBufferPropertiesANDROID, 224, "vkGetAndroidHardwareBufferPropertiesANDROID")(device, buffer, pProperties);
 	}
 #endif
 #if (defined(VK_ANDROID_external_memory_android_hardware_buffer))
 	VkResult getMemoryAndroidHardwareBufferANDROID(const VkMemoryGetAndroidHardwareBufferInfoANDROID* pInfo, struct AHardwareBuffer** pBuffer) const noexcept {
-		return fp_vkGetMemoryAndroidHardwareBufferANDROID(device, pInfo, pBuffer);
+		return load(fp_vkGetMemoryAndroidHardwareBufferANDROID, 225, "vkGetMemoryAndroidHardwareBufferANDROID")(device, pInfo, pBuffer);
 	}
 #endif
 #if (defined(VK_VERSION_1_2))
 	void cmdDrawIndirectCount(VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset, VkBuffer countBuffer, VkDeviceSize countBufferOffset, uint32_t maxDrawCount, uint32_t stride) const noexcept {
-		fp_vkCmdDrawIndirectCount(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
+		load(fp_vkCmdDrawIndirectCount, 226, "vkCmdDrawIndirectCount")(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
 	}
 #endif
 #if (defined(VK_VERSION_1_2))
 	void cmdDrawIndexedIndirectCount(VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset, VkBuffer countBuffer, VkDeviceSize countBufferOffset, uint32_t maxDrawCount, uint32_t stride) const noexcept {
-		fp_vkCmdDrawIndexedIndirectCount(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
+		load(fp_vkCmdDrawIndexedIndirectCount, 227, "vkCmdDrawIndexedIndirectCount")(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
 	}
 #endif
 #if (defined(VK_NV_device_diagnostic_checkpoints))
 	void cmdSetCheckpointNV(VkCommandBuffer commandBuffer, const void* pCheckpointMarker) const noexcept {
-		fp_vkCmdSetCheckpointNV(commandBuffer, pCheckpointMarker);
+		load(fp_vkCmdSetCheckpointNV, 228, "vkCmdSetCheckpointNV")(commandBuffer, pCheckpointMarker);
 	}
 #endif
 #if (defined(VK_NV_device_diagnostic_checkpoints))
 	void getQueueCheckpointDataNV(VkQueue queue, uint32_t* pCheckpointDataCount, VkCheckpointDataNV* pCheckpointData) const noexcept {
-		fp_vkGetQueueCheckpointDataNV(queue, pCheckpointDataCount, pCheckpointData);
+		load(fp_vkGetQueueCheckpointDataNV, 229, "vkGetQueueCheckpointDataNV")(queue, pCheckpointDataCount, pCheckpointData);
 	}
 #endif
 #if (defined(VK_EXT_transform_feedback))
 	void cmdBindTransformFeedbackBuffersEXT(VkCommandBuffer commandBuffer, uint32_t firstBinding, uint32_t bindingCount, const VkBuffer* pBuffers, const VkDeviceSize* pOffsets, const VkDeviceSize* pSizes) const noexcept {
-		fp_vkCmdBindTransformFeedbackBuffersEXT(commandBuffer, firstBinding, bindingCount, pBuffers, pOffsets, pSizes);
+		load(fp_vkCmdBindTransformFeedbackBuffersEXT, 230, "vkCmdBindTransformFeedbackBuffersEXT")(commandBuffer, firstBinding, bindingCount, pBuffers, pOffsets, pSizes);
 	}
 #endif
 #if (defined(VK_EXT_transform_feedback))
 	void cmdBeginTransformFeedbackEXT(VkCommandBuffer commandBuffer, uint32_t firstCounterBuffer, uint32_t counterBufferCount, const VkBuffer* pCounterBuffers, const VkDeviceSize* pCounterBufferOffsets) const noexcept {
-		fp_vkCmdBeginTransformFeedbackEXT(commandBuffer, firstCounterBuffer, counterBufferCount, pCounterBuffers, pCounterBufferOffsets);
+		load(fp_vkCmdBeginTransformFeedbackEXT, 231, "vkCmdBeginTransformFeedbackEXT")(commandBuffer, firstCounterBuffer, counterBufferCount, pCounterBuffers, pCounterBufferOffsets);
 	}
 #endif
 #if (defined(VK_EXT_transform_feedback))
 	void cmdEndTransformFeedbackEXT(VkCommandBuffer commandBuffer, uint32_t firstCounterBuffer, uint32_t counterBufferCount, const VkBuffer* pCounterBuffers, const VkDeviceSize* pCounterBufferOffsets) const noexcept {
-		fp_vkCmdEndTransformFeedbackEXT(commandBuffer, firstCounterBuffer, counterBufferCount, pCounterBuffers, pCounterBufferOffsets);
+		load(fp_vkCmdEndTransformFeedbackEXT, 232, "vkCmdEndTransformFeedbackEXT")(commandBuffer, firstCounterBuffer, counterBufferCount, pCounterBuffers, pCounterBufferOffsets);
 	}
 #endif
 #if (defined(VK_EXT_transform_feedback))
 	void cmdBeginQueryIndexedEXT(VkCommandBuffer commandBuffer, VkQueryPool queryPool, uint32_t query, VkQueryControlFlags flags, uint32_t index) const noexcept {
-		fp_vkCmdBeginQueryIndexedEXT(commandBuffer, queryPool, query, flags, index);
+		load(fp_vkCmdBeginQueryIndexedEXT, 233, "vkCmdBeginQueryIndexedEXT")(commandBuffer, queryPool, query, flags, index);
 	}
 #endif
 #if (defined(VK_EXT_transform_feedback))
 	void cmdEndQueryIndexedEXT(VkCommandBuffer commandBuffer, VkQueryPool queryPool, uint32_t query, uint32_t index) const noexcept {
-		fp_vkCmdEndQueryIndexedEXT(commandBuffer, queryPool, query, index);
+		load(fp_vkCmdEndQueryIndexedEXT, 234, "vkCmdEndQueryIndexedEXT")(commandBuffer, queryPool, query, index);
 	}
 #endif
 #if (defined(VK_EXT_transform_feedback))
 	void cmdDrawIndirectByteCountEXT(VkCommandBuffer commandBuffer, uint32_t instanceCount, uint32_t firstInstance, VkBuffer counterBuffer, VkDeviceSize counterBufferOffset, uint32_t counterOffset, uint32_t vertexStride) const noexcept {
-		fp_vkCmdDrawIndirectByteCountEXT(commandBuffer, instanceCount, firstInstance, counterBuffer, counterBufferOffset, counterOffset, vertexStride);
+		load(fp_vkCmdDrawIndirectByteCountEXT, 235, "vkCmdDrawIndirectByteCountEXT")(commandBuffer, instanceCount, firstInstance, counterBuffer, counterBufferOffset, counterOffset, vertexStride);
 	}
 #endif
 #if (defined(VK_NV_scissor_exclusive))
 	void cmdSetExclusiveScissorNV(VkCommandBuffer commandBuffer, uint32_t firstExclusiveScissor, uint32_t exclusiveScissorCount, const VkRect2D* pExclusiveScissors) const noexcept {
-		fp_vkCmdSetExclusiveScissorNV(commandBuffer, firstExclusiveScissor, exclusiveScissorCount, pExclusiveScissors);
+		load(fp_vkCmdSetExclusiveScissorNV, 236, "vkCmdSetExclusiveScissorNV")(commandBuffer, firstExclusiveScissor, exclusiveScissorCount, pExclusiveScissors);
 	}
 #endif
 #if (defined(VK_NV_shading_rate_image))
 	void cmdBindShadingRateImageNV(VkCommandBuffer commandBuffer, VkImageView imageView, VkImageLayout imageLayout) const noexcept {
-		fp_vkCmdBindShadingRateImageNV(commandBuffer, imageView, imageLayout);
+		load(fp_vkCmdBindShadingRateImageNV, 237, "vkCmdBindShadingRateImageNV")(commandBuffer, imageView, imageLayout);
 	}
 #endif
 #if (defined(VK_NV_shading_rate_image))
 	void cmdSetViewportShadingRatePaletteNV(VkCommandBuffer commandBuffer, uint32_t firstViewport, uint32_t viewportCount, const VkShadingRatePaletteNV* pShadingRatePalettes) const noexcept {
-		fp_vkCmdSetViewportShadingRatePaletteNV(commandBuffer, firstViewport, viewportCount, pShadingRatePalettes);
+		load(fp_vkCmdSetViewportShadingRatePaletteNV, 238, "vkCmdSetViewportShadingRatePaletteNV")(commandBuffer, firstViewport, viewportCount, pShadingRatePalettes);
 	}
 #endif
 #if (defined(VK_NV_shading_rate_image))
 	void cmdSetCoarseSampleOrderNV(VkCommandBuffer commandBuffer, VkCoarseSampleOrderTypeNV sampleOrderType, uint32_t customSampleOrderCount, const VkCoarseSampleOrderCustomNV* pCustomSampleOrders) const noexcept {
-		fp_vkCmdSetCoarseSampleOrderNV(commandBuffer, sampleOrderType, customSampleOrderCount, pCustomSampleOrders);
+		load(fp_vkCmdSetCoarseSampleOrderNV, 239, "vkCmdSetCoarseSampleOrderNV")(commandBuffer, sampleOrderType, customSampleOrderCount, pCustomSampleOrders);
 	}
 #endif
 #if (defined(VK_NV_mesh_shader))
 	void cmdDrawMeshTasksNV(VkCommandBuffer commandBuffer, uint32_t taskCount, uint32_t firstTask) const noexcept {
-		fp_vkCmdDrawMeshTasksNV(commandBuffer, taskCount, firstTask);
+		load(fp_vkCmdDrawMeshTasksNV, 240, "vkCmdDrawMeshTasksNV")(commandBuffer, taskCount, firstTask);
 	}
 #endif
 #if (defined(VK_NV_mesh_shader))
 	void cmdDrawMeshTasksIndirectNV(VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset, uint32_t drawCount, uint32_t stride) const noexcept {
-		fp_vkCmdDrawMeshTasksIndirectNV(commandBuffer, buffer, offset, drawCount, stride);
+		load(fp_vkCmdDrawMeshTasksIndirectNV, 241, "vkCmdDrawMeshTasksIndirectNV")(commandBuffer, buffer, offset, drawCount, stride);
 	}
 #endif
 #if (defined(VK_NV_mesh_shader))
 	void cmdDrawMeshTasksIndirectCountNV(VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset, VkBuffer countBuffer, VkDeviceSize countBufferOffset, uint32_t maxDrawCount, uint32_t stride) const noexcept {
-		fp_vkCmdDrawMeshTasksIndirectCountNV(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
+		load(fp_vkCmdDrawMeshTasksIndirectCountNV, 242, "vkCmdDrawMeshTasksIndirectCountNV")(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
 	}
 #endif
 #if (defined(VK_EXT_mesh_shader))
 	void cmdDrawMeshTasksEXT(VkCommandBuffer commandBuffer, uint32_t groupCountX, uint32_t groupCountY, uint32_t groupCountZ) const noexcept {
-		fp_vkCmdDrawMeshTasksEXT(commandBuffer, groupCountX, groupCountY, groupCountZ);
+		load(fp_vkCmdDrawMeshTasksEXT, 243, "vkCmdDrawMeshTasksEXT")(commandBuffer, groupCountX, groupCountY, groupCountZ);
 	}
 #endif
 #if (defined(VK_EXT_mesh_shader))
 	void cmdDrawMeshTasksIndirectEXT(VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset, uint32_t drawCount, uint32_t stride) const noexcept {
-		fp_vkCmdDrawMeshTasksIndirectEXT(commandBuffer, buffer, offset, drawCount, stride);
+		load(fp_vkCmdDrawMeshTasksIndirectEXT, 244, "vkCmdDrawMeshTasksIndirectEXT")(commandBuffer, buffer, offset, drawCount, stride);
 	}
 #endif
 #if (defined(VK_EXT_mesh_shader))
 	void cmdDrawMeshTasksIndirectCountEXT(VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset, VkBuffer countBuffer, VkDeviceSize countBufferOffset, uint32_t maxDrawCount, uint32_t stride) const noexcept {
-		fp_vkCmdDrawMeshTasksIndirectCountEXT(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
+		load(fp_vkCmdDrawMeshTasksIndirectCountEXT, 245, "vkCmdDrawMeshTasksIndirectCountEXT")(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
 	}
 #endif
 #if (defined(VK_NV_ray_tracing))
 	VkResult compileDeferredNV(VkPipeline pipeline, uint32_t shader) const noexcept {
-		return fp_vkCompileDeferredNV(device, pipeline, shader);
+		return load(fp_vkCompileDeferredNV, 246, "vkCompileDeferredNV")(device, pipeline, shader);
 	}
 #endif
 #if (defined(VK_NV_ray_tracing))
 	VkResult createAccelerationStructureNV(const VkAccelerationStructureCreateInfoNV* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkAccelerationStructureNV* pAccelerationStructure) const noexcept {
-		return fp_vkCreateAccelerationStructureNV(device, pCreateInfo, pAllocator, pAccelerationStructure);
+		return load(fp_vkCreateAccelerationStructureNV, 247, "vkCreateAccelerationStructureNV")(device, pCreateInfo, pAllocator, pAccelerationStructure);
 	}
 #endif
 #if (defined(VK_HUAWEI_invocation_mask))
 	void cmdBindInvocationMaskHUAWEI(VkCommandBuffer commandBuffer, VkImageView imageView, VkImageLayout imageLayout) const noexcept {
-		fp_vkCmdBindInvocationMaskHUAWEI(commandBuffer, imageView, imageLayout);
+		load(fp_vkCmdBindInvocationMaskHUAWEI, 248, "vkCmdBindInvocationMaskHUAWEI")(commandBuffer, imageView, imageLayout);
 	}
 #endif
 #if (defined(VK_KHR_acceleration_structure))
 	void destroyAccelerationStructureKHR(VkAccelerationStructureKHR accelerationStructure, const VkAllocationCallbacks* pAllocator) const noexcept {
-		fp_vkDestroyAccelerationStructureKHR(device, accelerationStructure, pAllocator);
+		load(fp_vkDestroyAccelerationStructureKHR, 249, "vkDestroyAccelerationStructureKHR")(device, accelerationStructure, pAllocator);
 	}
 #endif
 #if (defined(VK_NV_ray_tracing))
 	void destroyAccelerationStructureNV(VkAccelerationStructureNV accelerationStructure, const VkAllocationCallbacks* pAllocator) const noexcept {
-		fp_vkDestroyAccelerationStructureNV(device, accelerationStructure, pAllocator);
+		load(fp_vkDestroyAccelerationStructureNV, 250, "vkDestroyAccelerationStructureNV")(device, accelerationStructure, pAllocator);
 	}
 #endif
 #if (defined(VK_NV_ray_tracing))
 	void getAccelerationStructureMemoryRequirementsNV(const VkAccelerationStructureMemoryRequirementsInfoNV* pInfo, VkMemoryRequirements2KHR* pMemoryRequirements) const noexcept {
-		fp_vkGetAccelerationStructureMemoryRequirementsNV(device, pInfo, pMemoryRequirements);
+		load(fp_vkGetAccelerationStructureMemoryRequirementsNV, 251, "vkGetAccelerationStructureMemoryRequirementsNV")(device, pInfo, pMemoryRequirements);
 	}
 #endif
 #if (defined(VK_NV_ray_tracing))
 	VkResult bindAccelerationStructureMemoryNV(uint32_t bindInfoCount, const VkBindAccelerationStructureMemoryInfoNV* pBindInfos) const noexcept {
-		return fp_vkBindAccelerationStructureMemoryNV(device, bindInfoCount, pBindInfos);
+		return load(fp_vkBindAccelerationStructureMemoryNV, 252, "vkBindAccelerationStructureMemoryNV")(device, bindInfoCount, pBindInfos);
 	}
 #endif
 #if (defined(VK_NV_ray_tracing))
 	void cmdCopyAccelerationStructureNV(VkCommandBuffer commandBuffer, VkAccelerationStructureNV dst, VkAccelerationStructureNV src, VkCopyAccelerationStructureModeNV mode) const noexcept {
-		fp_vkCmdCopyAccelerationStructureNV(commandBuffer, dst, src, mode);
+		load(fp_vkCmdCopyAccelerationStructureNV, 253, "vkCmdCopyAccelerationStructureNV")(commandBuffer, dst, src, mode);
 	}
 #endif
 #if (defined(VK_KHR_acceleration_structure))
 	void cmdCopyAccelerationStructureKHR(VkCommandBuffer commandBuffer, const VkCopyAccelerationStructureInfoKHR* pInfo) const noexcept {
-		fp_vkCmdCopyAccelerationStructureKHR(commandBuffer, pInfo);
+		load(fp_vkCmdCopyAccelerationStructureKHR, 254, "vkCmdCopyAccelerationStructureKHR")(commandBuffer, pInfo);
 	}
 #endif
 #if (defined(VK_KHR_acceleration_structure))
 	VkResult copyAccelerationStructureKHR(VkDeferredOperationKHR deferredOperation, const VkCopyAccelerationStructureInfoKHR* pInfo) const noexcept {
-		return fp_vkCopyAccelerationStructureKHR(device, deferredOperation, pInfo);
+		return load(fp_vkCopyAccelerationStructureKHR, 255, "vkCopyAccelerationStructureKHR")(device, deferredOperation, pInfo);
 	}
 #endif
 #if (defined(VK_KHR_acceleration_structure))
 	void cmdCopyAccelerationStructureToMemoryKHR(VkCommandBuffer commandBuffer, const VkCopyAccelerationStructureToMemoryInfoKHR* pInfo) const noexcept {
-		fp_vkCmdCopyAccelerationStructureToMemoryKHR(commandBuffer, pInfo);
+		load(fp_vkCmdCopyAccelerationStructureToMemoryKHR, 256, "vkCmdCopyAccelerationStructureToMemoryKHR")(commandBuffer, pInfo);
 	}
 #endif
 #if (defined(VK_KHR_acceleration_structure))
 	VkResult copyAccelerationStructureToMemoryKHR(VkDeferredOperationKHR deferredOperation, const VkCopyAccelerationStructureToMemoryInfoKHR* pInfo) const noexcept {
-		return fp_vkCopyAccelerationStructureToMemoryKHR(device, deferredOperation, pInfo);
+		return load(fp_vkCopyAccelerationStructureToMemoryKHR, 257, "vkCopyAccelerationStructureToMemoryKHR")(device, deferredOperation, pInfo);
 	}
 #endif
 #if (defined(VK_KHR_acceleration_structure))
 	void cmdCopyMemoryToAccelerationStructureKHR(VkCommandBuffer commandBuffer, const VkCopyMemoryToAccelerationStructureInfoKHR* pInfo) const noexcept {
-		fp_vkCmdCopyMemoryToAccelerationStructureKHR(commandBuffer, pInfo);
+		load(fp_vkCmdCopyMemoryToAccelerationStructureKHR, 258, "vkCmdCopyMemoryToAccelerationStructureKHR")(commandBuffer, pInfo);
 	}
 #endif
 #if (defined(VK_KHR_acceleration_structure))
 	VkResult copyMemoryToAccelerationStructureKHR(VkDeferredOperationKHR deferredOperation, const VkCopyMemoryToAccelerationStructureInfoKHR* pInfo) const noexcept {
-		return fp_vkCopyMemoryToAccelerationStructureKHR(device, deferredOperation, pInfo);
+		return load(fp_vkCopyMemoryToAccelerationStructureKHR, 259, "vkCopyMemoryToAccelerationStructureKHR")(device, deferredOperation, pInfo);
 	}
 #endif
 #if (defined(VK_KHR_acceleration_structure))
 	void cmdWriteAccelerationStructuresPropertiesKHR(VkCommandBuffer commandBuffer, uint32_t accelerationStructureCount, const VkAccelerationStructureKHR* pAccelerationStructures, VkQueryType queryType, VkQueryPool queryPool, uint32_t firstQuery) const noexcept {
-		fp_vkCmdWriteAccelerationStructuresPropertiesKHR(commandBuffer, accelerationStructureCount, pAccelerationStructures, queryType, queryPool, firstQuery);
+		load(fp_vkCmdWriteAccelerationStructuresPropertiesKHR, 260, "vkCmdWriteAccelerationStructuresPropertiesKHR")(commandBuffer, accelerationStructureCount, pAccelerationStructures, queryType, queryPool, firstQuery);
 	}
 #endif
 #if (defined(VK_NV_ray_tracing))
 	void cmdWriteAccelerationStructuresPropertiesNV(VkCommandBuffer commandBuffer, uint32_t accelerationStructureCount, const VkAccelerationStructureNV* pAccelerationStructures, VkQueryType queryType, VkQueryPool queryPool, uint32_t firstQuery) const noexcept {
-		fp_vkCmdWriteAccelerationStructuresPropertiesNV(commandBuffer, accelerationStructureCount, pAccelerationStructures, queryType, queryPool, firstQuery);
+		load(fp_vkCmdWriteAccelerationStructuresPropertiesNV, 261, "vkCmdWriteAccelerationStructuresPropertiesNV")(commandBuffer, accelerationStructureCount, pAccelerationStructures, queryType, queryPool, firstQuery);
 	}
 #endif
 #if (defined(VK_NV_ray_tracing))
 	void cmdBuildAccelerationStructureNV(VkCommandBuffer commandBuffer, const VkAccelerationStructureInfoNV* pInfo, VkBuffer instanceData, VkDeviceSize instanceOffset, VkBool32 update, VkAccelerationStructureNV dst, VkAccelerationStructureNV src, VkBuffer scratch, VkDeviceSize scratchOffset) const noexcept {
-		fp_vkCmdBuildAccelerationStructureNV(commandBuffer, pInfo, instanceData, instanceOffset, update, dst, src, scratch, scratchOffset);
+		load(fp_vkCmdBuildAccelerationStructureNV, 262, "vkCmdBuildAccelerationStructureNV")(commandBuffer, pInfo, instanceData, instanceOffset, update, dst, src, scratch, scratchOffset);
 	}
 #endif
 #if (defined(VK_KHR_acceleration_structure))
 	VkResult writeAccelerationStructuresPropertiesKHR(uint32_t accelerationStructureCount, const VkAccelerationStructureKHR* pAccelerationStructures, VkQueryType queryType, size_t dataSize, void* pData, size_t stride) const noexcept {
-		return fp_vkWriteAccelerationStructuresPropertiesKHR(device, accelerationStructureCount, pAccelerationStructures, queryType, dataSize, pData, stride);
+		return load(fp_vkWriteAccelerationStructuresPropertiesKHR, 263, "vkWriteAccelerationStructuresPropertiesKHR")(device, accelerationStructureCount, pAccelerationStructures, queryType, dataSize, pData, stride);
 	}
 #endif
 #if (defined(VK_KHR_ray_tracing_pipeline))
 	void cmdTraceRaysKHR(VkCommandBuffer commandBuffer, const VkStridedDeviceAddressRegionKHR* pRaygenShaderBindingTable, const VkStridedDeviceAddressRegionKHR* pMissShaderBindingTable, const VkStridedDeviceAddressRegionKHR* pHitShaderBindingTable, const VkStridedDeviceAddressRegionKHR* pCallableShaderBindingTable, uint32_t width, uint32_t height, uint32_t depth) const noexcept {
-		fp_vkCmdTraceRaysKHR(commandBuffer, pRaygenShaderBindingTable, pMissShaderBindingTable, pHitShaderBindingTable, pCallableShaderBindingTable, width, height, depth);
+		load(fp_vkCmdTraceRaysKHR, 264, "vkCmdTraceRaysKHR")(commandBuffer, pRaygenShaderBindingTable, pMissShaderBindingTable, pHitShaderBindingTable, pCallableShaderBindingTable, width, height, depth);
 	}
 #endif
 #if (defined(VK_NV_ray_tracing))
 	void cmdTraceRaysNV(VkCommandBuffer commandBuffer, VkBuffer raygenShaderBindingTableBuffer, VkDeviceSize raygenShaderBindingOffset, VkBuffer missShaderBindingTableBuffer, VkDeviceSize missShaderBindingOffset, VkDeviceSize missShaderBindingStride, VkBuffer hitShaderBindingTableBuffer, VkDeviceSize hitShaderBindingOffset, VkDeviceSize hitShaderBindingStride, VkBuffer callableShaderBindingTableBuffer, VkDeviceSize callableShaderBindingOffset, VkDeviceSize callableShaderBindingStride, uint32_t width, uint32_t height, uint32_t depth) const noexcept {
-		fp_vkCmdTraceRaysNV(commandBuffer, raygenShaderBindingTableBuffer, raygenShaderBindingOffset, missShaderBindingTableBuffer, missShaderBindingOffset, missShaderBindingStride, hitShaderBindingTableBuffer, hitShaderBindingOffset, hitShaderBindingStride, callableShaderBindingTableBuffer, callableShaderBindingOffset, callableShaderBindingStride, width, height, depth);
+		load(fp_vkCmdTraceRaysNV, 265, "vkCmdTraceRaysNV")(commandBuffer, raygenShaderBindingTableBuffer, raygenShaderBindingOffset, missShaderBindingTableBuffer, missShaderBindingOffset, missShaderBindingStride, hitShaderBindingTableBuffer, hitShaderBindingOffset, hitShaderBindingStride, callableShaderBindingTableBuffer, callableShaderBindingOffset, callableShaderBindingStride, width, height, depth);
 	}
 #endif
 #if (defined(VK_KHR_ray_tracing_pipeline))
 	VkResult getRayTracingShaderGroupHandlesKHR(VkPipeline pipeline, uint32_t firstGroup, uint32_t groupCount, size_t dataSize, void* pData) const noexcept {
-		return fp_vkGetRayTracingShaderGroupHandlesKHR(device, pipeline, firstGroup, groupCount, dataSize, pData);
+		return load(fp_vkGetRayTracingShaderGroupHandlesKHR, 266, "vkGetRayTracingShaderGroupHandlesKHR")(device, pipeline, firstGroup, groupCount, dataSize, pData);
 	}
 #endif
 #if (defined(VK_KHR_ray_tracing_pipeline))
 	VkResult getRayTracingCaptureReplayShaderGroupHandlesKHR(VkPipeline pipeline, uint32_t firstGroup, uint32_t groupCount, size_t dataSize, void* pData) const noexcept {
-		return fp_vkGetRayTracingCaptureReplayShaderGroupHandlesKHR(device, pipeline, firstGroup, groupCount, dataSize, pData);
+		return load(fp_vkGetRayTracingCaptureReplayShaderGroupHandlesKHR, 267, "vkGetRayTracingCaptureReplayShaderGroupHandlesKHR")(device, pipeline, firstGroup, groupCount, dataSize, pData);
 	}
 #endif
 #if (defined(VK_NV_ray_tracing))
 	VkResult getAccelerationStructureHandleNV(VkAccelerationStructureNV accelerationStructure, size_t dataSize, void* pData) const noexcept {
-		return fp_vkGetAccelerationStructureHandleNV(device, accelerationStructure, dataSize, pData);
+		return load(fp_vkGetAccelerationStructureHandleNV, 268, "vkGetAccelerationStructureHandleNV")(device, accelerationStructure, dataSize, pData);
 	}
 #endif
 #if (defined(VK_NV_ray_tracing))
 	VkResult createRayTracingPipelinesNV(VkPipelineCache pipelineCache, uint32_t createInfoCount, const VkRayTracingPipelineCreateInfoNV* pCreateInfos, const VkAllocationCallbacks* pAllocator, VkPipeline* pPipelines) const noexcept {
-		return fp_vkCreateRayTracingPipelinesNV(device, pipelineCache, createInfoCount, pCreateInfos, pAllocator, pPipelines);
+		return load(fp_vkCreateRayTracingPipelinesNV, 269, "vkCreateRayTracingPipelinesNV")(device, pipelineCache, createInfoCount, pCreateInfos, pAllocator, pPipelines);
 	}
 #endif
 #if (defined(VK_KHR_ray_tracing_pipeline))
 	VkResult createRayTracingPipelinesKHR(VkDeferredOperationKHR deferredOperation, VkPipelineCache pipelineCache, uint32_t createInfoCount, const VkRayTracingPipelineCreateInfoKHR* pCreateInfos, const VkAllocationCallbacks* pAllocator, VkPipeline* pPipelines) const noexcept {
-		return fp_vkCreateRayTracingPipelinesKHR(device, deferredOperation, pipelineCache, createInfoCount, pCreateInfos, pAllocator, pPipelines);
+		return load(fp_vkCreateRayTracingPipelinesKHR, 270, "vkCreateRayTracingPipelinesKHR")(device, deferredOperation, pipelineCache, createInfoCount, pCreateInfos, pAllocator, pPipelines);
 	}
 #endif
 #if (defined(VK_KHR_ray_tracing_pipeline))
 	void cmdTraceRaysIndirectKHR(VkCommandBuffer commandBuffer, const VkStridedDeviceAddressRegionKHR* pRaygenShaderBindingTable, const VkStridedDeviceAddressRegionKHR* pMissShaderBindingTable, const VkStridedDeviceAddressRegionKHR* pHitShaderBindingTable, const VkStridedDeviceAddressRegionKHR* pCallableShaderBindingTable, VkDeviceAddress indirectDeviceAddress) const noexcept {
-		fp_vkCmdTraceRaysIndirectKHR(commandBuffer, pRaygenShaderBindingTable, pMissShaderBindingTable, pHitShaderBindingTable, pCallableShaderBindingTable, indirectDeviceAddress);
+		load(fp_vkCmdTraceRaysIndirectKHR, 271, "vkCmdTraceRaysIndirectKHR")(commandBuffer, pRaygenShaderBindingTable, pMissShaderBindingTable, pHitShaderBindingTable, pCallableShaderBindingTable, indirectDeviceAddress);
 	}
 #endif
 #if (defined(VK_KHR_ray_tracing_maintenance1) && defined(VK_KHR_ray_tracing_pipeline))
 	void cmdTraceRaysIndirect2KHR(VkCommandBuffer commandBuffer, VkDeviceAddress indirectDeviceAddress) const noexcept {
-		fp_vkCmdTraceRaysIndirect2KHR(commandBuffer, indirectDeviceAddress);
+		load(fp_vkCmdTraceRaysIndirect2KHR, 272, "vkCmdTraceRaysIndirect2KHR")(commandBuffer, indirectDeviceAddress);
 	}
 #endif
 #if (defined(VK_KHR_acceleration_structure))
 	void getDeviceAccelerationStructureCompatibilityKHR(const VkAccelerationStructureVersionInfoKHR* pVersionInfo, VkAccelerationStructureCompatibilityKHR* pCompatibility) const noexcept {
-		fp_vkGetDeviceAccelerationStructureCompatibilityKHR(device, pVersionInfo, pCompatibility);
+		load(fp_vkGetDeviceAccelerationStructureCompatibilityKHR, 273, "vkGetDeviceAccelerationStructureCompatibilityKHR")(device, pVersionInfo, pCompatibility);
 	}
 #endif
 #if (defined(VK_KHR_ray_tracing_pipeline))
 	VkDeviceSize getRayTracingShaderGroupStackSizeKHR(VkPipeline pipeline, uint32_t group, VkShaderGroupShaderKHR groupShader) const noexcept {
-		return fp_vkGetRayTracingShaderGroupStackSizeKHR(device, pipeline, group, groupShader);
+		return load(fp_vkGetRayTracingShaderGroupStackSizeKHR, 274, "vkGetRayTracingShaderGroupStackSizeKHR")(device, pipeline, group, groupShader);
 	}
 #endif
 #if (defined(VK_KHR_ray_tracing_pipeline))
 	void cmdSetRayTracingPipelineStackSizeKHR(VkCommandBuffer commandBuffer, uint32_t pipelineStackSize) const noexcept {
-		fp_vkCmdSetRayTracingPipelineStackSizeKHR(commandBuffer, pipelineStackSize);
+		load(fp_vkCmdSetRayTracingPipelineStackSizeKHR, 275, "vkCmdSetRayTracingPipelineStackSizeKHR")(commandBuffer, pipelineStackSize);
 	}
 #endif
 #if (defined(VK_EXT_full_screen_exclusive) && defined(VK_KHR_device_group)) || (defined(VK_EXT_full_screen_exclusive) && defined(VK_VERSION_1_1))
 	VkResult getDeviceGroupSurfacePresentModes2EXT(const VkPhysicalDeviceSurfaceInfo2KHR* pSurfaceInfo, VkDeviceGroupPresentModeFlagsKHR* pModes) const noexcept {
-		return fp_vkGetDeviceGroupSurfacePresentModes2EXT(device, pSurfaceInfo, pModes);
+		return load(fp_vkGetDeviceGroupSurfacePresentModes2EXT, 276, "vkGetDeviceGroupSurfacePresentModes2EXT")(device, pSurfaceInfo, pModes);
 	}
 #endif
 #if (defined(VK_EXT_full_screen_exclusive))
 	VkResult acquireFullScreenExclusiveModeEXT(VkSwapchainKHR swapchain) const noexcept {
-		return fp_vkAcquireFullScreenExclusiveModeEXT(device, swapchain);
+		return load(fp_vkAcquireFullScreenExclusiveModeEXT, 277, "vkAcquireFullScreenExclusiveModeEXT")(device, swapchain);
 	}
 #endif
 #if (defined(VK_EXT_full_screen_exclusive))
 	VkResult releaseFullScreenExclusiveModeEXT(VkSwapchainKHR swapchain) const noexcept {
-		return fp_vkReleaseFullScreenExclusiveModeEXT(device, swapchain);
+		return load(fp_vkReleaseFullScreenExclusiveModeEXT, 278, "vkReleaseFullScreenExclusiveModeEXT")(device, swapchain);
 	}
 #endif
 #if (defined(VK_KHR_performance_query))
 	VkResult acquireProfilingLockKHR(const VkAcquireProfilingLockInfoKHR* pInfo) const noexcept {
-		return fp_vkAcquireProfilingLockKHR(device, pInfo);
+		return load(fp_vkAcquireProfilingLockKHR, 279, "vkAcquireProfilingLockKHR")(device, pInfo);
 	}
 #endif
 #if (defined(VK_KHR_performance_query))
 	void releaseProfilingLockKHR() const noexcept {
-		fp_vkReleaseProfilingLockKHR(device);
+		load(fp_vkReleaseProfilingLockKHR, 280, "vkReleaseProfilingLockKHR")(device);
 	}
 #endif
 #if (defined(VK_EXT_image_drm_format_modifier))
 	VkResult getImageDrmFormatModifierPropertiesEXT(VkImage image, VkImageDrmFormatModifierPropertiesEXT* pProperties) const noexcept {
-		return fp_vkGetImageDrmFormatModifierPropertiesEXT(device, image, pProperties);
+		return load(fp_vkGetImageDrmFormatModifierPropertiesEXT, 281, "vkGetImageDrmFormatModifierPropertiesEXT")(device, image, pProperties);
 	}
 #endif
 #if (defined(VK_VERSION_1_2))
 	uint64_t getBufferOpaqueCaptureAddress(const VkBufferDeviceAddressInfoEXT* pInfo) const noexcept {
-		return fp_vkGetBufferOpaqueCaptureAddress(device, pInfo);
+		return load(fp_vkGetBufferOpaqueCaptureAddress, 282, "vkGetBufferOpaqueCaptureAddress")(device, pInfo);
 	}
 #endif
 #if (defined(VK_VERSION_1_2))
 	VkDeviceAddress getBufferDeviceAddress(const VkBufferDeviceAddressInfoEXT* pInfo) const noexcept {
-		return fp_vkGetBufferDeviceAddress(device, pInfo);
+		return load(fp_vkGetBufferDeviceAddress, 283, "vkGetBufferDeviceAddress")(device, pInfo);
 	}
 #endif
 #if (defined(VK_INTEL_performance_query))
 	VkResult initializePerformanceApiINTEL(const VkInitializePerformanceApiInfoINTEL* pInitializeInfo) const noexcept {
-		return fp_vkInitializePerformanceApiINTEL(device, pInitializeInfo);
+		return load(fp_vkInitializePerformanceApiINTEL, 284, "vkInitializePerformanceApiINTEL")(device, pInitializeInfo);
 	}
 #endif
 #if (defined(VK_INTEL_performance_query))
 	void uninitializePerformanceApiINTEL() const noexcept {
-		fp_vkUninitializePerformanceApiINTEL(device);
+		load(fp_vkUninitializePerformanceApiINTEL, 285, "vkUninitializePerformanceApiINTEL")(device);
 	}
 #endif
 #if (defined(VK_INTEL_performance_query))
 	VkResult cmdSetPerformanceMarkerINTEL(VkCommandBuffer commandBuffer, const VkPerformanceMarkerInfoINTEL* pMarkerInfo) const noexcept {
-		return fp_vkCmdSetPerformanceMarkerINTEL(commandBuffer, pMarkerInfo);
+		return load(fp_vkCmdSetPerformanceMarkerINTEL, 286, "vkCmdSetPerformanceMarkerINTEL")(commandBuffer, pMarkerInfo);
 	}
 #endif
 #if (defined(VK_INTEL_performance_query))
 	VkResult cmdSetPerformanceStreamMarkerINTEL(VkCommandBuffer commandBuffer, const VkPerformanceStreamMarkerInfoINTEL* pMarkerInfo) const noexcept {
-		return fp_vkCmdSetPerformanceStreamMarkerINTEL(commandBuffer, pMarkerInfo);
+		return load(fp_vkCmdSetPerformanceStreamMarkerINTEL, 287, "vkCmdSetPerformanceStreamMarkerINTEL")(commandBuffer, pMarkerInfo);
 	}
 #endif
 #if (defined(VK_INTEL_performance_query))
 	VkResult cmdSetPerformanceOverrideINTEL(VkCommandBuffer commandBuffer, const VkPerformanceOverrideInfoINTEL* pOverrideInfo) const noexcept {
-		return fp_vkCmdSetPerformanceOverrideINTEL(commandBuffer, pOverrideInfo);
+		return load(fp_vkCmdSetPerformanceOverrideINTEL, 288, "vkCmdSetPerformanceOverrideINTEL")(commandBuffer, pOverrideInfo);
 	}
 #endif
 #if (defined(VK_INTEL_performance_query))
 	VkResult acquirePerformanceConfigurationINTEL(const VkPerformanceConfigurationAcquireInfoINTEL* pAcquireInfo, VkPerformanceConfigurationINTEL* pConfiguration) const noexcept {
-		return fp_vkAcquirePerformanceConfigurationINTEL(device, pAcquireInfo, pConfiguration);
+		return load(fp_vkAcquirePerformanceConfigurationINTEL, 289, "vkAcquirePerformanceConfigurationINTEL")(device, pAcquireInfo, pConfiguration);
 	}
 #endif
 #if (defined(VK_INTEL_performance_query))
 	VkResult releasePerformanceConfigurationINTEL(VkPerformanceConfigurationINTEL configuration) const noexcept {
-		return fp_vkReleasePerformanceConfigurationINTEL(device, configuration);
+		return load(fp_vkReleasePerformanceConfigurationINTEL, 290, "vkReleasePerformanceConfigurationINTEL")(device, configuration);
 	}
 #endif
 #if (defined(VK_INTEL_performance_query))
 	VkResult queueSetPerformanceConfigurationINTEL(VkQueue queue, VkPerformanceConfigurationINTEL configuration) const noexcept {
-		return fp_vkQueueSetPerformanceConfigurationINTEL(queue, configuration);
+		return load(fp_vkQueueSetPerformanceConfigurationINTEL, 291, "vkQueueSetPerformanceConfigurationINTEL")(queue, configuration);
 	}
 #endif
 #if (defined(VK_INTEL_performance_query))
 	VkResult getPerformanceParameterINTEL(VkPerformanceParameterTypeINTEL parameter, VkPerformanceValueINTEL* pValue) const noexcept {
-		return fp_vkGetPerformanceParameterINTEL(device, parameter, pValue);
+		return load(fp_vkGetPerformanceParameterINTEL, 292, "vkGetPerformanceParameterINTEL")(device, parameter, pValue);
 	}
 #endif
 #if (defined(VK_VERSION_1_2))
 	uint64_t getDeviceMemoryOpaqueCaptureAddress(const VkDeviceMemoryOpaqueCaptureAddressInfoKHR* pInfo) const noexcept {
-		return fp_vkGetDeviceMemoryOpaqueCaptureAddress(device, pInfo);
+		return load(fp_vkGetDeviceMemoryOpaqueCaptureAddress, 293, "vkGetDeviceMemoryOpaqueCaptureAddress")(device, pInfo);
 	}
 #endif
 #if (defined(VK_KHR_pipeline_executable_properties))
 	VkResult getPipelineExecutablePropertiesKHR(const VkPipelineInfoKHR* pPipelineInfo, uint32_t* pExecutableCount, VkPipelineExecutablePropertiesKHR* pProperties) const noexcept {
-		return fp_vkGetPipelineExecutablePropertiesKHR(device, pPipelineInfo, pExecutableCount, pProperties);
+		return load(fp_vkGetPipelineExecutablePropertiesKHR, 294, "vkGetPipelineExecutablePropertiesKHR")(device, pPipelineInfo, pExecutableCount, pProperties);
 	}
 #endif
 #if (defined(VK_KHR_pipeline_executable_properties))
 	VkResult getPipelineExecutableStatisticsKHR(const VkPipelineExecutableInfoKHR* pExecutableInfo, uint32_t* pStatisticCount, VkPipelineExecutableStatisticKHR* pStatistics) const noexcept {
-		return fp_vkGetPipelineExecutableStatisticsKHR(device, pExecutableInfo, pStatisticCount, pStatistics);
+		return load(fp_vkGetPipelineExecutableStatisticsKHR, 295, "vkGetPipelineExecutableStatisticsKHR")(device, pExecutableInfo, pStatisticCount, pStatistics);
 	}
 #endif
 #if (defined(VK_KHR_pipeline_executable_properties))
 	VkResult getPipelineExecutableInternalRepresentationsKHR(const VkPipelineExecutableInfoKHR* pExecutableInfo, uint32_t* pInternalRepresentationCount, VkPipelineExecutableInternalRepresentationKHR* pInternalRepresentations) const noexcept {
-		return fp_vkGetPipelineExecutableInternalRepresentationsKHR(device, pExecutableInfo, pInternalRepresentationCount, pInternalRepresentations);
+		return load(fp_vkGetPipelineExecutableInternalRepresentationsKHR, 296, "vkGetPipelineExecutableInternalRepresentationsKHR")(device, pExecutableInfo, pInternalRepresentationCount, pInternalRepresentations);
 	}
 #endif
 #if (defined(VK_EXT_line_rasterization))
 	void cmdSetLineStippleEXT(VkCommandBuffer commandBuffer, uint32_t lineStippleFactor, uint16_t lineStipplePattern) const noexcept {
-		fp_vkCmdSetLineStippleEXT(commandBuffer, lineStippleFactor, lineStipplePattern);
+		load(fp_vkCmdSetLineStippleEXT, 297, "vkCmdSetLineStippleEXT")(commandBuffer, lineStippleFactor, lineStipplePattern);
 	}
 #endif
 #if (defined(VK_KHR_acceleration_structure))
 	VkResult createAccelerationStructureKHR(const VkAccelerationStructureCreateInfoKHR* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkAccelerationStructureKHR* pAccelerationStructure) const noexcept {
-		return fp_vkCreateAccelerationStructureKHR(device, pCreateInfo, pAllocator, pAccelerationStructure);
+		return load(fp_vkCreateAccelerationStructureKHR, 298, "vkCreateAccelerationStructureKHR")(device, pCreateInfo, pAllocator, pAccelerationStructure);
 	}
 #endif
 #if (defined(VK_KHR_acceleration_structure))
 	void cmdBuildAccelerationStructuresKHR(VkCommandBuffer commandBuffer, uint32_t infoCount, const VkAccelerationStructureBuildGeometryInfoKHR* pInfos, const VkAccelerationStructureBuildRangeInfoKHR* const* ppBuildRangeInfos) const noexcept {
-		fp_vkCmdBuildAccelerationStructuresKHR(commandBuffer, infoCount, pInfos, ppBuildRangeInfos);
+		load(fp_vkCmdBuildAccelerationStructuresKHR, 299, "vkCmdBuildAccelerationStructuresKHR")(commandBuffer, infoCount, pInfos, ppBuildRangeInfos);
 	}
 #endif
 #if (defined(VK_KHR_acceleration_structure))
 	void cmdBuildAccelerationStructuresIndirectKHR(VkCommandBuffer commandBuffer, uint32_t infoCount, const VkAccelerationStructureBuildGeometryInfoKHR* pInfos, const VkDeviceAddress* pIndirectDeviceAddresses, const uint32_t* pIndirectStrides, const uint32_t* const* ppMaxPrimitiveCounts) const noexcept {
-		fp_vkCmdBuildAccelerationStructuresIndirectKHR(commandBuffer, infoCount, pInfos, pIndirectDeviceAddresses, pIndirectStrides, ppMaxPrimitiveCounts);
+		load(fp_vkCmdBuildAccelerationStructuresIndirectKHR, 300, "vkCmdBuildAccelerationStructuresIndirectKHR")(commandBuffer, infoCount, pInfos, pIndirectDeviceAddresses, pIndirectStrides, ppMaxPrimitiveCounts);
 	}
 #endif
 #if (defined(VK_KHR_acceleration_structure))
 	VkResult buildAccelerationStructuresKHR(VkDeferredOperationKHR deferredOperation, uint32_t infoCount, const VkAccelerationStructureBuildGeometryInfoKHR* pInfos, const VkAccelerationStructureBuildRangeInfoKHR* const* ppBuildRangeInfos) const noexcept {
-		return fp_vkBuildAccelerationStructuresKHR(device, deferredOperation, infoCount, pInfos, ppBuildRangeInfos);
+		return load(fp_vkBuildAccelerationStructuresKHR, 301, "vkBuildAccelerationStructuresKHR")(device, deferredOperation, infoCount, pInfos, ppBuildRangeInfos);
 	}
 #endif
 #if (defined(VK_KHR_acceleration_structure))
 	VkDeviceAddress getAccelerationStructureDeviceAddressKHR(const VkAccelerationStructureDeviceAddressInfoKHR* pInfo) const noexcept {
-		return fp_vkGetAccelerationStructureDeviceAddressKHR(device, pInfo);
+		return load(fp_vkGetAccelerationStructureDeviceAddressKHR, 302, "vkGetAccelerationStructureDeviceAddressKHR")(device, pInfo);
 	}
 #endif
 #if (defined(VK_KHR_deferred_host_operations))
 	VkResult createDeferredOperationKHR(const VkAllocationCallbacks* pAllocator, VkDeferredOperationKHR* pDeferredOperation) const noexcept {
-		return fp_vkCreateDeferredOperationKHR(device, pAllocator, pDeferredOperation);
+		return load(fp_vkCreateDeferredOperationKHR, 303, "vkCreateDeferredOperationKHR")(device, pAllocator, pDeferredOperation);
 	}
 #endif
 #if (defined(VK_KHR_deferred_host_operations))
 	void destroyDeferredOperationKHR(VkDeferredOperationKHR operation, const VkAllocationCallbacks* pAllocator) const noexcept {
-		fp_vkDestroyDeferredOperationKHR(device, operation, pAllocator);
+		load(fp_vkDestroyDeferredOperationKHR, 304, "vkDestroyDeferredOperationKHR")(device, operation, pAllocator);
 	}
 #endif
 #if (defined(VK_KHR_deferred_host_operations))
 	uint32_t getDeferredOperationMaxConcurrencyKHR(VkDeferredOperationKHR operation) const noexcept {
-		return fp_vkGetDeferredOperationMaxConcurrencyKHR(device, operation);
+		return load(fp_vkGetDeferredOperationMaxConcurrencyKHR, 305, "vkGetDeferredOperationMaxConcurrencyKHR")(device, operation);
 	}
 #endif
 #if (defined(VK_KHR_deferred_host_operations))
 	VkResult getDeferredOperationResultKHR(VkDeferredOperationKHR operation) const noexcept {
-		return fp_vkGetDeferredOperationResultKHR(device, operation);
+		return load(fp_vkGetDeferredOperationResultKHR, 306, "vkGetDeferredOperationResultKHR")(device, operation);
 	}
 #endif
 #if (defined(VK_KHR_deferred_host_operations))
 	VkResult deferredOperationJoinKHR(VkDeferredOperationKHR operation) const noexcept {
-		return fp_vkDeferredOperationJoinKHR(device, operation);
+		return load(fp_vkDeferredOperationJoinKHR, 307, "vkDeferredOperationJoinKHR")(device, operation);
 	}
 #endif
 #if (defined(VK_VERSION_1_3))
 	void cmdSetCullMode(VkCommandBuffer commandBuffer, VkCullModeFlags cullMode) const noexcept {
-		fp_vkCmdSetCullMode(commandBuffer, cullMode);
+		load(fp_vkCmdSetCullMode, 308, "vkCmdSetCullMode")(commandBuffer, cullMode);
 	}
 #endif
 #if (defined(VK_VERSION_1_3))
 	void cmdSetFrontFace(VkCommandBuffer commandBuffer, VkFrontFace frontFace) const noexcept {
-		fp_vkCmdSetFrontFace(commandBuffer, frontFace);
+		load(fp_vkCmdSetFrontFace, 309, "vkCmdSetFrontFace")(commandBuffer, frontFace);
 	}
 #endif
 #if (defined(VK_VERSION_1_3))
 	void cmdSetPrimitiveTopology(VkCommandBuffer commandBuffer, VkPrimitiveTopology primitiveTopology) const noexcept {
-		fp_vkCmdSetPrimitiveTopology(commandBuffer, primitiveTopology);
+		load(fp_vkCmdSetPrimitiveTopology, 310, "vkCmdSetPrimitiveTopology")(commandBuffer, primitiveTopology);
 	}
 #endif
 #if (defined(VK_VERSION_1_3))
 	void cmdSetViewportWithCount(VkCommandBuffer commandBuffer, uint32_t viewportCount, const VkViewport* pViewports) const noexcept {
-		fp_vkCmdSetViewportWithCount(commandBuffer, viewportCount, pViewports);
+		load(fp_vkCmdSetViewportWithCount, 311, "vkCmdSetViewportWithCount")(commandBuffer, viewportCount, pViewports);
 	}
 #endif
 #if (defined(VK_VERSION_1_3))
 	void cmdSetScissorWithCount(VkCommandBuffer commandBuffer, uint32_t scissorCount, const VkRect2D* pScissors) const noexcept {
-		fp_vkCmdSetScissorWithCount(commandBuffer, scissorCount, pScissors);
+		load(fp_vkCmdSetScissorWithCount, 312, "vkCmdSetScissorWithCount")(commandBuffer, scissorCount, pScissors);
 	}
 #endif
 #if (defined(VK_VERSION_1_3))
 	void cmdBindVertexBuffers2(VkCommandBuffer commandBuffer, uint32_t firstBinding, uint32_t bindingCount, const VkBuffer* pBuffers, const VkDeviceSize* pOffsets, const VkDeviceSize* pSizes, const VkDeviceSize* pStrides) const noexcept {
-		fp_vkCmdBindVertexBuffers2(commandBuffer, firstBinding, bindingCount, pBuffers, pOffsets, pSizes, pStrides);
+		load(fp_vkCmdBindVertexBuffers2, 313, "vkCmdBindVertexBuffers2")(commandBuffer, firstBinding, bindingCount, pBuffers, pOffsets, pSizes, pStrides);
 	}
 #endif
 #if (defined(VK_VERSION_1_3))
 	void cmdSetDepthTestEnable(VkCommandBuffer commandBuffer, VkBool32 depthTestEnable) const noexcept {
-		fp_vkCmdSetDepthTestEnable(commandBuffer, depthTestEnable);
+		load(fp_vkCmdSetDepthTestEnable, 314, "vkCmdSetDepthTestEnable")(commandBuffer, depthTestEnable);
 	}
 #endif
 #if (defined(VK_VERSION_1_3))
 	void cmdSetDepthWriteEnable(VkCommandBuffer commandBuffer, VkBool32 depthWriteEnable) const noexcept {
-		fp_vkCmdSetDepthWriteEnable(commandBuffer, depthWriteEnable);
+		load(fp_vkCmdSetDepthWriteEnable, 315, "vkCmdSetDepthWriteEnable")(commandBuffer, depthWriteEnable);
 	}
 #endif
 #if (defined(VK_VERSION_1_3))
 	void cmdSetDepthCompareOp(VkCommandBuffer commandBuffer, VkCompareOp depthCompareOp) const noexcept {
-		fp_vkCmdSetDepthCompareOp(commandBuffer, depthCompareOp);
+		load(fp_vkCmdSetDepthCompareOp, 316, "vkCmdSetDepthCompareOp")(commandBuffer, depthCompareOp);
 	}
 #endif
 #if (defined(VK_VERSION_1_3))
 	void cmdSetDepthBoundsTestEnable(VkCommandBuffer commandBuffer, VkBool32 depthBoundsTestEnable) const noexcept {
-		fp_vkCmdSetDepthBoundsTestEnable(commandBuffer, depthBoundsTestEnable);
+		load(fp_vkCmdSetDepthBoundsTestEnable, 317, "vkCmdSetDepthBoundsTestEnable")(commandBuffer, depthBoundsTestEnable);
 	}
 #endif
 #if (defined(VK_VERSION_1_3))
 	void cmdSetStencilTestEnable(VkCommandBuffer commandBuffer, VkBool32 stencilTestEnable) const noexcept {
-		fp_vkCmdSetStencilTestEnable(commandBuffer, stencilTestEnable);
+		load(fp_vkCmdSetStencilTestEnable, 318, "vkCmdSetStencilTestEnable")(commandBuffer, stencilTestEnable);
 	}
 #endif
 #if (defined(VK_VERSION_1_3))
 	void cmdSetStencilOp(VkCommandBuffer commandBuffer, VkStencilFaceFlags faceMask, VkStencilOp failOp, VkStencilOp passOp, VkStencilOp depthFailOp, VkCompareOp compareOp) const noexcept {
-		fp_vkCmdSetStencilOp(commandBuffer, faceMask, failOp, passOp, depthFailOp, compareOp);
+		load(fp_vkCmdSetStencilOp, 319, "vkCmdSetStencilOp")(commandBuffer, faceMask, failOp, passOp, depthFailOp, compareOp);
 	}
 #endif
 #if (defined(VK_EXT_extended_dynamic_state2))
 	void cmdSetPatchControlPointsEXT(VkCommandBuffer commandBuffer, uint32_t patchControlPoints) const noexcept {
-		fp_vkCmdSetPatchControlPointsEXT(commandBuffer, patchControlPoints);
+		load(fp_vkCmdSetPatchControlPointsEXT, 320, "vkCmdSetPatchControlPointsEXT")(commandBuffer, patchControlPoints);
 	}
 #endif
 #if (defined(VK_VERSION_1_3))
 	void cmdSetRasterizerDiscardEnable(VkCommandBuffer commandBuffer, VkBool32 rasterizerDiscardEnable) const noexcept {
-		fp_vkCmdSetRasterizerDiscardEnable(commandBuffer, rasterizerDiscardEnable);
+		load(fp_vkCmdSetRasterizerDiscardEnable, 321, "vkCmdSetRasterizerDiscardEnable")(commandBuffer, rasterizerDiscardEnable);
 	}
 #endif
 #if (defined(VK_VERSION_1_3))
 	void cmdSetDepthBiasEnable(VkCommandBuffer commandBuffer, VkBool32 depthBiasEnable) const noexcept {
-		fp_vkCmdSetDepthBiasEnable(commandBuffer, depthBiasEnable);
+		load(fp_vkCmdSetDepthBiasEnable, 322, "vkCmdSetDepthBiasEnable")(commandBuffer, depthBiasEnable);
 	}
 #endif
 #if (defined(VK_EXT_extended_dynamic_state2))
 	void cmdSetLogicOpEXT(VkCommandBuffer commandBuffer, VkLogicOp logicOp) const noexcept {
-		fp_vkCmdSetLogicOpEXT(commandBuffer, logicOp);
+		load(fp_vkCmdSetLogicOpEXT, 323, "vkCmdSetLogicOpEXT")(commandBuffer, logicOp);
 	}
 #endif
 #if (defined(VK_VERSION_1_3))
 	void cmdSetPrimitiveRestartEnable(VkCommandBuffer commandBuffer, VkBool32 primitiveRestartEnable) const noexcept {
-		fp_vkCmdSetPrimitiveRestartEnable(commandBuffer, primitiveRestartEnable);
+		load(fp_vkCmdSetPrimitiveRestartEnable, 324, "vkCmdSetPrimitiveRestartEnable")(commandBuffer, primitiveRestartEnable);
 	}
 #endif
 #if (defined(VK_VERSION_1_3))
 	VkResult createPrivateDataSlot(const VkPrivateDataSlotCreateInfoEXT* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkPrivateDataSlotEXT* pPrivateDataSlot) const noexcept {
-		return fp_vkCreatePrivateDataSlot(device, pCreateInfo, pAllocator, pPrivateDataSlot);
+		return load(fp_vkCreatePrivateDataSlot, 325, "vkCreatePrivateDataSlot")(device, pCreateInfo, pAllocator, pPrivateDataSlot);
 	}
 #endif
 #if (defined(VK_EXT_extended_dynamic_state3))
 	void cmdSetTessellationDomainOriginEXT(VkCommandBuffer commandBuffer, VkTessellationDomainOriginKHR domainOrigin) const noexcept {
-		fp_vkCmdSetTessellationDomainOriginEXT(commandBuffer, domainOrigin);
+		load(fp_vkCmdSetTessellationDomainOriginEXT, 326, "vkCmdSetTessellationDomainOriginEXT")(commandBuffer, domainOrigin);
 	}
 #endif
 #if (defined(VK_EXT_extended_dynamic_state3))
 	void cmdSetDepthClampEnableEXT(VkCommandBuffer commandBuffer, VkBool32 depthClampEnable) const noexcept {
-		fp_vkCmdSetDepthClampEnableEXT(commandBuffer, depthClampEnable);
+		load(fp_vkCmdSetDepthClampEnableEXT, 327, "vkCmdSetDepthClampEnableEXT")(commandBuffer, depthClampEnable);
 	}
 #endif
 #if (defined(VK_EXT_extended_dynamic_state3))
 	void cmdSetPolygonModeEXT(VkCommandBuffer commandBuffer, VkPolygonMode polygonMode) const noexcept {
-		fp_vkCmdSetPolygonModeEXT(commandBuffer, polygonMode);
+		load(fp_vkCmdSetPolygonModeEXT, 328, "vkCmdSetPolygonModeEXT")(commandBuffer, polygonMode);
 	}
 #endif
 #if (defined(VK_EXT_extended_dynamic_state3))
 	void cmdSetRasterizationSamplesEXT(VkCommandBuffer commandBuffer, VkSampleCountFlagBits rasterizationSamples) const noexcept {
-		fp_vkCmdSetRasterizationSamplesEXT(commandBuffer, rasterizationSamples);
+		load(fp_vkCmdSetRasterizationSamplesEXT, 329, "vkCmdSetRasterizationSamplesEXT")(commandBuffer, rasterizationSamples);
 	}
 #endif
 #if (defined(VK_EXT_extended_dynamic_state3))
 	void cmdSetSampleMaskEXT(VkCommandBuffer commandBuffer, VkSampleCountFlagBits samples, const VkSampleMask* pSampleMask) const noexcept {
-		fp_vkCmdSetSampleMaskEXT(commandBuffer, samples, pSampleMask);
+		load(fp_vkCmdSetSampleMaskEXT, 330, "vkCmdSetSampleMaskEXT")(commandBuffer, samples, pSampleMask);
 	}
 #endif
 #if (defined(VK_EXT_extended_dynamic_state3))
 	void cmdSetAlphaToCoverageEnableEXT(VkCommandBuffer commandBuffer, VkBool32 alphaToCoverageEnable) const noexcept {
-		fp_vkCmdSetAlphaToCoverageEnableEXT(commandBuffer, alphaToCoverageEnable);
+		load(fp_vkCmdSetAlphaToCoverageEnableEXT, 331, "vkCmdSetAlphaToCoverageEnableEXT")(commandBuffer, alphaToCoverageEnable);
 	}
 #endif
 #if (defined(VK_EXT_extended_dynamic_state3))
 	void cmdSetAlphaToOneEnableEXT(VkCommandBuffer commandBuffer, VkBool32 alphaToOneEnable) const noexcept {
-		fp_vkCmdSetAlphaToOneEnableEXT(commandBuffer, alphaToOneEnable);
+		load(fp_vkCmdSetAlphaToOneEnableEXT, 332, "vkCmdSetAlphaToOneEnableEXT")(commandBuffer, alphaToOneEnable);
 	}
 #endif
 #if (defined(VK_EXT_extended_dynamic_state3))
 	void cmdSetLogicOpEnableEXT(VkCommandBuffer commandBuffer, VkBool32 logicOpEnable) const noexcept {
-		fp_vkCmdSetLogicOpEnableEXT(commandBuffer, logicOpEnable);
+		load(fp_vkCmdSetLogicOpEnableEXT, 333, "vkCmdSetLogicOpEnableEXT")(commandBuffer, logicOpEnable);
 	}
 #endif
 #if (defined(VK_EXT_extended_dynamic_state3))
 	void cmdSetColorBlendEnableEXT(VkCommandBuffer commandBuffer, uint32_t firstAttachment, uint32_t attachmentCount, const VkBool32* pColorBlendEnables) const noexcept {
-		fp_vkCmdSetColorBlendEnableEXT(commandBuffer, firstAttachment, attachmentCount, pColorBlendEnables);
+		load(fp_vkCmdSetColorBlendEnableEXT, 334, "vkCmdSetColorBlendEnableEXT")(commandBuffer, firstAttachment, attachmentCount, pColorBlendEnables);
 	}
 #endif
 #if (defined(VK_EXT_extended_dynamic_state3))
 	void cmdSetColorBlendEquationEXT(VkCommandBuffer commandBuffer, uint32_t firstAttachment, uint32_t attachmentCount, const VkColorBlendEquationEXT* pColorBlendEquations) const noexcept {
-		fp_vkCmdSetColorBlendEquationEXT(commandBuffer, firstAttachment, attachmentCount, pColorBlendEquations);
+		load(fp_vkCmdSetColorBlendEquationEXT, 335, "vkCmdSetColorBlendEquationEXT")(commandBuffer, firstAttachment, attachmentCount, pColorBlendEquations);
 	}
 #endif
 #if (defined(VK_EXT_extended_dynamic_state3))
 	void cmdSetColorWriteMaskEXT(VkCommandBuffer commandBuffer, uint32_t firstAttachment, uint32_t attachmentCount, const VkColorComponentFlags* pColorWriteMasks) const noexcept {
-		fp_vkCmdSetColorWriteMaskEXT(commandBuffer, firstAttachment, attachmentCount, pColorWriteMasks);
+		load(fp_vkCmdSetColorWriteMaskEXT, 336, "vkCmdSetColorWriteMaskEXT")(commandBuffer, firstAttachment, attachmentCount, pColorWriteMasks);
 	}
 #endif
 #if (defined(VK_EXT_extended_dynamic_state3))
 	void cmdSetRasterizationStreamEXT(VkCommandBuffer commandBuffer, uint32_t rasterizationStream) const noexcept {
-		fp_vkCmdSetRasterizationStreamEXT(commandBuffer, rasterizationStream);
+		load(fp_vkCmdSetRasterizationStreamEXT, 337, "vkCmdSetRasterizationStreamEXT")(commandBuffer, rasterizationStream);
 	}
 #endif
 #if (defined(VK_EXT_extended_dynamic_state3))
 	void cmdSetConservativeRasterizationModeEXT(VkCommandBuffer commandBuffer, VkConservativeRasterizationModeEXT conservativeRasterizationMode) const noexcept {
-		fp_vkCmdSetConservativeRasterizationModeEXT(commandBuffer, conservativeRasterizationMode);
+		load(fp_vkCmdSetConservativeRasterizationModeEXT, 338, "vkCmdSetConservativeRasterizationModeEXT")(commandBuffer, conservativeRasterizationMode);
 	}
 #endif
 #if (defined(VK_EXT_extended_dynamic_state3))
 	void cmdSetExtraPrimitiveOverestimationSizeEXT(VkCommandBuffer commandBuffer, float extraPrimitiveOverestimationSize) const noexcept {
-		fp_vkCmdSetExtraPrimitiveOverestimationSizeEXT(commandBuffer, extraPrimitiveOverestimationSize);
+		load(fp_vkCmdSetExtraPrimitiveOverestimationSizeEXT, 339, "vkCmdSetExtraPrimitiveOverestimationSizeEXT")(commandBuffer, extraPrimitiveOverestimationSize);
 	}
 #endif
 #if (defined(VK_EXT_extended_dynamic_state3))
 	void cmdSetDepthClipEnableEXT(VkCommandBuffer commandBuffer, VkBool32 depthClipEnable) const noexcept {
-		fp_vkCmdSetDepthClipEnableEXT(commandBuffer, depthClipEnable);
+		load(fp_vkCmdSetDepthClipEnableEXT, 340, "vkCmdSetDepthClipEnableEXT")(commandBuffer, depthClipEnable);
 	}
 #endif
 #if (defined(VK_EXT_extended_dynamic_state3))
 	void cmdSetSampleLocationsEnableEXT(VkCommandBuffer commandBuffer, VkBool32 sampleLocationsEnable) const noexcept {
-		fp_vkCmdSetSampleLocationsEnableEXT(commandBuffer, sampleLocationsEnable);
+		load(fp_vkCmdSetSampleLocationsEnableEXT, 341, "vkCmdSetSampleLocationsEnableEXT")(commandBuffer, sampleLocationsEnable);
 	}
 #endif
 #if (defined(VK_EXT_extended_dynamic_state3))
 	void cmdSetColorBlendAdvancedEXT(VkCommandBuffer commandBuffer, uint32_t firstAttachment, uint32_t attachmentCount, const VkColorBlendAdvancedEXT* pColorBlendAdvanced) const noexcept {
-		fp_vkCmdSetColorBlendAdvancedEXT(commandBuffer, firstAttachment, attachmentCount, pColorBlendAdvanced);
+		load(fp_vkCmdSetColorBlendAdvancedEXT, 342, "vkCmdSetColorBlendAdvancedEXT")(commandBuffer, firstAttachment, attachmentCount, pColorBlendAdvanced);
 	}
 #endif
 #if (defined(VK_EXT_extended_dynamic_state3))
 	void cmdSetProvokingVertexModeEXT(VkCommandBuffer commandBuffer, VkProvokingVertexModeEXT provokingVertexMode) const noexcept {
-		fp_vkCmdSetProvokingVertexModeEXT(commandBuffer, provokingVertexMode);
+		load(fp_vkCmdSetProvokingVertexModeEXT, 343, "vkCmdSetProvokingVertexModeEXT")(commandBuffer, provokingVertexMode);
 	}
 #endif
 #if (defined(VK_EXT_extended_dynamic_state3))
 	void cmdSetLineRasterizationModeEXT(VkCommandBuffer commandBuffer, VkLineRasterizationModeEXT lineRasterizationMode) const noexcept {
-		fp_vkCmdSetLineRasterizationModeEXT(commandBuffer, lineRasterizationMode);
+		load(fp_vkCmdSetLineRasterizationModeEXT, 344, "vkCmdSetLineRasterizationModeEXT")(commandBuffer, lineRasterizationMode);
 	}
 #endif
 #if (defined(VK_EXT_extended_dynamic_state3))
 	void cmdSetLineStippleEnableEXT(VkCommandBuffer commandBuffer, VkBool32 stippledLineEnable) const noexcept {
-		fp_vkCmdSetLineStippleEnableEXT(commandBuffer, stippledLineEnable);
+		load(fp_vkCmdSetLineStippleEnableEXT, 345, "vkCmdSetLineStippleEnableEXT")(commandBuffer, stippledLineEnable);
 	}
 #endif
 #if (defined(VK_EXT_extended_dynamic_state3))
 	void cmdSetDepthClipNegativeOneToOneEXT(VkCommandBuffer commandBuffer, VkBool32 negativeOneToOne) const noexcept {
-		fp_vkCmdSetDepthClipNegativeOneToOneEXT(commandBuffer, negativeOneToOne);
+		load(fp_vkCmdSetDepthClipNegativeOneToOneEXT, 346, "vkCmdSetDepthClipNegativeOneToOneEXT")(commandBuffer, negativeOneToOne);
 	}
 #endif
 #if (defined(VK_EXT_extended_dynamic_state3))
 	void cmdSetViewportWScalingEnableNV(VkCommandBuffer commandBuffer, VkBool32 viewportWScalingEnable) const noexcept {
-		fp_vkCmdSetViewportWScalingEnableNV(commandBuffer, viewportWScalingEnable);
+		load(fp_vkCmdSetViewportWScalingEnableNV, 347, "vkCmdSetViewportWScalingEnableNV")(commandBuffer, viewportWScalingEnable);
 	}
 #endif
 #if (defined(VK_EXT_extended_dynamic_state3))
 	void cmdSetViewportSwizzleNV(VkCommandBuffer commandBuffer, uint32_t firstViewport, uint32_t viewportCount, const VkViewportSwizzleNV* pViewportSwizzles) const noexcept {
-		fp_vkCmdSetViewportSwizzleNV(commandBuffer, firstViewport, viewportCount, pViewportSwizzles);
+		load(fp_vkCmdSetViewportSwizzleNV, 348, "vkCmdSetViewportSwizzleNV")(commandBuffer, firstViewport, viewportCount, pViewportSwizzles);
 	}
 #endif
 #if (defined(VK_EXT_extended_dynamic_state3))
 	void cmdSetCoverageToColorEnableNV(VkCommandBuffer commandBuffer, VkBool32 coverageToColorEnable) const noexcept {
-		fp_vkCmdSetCoverageToColorEnableNV(commandBuffer, coverageToColorEnable);
+		load(fp_vkCmdSetCoverageToColorEnableNV, 349, "vkCmdSetCoverageToColorEnableNV")(commandBuffer, coverageToColorEnable);
 	}
 #endif
 #if (defined(VK_EXT_extended_dynamic_state3))
 	void cmdSetCoverageToColorLocationNV(VkCommandBuffer commandBuffer, uint32_t coverageToColorLocation) const noexcept {
-		fp_vkCmdSetCoverageToColorLocationNV(commandBuffer, coverageToColorLocation);
+		load(fp_vkCmdSetCoverageToColorLocationNV, 350, "vkCmdSetCoverageToColorLocationNV")(commandBuffer, coverageToColorLocation);
 	}
 #endif
 #if (defined(VK_EXT_extended_dynamic_state3))
 	void cmdSetCoverageModulationModeNV(VkCommandBuffer commandBuffer, VkCoverageModulationModeNV coverageModulationMode) const noexcept {
-		fp_vkCmdSetCoverageModulationModeNV(commandBuffer, coverageModulationMode);
+		load(fp_vkCmdSetCoverageModulationModeNV, 351, "vkCmdSetCoverageModulationModeNV")(commandBuffer, coverageModulationMode);
 	}
 #endif
 #if (defined(VK_EXT_extended_dynamic_state3))
 	void cmdSetCoverageModulationTableEnableNV(VkCommandBuffer commandBuffer, VkBool32 coverageModulationTableEnable) const noexcept {
-		fp_vkCmdSetCoverageModulationTableEnableNV(commandBuffer, coverageModulationTableEnable);
+		load(fp_vkCmdSetCoverageModulationTableEnableNV, 352, "vkCmdSetCoverageModulationTableEnableNV")(commandBuffer, coverageModulationTableEnable);
 	}
 #endif
 #if (defined(VK_EXT_extended_dynamic_state3))
 	void cmdSetCoverageModulationTableNV(VkCommandBuffer commandBuffer, uint32_t coverageModulationTableCount, const float* pCoverageModulationTable) const noexcept {
-		fp_vkCmdSetCoverageModulationTableNV(commandBuffer, coverageModulationTableCount, pCoverageModulationTable);
+		load(fp_vkCmdSetCoverageModulationTableNV, 353, "vkCmdSetCoverageModulationTableNV")(commandBuffer, coverageModulationTableCount, pCoverageModulationTable);
 	}
 #endif
 #if (defined(VK_EXT_extended_dynamic_state3))
 	void cmdSetShadingRateImageEnableNV(VkCommandBuffer commandBuffer, VkBool32 shadingRateImageEnable) const noexcept {
-		fp_vkCmdSetShadingRateImageEnableNV(commandBuffer, shadingRateImageEnable);
+		load(fp_vkCmdSetShadingRateImageEnableNV, 354, "vkCmdSetShadingRateImageEnableNV")(commandBuffer, shadingRateImageEnable);
 	}
 #endif
 #if (defined(VK_EXT_extended_dynamic_state3))
 	void cmdSetCoverageReductionModeNV(VkCommandBuffer commandBuffer, VkCoverageReductionModeNV coverageReductionMode) const noexcept {
-		fp_vkCmdSetCoverageReductionModeNV(commandBuffer, coverageReductionMode);
+		load(fp_vkCmdSetCoverageReductionModeNV, 355, "vkCmdSetCoverageReductionModeNV")(commandBuffer, coverageReductionMode);
 	}
 #endif
 #if (defined(VK_EXT_extended_dynamic_state3))
 	void cmdSetRepresentativeFragmentTestEnableNV(VkCommandBuffer commandBuffer, VkBool32 representativeFragmentTestEnable) const noexcept {
-		fp_vkCmdSetRepresentativeFragmentTestEnableNV(commandBuffer, representativeFragmentTestEnable);
+		load(fp_vkCmdSetRepresentativeFragmentTestEnableNV, 356, "vkCmdSetRepresentativeFragmentTestEnableNV")(commandBuffer, representativeFragmentTestEnable);
 	}
 #endif
 #if (defined(VK_VERSION_1_3))
 	void destroyPrivateDataSlot(VkPrivateDataSlotEXT privateDataSlot, const VkAllocationCallbacks* pAllocator) const noexcept {
-		fp_vkDestroyPrivateDataSlot(device, privateDataSlot, pAllocator);
+		load(fp_vkDestroyPrivateDataSlot, 357, "vkDestroyPrivateDataSlot")(device, privateDataSlot, pAllocator);
 	}
 #endif
 #if (defined(VK_VERSION_1_3))
 	VkResult setPrivateData(VkObjectType objectType, uint64_t objectHandle, VkPrivateDataSlotEXT privateDataSlot, uint64_t data) const noexcept {
-		return fp_vkSetPrivateData(device, objectType, objectHandle, privateDataSlot, data);
+		return load(fp_vkSetPrivateData, 358, "vkSetPrivateData")(device, objectType, objectHandle, privateDataSlot, data);
 	}
 #endif
 #if (defined(VK_VERSION_1_3))
 	void getPrivateData(VkObjectType objectType, uint64_t objectHandle, VkPrivateDataSlotEXT privateDataSlot, uint64_t* pData) const noexcept {
-		fp_vkGetPrivateData(device, objectType, objectHandle, privateDataSlot, pData);
+		load(fp_vkGetPrivateData, 359, "vkGetPrivateData")(device, objectType, objectHandle, privateDataSlot, pData);
 	}
 #endif
 #if (defined(VK_VERSION_1_3))
 	void cmdCopyBuffer2(VkCommandBuffer commandBuffer, const VkCopyBufferInfo2KHR* pCopyBufferInfo) const noexcept {
-		fp_vkCmdCopyBuffer2(commandBuffer, pCopyBufferInfo);
+		load(fp_vkCmdCopyBuffer2, 360, "vkCmdCopyBuffer2")(commandBuffer, pCopyBufferInfo);
 	}
 #endif
 #if (defined(VK_VERSION_1_3))
 	void cmdCopyImage2(VkCommandBuffer commandBuffer, const VkCopyImageInfo2KHR* pCopyImageInfo) const noexcept {
-		fp_vkCmdCopyImage2(commandBuffer, pCopyImageInfo);
+		load(fp_vkCmdCopyImage2, 361, "vkCmdCopyImage2")(commandBuffer, pCopyImageInfo);
 	}
 #endif
 #if (defined(VK_VERSION_1_3))
 	void cmdBlitImage2(VkCommandBuffer commandBuffer, const VkBlitImageInfo2KHR* pBlitImageInfo) const noexcept {
-		fp_vkCmdBlitImage2(commandBuffer, pBlitImageInfo);
+		load(fp_vkCmdBlitImage2, 362, "vkCmdBlitImage2")(commandBuffer, pBlitImageInfo);
 	}
 #endif
 #if (defined(VK_VERSION_1_3))
 	void cmdCopyBufferToImage2(VkCommandBuffer commandBuffer, const VkCopyBufferToImageInfo2KHR* pCopyBufferToImageInfo) const noexcept {
-		fp_vkCmdCopyBufferToImage2(commandBuffer, pCopyBufferToImageInfo);
+		load(fp_vkCmdCopyBufferToImage2, 363, "vkCmdCopyBufferToImage2")(commandBuffer, pCopyBufferToImageInfo);
 	}
 #endif
 #if (defined(VK_VERSION_1_3))
 	void cmdCopyImageToBuffer2(VkCommandBuffer commandBuffer, const VkCopyImageToBufferInfo2KHR* pCopyImageToBufferInfo) const noexcept {
-		fp_vkCmdCopyImageToBuffer2(commandBuffer, pCopyImageToBufferInfo);
+		load(fp_vkCmdCopyImageToBuffer2, 364, "vkCmdCopyImageToBuffer2")(commandBuffer, pCopyImageToBufferInfo);
 	}
 #endif
 #if (defined(VK_VERSION_1_3))
 	void cmdResolveImage2(VkCommandBuffer commandBuffer, const VkResolveImageInfo2KHR* pResolveImageInfo) const noexcept {
-		fp_vkCmdResolveImage2(commandBuffer, pResolveImageInfo);
+		load(fp_vkCmdResolveImage2, 365, "vkCmdResolveImage2")(commandBuffer, pResolveImageInfo);
 	}
 #endif
 #if (defined(VK_KHR_fragment_shading_rate))
 	void cmdSetFragmentShadingRateKHR(VkCommandBuffer commandBuffer, const VkExtent2D* pFragmentSize, VkFragmentShadingRateCombinerOpKHR combinerOps[2]) const noexcept {
-		fp_vkCmdSetFragmentShadingRateKHR(commandBuffer, pFragmentSize, combinerOps);
+		load(fp_vkCmdSetFragmentShadingRateKHR, 366, "vkCmdSetFragmentShadingRateKHR")(commandBuffer, pFragmentSize, combinerOps);
 	}
 #endif
 #if (defined(VK_NV_fragment_shading_rate_enums))
 	void cmdSetFragmentShadingRateEnumNV(VkCommandBuffer commandBuffer, VkFragmentShadingRateNV shadingRate, VkFragmentShadingRateCombinerOpKHR combinerOps[2]) const noexcept {
-		fp_vkCmdSetFragmentShadingRateEnumNV(commandBuffer, shadingRate, combinerOps);
+		load(fp_vkCmdSetFragmentShadingRateEnumNV, 367, "vkCmdSetFragmentShadingRateEnumNV")(commandBuffer, shadingRate, combinerOps);
 	}
 #endif
 #if (defined(VK_KHR_acceleration_structure))
 	void getAccelerationStructureBuildSizesKHR(VkAccelerationStructureBuildTypeKHR buildType, const VkAccelerationStructureBuildGeometryInfoKHR* pBuildInfo, const uint32_t* pMaxPrimitiveCounts, VkAccelerationStructureBuildSizesInfoKHR* pSizeInfo) const noexcept {
-		fp_vkGetAccelerationStructureBuildSizesKHR(device, buildType, pBuildInfo, pMaxPrimitiveCounts, pSizeInfo);
+		load(fp_vkGetAccelerationStructureBuildSizesKHR, 368, "vkGetAccelerationStructureBuildSizesKHR")(device, buildType, pBuildInfo, pMaxPrimitiveCounts, pSizeInfo);
 	}
 #endif
 #if (defined(VK_EXT_vertex_input_dynamic_state))
 	void cmdSetVertexInputEXT(VkCommandBuffer commandBuffer, uint32_t vertexBindingDescriptionCount, const VkVertexInputBindingDescription2EXT* pVertexBindingDescriptions, uint32_t vertexAttributeDescriptionCount, const VkVertexInputAttributeDescription2EXT* pVertexAttributeDescriptions) const noexcept {
-		fp_vkCmdSetVertexInputEXT(commandBuffer, vertexBindingDescriptionCount, pVertexBindingDescriptions, vertexAttributeDescriptionCount, pVertexAttributeDescriptions);
+		load(fp_vkCmdSetVertexInputEXT, 369, "vkCmdSetVertexInputEXT")(commandBuffer, vertexBindingDescriptionCount, pVertexBindingDescriptions, vertexAttributeDescriptionCount, pVertexAttributeDescriptions);
 	}
 #endif
 #if (defined(VK_EXT_color_write_enable))
 	void cmdSetColorWriteEnableEXT(VkCommandBuffer commandBuffer, uint32_t attachmentCount, const VkBool32* pColorWriteEnables) const noexcept {
-		fp_vkCmdSetColorWriteEnableEXT(commandBuffer, attachmentCount, pColorWriteEnables);
+		load(fp_vkCmdSetColorWriteEnableEXT, 370, "vkCmdSetColorWriteEnableEXT")(commandBuffer, attachmentCount, pColorWriteEnables);
 	}
 #endif
 #if (defined(VK_VERSION_1_3))
 	void cmdSetEvent2(VkCommandBuffer commandBuffer, VkEvent event, const VkDependencyInfoKHR* pDependencyInfo) const noexcept {
-		fp_vkCmdSetEvent2(commandBuffer, event, pDependencyInfo);
+		load(fp_vkCmdSetEvent2, 371, "vkCmdSetEvent2")(commandBuffer, event, pDependencyInfo);
 	}
 #endif
 #if (defined(VK_VERSION_1_3))
 	void cmdResetEvent2(VkCommandBuffer commandBuffer, VkEvent event, VkPipelineStageFlags2KHR stageMask) const noexcept {
-		fp_vkCmdResetEvent2(commandBuffer, event, stageMask);
+		load(fp_vkCmdResetEvent2, 372, "vkCmdResetEvent2")(commandBuffer, event, stageMask);
 	}
 #endif
 #if (defined(VK_VERSION_1_3))
 	void cmdWaitEvents2(VkCommandBuffer commandBuffer, uint32_t eventCount, const VkEvent* pEvents, const VkDependencyInfoKHR* pDependencyInfos) const noexcept {
-		fp_vkCmdWaitEvents2(commandBuffer, eventCount, pEvents, pDependencyInfos);
+		load(fp_vkCmdWaitEvents2, 373, "vkCmdWaitEvents2")(commandBuffer, eventCount, pEvents, pDependencyInfos);
 	}
 #endif
 #if (defined(VK_VERSION_1_3))
 	void cmdPipelineBarrier2(VkCommandBuffer commandBuffer, const VkDependencyInfoKHR* pDependencyInfo) const noexcept {
-		fp_vkCmdPipelineBarrier2(commandBuffer, pDependencyInfo);
+		load(fp_vkCmdPipelineBarrier2, 374, "vkCmdPipelineBarrier2")(commandBuffer, pDependencyInfo);
 	}
 #endif
 #if (defined(VK_VERSION_1_3))
 	VkResult queueSubmit2(VkQueue queue, uint32_t submitCount, const VkSubmitInfo2KHR* pSubmits, VkFence fence) const noexcept {
-		return fp_vkQueueSubmit2(queue, submitCount, pSubmits, fence);
+		return load(fp_vkQueueSubmit2, 375, "vkQueueSubmit2")(queue, submitCount, pSubmits, fence);
 	}
 #endif
 #if (defined(VK_VERSION_1_3))
 	void cmdWriteTimestamp2(VkCommandBuffer commandBuffer, VkPipelineStageFlags2KHR stage, VkQueryPool queryPool, uint32_t query) const noexcept {
-		fp_vkCmdWriteTimestamp2(commandBuffer, stage, queryPool, query);
+		load(fp_vkCmdWriteTimestamp2, 376, "vkCmdWriteTimestamp2")(commandBuffer, stage, queryPool, query);
 	}
 #endif
 #if (defined(VK_KHR_synchronization2) && defined(VK_AMD_buffer_marker))
 	void cmdWriteBufferMarker2AMD(VkCommandBuffer commandBuffer, VkPipelineStageFlags2KHR stage, VkBuffer dstBuffer, VkDeviceSize dstOffset, uint32_t marker) const noexcept {
-		fp_vkCmdWriteBufferMarker2AMD(commandBuffer, stage, dstBuffer, dstOffset, marker);
+		load(fp_vkCmdWriteBufferMarker2AMD, 377, "vkCmdWriteBufferMarker2AMD")(commandBuffer, stage, dstBuffer, dstOffset, marker);
 	}
 #endif
 #if (defined(VK_KHR_synchronization2) && defined(VK_NV_device_diagnostic_checkpoints))
 	void getQueueCheckpointData2NV(VkQueue queue, uint32_t* pCheckpointDataCount, VkCheckpointData2NV* pCheckpointData) const noexcept {
-		fp_vkGetQueueCheckpointData2NV(queue, pCheckpointDataCount, pCheckpointData);
+		load(fp_vkGetQueueCheckpointData2NV, 378, "vkGetQueueCheckpointData2NV")(queue, pCheckpointDataCount, pCheckpointData);
 	}
 #endif
 #if (defined(VK_KHR_video_queue))
 	VkResult createVideoSessionKHR(const VkVideoSessionCreateInfoKHR* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkVideoSessionKHR* pVideoSession) const noexcept {
-		return fp_vkCreateVideoSessionKHR(device, pCreateInfo, pAllocator, pVideoSession);
+		return load(fp_vkCreateVideoSessionKHR, 379, "vkCreateVideoSessionKHR")(device, pCreateInfo, pAllocator, pVideoSession);
 	}
 #endif
 #if (defined(VK_KHR_video_queue))
 	void destroyVideoSessionKHR(VkVideoSessionKHR videoSession, const VkAllocationCallbacks* pAllocator) const noexcept {
-		fp_vkDestroyVideoSessionKHR(device, videoSession, pAllocator);
+		load(fp_vkDestroyVideoSessionKHR, 380, "vkDestroyVideoSessionKHR")(device, videoSession, pAllocator);
 	}
 #endif
 #if (defined(VK_KHR_video_queue))
 	VkResult createVideoSessionParametersKHR(const VkVideoSessionParametersCreateInfoKHR* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkVideoSessionParametersKHR* pVideoSessionParameters) const noexcept {
-		return fp_vkCreateVideoSessionParametersKHR(device, pCreateInfo, pAllocator, pVideoSessionParameters);
+		return load(fp_vkCreateVideoSessionParametersKHR, 381, "vkCreateVideoSessionParametersKHR")(device, pCreateInfo, pAllocator, pVideoSessionParameters);
 	}
 #endif
 #if (defined(VK_KHR_video_queue))
 	VkResult updateVideoSessionParametersKHR(VkVideoSessionParametersKHR videoSessionParameters, const VkVideoSessionParametersUpdateInfoKHR* pUpdateInfo) const noexcept {
-		return fp_vkUpdateVideoSessionParametersKHR(device, videoSessionParameters, pUpdateInfo);
+		return load(fp_vkUpdateVideoSessionParametersKHR, 382, "vkUpdateVideoSessionParametersKHR")(device, videoSessionParameters, pUpdateInfo);
 	}
 #endif
 #if (defined(VK_KHR_video_queue))
 	void destroyVideoSessionParametersKHR(VkVideoSessionParametersKHR videoSessionParameters, const VkAllocationCallbacks* pAllocator) const noexcept {
-		fp_vkDestroyVideoSessionParametersKHR(device, videoSessionParameters, pAllocator);
+		load(fp_vkDestroyVideoSessionParametersKHR, 383, "vkDestroyVideoSessionParametersKHR")(device, videoSessionParameters, pAllocator);
 	}
 #endif
 #if (defined(VK_KHR_video_queue))
 	VkResult getVideoSessionMemoryRequirementsKHR(VkVideoSessionKHR videoSession, uint32_t* pMemoryRequirementsCount, VkVideoSessionMemoryRequirementsKHR* pMemoryRequirements) const noexcept {
-		return fp_vkGetVideoSessionMemoryRequirementsKHR(device, videoSession, pMemoryRequirementsCount, pMemoryRequirements);
+		return load(fp_vkGetVideoSessionMemoryRequirementsKHR, 384, "vkGetVideoSessionMemoryRequirementsKHR")(device, videoSession, pMemoryRequirementsCount, pMemoryRequirements);
 	}
 #endif
 #if (defined(VK_KHR_video_queue))
 	VkResult bindVideoSessionMemoryKHR(VkVideoSessionKHR videoSession, uint32_t bindSessionMemoryInfoCount, const VkBindVideoSessionMemoryInfoKHR* pBindSessionMemoryInfos) const noexcept {
-		return fp_vkBindVideoSessionMemoryKHR(device, videoSession, bindSessionMemoryInfoCount, pBindSessionMemoryInfos);
+		return load(fp_vkBindVideoSessionMemoryKHR, 385, "vkBindVideoSessionMemoryKHR")(device, videoSession, bindSessionMemoryInfoCount, pBindSessionMemoryInfos);
 	}
 #endif
 #if (defined(VK_KHR_video_decode_queue))
 	void cmdDecodeVideoKHR(VkCommandBuffer commandBuffer, const VkVideoDecodeInfoKHR* pDecodeInfo) const noexcept {
-		fp_vkCmdDecodeVideoKHR(commandBuffer, pDecodeInfo);
+		load(fp_vkCmdDecodeVideoKHR, 386, "vkCmdDecodeVideoKHR")(commandBuffer, pDecodeInfo);
 	}
 #endif
 #if (defined(VK_KHR_video_queue))
 	void cmdBeginVideoCodingKHR(VkCommandBuffer commandBuffer, const VkVideoBeginCodingInfoKHR* pBeginInfo) const noexcept {
-		fp_vkCmdBeginVideoCodingKHR(commandBuffer, pBeginInfo);
+		load(fp_vkCmdBeginVideoCodingKHR, 387, "vkCmdBeginVideoCodingKHR")(commandBuffer, pBeginInfo);
 	}
 #endif
 #if (defined(VK_KHR_video_queue))
 	void cmdControlVideoCodingKHR(VkCommandBuffer commandBuffer, const VkVideoCodingControlInfoKHR* pCodingControlInfo) const noexcept {
-		fp_vkCmdControlVideoCodingKHR(commandBuffer, pCodingControlInfo);
+		load(fp_vkCmdControlVideoCodingKHR, 388, "vkCmdControlVideoCodingKHR")(commandBuffer, pCodingControlInfo);
 	}
 #endif
 #if (defined(VK_KHR_video_queue))
 	void cmdEndVideoCodingKHR(VkCommandBuffer commandBuffer, const VkVideoEndCodingInfoKHR* pEndCodingInfo) const noexcept {
-		fp_vkCmdEndVideoCodingKHR(commandBuffer, pEndCodingInfo);
+		load(fp_vkCmdEndVideoCodingKHR, 389, "vkCmdEndVideoCodingKHR")(commandBuffer, pEndCodingInfo);
 	}
 #endif
 #if (defined(VK_KHR_video_encode_queue))
 	void cmdEncodeVideoKHR(VkCommandBuffer commandBuffer, const VkVideoEncodeInfoKHR* pEncodeInfo) const noexcept {
-		fp_vkCmdEncodeVideoKHR(commandBuffer, pEncodeInfo);
+		load(fp_vkCmdEncodeVideoKHR, 390, "vkCmdEncodeVideoKHR")(commandBuffer, pEncodeInfo);
 	}
 #endif
 #if (defined(VK_EXT_pageable_device_local_memory))
 	void setDeviceMemoryPriorityEXT(VkDeviceMemory memory, float priority) const noexcept {
-		fp_vkSetDeviceMemoryPriorityEXT(device, memory, priority);
+		load(fp_vkSetDeviceMemoryPriorityEXT, 391, "vkSetDeviceMemoryPriorityEXT")(device, memory, priority);
 	}
 #endif
 #if (defined(VK_KHR_present_wait))
 	VkResult waitForPresentKHR(VkSwapchainKHR swapchain, uint64_t presentId, uint64_t timeout) const noexcept {
-		return fp_vkWaitForPresentKHR(device, swapchain, presentId, timeout);
+		return load(fp_vkWaitForPresentKHR, 392, "vkWaitForPresentKHR")(device, swapchain, presentId, timeout);
 	}
 #endif
 #if (defined(VK_FUCHSIA_buffer_collection))
 	VkResult createBufferCollectionFUCHSIA(const VkBufferCollectionCreateInfoFUCHSIA* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkBufferCollectionFUCHSIA* pCollection) const noexcept {
-		return fp_vkCreateBufferCollectionFUCHSIA(device, pCreateInfo, pAllocator, pCollection);
+		return load(fp_vkCreateBufferCollectionFUCHSIA, 393, "vkCreateBufferCollectionFUCHSIA")(device, pCreateInfo, pAllocator, pCollection);
 	}
 #endif
 #if (defined(VK_FUCHSIA_buffer_collection))
 	VkResult setBufferCollectionBufferConstraintsFUCHSIA(VkBufferCollectionFUCHSIA collection, const VkBufferConstraintsInfoFUCHSIA* pBufferConstraintsInfo) const noexcept {
-		return fp_vkSetBufferCollectionBufferConstraintsFUCHSIA(device, collection, pBufferConstraintsInfo);
+		return load(fp_vkSetBufferCollectionBufferConstraintsFUCHSIA, 394, "vkSetBufferCollectionBufferConstraintsFUCHSIA")(device, collection, pBufferConstraintsInfo);
 	}
 #endif
 #if (defined(VK_FUCHSIA_buffer_collection))
 	VkResult setBufferCollectionImageConstraintsFUCHSIA(VkBufferCollectionFUCHSIA collection, const VkImageConstraintsInfoFUCHSIA* pImageConstraintsInfo) const noexcept {
-		return fp_vkSetBufferCollectionImageConstraintsFUCHSIA(device, collection, pImageConstraintsInfo);
+		return load(fp_vkSetBufferCollectionImageConstraintsFUCHSIA, 395, "vkSetBufferCollectionImageConstraintsFUCHSIA")(device, collection, pImageConstraintsInfo);
 	}
 #endif
 #if (defined(VK_FUCHSIA_buffer_collection))
 	void destroyBufferCollectionFUCHSIA(VkBufferCollectionFUCHSIA collection, const VkAllocationCallbacks* pAllocator) const noexcept {
-		fp_vkDestroyBufferCollectionFUCHSIA(device, collection, pAllocator);
+		load(fp_vkDestroyBufferCollectionFUCHSIA, 396, "vkDestroyBufferCollectionFUCHSIA")(device, collection, pAllocator);
 	}
 #endif
 #if (defined(VK_FUCHSIA_buffer_collection))
 	VkResult getBufferCollectionPropertiesFUCHSIA(VkBufferCollectionFUCHSIA collection, VkBufferCollectionPropertiesFUCHSIA* pProperties) const noexcept {
-		return fp_vkGetBufferCollectionPropertiesFUCHSIA(device, collection, pProperties);
+		return load(fp_vkGetBufferCollectionPropertiesFUCHSIA, 397, "vkGetBufferCollectionPropertiesFUCHSIA")(device, collection, pProperties);
 	}
 #endif
 #if (defined(VK_VERSION_1_3))
 	void cmdBeginRendering(VkCommandBuffer commandBuffer, const VkRenderingInfoKHR* pRenderingInfo) const noexcept {
-		fp_vkCmdBeginRendering(commandBuffer, pRenderingInfo);
+		load(fp_vkCmdBeginRendering, 398, "vkCmdBeginRendering")(commandBuffer, pRenderingInfo);
 	}
 #endif
 #if (defined(VK_VERSION_1_3))
 	void cmdEndRendering(VkCommandBuffer commandBuffer) const noexcept {
-		fp_vkCmdEndRendering(commandBuffer);
+		load(fp_vkCmdEndRendering, 399, "vkCmdEndRendering")(commandBuffer);
 	}
 #endif
 #if (defined(VK_VALVE_descriptor_set_host_mapping))
 	void getDescriptorSetLayoutHostMappingInfoVALVE(const VkDescriptorSetBindingReferenceVALVE* pBindingReference, VkDescriptorSetLayoutHostMappingInfoVALVE* pHostMapping) const noexcept {
-		fp_vkGetDescriptorSetLayoutHostMappingInfoVALVE(device, pBindingReference, pHostMapping);
+		load(fp_vkGetDescriptorSetLayoutHostMappingInfoVALVE, 400, "vkGetDescriptorSetLayoutHostMappingInfoVALVE")(device, pBindingReference, pHostMapping);
 	}
 #endif
 #if (defined(VK_VALVE_descriptor_set_host_mapping))
 	void getDescriptorSetHostMappingVALVE(VkDescriptorSet descriptorSet, void** ppData) const noexcept {
-		fp_vkGetDescriptorSetHostMappingVALVE(device, descriptorSet, ppData);
+		load(fp_vkGetDescriptorSetHostMappingVALVE, 401, "vkGetDescriptorSetHostMappingVALVE")(device, descriptorSet, ppData);
 	}
 #endif
 #if (defined(VK_EXT_opacity_micromap))
 	VkResult createMicromapEXT(const VkMicromapCreateInfoEXT* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkMicromapEXT* pMicromap) const noexcept {
-		return fp_vkCreateMicromapEXT(device, pCreateInfo, pAllocator, pMicromap);
+		return load(fp_vkCreateMicromapEXT, 402, "vkCreateMicromapEXT")(device, pCreateInfo, pAllocator, pMicromap);
 	}
 #endif
 #if (defined(VK_EXT_opacity_micromap))
 	void cmdBuildMicromapsEXT(VkCommandBuffer commandBuffer, uint32_t infoCount, const VkMicromapBuildInfoEXT* pInfos) const noexcept {
-		fp_vkCmdBuildMicromapsEXT(commandBuffer, infoCount, pInfos);
+		load(fp_vkCmdBuildMicromapsEXT, 403, "vkCmdBuildMicromapsEXT")(commandBuffer, infoCount, pInfos);
 	}
 #endif
 #if (defined(VK_EXT_opacity_micromap))
 	VkResult buildMicromapsEXT(VkDeferredOperationKHR deferredOperation, uint32_t infoCount, const VkMicromapBuildInfoEXT* pInfos) const noexcept {
-		return fp_vkBuildMicromapsEXT(device, deferredOperation, infoCount, pInfos);
+		return load(fp_vkBuildMicromapsEXT, 404, "vkBuildMicromapsEXT")(device, deferredOperation, infoCount, pInfos);
 	}
 #endif
 #if (defined(VK_EXT_opacity_micromap))
 	void destroyMicromapEXT(VkMicromapEXT micromap, const VkAllocationCallbacks* pAllocator) const noexcept {
-		fp_vkDestroyMicromapEXT(device, micromap, pAllocator);
+		load(fp_vkDestroyMicromapEXT, 405, "vkDestroyMicromapEXT")(device, micromap, pAllocator);
 	}
 #endif
 #if (defined(VK_EXT_opacity_micromap))
 	void cmdCopyMicromapEXT(VkCommandBuffer commandBuffer, const VkCopyMicromapInfoEXT* pInfo) const noexcept {
-		fp_vkCmdCopyMicromapEXT(commandBuffer, pInfo);
+		load(fp_vkCmdCopyMicromapEXT, 406, "vkCmdCopyMicromapEXT")(commandBuffer, pInfo);
 	}
 #endif
 #if (defined(VK_EXT_opacity_micromap))
 	VkResult copyMicromapEXT(VkDeferredOperationKHR deferredOperation, const VkCopyMicromapInfoEXT* pInfo) const noexcept {
-		return fp_vkCopyMicromapEXT(device, deferredOperation, pInfo);
+		return load(fp_vkCopyMicromapEXT, 407, "vkCopyMicromapEXT")(device, deferredOperation, pInfo);
 	}
 #endif
 #if (defined(VK_EXT_opacity_micromap))
 	void cmdCopyMicromapToMemoryEXT(VkCommandBuffer commandBuffer, const VkCopyMicromapToMemoryInfoEXT* pInfo) const noexcept {
-		fp_vkCmdCopyMicromapToMemoryEXT(commandBuffer, pInfo);
+		load(fp_vkCmdCopyMicromapToMemoryEXT, 408, "vkCmdCopyMicromapToMemoryEXT")(commandBuffer, pInfo);
 	}
 #endif
 #if (defined(VK_EXT_opacity_micromap))
 	VkResult copyMicromapToMemoryEXT(VkDeferredOperationKHR deferredOperation, const VkCopyMicromapToMemoryInfoEXT* pInfo) const noexcept {
-		return fp_vkCopyMicromapToMemoryEXT(device, deferredOperation, pInfo);
+		return load(fp_vkCopyMicromapToMemoryEXT, 409, "vkCopyMicromapToMemoryEXT")(device, deferredOperation, pInfo);
 	}
 #endif
 #if (defined(VK_EXT_opacity_micromap))
 	void cmdCopyMemoryToMicromapEXT(VkCommandBuffer commandBuffer, const VkCopyMemoryToMicromapInfoEXT* pInfo) const noexcept {
-		fp_vkCmdCopyMemoryToMicromapEXT(commandBuffer, pInfo);
+		load(fp_vkCmdCopyMemoryToMicromapEXT, 410, "vkCmdCopyMemoryToMicromapEXT")(commandBuffer, pInfo);
 	}
 #endif
 #if (defined(VK_EXT_opacity_micromap))
 	VkResult copyMemoryToMicromapEXT(VkDeferredOperationKHR deferredOperation, const VkCopyMemoryToMicromapInfoEXT* pInfo) const noexcept {
-		return fp_vkCopyMemoryToMicromapEXT(device, deferredOperation, pInfo);
+		return load(fp_vkCopyMemoryToMicromapEXT, 411, "vkCopyMemoryToMicromapEXT")(device, deferredOperation, pInfo);
 	}
 #endif
 #if (defined(VK_EXT_opacity_micromap))
 	void cmdWriteMicromapsPropertiesEXT(VkCommandBuffer commandBuffer, uint32_t micromapCount, const VkMicromapEXT* pMicromaps, VkQueryType queryType, VkQueryPool queryPool, uint32_t firstQuery) const noexcept {
-		fp_vkCmdWriteMicromapsPropertiesEXT(commandBuffer, micromapCount, pMicromaps, queryType, queryPool, firstQuery);
+		load(fp_vkCmdWriteMicromapsPropertiesEXT, 412, "vkCmdWriteMicromapsPropertiesEXT")(commandBuffer, micromapCount, pMicromaps, queryType, queryPool, firstQuery);
 	}
 #endif
 #if (defined(VK_EXT_opacity_micromap))
 	VkResult writeMicromapsPropertiesEXT(uint32_t micromapCount, const VkMicromapEXT* pMicromaps, VkQueryType queryType, size_t dataSize, void* pData, size_t stride) const noexcept {
-		return fp_vkWriteMicromapsPropertiesEXT(device, micromapCount, pMicromaps, queryType, dataSize, pData, stride);
+		return load(fp_vkWriteMicromapsPropertiesEXT, 413, "vkWriteMicromapsPropertiesEXT")(device, micromapCount, pMicromaps, queryType, dataSize, pData, stride);
 	}
 #endif
 #if (defined(VK_EXT_opacity_micromap))
 	void getDeviceMicromapCompatibilityEXT(const VkMicromapVersionInfoEXT* pVersionInfo, VkAccelerationStructureCompatibilityKHR* pCompatibility) const noexcept {
-		fp_vkGetDeviceMicromapCompatibilityEXT(device, pVersionInfo, pCompatibility);
+		load(fp_vkGetDeviceMicromapCompatibilityEXT, 414, "vkGetDeviceMicromapCompatibilityEXT")(device, pVersionInfo, pCompatibility);
 	}
 #endif
 #if (defined(VK_EXT_opacity_micromap))
 	void getMicromapBuildSizesEXT(VkAccelerationStructureBuildTypeKHR buildType, const VkMicromapBuildInfoEXT* pBuildInfo, VkMicromapBuildSizesInfoEXT* pSizeInfo) const noexcept {
-		fp_vkGetMicromapBuildSizesEXT(device, buildType, pBuildInfo, pSizeInfo);
+		load(fp_vkGetMicromapBuildSizesEXT, 415, "vkGetMicromapBuildSizesEXT")(device, buildType, pBuildInfo, pSizeInfo);
 	}
 #endif
 #if (defined(VK_EXT_shader_module_identifier))
 	void getShaderModuleIdentifierEXT(VkShaderModule shaderModule, VkShaderModuleIdentifierEXT* pIdentifier) const noexcept {
-		fp_vkGetShaderModuleIdentifierEXT(device, shaderModule, pIdentifier);
+		load(fp_vkGetShaderModuleIdentifierEXT, 416, "vkGetShaderModuleIdentifierEXT")(device, shaderModule, pIdentifier);
 	}
 #endif
 #if (defined(VK_EXT_shader_module_identifier))
 	void getShaderModuleCreateInfoIdentifierEXT(const VkShaderModuleCreateInfo* pCreateInfo, VkShaderModuleIdentifierEXT* pIdentifier) const noexcept {
-		fp_vkGetShaderModuleCreateInfoIdentifierEXT(device, pCreateInfo, pIdentifier);
+		load(fp_vkGetShaderModuleCreateInfoIdentifierEXT, 417, "vkGetShaderModuleCreateInfoIdentifierEXT")(device, pCreateInfo, pIdentifier);
 	}
 #endif
 #if (defined(VK_EXT_image_compression_control))
 	void getImageSubresourceLayout2EXT(VkImage image, const VkImageSubresource2EXT* pSubresource, VkSubresourceLayout2EXT* pLayout) const noexcept {
-		fp_vkGetImageSubresourceLayout2EXT(device, image, pSubresource, pLayout);
+		load(fp_vkGetImageSubresourceLayout2EXT, 418, "vkGetImageSubresourceLayout2EXT")(device, image, pSubresource, pLayout);
 	}
 #endif
 #if (defined(VK_EXT_pipeline_properties))
 	VkResult getPipelinePropertiesEXT(const VkPipelineInfoEXT* pPipelineInfo, VkBaseOutStructure* pPipelineProperties) const noexcept {
-		return fp_vkGetPipelinePropertiesEXT(device, pPipelineInfo, pPipelineProperties);
+		return load(fp_vkGetPipelinePropertiesEXT, 419, "vkGetPipelinePropertiesEXT")(device, pPipelineInfo, pPipelineProperties);
 	}
 #endif
 #if (defined(VK_EXT_metal_objects))
 	void exportMetalObjectsEXT(VkExportMetalObjectsInfoEXT* pMetalObjectsInfo) const noexcept {
-		fp_vkExportMetalObjectsEXT(device, pMetalObjectsInfo);
+		load(fp_vkExportMetalObjectsEXT, 420, "vkExportMetalObjectsEXT")(device, pMetalObjectsInfo);
 	}
 #endif
 #if (defined(VK_QCOM_tile_properties))
 	VkResult getFramebufferTilePropertiesQCOM(VkFramebuffer framebuffer, uint32_t* pPropertiesCount, VkTilePropertiesQCOM* pProperties) const noexcept {
-		return fp_vkGetFramebufferTilePropertiesQCOM(device, framebuffer, pPropertiesCount, pProperties);
+		return load(fp_vkGetFramebufferTilePropertiesQCOM, 421, "vkGetFramebufferTilePropertiesQCOM")(device, framebuffer, pPropertiesCount, pProperties);
 	}
 #endif
 #if (defined(VK_QCOM_tile_properties))
 	VkResult getDynamicRenderingTilePropertiesQCOM(const VkRenderingInfoKHR* pRenderingInfo, VkTilePropertiesQCOM* pProperties) const noexcept {
-		return fp_vkGetDynamicRenderingTilePropertiesQCOM(device, pRenderingInfo, pProperties);
+		return load(fp_vkGetDynamicRenderingTilePropertiesQCOM, 422, "vkGetDynamicRenderingTilePropertiesQCOM")(device, pRenderingInfo, pProperties);
 	}
 #endif
 #if (defined(VK_NV_optical_flow))
 	VkResult createOpticalFlowSessionNV(const VkOpticalFlowSessionCreateInfoNV* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkOpticalFlowSessionNV* pSession) const noexcept {
-		return fp_vkCreateOpticalFlowSessionNV(device, pCreateInfo, pAllocator, pSession);
+		return load(fp_vkCreateOpticalFlowSessionNV, 423, "vkCreateOpticalFlowSessionNV")(device, pCreateInfo, pAllocator, pSession);
 	}
 #endif
 #if (defined(VK_NV_optical_flow))
 	void destroyOpticalFlowSessionNV(VkOpticalFlowSessionNV session, const VkAllocationCallbacks* pAllocator) const noexcept {
-		fp_vkDestroyOpticalFlowSessionNV(device, session, pAllocator);
+		load(fp_vkDestroyOpticalFlowSessionNV, 424, "vkDestroyOpticalFlowSessionNV")(device, session, pAllocator);
 	}
 #endif
 #if (defined(VK_NV_optical_flow))
 	VkResult bindOpticalFlowSessionImageNV(VkOpticalFlowSessionNV session, VkOpticalFlowSessionBindingPointNV bindingPoint, VkImageView view, VkImageLayout layout) const noexcept {
-		return fp_vkBindOpticalFlowSessionImageNV(device, session, bindingPoint, view, layout);
+		return load(fp_vkBindOpticalFlowSessionImageNV, 425, "vkBindOpticalFlowSessionImageNV")(device, session, bindingPoint, view, layout);
 	}
 #endif
 #if (defined(VK_NV_optical_flow))
 	void cmdOpticalFlowExecuteNV(VkCommandBuffer commandBuffer, VkOpticalFlowSessionNV session, const VkOpticalFlowExecuteInfoNV* pExecuteInfo) const noexcept {
-		fp_vkCmdOpticalFlowExecuteNV(commandBuffer, session, pExecuteInfo);
+		load(fp_vkCmdOpticalFlowExecuteNV, 426, "vkCmdOpticalFlowExecuteNV")(commandBuffer, session, pExecuteInfo);
 	}
 #endif
 #if (defined(VK_EXT_device_fault))
 	VkResult getDeviceFaultInfoEXT(VkDeviceFaultCountsEXT* pFaultCounts, VkDeviceFaultInfoEXT* pFaultInfo) const noexcept {
-		return fp_vkGetDeviceFaultInfoEXT(device, pFaultCounts, pFaultInfo);
+		return load(fp_vkGetDeviceFaultInfoEXT, 427, "vkGetDeviceFaultInfoEXT")(device, pFaultCounts, pFaultInfo);
 	}
 #endif
 #if (defined(VK_EXT_host_query_reset))
 	void resetQueryPoolEXT(VkQueryPool queryPool, uint32_t firstQuery, uint32_t queryCount) const noexcept {
-		fp_vkResetQueryPoolEXT(device, queryPool, firstQuery, queryCount);
+		load(fp_vkResetQueryPoolEXT, 428, "vkResetQueryPoolEXT")(device, queryPool, firstQuery, queryCount);
 	}
 #endif
 #if (defined(VK_KHR_maintenance1))
 	void trimCommandPoolKHR(VkCommandPool commandPool, VkCommandPoolTrimFlagsKHR flags) const noexcept {
-		fp_vkTrimCommandPoolKHR(device, commandPool, flags);
+		load(fp_vkTrimCommandPoolKHR, 429, "vkTrimCommandPoolKHR")(device, commandPool, flags);
 	}
 #endif
 #if (defined(VK_KHR_device_group))
 	void getDeviceGroupPeerMemoryFeaturesKHR(uint32_t heapIndex, uint32_t localDeviceIndex, uint32_t remoteDeviceIndex, VkPeerMemoryFeatureFlagsKHR* pPeerMemoryFeatures) const noexcept {
-		fp_vkGetDeviceGroupPeerMemoryFeaturesKHR(device, heapIndex, localDeviceIndex, remoteDeviceIndex, pPeerMemoryFeatures);
+		load(fp_vkGetDeviceGroupPeerMemoryFeaturesKHR, 430, "vkGetDeviceGroupPeerMemoryFeaturesKHR")(device, heapIndex, localDeviceIndex, remoteDeviceIndex, pPeerMemoryFeatures);
 	}
 #endif
 #if (defined(VK_KHR_bind_memory2))
 	VkResult bindBufferMemory2KHR(uint32_t bindInfoCount, const VkBindBufferMemoryInfoKHR* pBindInfos) const noexcept {
-		return fp_vkBindBufferMemory2KHR(device, bindInfoCount, pBindInfos);
+		return load(fp_vkBindBufferMemory2KHR, 431, "vkBindBufferMemory2KHR")(device, bindInfoCount, pBindInfos);
 	}
 #endif
 #if (defined(VK_KHR_bind_memory2))
 	VkResult bindImageMemory2KHR(uint32_t bindInfoCount, const VkBindImageMemoryInfoKHR* pBindInfos) const noexcept {
-		return fp_vkBindImageMemory2KHR(device, bindInfoCount, pBindInfos);
+		return load(fp_vkBindImageMemory2KHR, 432, "vkBindImageMemory2KHR")(device, bindInfoCount, pBindInfos);
 	}
 #endif
 #if (defined(VK_KHR_device_group))
 	void cmdSetDeviceMaskKHR(VkCommandBuffer commandBuffer, uint32_t deviceMask) const noexcept {
-		fp_vkCmdSetDeviceMaskKHR(commandBuffer, deviceMask);
+		load(fp_vkCmdSetDeviceMaskKHR, 433, "vkCmdSetDeviceMaskKHR")(commandBuffer, deviceMask);
 	}
 #endif
 #if (defined(VK_KHR_device_group))
 	void cmdDispatchBaseKHR(VkCommandBuffer commandBuffer, uint32_t baseGroupX, uint32_t baseGroupY, uint32_t baseGroupZ, uint32_t groupCountX, uint32_t groupCountY, uint32_t groupCountZ) const noexcept {
-		fp_vkCmdDispatchBaseKHR(commandBuffer, baseGroupX, baseGroupY, baseGroupZ, groupCountX, groupCountY, groupCountZ);
+		load(fp_vkCmdDispatchBaseKHR, 434, "vkCmdDispatchBaseKHR")(commandBuffer, baseGroupX, baseGroupY, baseGroupZ, groupCountX, groupCountY, groupCountZ);
 	}
 #endif
 #if (defined(VK_KHR_descriptor_update_template))
 	VkResult createDescriptorUpdateTemplateKHR(const VkDescriptorUpdateTemplateCreateInfoKHR* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkDescriptorUpdateTemplateKHR* pDescriptorUpdateTemplate) const noexcept {
-		return fp_vkCreateDescriptorUpdateTemplateKHR(device, pCreateInfo, pAllocator, pDescriptorUpdateTemplate);
+		return load(fp_vkCreateDescriptorUpdateTemplateKHR, 435, "vkCreateDescriptorUpdateTemplateKHR")(device, pCreateInfo, pAllocator, pDescriptorUpdateTemplate);
 	}
 #endif
 #if (defined(VK_KHR_descriptor_update_template))
 	void destroyDescriptorUpdateTemplateKHR(VkDescriptorUpdateTemplateKHR descriptorUpdateTemplate, const VkAllocationCallbacks* pAllocator) const noexcept {
-		fp_vkDestroyDescriptorUpdateTemplateKHR(device, descriptorUpdateTemplate, pAllocator);
+		load(fp_vkDestroyDescriptorUpdateTemplateKHR, 436, "vkDestroyDescriptorUpdateTemplateKHR")(device, descriptorUpdateTemplate, pAllocator);
 	}
 #endif
 #if (defined(VK_KHR_descriptor_update_template))
 	void updateDescriptorSetWithTemplateKHR(VkDescriptorSet descriptorSet, VkDescriptorUpdateTemplateKHR descriptorUpdateTemplate, const void* pData) const noexcept {
-		fp_vkUpdateDescriptorSetWithTemplateKHR(device, descriptorSet, descriptorUpdateTemplate, pData);
+		load(fp_vkUpdateDescriptorSetWithTemplateKHR, 437, "vkUpdateDescriptorSetWithTemplateKHR")(device, descriptorSet, descriptorUpdateTemplate, pData);
 	}
 #endif
 #if (defined(VK_KHR_get_memory_requirements2))
 	void getBufferMemoryRequirements2KHR(const VkBufferMemoryRequirementsInfo2KHR* pInfo, VkMemoryRequirements2KHR* pMemoryRequirements) const noexcept {
-		fp_vkGetBufferMemoryRequirements2KHR(device, pInfo, pMemoryRequirements);
+		load(fp_vkGetBufferMemoryRequirements2KHR, 438, "vkGetBufferMemoryRequirements2KHR")(device, pInfo, pMemoryRequirements);
 	}
 #endif
 #if (defined(VK_KHR_get_memory_requirements2))
 	void getImageMemoryRequirements2KHR(const VkImageMemoryRequirementsInfo2KHR* pInfo, VkMemoryRequirements2KHR* pMemoryRequirements) const noexcept {
-		fp_vkGetImageMemoryRequirements2KHR(device, pInfo, pMemoryRequirements);
+		load(fp_vkGetImageMemoryRequirements2KHR, 439, "vkGetImageMemoryRequirements2KHR")(device, pInfo, pMemoryRequirements);
 	}
 #endif
 #if (defined(VK_KHR_get_memory_requirements2))
 	void getImageSparseMemoryRequirements2KHR(const VkImageSparseMemoryRequirementsInfo2KHR* pInfo, uint32_t* pSparseMemoryRequirementCount, VkSparseImageMemoryRequirements2KHR* pSparseMemoryRequirements) const noexcept {
-		fp_vkGetImageSparseMemoryRequirements2KHR(device, pInfo, pSparseMemoryRequirementCount, pSparseMemoryRequirements);
+		load(fp_vkGetImageSparseMemoryRequirements2KHR, 440, "vkGetImageSparseMemoryRequirements2KHR")(device, pInfo, pSparseMemoryRequirementCount, pSparseMemoryRequirements);
 	}
 #endif
 #if (defined(VK_KHR_maintenance4))
 	void getDeviceBufferMemoryRequirementsKHR(const VkDeviceBufferMemoryRequirementsKHR* pInfo, VkMemoryRequirements2KHR* pMemoryRequirements) const noexcept {
-		fp_vkGetDeviceBufferMemoryRequirementsKHR(device, pInfo, pMemoryRequirements);
+		load(fp_vkGetDeviceBufferMemoryRequirementsKHR, 441, "vkGetDeviceBufferMemoryRequirementsKHR")(device, pInfo, pMemoryRequirements);
 	}
 #endif
 #if (defined(VK_KHR_maintenance4))
 	void getDeviceImageMemoryRequirementsKHR(const VkDeviceImageMemoryRequirementsKHR* pInfo, VkMemoryRequirements2KHR* pMemoryRequirements) const noexcept {
-		fp_vkGetDeviceImageMemoryRequirementsKHR(device, pInfo, pMemoryRequirements);
+		load(fp_vkGetDeviceImageMemoryRequirementsKHR, 442, "vkGetDeviceImageMemoryRequirementsKHR")(device, pInfo, pMemoryRequirements);
 	}
 #endif
 #if (defined(VK_KHR_maintenance4))
 	void getDeviceImageSparseMemoryRequirementsKHR(const VkDeviceImageMemoryRequirementsKHR* pInfo, uint32_t* pSparseMemoryRequirementCount, VkSparseImageMemoryRequirements2KHR* pSparseMemoryRequirements) const noexcept {
-		fp_vkGetDeviceImageSparseMemoryRequirementsKHR(device, pInfo, pSparseMemoryRequirementCount, pSparseMemoryRequirements);
+		load(fp_vkGetDeviceImageSparseMemoryRequirementsKHR, 443, "vkGetDeviceImageSparseMemoryRequirementsKHR")(device, pInfo, pSparseMemoryRequirementCount, pSparseMemoryRequirements);
 	}
 #endif
 #if (defined(VK_KHR_sampler_ycbcr_conversion))
 	VkResult createSamplerYcbcrConversionKHR(const VkSamplerYcbcrConversionCreateInfoKHR* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkSamplerYcbcrConversionKHR* pYcbcrConversion) const noexcept {
-		return fp_vkCreateSamplerYcbcrConversionKHR(device, pCreateInfo, pAllocator, pYcbcrConversion);
+		return load(fp_vkCreateSamplerYcbcrConversionKHR, 444, "vkCreateSamplerYcbcrConversionKHR")(device, pCreateInfo, pAllocator, pYcbcrConversion);
 	}
 #endif
 #if (defined(VK_KHR_sampler_ycbcr_conversion))
 	void destroySamplerYcbcrConversionKHR(VkSamplerYcbcrConversionKHR ycbcrConversion, const VkAllocationCallbacks* pAllocator) const noexcept {
-		fp_vkDestroySamplerYcbcrConversionKHR(device, ycbcrConversion, pAllocator);
+		load(fp_vkDestroySamplerYcbcrConversionKHR, 445, "vkDestroySamplerYcbcrConversionKHR")(device, ycbcrConversion, pAllocator);
 	}
 #endif
 #if (defined(VK_KHR_maintenance3))
 	void getDescriptorSetLayoutSupportKHR(const VkDescriptorSetLayoutCreateInfo* pCreateInfo, VkDescriptorSetLayoutSupportKHR* pSupport) const noexcept {
-		fp_vkGetDescriptorSetLayoutSupportKHR(device, pCreateInfo, pSupport);
+		load(fp_vkGetDescriptorSetLayoutSupportKHR, 446, "vkGetDescriptorSetLayoutSupportKHR")(device, pCreateInfo, pSupport);
 	}
 #endif
 #if (defined(VK_KHR_create_renderpass2))
 	VkResult createRenderPass2KHR(const VkRenderPassCreateInfo2KHR* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkRenderPass* pRenderPass) const noexcept {
-		return fp_vkCreateRenderPass2KHR(device, pCreateInfo, pAllocator, pRenderPass);
+		return load(fp_vkCreateRenderPass2KHR, 447, "vkCreateRenderPass2KHR")(device, pCreateInfo, pAllocator, pRenderPass);
 	}
 #endif
 #if (defined(VK_KHR_create_renderpass2))
 	void cmdBeginRenderPass2KHR(VkCommandBuffer commandBuffer, const VkRenderPassBeginInfo* pRenderPassBegin, const VkSubpassBeginInfoKHR* pSubpassBeginInfo) const noexcept {
-		fp_vkCmdBeginRenderPass2KHR(commandBuffer, pRenderPassBegin, pSubpassBeginInfo);
+		load(fp_vkCmdBeginRenderPass2KHR, 448, "vkCmdBeginRenderPass2KHR")(commandBuffer, pRenderPassBegin, pSubpassBeginInfo);
 	}
 #endif
 #if (defined(VK_KHR_create_renderpass2))
 	void cmdNextSubpass2KHR(VkCommandBuffer commandBuffer, const VkSubpassBeginInfoKHR* pSubpassBeginInfo, const VkSubpassEndInfoKHR* pSubpassEndInfo) const noexcept {
-		fp_vkCmdNextSubpass2KHR(commandBuffer, pSubpassBeginInfo, pSubpassEndInfo);
+		load(fp_vkCmdNextSubpass2KHR, 449, "vkCmdNextSubpass2KHR")(commandBuffer, pSubpassBeginInfo, pSubpassEndInfo);
 	}
 #endif
 #if (defined(VK_KHR_create_renderpass2))
 	void cmdEndRenderPass2KHR(VkCommandBuffer commandBuffer, const VkSubpassEndInfoKHR* pSubpassEndInfo) const noexcept {
-		fp_vkCmdEndRenderPass2KHR(commandBuffer, pSubpassEndInfo);
+		load(fp_vkCmdEndRenderPass2KHR, 450, "vkCmdEndRenderPass2KHR")(commandBuffer, pSubpassEndInfo);
 	}
 #endif
 #if (defined(VK_KHR_timeline_semaphore))
 	VkResult getSemaphoreCounterValueKHR(VkSemaphore semaphore, uint64_t* pValue) const noexcept {
-		return fp_vkGetSemaphoreCounterValueKHR(device, semaphore, pValue);
+		return load(fp_vkGetSemaphoreCounterValueKHR, 451, "vkGetSemaphoreCounterValueKHR")(device, semaphore, pValue);
 	}
 #endif
 #if (defined(VK_KHR_timeline_semaphore))
 	VkResult waitSemaphoresKHR(const VkSemaphoreWaitInfoKHR* pWaitInfo, uint64_t timeout) const noexcept {
-		return fp_vkWaitSemaphoresKHR(device, pWaitInfo, timeout);
+		return load(fp_vkWaitSemaphoresKHR, 452, "vkWaitSemaphoresKHR")(device, pWaitInfo, timeout);
 	}
 #endif
 #if (defined(VK_KHR_timeline_semaphore))
 	VkResult signalSemaphoreKHR(const VkSemaphoreSignalInfoKHR* pSignalInfo) const noexcept {
-		return fp_vkSignalSemaphoreKHR(device, pSignalInfo);
+		return load(fp_vkSignalSemaphoreKHR, 453, "vkSignalSemaphoreKHR")(device, pSignalInfo);
 	}
 #endif
 #if (defined(VK_AMD_draw_indirect_count))
 	void cmdDrawIndirectCountAMD(VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset, VkBuffer countBuffer, VkDeviceSize countBufferOffset, uint32_t maxDrawCount, uint32_t stride) const noexcept {
-		fp_vkCmdDrawIndirectCountAMD(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
+		load(fp_vkCmdDrawIndirectCountAMD, 454, "vkCmdDrawIndirectCountAMD")(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
 	}
 #endif
 #if (defined(VK_AMD_draw_indirect_count))
 	void cmdDrawIndexedIndirectCountAMD(VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset, VkBuffer countBuffer, VkDeviceSize countBufferOffset, uint32_t maxDrawCount, uint32_t stride) const noexcept {
-		fp_vkCmdDrawIndexedIndirectCountAMD(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
+		load(fp_vkCmdDrawIndexedIndirectCountAMD, 455, "vkCmdDrawIndexedIndirectCountAMD")(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
 	}
 #endif
 #if (defined(VK_NV_ray_tracing))
 	VkResult getRayTracingShaderGroupHandlesNV(VkPipeline pipeline, uint32_t firstGroup, uint32_t groupCount, size_t dataSize, void* pData) const noexcept {
-		return fp_vkGetRayTracingShaderGroupHandlesNV(device, pipeline, firstGroup, groupCount, dataSize, pData);
+		return load(fp_vkGetRayTracingShaderGroupHandlesNV, 456, "vkGetRayTracingShaderGroupHandlesNV")(device, pipeline, firstGroup, groupCount, dataSize, pData);
 	}
 #endif
 #if (defined(VK_KHR_buffer_device_address))
 	uint64_t getBufferOpaqueCaptureAddressKHR(const VkBufferDeviceAddressInfoEXT* pInfo) const noexcept {
-		return fp_vkGetBufferOpaqueCaptureAddressKHR(device, pInfo);
+		return load(fp_vkGetBufferOpaqueCaptureAddressKHR, 457, "vkGetBufferOpaqueCaptureAddressKHR")(device, pInfo);
 	}
 #endif
 #if (defined(VK_EXT_buffer_device_address))
 	VkDeviceAddress getBufferDeviceAddressEXT(const VkBufferDeviceAddressInfoEXT* pInfo) const noexcept {
-		return fp_vkGetBufferDeviceAddressEXT(device, pInfo);
+		return load(fp_vkGetBufferDeviceAddressEXT, 458, "vkGetBufferDeviceAddressEXT")(device, pInfo);
 	}
 #endif
 #if (defined(VK_KHR_buffer_device_address))
 	uint64_t getDeviceMemoryOpaqueCaptureAddressKHR(const VkDeviceMemoryOpaqueCaptureAddressInfoKHR* pInfo) const noexcept {
-		return fp_vkGetDeviceMemoryOpaqueCaptureAddressKHR(device, pInfo);
+		return load(fp_vkGetDeviceMemoryOpaqueCaptureAddressKHR, 459, "vkGetDeviceMemoryOpaqueCaptureAddressKHR")(device, pInfo);
 	}
 #endif
 #if (defined(VK_EXT_extended_dynamic_state))
 	void cmdSetCullModeEXT(VkCommandBuffer commandBuffer, VkCullModeFlags cullMode) const noexcept {
-		fp_vkCmdSetCullModeEXT(commandBuffer, cullMode);
+		load(fp_vkCmdSetCullModeEXT, 460, "vkCmdSetCullModeEXT")(commandBuffer, cullMode);
 	}
 #endif
 #if (defined(VK_EXT_extended_dynamic_state))
 	void cmdSetFrontFaceEXT(VkCommandBuffer commandBuffer, VkFrontFace frontFace) const noexcept {
-		fp_vkCmdSetFrontFaceEXT(commandBuffer, frontFace);
+		load(fp_vkCmdSetFrontFaceEXT, 461, "vkCmdSetFrontFaceEXT")(commandBuffer, frontFace);
 	}
 #endif
 #if (defined(VK_EXT_extended_dynamic_state))
 	void cmdSetPrimitiveTopologyEXT(VkCommandBuffer commandBuffer, VkPrimitiveTopology primitiveTopology) const noexcept {
-		fp_vkCmdSetPrimitiveTopologyEXT(commandBuffer, primitiveTopology);
+		load(fp_vkCmdSetPrimitiveTopologyEXT, 462, "vkCmdSetPrimitiveTopologyEXT")(commandBuffer, primitiveTopology);
 	}
 #endif
 #if (defined(VK_EXT_extended_dynamic_state))
 	void cmdSetViewportWithCountEXT(VkCommandBuffer commandBuffer, uint32_t viewportCount, const VkViewport* pViewports) const noexcept {
-		fp_vkCmdSetViewportWithCountEXT(commandBuffer, viewportCount, pViewports);
+		load(fp_vkCmdSetViewportWithCountEXT, 463, "vkCmdSetViewportWithCountEXT")(commandBuffer, viewportCount, pViewports);
 	}
 #endif
 #if (defined(VK_EXT_extended_dynamic_state))
 	void cmdSetScissorWithCountEXT(VkCommandBuffer commandBuffer, uint32_t scissorCount, const VkRect2D* pScissors) const noexcept {
-		fp_vkCmdSetScissorWithCountEXT(commandBuffer, scissorCount, pScissors);
+		load(fp_vkCmdSetScissorWithCountEXT, 464, "vkCmdSetScissorWithCountEXT")(commandBuffer, scissorCount, pScissors);
 	}
 #endif
 #if (defined(VK_EXT_extended_dynamic_state))
 	void cmdBindVertexBuffers2EXT(VkCommandBuffer commandBuffer, uint32_t firstBinding, uint32_t bindingCount, const VkBuffer* pBuffers, const VkDeviceSize* pOffsets, const VkDeviceSize* pSizes, const VkDeviceSize* pStrides) const noexcept {
-		fp_vkCmdBindVertexBuffers2EXT(commandBuffer, firstBinding, bindingCount, pBuffers, pOffsets, pSizes, pStrides);
+		load(fp_vkCmdBindVertexBuffers2EXT, 465, "vkCmdBindVertexBuffers2EXT")(commandBuffer, firstBinding, bindingCount, pBuffers, pOffsets, pSizes, pStrides);
 	}
 #endif
 #if (defined(VK_EXT_extended_dynamic_state))
 	void cmdSetDepthTestEnableEXT(VkCommandBuffer commandBuffer, VkBool32 depthTestEnable) const noexcept {
-		fp_vkCmdSetDepthTestEnableEXT(commandBuffer, depthTestEnable);
+		load(fp_vkCmdSetDepthTestEnableEXT, 466, "vkCmdSetDepthTestEnableEXT")(commandBuffer, depthTestEnable);
 	}
 #endif
 #if (defined(VK_EXT_extended_dynamic_state))
 	void cmdSetDepthWriteEnableEXT(VkCommandBuffer commandBuffer, VkBool32 depthWriteEnable) const noexcept {
-		fp_vkCmdSetDepthWriteEnableEXT(commandBuffer, depthWriteEnable);
+		load(fp_vkCmdSetDepthWriteEnableEXT, 467, "vkCmdSetDepthWriteEnableEXT")(commandBuffer, depthWriteEnable);
 	}
 #endif
 #if (defined(VK_EXT_extended_dynamic_state))
 	void cmdSetDepthCompareOpEXT(VkCommandBuffer commandBuffer, VkCompareOp depthCompareOp) const noexcept {
-		fp_vkCmdSetDepthCompareOpEXT(commandBuffer, depthCompareOp);
+		load(fp_vkCmdSetDepthCompareOpEXT, 468, "vkCmdSetDepthCompareOpEXT")(commandBuffer, depthCompareOp);
 	}
 #endif
 #if (defined(VK_EXT_extended_dynamic_state))
 	void cmdSetDepthBoundsTestEnableEXT(VkCommandBuffer commandBuffer, VkBool32 depthBoundsTestEnable) const noexcept {
-		fp_vkCmdSetDepthBoundsTestEnableEXT(commandBuffer, depthBoundsTestEnable);
+		load(fp_vkCmdSetDepthBoundsTestEnableEXT, 469, "vkCmdSetDepthBoundsTestEnableEXT")(commandBuffer, depthBoundsTestEnable);
 	}
 #endif
 #if (defined(VK_EXT_extended_dynamic_state))
 	void cmdSetStencilTestEnableEXT(VkCommandBuffer commandBuffer, VkBool32 stencilTestEnable) const noexcept {
-		fp_vkCmdSetStencilTestEnableEXT(commandBuffer, stencilTestEnable);
+		load(fp_vkCmdSetStencilTestEnableEXT, 470, "vkCmdSetStencilTestEnableEXT")(commandBuffer, stencilTestEnable);
 	}
 #endif
 #if (defined(VK_EXT_extended_dynamic_state))
 	void cmdSetStencilOpEXT(VkCommandBuffer commandBuffer, VkStencilFaceFlags faceMask, VkStencilOp failOp, VkStencilOp passOp, VkStencilOp depthFailOp, VkCompareOp compareOp) const noexcept {
-		fp_vkCmdSetStencilOpEXT(commandBuffer, faceMask, failOp, passOp, depthFailOp, compareOp);
+		load(fp_vkCmdSetStencilOpEXT, 471, "vkCmdSetStencilOpEXT")(commandBuffer, faceMask, failOp, passOp, depthFailOp, compareOp);
 	}
 #endif
 #if (defined(VK_EXT_extended_dynamic_state2))
 	void cmdSetRasterizerDiscardEnableEXT(VkCommandBuffer commandBuffer, VkBool32 rasterizerDiscardEnable) const noexcept {
-		fp_vkCmdSetRasterizerDiscardEnableEXT(commandBuffer, rasterizerDiscardEnable);
+		load(fp_vkCmdSetRasterizerDiscardEnableEXT, 472, "vkCmdSetRasterizerDiscardEnableEXT")(commandBuffer, rasterizerDiscardEnable);
 	}
 #endif
 #if (defined(VK_EXT_extended_dynamic_state2))
 	void cmdSetDepthBiasEnableEXT(VkCommandBuffer commandBuffer, VkBool32 depthBiasEnable) const noexcept {
-		fp_vkCmdSetDepthBiasEnableEXT(commandBuffer, depthBiasEnable);
+		load(fp_vkCmdSetDepthBiasEnableEXT, 473, "vkCmdSetDepthBiasEnableEXT")(commandBuffer, depthBiasEnable);
 	}
 #endif
 #if (defined(VK_EXT_extended_dynamic_state2))
 	void cmdSetPrimitiveRestartEnableEXT(VkCommandBuffer commandBuffer, VkBool32 primitiveRestartEnable) const noexcept {
-		fp_vkCmdSetPrimitiveRestartEnableEXT(commandBuffer, primitiveRestartEnable);
+		load(fp_vkCmdSetPrimitiveRestartEnableEXT, 474, "vkCmdSetPrimitiveRestartEnableEXT")(commandBuffer, primitiveRestartEnable);
 	}
 #endif
 #if (defined(VK_EXT_private_data))
 	VkResult createPrivateDataSlotEXT(const VkPrivateDataSlotCreateInfoEXT* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkPrivateDataSlotEXT* pPrivateDataSlot) const noexcept {
-		return fp_vkCreatePrivateDataSlotEXT(device, pCreateInfo, pAllocator, pPrivateDataSlot);
+		return load(fp_vkCreatePrivateDataSlotEXT, 475, "vkCreatePrivateDataSlotEXT")(device, pCreateInfo, pAllocator, pPrivateDataSlot);
 	}
 #endif
 #if (defined(VK_EXT_private_data))
 	void destroyPrivateDataSlotEXT(VkPrivateDataSlotEXT privateDataSlot, const VkAllocationCallbacks* pAllocator) const noexcept {
-		fp_vkDestroyPrivateDataSlotEXT(device, privateDataSlot, pAllocator);
+		load(fp_vkDestroyPrivateDataSlotEXT, 476, "vkDestroyPrivateDataSlotEXT")(device, privateDataSlot, pAllocator);
 	}
 #endif
 #if (defined(VK_EXT_private_data))
 	VkResult setPrivateDataEXT(VkObjectType objectType, uint64_t objectHandle, VkPrivateDataSlotEXT privateDataSlot, uint64_t data) const noexcept {
-		return fp_vkSetPrivateDataEXT(device, objectType, objectHandle, privateDataSlot, data);
+		return load(fp_vkSetPrivateDataEXT, 477, "vkSetPrivateDataEXT")(device, objectType, objectHandle, privateDataSlot, data);
 	}
 #endif
 #if (defined(VK_EXT_private_data))
 	void getPrivateDataEXT(VkObjectType objectType, uint64_t objectHandle, VkPrivateDataSlotEXT privateDataSlot, uint64_t* pData) const noexcept {
-		fp_vkGetPrivateDataEXT(device, objectType, objectHandle, privateDataSlot, pData);
+		load(fp_vkGetPrivateDataEXT, 478, "vkGetPrivateDataEXT")(device, objectType, objectHandle, privateDataSlot, pData);
 	}
 #endif
 #if (defined(VK_KHR_copy_commands2))
 	void cmdCopyBuffer2KHR(VkCommandBuffer commandBuffer, const VkCopyBufferInfo2KHR* pCopyBufferInfo) const noexcept {
-		fp_vkCmdCopyBuffer2KHR(commandBuffer, pCopyBufferInfo);
+		load(fp_vkCmdCopyBuffer2KHR, 479, "vkCmdCopyBuffer2KHR")(commandBuffer, pCopyBufferInfo);
 	}
 #endif
 #if (defined(VK_KHR_copy_commands2))
 	void cmdCopyImage2KHR(VkCommandBuffer commandBuffer, const VkCopyImageInfo2KHR* pCopyImageInfo) const noexcept {
-		fp_vkCmdCopyImage2KHR(commandBuffer, pCopyImageInfo);
+		load(fp_vkCmdCopyImage2KHR, 480, "vkCmdCopyImage2KHR")(commandBuffer, pCopyImageInfo);
 	}
 #endif
 #if (defined(VK_KHR_copy_commands2))
 	void cmdBlitImage2KHR(VkCommandBuffer commandBuffer, const VkBlitImageInfo2KHR* pBlitImageInfo) const noexcept {
-		fp_vkCmdBlitImage2KHR(commandBuffer, pBlitImageInfo);
+		load(fp_vkCmdBlitImage2KHR, 481, "vkCmdBlitImage2KHR")(commandBuffer, pBlitImageInfo);
 	}
 #endif
 #if (defined(VK_KHR_copy_commands2))
 	void cmdCopyBufferToImage2KHR(VkCommandBuffer commandBuffer, const VkCopyBufferToImageInfo2KHR* pCopyBufferToImageInfo) const noexcept {
-		fp_vkCmdCopyBufferToImage2KHR(commandBuffer, pCopyBufferToImageInfo);
+		load(fp_vkCmdCopyBufferToImage2KHR, 482, "vkCmdCopyBufferToImage2KHR")(commandBuffer, pCopyBufferToImageInfo);
 	}
 #endif
 #if (defined(VK_KHR_copy_commands2))
 	void cmdCopyImageToBuffer2KHR(VkCommandBuffer commandBuffer, const VkCopyImageToBufferInfo2KHR* pCopyImageToBufferInfo) const noexcept {
-		fp_vkCmdCopyImageToBuffer2KHR(commandBuffer, pCopyImageToBufferInfo);
+		load(fp_vkCmdCopyImageToBuffer2KHR, 483, "vkCmdCopyImageToBuffer2KHR")(commandBuffer, pCopyImageToBufferInfo);
 	}
 #endif
 #if (defined(VK_KHR_copy_commands2))
 	void cmdResolveImage2KHR(VkCommandBuffer commandBuffer, const VkResolveImageInfo2KHR* pResolveImageInfo) const noexcept {
-		fp_vkCmdResolveImage2KHR(commandBuffer, pResolveImageInfo);
+		load(fp_vkCmdResolveImage2KHR, 484, "vkCmdResolveImage2KHR")(commandBuffer, pResolveImageInfo);
 	}
 #endif
 #if (defined(VK_KHR_synchronization2))
 	void cmdSetEvent2KHR(VkCommandBuffer commandBuffer, VkEvent event, const VkDependencyInfoKHR* pDependencyInfo) const noexcept {
-		fp_vkCmdSetEvent2KHR(commandBuffer, event, pDependencyInfo);
+		load(fp_vkCmdSetEvent2KHR, 485, "vkCmdSetEvent2KHR")(commandBuffer, event, pDependencyInfo);
 	}
 #endif
 #if (defined(VK_KHR_synchronization2))
 	void cmdResetEvent2KHR(VkCommandBuffer commandBuffer, VkEvent event, VkPipelineStageFlags2KHR stageMask) const noexcept {
-		fp_vkCmdResetEvent2KHR(commandBuffer, event, stageMask);
+		load(fp_vkCmdResetEvent2KHR, 486, "vkCmdResetEvent2KHR")(commandBuffer, event, stageMask);
 	}
 #endif
 #if (defined(VK_KHR_synchronization2))
 	void cmdWaitEvents2KHR(VkCommandBuffer commandBuffer, uint32_t eventCount, const VkEvent* pEvents, const VkDependencyInfoKHR* pDependencyInfos) const noexcept {
-		fp_vkCmdWaitEvents2KHR(commandBuffer, eventCount, pEvents, pDependencyInfos);
+		load(fp_vkCmdWaitEvents2KHR, 487, "vkCmdWaitEvents2KHR")(commandBuffer, eventCount, pEvents, pDependencyInfos);
 	}
 #endif
 #if (defined(VK_KHR_synchronization2))
 	void cmdPipelineBarrier2KHR(VkCommandBuffer commandBuffer, const VkDependencyInfoKHR* pDependencyInfo) const noexcept {
-		fp_vkCmdPipelineBarrier2KHR(commandBuffer, pDependencyInfo);
+		load(fp_vkCmdPipelineBarrier2KHR, 488, "vkCmdPipelineBarrier2KHR")(commandBuffer, pDependencyInfo);
 	}
 #endif
 #if (defined(VK_KHR_synchronization2))
 	VkResult queueSubmit2KHR(VkQueue queue, uint32_t submitCount, const VkSubmitInfo2KHR* pSubmits, VkFence fence) const noexcept {
-		return fp_vkQueueSubmit2KHR(queue, submitCount, pSubmits, fence);
+		return load(fp_vkQueueSubmit2KHR, 489, "vkQueueSubmit2KHR")(queue, submitCount, pSubmits, fence);
 	}
 #endif
 #if (defined(VK_KHR_synchronization2))
 	void cmdWriteTimestamp2KHR(VkCommandBuffer commandBuffer, VkPipelineStageFlags2KHR stage, VkQueryPool queryPool, uint32_t query) const noexcept {
-		fp_vkCmdWriteTimestamp2KHR(commandBuffer, stage, queryPool, query);
+		load(fp_vkCmdWriteTimestamp2KHR, 490, "vkCmdWriteTimestamp2KHR")(commandBuffer, stage, queryPool, query);
 	}
 #endif
 #if (defined(VK_KHR_dynamic_rendering))
 	void cmdBeginRenderingKHR(VkCommandBuffer commandBuffer, const VkRenderingInfoKHR* pRenderingInfo) const noexcept {
-		fp_vkCmdBeginRenderingKHR(commandBuffer, pRenderingInfo);
+		load(fp_vkCmdBeginRenderingKHR, 491, "vkCmdBeginRenderingKHR")(commandBuffer, pRenderingInfo);
 	}
 #endif
 #if (defined(VK_KHR_dynamic_rendering))
 	void cmdEndRenderingKHR(VkCommandBuffer commandBuffer) const noexcept {
-		fp_vkCmdEndRenderingKHR(commandBuffer);
+		load(fp_vkCmdEndRenderingKHR, 492, "vkCmdEndRenderingKHR")(commandBuffer);
 	}
 #endif
 	PFN_vkGetDeviceQueue fp_vkGetDeviceQueue = nullptr;
@@ -4743,6 +4759,24 @@ struct DispatchTable {
 	VkDevice device = VK_NULL_HANDLE;
 private:
 	 bool populated = false;
+
+	struct LazyEntryPoints {
+		PFN_vkGetDeviceProcAddr procAddr = nullptr;
+		std::atomic<PFN_vkVoidFunction> pointers[493] {};
+	};
+	std::shared_ptr<LazyEntryPoints> lazy;
+
+	// `fp` on tables resolved up front, otherwise the entry point's slot, resolved if it's still empty
+	template <typename T> T load(T fp, size_t index, const char* name) const noexcept {
+		if (fp != nullptr || !lazy) return fp;
+		PFN_vkVoidFunction function = lazy->pointers[index].load(std::memory_order_acquire);
+		if (function == nullptr) {
+			// Threads racing on the first call all resolve the same pointer
+			function = lazy->procAddr(device, name);
+			lazy->pointers[index].store(function, std::memory_order_release);
+		}
+		return reinterpret_cast<T>(function);
+	}
 };
 
 } // namespace vkb
\ No newline at end of file
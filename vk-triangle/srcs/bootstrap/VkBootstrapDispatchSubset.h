@@ -0,0 +1,5742 @@
+//
+//  VkBootstrapDispatchSubset.h
+//  vk-triangle
+//
+//  Generated by tools/generate_dispatch.py from VkBootstrapDispatch.h, do not edit.
+//
+
+#pragma once
+
+#include <cstddef>
+#include <type_traits>
+
+#include <vulkan/vulkan.h>
+
+namespace vkb {
+
+// One tag per device entry point, named after the function without its vk prefix. A tag names the
+// pointer type and the function, and brings the same wrapper as DispatchTable into a DispatchSubset.
+namespace dispatch {
+
+struct GetDeviceQueue {
+	using type = PFN_vkGetDeviceQueue;
+	static constexpr const char* name = "vkGetDeviceQueue";
+	template <typename Table> struct Wrapper {
+		void getDeviceQueue(uint32_t queueFamilyIndex, uint32_t queueIndex, VkQueue* pQueue) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<GetDeviceQueue>()(table.device, queueFamilyIndex, queueIndex, pQueue);
+		}
+	};
+};
+struct QueueSubmit {
+	using type = PFN_vkQueueSubmit;
+	static constexpr const char* name = "vkQueueSubmit";
+	template <typename Table> struct Wrapper {
+		VkResult queueSubmit(VkQueue queue, uint32_t submitCount, const VkSubmitInfo* pSubmits, VkFence fence) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			return table.template get<QueueSubmit>()(queue, submitCount, pSubmits, fence);
+		}
+	};
+};
+struct QueueWaitIdle {
+	using type = PFN_vkQueueWaitIdle;
+	static constexpr const char* name = "vkQueueWaitIdle";
+	template <typename Table> struct Wrapper {
+		VkResult queueWaitIdle(VkQueue queue) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			return table.template get<QueueWaitIdle>()(queue);
+		}
+	};
+};
+struct DeviceWaitIdle {
+	using type = PFN_vkDeviceWaitIdle;
+	static constexpr const char* name = "vkDeviceWaitIdle";
+	template <typename Table> struct Wrapper {
+		VkResult deviceWaitIdle() const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			return table.template get<DeviceWaitIdle>()(table.device);
+		}
+	};
+};
+struct AllocateMemory {
+	using type = PFN_vkAllocateMemory;
+	static constexpr const char* name = "vkAllocateMemory";
+	template <typename Table> struct Wrapper {
+		VkResult allocateMemory(const VkMemoryAllocateInfo* pAllocateInfo, const VkAllocationCallbacks* pAllocator, VkDeviceMemory* pMemory) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			return table.template get<AllocateMemory>()(table.device, pAllocateInfo, pAllocator, pMemory);
+		}
+	};
+};
+struct FreeMemory {
+	using type = PFN_vkFreeMemory;
+	static constexpr const char* name = "vkFreeMemory";
+	template <typename Table> struct Wrapper {
+		void freeMemory(VkDeviceMemory memory, const VkAllocationCallbacks* pAllocator) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<FreeMemory>()(table.device, memory, pAllocator);
+		}
+	};
+};
+struct MapMemory {
+	using type = PFN_vkMapMemory;
+	static constexpr const char* name = "vkMapMemory";
+	template <typename Table> struct Wrapper {
+		VkResult mapMemory(VkDeviceMemory memory, VkDeviceSize offset, VkDeviceSize size, VkMemoryMapFlags flags, void** ppData) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			return table.template get<MapMemory>()(table.device, memory, offset, size, flags, ppData);
+		}
+	};
+};
+struct UnmapMemory {
+	using type = PFN_vkUnmapMemory;
+	static constexpr const char* name = "vkUnmapMemory";
+	template <typename Table> struct Wrapper {
+		void unmapMemory(VkDeviceMemory memory) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<UnmapMemory>()(table.device, memory);
+		}
+	};
+};
+struct FlushMappedMemoryRanges {
+	using type = PFN_vkFlushMappedMemoryRanges;
+	static constexpr const char* name = "vkFlushMappedMemoryRanges";
+	template <typename Table> struct Wrapper {
+		VkResult flushMappedMemoryRanges(uint32_t memoryRangeCount, const VkMappedMemoryRange* pMemoryRanges) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			return table.template get<FlushMappedMemoryRanges>()(table.device, memoryRangeCount, pMemoryRanges);
+		}
+	};
+};
+struct InvalidateMappedMemoryRanges {
+	using type = PFN_vkInvalidateMappedMemoryRanges;
+	static constexpr const char* name = "vkInvalidateMappedMemoryRanges";
+	template <typename Table> struct Wrapper {
+		VkResult invalidateMappedMemoryRanges(uint32_t memoryRangeCount, const VkMappedMemoryRange* pMemoryRanges) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			return table.template get<InvalidateMappedMemoryRanges>()(table.device, memoryRangeCount, pMemoryRanges);
+		}
+	};
+};
+struct GetDeviceMemoryCommitment {
+	using type = PFN_vkGetDeviceMemoryCommitment;
+	static constexpr const char* name = "vkGetDeviceMemoryCommitment";
+	template <typename Table> struct Wrapper {
+		void getDeviceMemoryCommitment(VkDeviceMemory memory, VkDeviceSize* pCommittedMemoryInBytes) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<GetDeviceMemoryCommitment>()(table.device, memory, pCommittedMemoryInBytes);
+		}
+	};
+};
+struct GetBufferMemoryRequirements {
+	using type = PFN_vkGetBufferMemoryRequirements;
+	static constexpr const char* name = "vkGetBufferMemoryRequirements";
+	template <typename Table> struct Wrapper {
+		void getBufferMemoryRequirements(VkBuffer buffer, VkMemoryRequirements* pMemoryRequirements) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<GetBufferMemoryRequirements>()(table.device, buffer, pMemoryRequirements);
+		}
+	};
+};
+struct BindBufferMemory {
+	using type = PFN_vkBindBufferMemory;
+	static constexpr const char* name = "vkBindBufferMemory";
+	template <typename Table> struct Wrapper {
+		VkResult bindBufferMemory(VkBuffer buffer, VkDeviceMemory memory, VkDeviceSize memoryOffset) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			return table.template get<BindBufferMemory>()(table.device, buffer, memory, memoryOffset);
+		}
+	};
+};
+struct GetImageMemoryRequirements {
+	using type = PFN_vkGetImageMemoryRequirements;
+	static constexpr const char* name = "vkGetImageMemoryRequirements";
+	template <typename Table> struct Wrapper {
+		void getImageMemoryRequirements(VkImage image, VkMemoryRequirements* pMemoryRequirements) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<GetImageMemoryRequirements>()(table.device, image, pMemoryRequirements);
+		}
+	};
+};
+struct BindImageMemory {
+	using type = PFN_vkBindImageMemory;
+	static constexpr const char* name = "vkBindImageMemory";
+	template <typename Table> struct Wrapper {
+		VkResult bindImageMemory(VkImage image, VkDeviceMemory memory, VkDeviceSize memoryOffset) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			return table.template get<BindImageMemory>()(table.device, image, memory, memoryOffset);
+		}
+	};
+};
+struct GetImageSparseMemoryRequirements {
+	using type = PFN_vkGetImageSparseMemoryRequirements;
+	static constexpr const char* name = "vkGetImageSparseMemoryRequirements";
+	template <typename Table> struct Wrapper {
+		void getImageSparseMemoryRequirements(VkImage image, uint32_t* pSparseMemoryRequirementCount, VkSparseImageMemoryRequirements* pSparseMemoryRequirements) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<GetImageSparseMemoryRequirements>()(table.device, image, pSparseMemoryRequirementCount, pSparseMemoryRequirements);
+		}
+	};
+};
+struct QueueBindSparse {
+	using type = PFN_vkQueueBindSparse;
+	static constexpr const char* name = "vkQueueBindSparse";
+	template <typename Table> struct Wrapper {
+		VkResult queueBindSparse(VkQueue queue, uint32_t bindInfoCount, const VkBindSparseInfo* pBindInfo, VkFence fence) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			return table.template get<QueueBindSparse>()(queue, bindInfoCount, pBindInfo, fence);
+		}
+	};
+};
+struct CreateFence {
+	using type = PFN_vkCreateFence;
+	static constexpr const char* name = "vkCreateFence";
+	template <typename Table> struct Wrapper {
+		VkResult createFence(const VkFenceCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkFence* pFence) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			return table.template get<CreateFence>()(table.device, pCreateInfo, pAllocator, pFence);
+		}
+	};
+};
+struct DestroyFence {
+	using type = PFN_vkDestroyFence;
+	static constexpr const char* name = "vkDestroyFence";
+	template <typename Table> struct Wrapper {
+		void destroyFence(VkFence fence, const VkAllocationCallbacks* pAllocator) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<DestroyFence>()(table.device, fence, pAllocator);
+		}
+	};
+};
+struct ResetFences {
+	using type = PFN_vkResetFences;
+	static constexpr const char* name = "vkResetFences";
+	template <typename Table> struct Wrapper {
+		VkResult resetFences(uint32_t fenceCount, const VkFence* pFences) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			return table.template get<ResetFences>()(table.device, fenceCount, pFences);
+		}
+	};
+};
+struct GetFenceStatus {
+	using type = PFN_vkGetFenceStatus;
+	static constexpr const char* name = "vkGetFenceStatus";
+	template <typename Table> struct Wrapper {
+		VkResult getFenceStatus(VkFence fence) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			return table.template get<GetFenceStatus>()(table.device, fence);
+		}
+	};
+};
+struct WaitForFences {
+	using type = PFN_vkWaitForFences;
+	static constexpr const char* name = "vkWaitForFences";
+	template <typename Table> struct Wrapper {
+		VkResult waitForFences(uint32_t fenceCount, const VkFence* pFences, VkBool32 waitAll, uint64_t timeout) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			return table.template get<WaitForFences>()(table.device, fenceCount, pFences, waitAll, timeout);
+		}
+	};
+};
+struct CreateSemaphore {
+	using type = PFN_vkCreateSemaphore;
+	static constexpr const char* name = "vkCreateSemaphore";
+	template <typename Table> struct Wrapper {
+		VkResult createSemaphore(const VkSemaphoreCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkSemaphore* pSemaphore) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			return table.template get<CreateSemaphore>()(table.device, pCreateInfo, pAllocator, pSemaphore);
+		}
+	};
+};
+struct DestroySemaphore {
+	using type = PFN_vkDestroySemaphore;
+	static constexpr const char* name = "vkDestroySemaphore";
+	template <typename Table> struct Wrapper {
+		void destroySemaphore(VkSemaphore semaphore, const VkAllocationCallbacks* pAllocator) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<DestroySemaphore>()(table.device, semaphore, pAllocator);
+		}
+	};
+};
+struct CreateEvent {
+	using type = PFN_vkCreateEvent;
+	static constexpr const char* name = "vkCreateEvent";
+	template <typename Table> struct Wrapper {
+		VkResult createEvent(const VkEventCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkEvent* pEvent) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			return table.template get<CreateEvent>()(table.device, pCreateInfo, pAllocator, pEvent);
+		}
+	};
+};
+struct DestroyEvent {
+	using type = PFN_vkDestroyEvent;
+	static constexpr const char* name = "vkDestroyEvent";
+	template <typename Table> struct Wrapper {
+		void destroyEvent(VkEvent event, const VkAllocationCallbacks* pAllocator) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<DestroyEvent>()(table.device, event, pAllocator);
+		}
+	};
+};
+struct GetEventStatus {
+	using type = PFN_vkGetEventStatus;
+	static constexpr const char* name = "vkGetEventStatus";
+	template <typename Table> struct Wrapper {
+		VkResult getEventStatus(VkEvent event) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			return table.template get<GetEventStatus>()(table.device, event);
+		}
+	};
+};
+struct SetEvent {
+	using type = PFN_vkSetEvent;
+	static constexpr const char* name = "vkSetEvent";
+	template <typename Table> struct Wrapper {
+		VkResult setEvent(VkEvent event) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			return table.template get<SetEvent>()(table.device, event);
+		}
+	};
+};
+struct ResetEvent {
+	using type = PFN_vkResetEvent;
+	static constexpr const char* name = "vkResetEvent";
+	template <typename Table> struct Wrapper {
+		VkResult resetEvent(VkEvent event) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			return table.template get<ResetEvent>()(table.device, event);
+		}
+	};
+};
+struct CreateQueryPool {
+	using type = PFN_vkCreateQueryPool;
+	static constexpr const char* name = "vkCreateQueryPool";
+	template <typename Table> struct Wrapper {
+		VkResult createQueryPool(const VkQueryPoolCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkQueryPool* pQueryPool) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			return table.template get<CreateQueryPool>()(table.device, pCreateInfo, pAllocator, pQueryPool);
+		}
+	};
+};
+struct DestroyQueryPool {
+	using type = PFN_vkDestroyQueryPool;
+	static constexpr const char* name = "vkDestroyQueryPool";
+	template <typename Table> struct Wrapper {
+		void destroyQueryPool(VkQueryPool queryPool, const VkAllocationCallbacks* pAllocator) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<DestroyQueryPool>()(table.device, queryPool, pAllocator);
+		}
+	};
+};
+struct GetQueryPoolResults {
+	using type = PFN_vkGetQueryPoolResults;
+	static constexpr const char* name = "vkGetQueryPoolResults";
+	template <typename Table> struct Wrapper {
+		VkResult getQueryPoolResults(VkQueryPool queryPool, uint32_t firstQuery, uint32_t queryCount, size_t dataSize, void* pData, VkDeviceSize stride, VkQueryResultFlags flags) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			return table.template get<GetQueryPoolResults>()(table.device, queryPool, firstQuery, queryCount, dataSize, pData, stride, flags);
+		}
+	};
+};
+#if (defined(VK_VERSION_1_2))
+struct ResetQueryPool {
+	using type = PFN_vkResetQueryPool;
+	static constexpr const char* name = "vkResetQueryPool";
+	template <typename Table> struct Wrapper {
+		void resetQueryPool(VkQueryPool queryPool, uint32_t firstQuery, uint32_t queryCount) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<ResetQueryPool>()(table.device, queryPool, firstQuery, queryCount);
+		}
+	};
+};
+#endif
+struct CreateBuffer {
+	using type = PFN_vkCreateBuffer;
+	static constexpr const char* name = "vkCreateBuffer";
+	template <typename Table> struct Wrapper {
+		VkResult createBuffer(const VkBufferCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkBuffer* pBuffer) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			return table.template get<CreateBuffer>()(table.device, pCreateInfo, pAllocator, pBuffer);
+		}
+	};
+};
+struct DestroyBuffer {
+	using type = PFN_vkDestroyBuffer;
+	static constexpr const char* name = "vkDestroyBuffer";
+	template <typename Table> struct Wrapper {
+		void destroyBuffer(VkBuffer buffer, const VkAllocationCallbacks* pAllocator) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<DestroyBuffer>()(table.device, buffer, pAllocator);
+		}
+	};
+};
+struct CreateBufferView {
+	using type = PFN_vkCreateBufferView;
+	static constexpr const char* name = "vkCreateBufferView";
+	template <typename Table> struct Wrapper {
+		VkResult createBufferView(const VkBufferViewCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkBufferView* pView) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			return table.template get<CreateBufferView>()(table.device, pCreateInfo, pAllocator, pView);
+		}
+	};
+};
+struct DestroyBufferView {
+	using type = PFN_vkDestroyBufferView;
+	static constexpr const char* name = "vkDestroyBufferView";
+	template <typename Table> struct Wrapper {
+		void destroyBufferView(VkBufferView bufferView, const VkAllocationCallbacks* pAllocator) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<DestroyBufferView>()(table.device, bufferView, pAllocator);
+		}
+	};
+};
+struct CreateImage {
+	using type = PFN_vkCreateImage;
+	static constexpr const char* name = "vkCreateImage";
+	template <typename Table> struct Wrapper {
+		VkResult createImage(const VkImageCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkImage* pImage) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			return table.template get<CreateImage>()(table.device, pCreateInfo, pAllocator, pImage);
+		}
+	};
+};
+struct DestroyImage {
+	using type = PFN_vkDestroyImage;
+	static constexpr const char* name = "vkDestroyImage";
+	template <typename Table> struct Wrapper {
+		void destroyImage(VkImage image, const VkAllocationCallbacks* pAllocator) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<DestroyImage>()(table.device, image, pAllocator);
+		}
+	};
+};
+struct GetImageSubresourceLayout {
+	using type = PFN_vkGetImageSubresourceLayout;
+	static constexpr const char* name = "vkGetImageSubresourceLayout";
+	template <typename Table> struct Wrapper {
+		void getImageSubresourceLayout(VkImage image, const VkImageSubresource* pSubresource, VkSubresourceLayout* pLayout) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<GetImageSubresourceLayout>()(table.device, image, pSubresource, pLayout);
+		}
+	};
+};
+struct CreateImageView {
+	using type = PFN_vkCreateImageView;
+	static constexpr const char* name = "vkCreateImageView";
+	template <typename Table> struct Wrapper {
+		VkResult createImageView(const VkImageViewCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkImageView* pView) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			return table.template get<CreateImageView>()(table.device, pCreateInfo, pAllocator, pView);
+		}
+	};
+};
+struct DestroyImageView {
+	using type = PFN_vkDestroyImageView;
+	static constexpr const char* name = "vkDestroyImageView";
+	template <typename Table> struct Wrapper {
+		void destroyImageView(VkImageView imageView, const VkAllocationCallbacks* pAllocator) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<DestroyImageView>()(table.device, imageView, pAllocator);
+		}
+	};
+};
+struct CreateShaderModule {
+	using type = PFN_vkCreateShaderModule;
+	static constexpr const char* name = "vkCreateShaderModule";
+	template <typename Table> struct Wrapper {
+		VkResult createShaderModule(const VkShaderModuleCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkShaderModule* pShaderModule) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			return table.template get<CreateShaderModule>()(table.device, pCreateInfo, pAllocator, pShaderModule);
+		}
+	};
+};
+struct DestroyShaderModule {
+	using type = PFN_vkDestroyShaderModule;
+	static constexpr const char* name = "vkDestroyShaderModule";
+	template <typename Table> struct Wrapper {
+		void destroyShaderModule(VkShaderModule shaderModule, const VkAllocationCallbacks* pAllocator) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<DestroyShaderModule>()(table.device, shaderModule, pAllocator);
+		}
+	};
+};
+struct CreatePipelineCache {
+	using type = PFN_vkCreatePipelineCache;
+	static constexpr const char* name = "vkCreatePipelineCache";
+	template <typename Table> struct Wrapper {
+		VkResult createPipelineCache(const VkPipelineCacheCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkPipelineCache* pPipelineCache) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			return table.template get<CreatePipelineCache>()(table.device, pCreateInfo, pAllocator, pPipelineCache);
+		}
+	};
+};
+struct DestroyPipelineCache {
+	using type = PFN_vkDestroyPipelineCache;
+	static constexpr const char* name = "vkDestroyPipelineCache";
+	template <typename Table> struct Wrapper {
+		void destroyPipelineCache(VkPipelineCache pipelineCache, const VkAllocationCallbacks* pAllocator) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<DestroyPipelineCache>()(table.device, pipelineCache, pAllocator);
+		}
+	};
+};
+struct GetPipelineCacheData {
+	using type = PFN_vkGetPipelineCacheData;
+	static constexpr const char* name = "vkGetPipelineCacheData";
+	template <typename Table> struct Wrapper {
+		VkResult getPipelineCacheData(VkPipelineCache pipelineCache, size_t* pDataSize, void* pData) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			return table.template get<GetPipelineCacheData>()(table.device, pipelineCache, pDataSize, pData);
+		}
+	};
+};
+struct MergePipelineCaches {
+	using type = PFN_vkMergePipelineCaches;
+	static constexpr const char* name = "vkMergePipelineCaches";
+	template <typename Table> struct Wrapper {
+		VkResult mergePipelineCaches(VkPipelineCache dstCache, uint32_t srcCacheCount, const VkPipelineCache* pSrcCaches) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			return table.template get<MergePipelineCaches>()(table.device, dstCache, srcCacheCount, pSrcCaches);
+		}
+	};
+};
+struct CreateGraphicsPipelines {
+	using type = PFN_vkCreateGraphicsPipelines;
+	static constexpr const char* name = "vkCreateGraphicsPipelines";
+	template <typename Table> struct Wrapper {
+		VkResult createGraphicsPipelines(VkPipelineCache pipelineCache, uint32_t createInfoCount, const VkGraphicsPipelineCreateInfo* pCreateInfos, const VkAllocationCallbacks* pAllocator, VkPipeline* pPipelines) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			return table.template get<CreateGraphicsPipelines>()(table.device, pipelineCache, createInfoCount, pCreateInfos, pAllocator, pPipelines);
+		}
+	};
+};
+struct CreateComputePipelines {
+	using type = PFN_vkCreateComputePipelines;
+	static constexpr const char* name = "vkCreateComputePipelines";
+	template <typename Table> struct Wrapper {
+		VkResult createComputePipelines(VkPipelineCache pipelineCache, uint32_t createInfoCount, const VkComputePipelineCreateInfo* pCreateInfos, const VkAllocationCallbacks* pAllocator, VkPipeline* pPipelines) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			return table.template get<CreateComputePipelines>()(table.device, pipelineCache, createInfoCount, pCreateInfos, pAllocator, pPipelines);
+		}
+	};
+};
+#if (defined(VK_HUAWEI_subpass_shading))
+struct GetDeviceSubpassShadingMaxWorkgroupSizeHUAWEI {
+	using type = PFN_vkGetDeviceSubpassShadingMaxWorkgroupSizeHUAWEI;
+	static constexpr const char* name = "vkGetDeviceSubpassShadingMaxWorkgroupSizeHUAWEI";
+	template <typename Table> struct Wrapper {
+		VkResult getDeviceSubpassShadingMaxWorkgroupSizeHUAWEI(VkRenderPass renderpass, VkExtent2D* pMaxWorkgroupSize) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			return table.template get<GetDeviceSubpassShadingMaxWorkgroupSizeHUAWEI>()(table.device, renderpass, pMaxWorkgroupSize);
+		}
+	};
+};
+#endif
+struct DestroyPipeline {
+	using type = PFN_vkDestroyPipeline;
+	static constexpr const char* name = "vkDestroyPipeline";
+	template <typename Table> struct Wrapper {
+		void destroyPipeline(VkPipeline pipeline, const VkAllocationCallbacks* pAllocator) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<DestroyPipeline>()(table.device, pipeline, pAllocator);
+		}
+	};
+};
+struct CreatePipelineLayout {
+	using type = PFN_vkCreatePipelineLayout;
+	static constexpr const char* name = "vkCreatePipelineLayout";
+	template <typename Table> struct Wrapper {
+		VkResult createPipelineLayout(const VkPipelineLayoutCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkPipelineLayout* pPipelineLayout) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			return table.template get<CreatePipelineLayout>()(table.device, pCreateInfo, pAllocator, pPipelineLayout);
+		}
+	};
+};
+struct DestroyPipelineLayout {
+	using type = PFN_vkDestroyPipelineLayout;
+	static constexpr const char* name = "vkDestroyPipelineLayout";
+	template <typename Table> struct Wrapper {
+		void destroyPipelineLayout(VkPipelineLayout pipelineLayout, const VkAllocationCallbacks* pAllocator) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<DestroyPipelineLayout>()(table.device, pipelineLayout, pAllocator);
+		}
+	};
+};
+struct CreateSampler {
+	using type = PFN_vkCreateSampler;
+	static constexpr const char* name = "vkCreateSampler";
+	template <typename Table> struct Wrapper {
+		VkResult createSampler(const VkSamplerCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkSampler* pSampler) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			return table.template get<CreateSampler>()(table.device, pCreateInfo, pAllocator, pSampler);
+		}
+	};
+};
+struct DestroySampler {
+	using type = PFN_vkDestroySampler;
+	static constexpr const char* name = "vkDestroySampler";
+	template <typename Table> struct Wrapper {
+		void destroySampler(VkSampler sampler, const VkAllocationCallbacks* pAllocator) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<DestroySampler>()(table.device, sampler, pAllocator);
+		}
+	};
+};
+struct CreateDescriptorSetLayout {
+	using type = PFN_vkCreateDescriptorSetLayout;
+	static constexpr const char* name = "vkCreateDescriptorSetLayout";
+	template <typename Table> struct Wrapper {
+		VkResult createDescriptorSetLayout(const VkDescriptorSetLayoutCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkDescriptorSetLayout* pSetLayout) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			return table.template get<CreateDescriptorSetLayout>()(table.device, pCreateInfo, pAllocator, pSetLayout);
+		}
+	};
+};
+struct DestroyDescriptorSetLayout {
+	using type = PFN_vkDestroyDescriptorSetLayout;
+	static constexpr const char* name = "vkDestroyDescriptorSetLayout";
+	template <typename Table> struct Wrapper {
+		void destroyDescriptorSetLayout(VkDescriptorSetLayout descriptorSetLayout, const VkAllocationCallbacks* pAllocator) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<DestroyDescriptorSetLayout>()(table.device, descriptorSetLayout, pAllocator);
+		}
+	};
+};
+struct CreateDescriptorPool {
+	using type = PFN_vkCreateDescriptorPool;
+	static constexpr const char* name = "vkCreateDescriptorPool";
+	template <typename Table> struct Wrapper {
+		VkResult createDescriptorPool(const VkDescriptorPoolCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkDescriptorPool* pDescriptorPool) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			return table.template get<CreateDescriptorPool>()(table.device, pCreateInfo, pAllocator, pDescriptorPool);
+		}
+	};
+};
+struct DestroyDescriptorPool {
+	using type = PFN_vkDestroyDescriptorPool;
+	static constexpr const char* name = "vkDestroyDescriptorPool";
+	template <typename Table> struct Wrapper {
+		void destroyDescriptorPool(VkDescriptorPool descriptorPool, const VkAllocationCallbacks* pAllocator) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<DestroyDescriptorPool>()(table.device, descriptorPool, pAllocator);
+		}
+	};
+};
+struct ResetDescriptorPool {
+	using type = PFN_vkResetDescriptorPool;
+	static constexpr const char* name = "vkResetDescriptorPool";
+	template <typename Table> struct Wrapper {
+		VkResult resetDescriptorPool(VkDescriptorPool descriptorPool, VkDescriptorPoolResetFlags flags) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			return table.template get<ResetDescriptorPool>()(table.device, descriptorPool, flags);
+		}
+	};
+};
+struct AllocateDescriptorSets {
+	using type = PFN_vkAllocateDescriptorSets;
+	static constexpr const char* name = "vkAllocateDescriptorSets";
+	template <typename Table> struct Wrapper {
+		VkResult allocateDescriptorSets(const VkDescriptorSetAllocateInfo* pAllocateInfo, VkDescriptorSet* pDescriptorSets) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			return table.template get<AllocateDescriptorSets>()(table.device, pAllocateInfo, pDescriptorSets);
+		}
+	};
+};
+struct FreeDescriptorSets {
+	using type = PFN_vkFreeDescriptorSets;
+	static constexpr const char* name = "vkFreeDescriptorSets";
+	template <typename Table> struct Wrapper {
+		VkResult freeDescriptorSets(VkDescriptorPool descriptorPool, uint32_t descriptorSetCount, const VkDescriptorSet* pDescriptorSets) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			return table.template get<FreeDescriptorSets>()(table.device, descriptorPool, descriptorSetCount, pDescriptorSets);
+		}
+	};
+};
+struct UpdateDescriptorSets {
+	using type = PFN_vkUpdateDescriptorSets;
+	static constexpr const char* name = "vkUpdateDescriptorSets";
+	template <typename Table> struct Wrapper {
+		void updateDescriptorSets(uint32_t descriptorWriteCount, const VkWriteDescriptorSet* pDescriptorWrites, uint32_t descriptorCopyCount, const VkCopyDescriptorSet* pDescriptorCopies) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<UpdateDescriptorSets>()(table.device, descriptorWriteCount, pDescriptorWrites, descriptorCopyCount, pDescriptorCopies);
+		}
+	};
+};
+struct CreateFramebuffer {
+	using type = PFN_vkCreateFramebuffer;
+	static constexpr const char* name = "vkCreateFramebuffer";
+	template <typename Table> struct Wrapper {
+		VkResult createFramebuffer(const VkFramebufferCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkFramebuffer* pFramebuffer) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			return table.template get<CreateFramebuffer>()(table.device, pCreateInfo, pAllocator, pFramebuffer);
+		}
+	};
+};
+struct DestroyFramebuffer {
+	using type = PFN_vkDestroyFramebuffer;
+	static constexpr const char* name = "vkDestroyFramebuffer";
+	template <typename Table> struct Wrapper {
+		void destroyFramebuffer(VkFramebuffer framebuffer, const VkAllocationCallbacks* pAllocator) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<DestroyFramebuffer>()(table.device, framebuffer, pAllocator);
+		}
+	};
+};
+struct CreateRenderPass {
+	using type = PFN_vkCreateRenderPass;
+	static constexpr const char* name = "vkCreateRenderPass";
+	template <typename Table> struct Wrapper {
+		VkResult createRenderPass(const VkRenderPassCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkRenderPass* pRenderPass) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			return table.template get<CreateRenderPass>()(table.device, pCreateInfo, pAllocator, pRenderPass);
+		}
+	};
+};
+struct DestroyRenderPass {
+	using type = PFN_vkDestroyRenderPass;
+	static constexpr const char* name = "vkDestroyRenderPass";
+	template <typename Table> struct Wrapper {
+		void destroyRenderPass(VkRenderPass renderPass, const VkAllocationCallbacks* pAllocator) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<DestroyRenderPass>()(table.device, renderPass, pAllocator);
+		}
+	};
+};
+struct GetRenderAreaGranularity {
+	using type = PFN_vkGetRenderAreaGranularity;
+	static constexpr const char* name = "vkGetRenderAreaGranularity";
+	template <typename Table> struct Wrapper {
+		void getRenderAreaGranularity(VkRenderPass renderPass, VkExtent2D* pGranularity) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<GetRenderAreaGranularity>()(table.device, renderPass, pGranularity);
+		}
+	};
+};
+struct CreateCommandPool {
+	using type = PFN_vkCreateCommandPool;
+	static constexpr const char* name = "vkCreateCommandPool";
+	template <typename Table> struct Wrapper {
+		VkResult createCommandPool(const VkCommandPoolCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkCommandPool* pCommandPool) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			return table.template get<CreateCommandPool>()(table.device, pCreateInfo, pAllocator, pCommandPool);
+		}
+	};
+};
+struct DestroyCommandPool {
+	using type = PFN_vkDestroyCommandPool;
+	static constexpr const char* name = "vkDestroyCommandPool";
+	template <typename Table> struct Wrapper {
+		void destroyCommandPool(VkCommandPool commandPool, const VkAllocationCallbacks* pAllocator) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<DestroyCommandPool>()(table.device, commandPool, pAllocator);
+		}
+	};
+};
+struct ResetCommandPool {
+	using type = PFN_vkResetCommandPool;
+	static constexpr const char* name = "vkResetCommandPool";
+	template <typename Table> struct Wrapper {
+		VkResult resetCommandPool(VkCommandPool commandPool, VkCommandPoolResetFlags flags) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			return table.template get<ResetCommandPool>()(table.device, commandPool, flags);
+		}
+	};
+};
+struct AllocateCommandBuffers {
+	using type = PFN_vkAllocateCommandBuffers;
+	static constexpr const char* name = "vkAllocateCommandBuffers";
+	template <typename Table> struct Wrapper {
+		VkResult allocateCommandBuffers(const VkCommandBufferAllocateInfo* pAllocateInfo, VkCommandBuffer* pCommandBuffers) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			return table.template get<AllocateCommandBuffers>()(table.device, pAllocateInfo, pCommandBuffers);
+		}
+	};
+};
+struct FreeCommandBuffers {
+	using type = PFN_vkFreeCommandBuffers;
+	static constexpr const char* name = "vkFreeCommandBuffers";
+	template <typename Table> struct Wrapper {
+		void freeCommandBuffers(VkCommandPool commandPool, uint32_t commandBufferCount, const VkCommandBuffer* pCommandBuffers) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<FreeCommandBuffers>()(table.device, commandPool, commandBufferCount, pCommandBuffers);
+		}
+	};
+};
+struct BeginCommandBuffer {
+	using type = PFN_vkBeginCommandBuffer;
+	static constexpr const char* name = "vkBeginCommandBuffer";
+	template <typename Table> struct Wrapper {
+		VkResult beginCommandBuffer(VkCommandBuffer commandBuffer, const VkCommandBufferBeginInfo* pBeginInfo) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			return table.template get<BeginCommandBuffer>()(commandBuffer, pBeginInfo);
+		}
+	};
+};
+struct EndCommandBuffer {
+	using type = PFN_vkEndCommandBuffer;
+	static constexpr const char* name = "vkEndCommandBuffer";
+	template <typename Table> struct Wrapper {
+		VkResult endCommandBuffer(VkCommandBuffer commandBuffer) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			return table.template get<EndCommandBuffer>()(commandBuffer);
+		}
+	};
+};
+struct ResetCommandBuffer {
+	using type = PFN_vkResetCommandBuffer;
+	static constexpr const char* name = "vkResetCommandBuffer";
+	template <typename Table> struct Wrapper {
+		VkResult resetCommandBuffer(VkCommandBuffer commandBuffer, VkCommandBufferResetFlags flags) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			return table.template get<ResetCommandBuffer>()(commandBuffer, flags);
+		}
+	};
+};
+struct CmdBindPipeline {
+	using type = PFN_vkCmdBindPipeline;
+	static constexpr const char* name = "vkCmdBindPipeline";
+	template <typename Table> struct Wrapper {
+		void cmdBindPipeline(VkCommandBuffer commandBuffer, VkPipelineBindPoint pipelineBindPoint, VkPipeline pipeline) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<CmdBindPipeline>()(commandBuffer, pipelineBindPoint, pipeline);
+		}
+	};
+};
+struct CmdSetViewport {
+	using type = PFN_vkCmdSetViewport;
+	static constexpr const char* name = "vkCmdSetViewport";
+	template <typename Table> struct Wrapper {
+		void cmdSetViewport(VkCommandBuffer commandBuffer, uint32_t firstViewport, uint32_t viewportCount, const VkViewport* pViewports) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<CmdSetViewport>()(commandBuffer, firstViewport, viewportCount, pViewports);
+		}
+	};
+};
+struct CmdSetScissor {
+	using type = PFN_vkCmdSetScissor;
+	static constexpr const char* name = "vkCmdSetScissor";
+	template <typename Table> struct Wrapper {
+		void cmdSetScissor(VkCommandBuffer commandBuffer, uint32_t firstScissor, uint32_t scissorCount, const VkRect2D* pScissors) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<CmdSetScissor>()(commandBuffer, firstScissor, scissorCount, pScissors);
+		}
+	};
+};
+struct CmdSetLineWidth {
+	using type = PFN_vkCmdSetLineWidth;
+	static constexpr const char* name = "vkCmdSetLineWidth";
+	template <typename Table> struct Wrapper {
+		void cmdSetLineWidth(VkCommandBuffer commandBuffer, float lineWidth) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<CmdSetLineWidth>()(commandBuffer, lineWidth);
+		}
+	};
+};
+struct CmdSetDepthBias {
+	using type = PFN_vkCmdSetDepthBias;
+	static constexpr const char* name = "vkCmdSetDepthBias";
+	template <typename Table> struct Wrapper {
+		void cmdSetDepthBias(VkCommandBuffer commandBuffer, float depthBiasConstantFactor, float depthBiasClamp, float depthBiasSlopeFactor) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<CmdSetDepthBias>()(commandBuffer, depthBiasConstantFactor, depthBiasClamp, depthBiasSlopeFactor);
+		}
+	};
+};
+struct CmdSetBlendConstants {
+	using type = PFN_vkCmdSetBlendConstants;
+	static constexpr const char* name = "vkCmdSetBlendConstants";
+	template <typename Table> struct Wrapper {
+		void cmdSetBlendConstants(VkCommandBuffer commandBuffer, float blendConstants[4]) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<CmdSetBlendConstants>()(commandBuffer, blendConstants);
+		}
+	};
+};
+struct CmdSetDepthBounds {
+	using type = PFN_vkCmdSetDepthBounds;
+	static constexpr const char* name = "vkCmdSetDepthBounds";
+	template <typename Table> struct Wrapper {
+		void cmdSetDepthBounds(VkCommandBuffer commandBuffer, float minDepthBounds, float maxDepthBounds) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<CmdSetDepthBounds>()(commandBuffer, minDepthBounds, maxDepthBounds);
+		}
+	};
+};
+struct CmdSetStencilCompareMask {
+	using type = PFN_vkCmdSetStencilCompareMask;
+	static constexpr const char* name = "vkCmdSetStencilCompareMask";
+	template <typename Table> struct Wrapper {
+		void cmdSetStencilCompareMask(VkCommandBuffer commandBuffer, VkStencilFaceFlags faceMask, uint32_t compareMask) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<CmdSetStencilCompareMask>()(commandBuffer, faceMask, compareMask);
+		}
+	};
+};
+struct CmdSetStencilWriteMask {
+	using type = PFN_vkCmdSetStencilWriteMask;
+	static constexpr const char* name = "vkCmdSetStencilWriteMask";
+	template <typename Table> struct Wrapper {
+		void cmdSetStencilWriteMask(VkCommandBuffer commandBuffer, VkStencilFaceFlags faceMask, uint32_t writeMask) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<CmdSetStencilWriteMask>()(commandBuffer, faceMask, writeMask);
+		}
+	};
+};
+struct CmdSetStencilReference {
+	using type = PFN_vkCmdSetStencilReference;
+	static constexpr const char* name = "vkCmdSetStencilReference";
+	template <typename Table> struct Wrapper {
+		void cmdSetStencilReference(VkCommandBuffer commandBuffer, VkStencilFaceFlags faceMask, uint32_t reference) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<CmdSetStencilReference>()(commandBuffer, faceMask, reference);
+		}
+	};
+};
+struct CmdBindDescriptorSets {
+	using type = PFN_vkCmdBindDescriptorSets;
+	static constexpr const char* name = "vkCmdBindDescriptorSets";
+	template <typename Table> struct Wrapper {
+		void cmdBindDescriptorSets(VkCommandBuffer commandBuffer, VkPipelineBindPoint pipelineBindPoint, VkPipelineLayout layout, uint32_t firstSet, uint32_t descriptorSetCount, const VkDescriptorSet* pDescriptorSets, uint32_t dynamicOffsetCount, const uint32_t* pDynamicOffsets) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<CmdBindDescriptorSets>()(commandBuffer, pipelineBindPoint, layout, firstSet, descriptorSetCount, pDescriptorSets, dynamicOffsetCount, pDynamicOffsets);
+		}
+	};
+};
+struct CmdBindIndexBuffer {
+	using type = PFN_vkCmdBindIndexBuffer;
+	static constexpr const char* name = "vkCmdBindIndexBuffer";
+	template <typename Table> struct Wrapper {
+		void cmdBindIndexBuffer(VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset, VkIndexType indexType) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<CmdBindIndexBuffer>()(commandBuffer, buffer, offset, indexType);
+		}
+	};
+};
+struct CmdBindVertexBuffers {
+	using type = PFN_vkCmdBindVertexBuffers;
+	static constexpr const char* name = "vkCmdBindVertexBuffers";
+	template <typename Table> struct Wrapper {
+		void cmdBindVertexBuffers(VkCommandBuffer commandBuffer, uint32_t firstBinding, uint32_t bindingCount, const VkBuffer* pBuffers, const VkDeviceSize* pOffsets) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<CmdBindVertexBuffers>()(commandBuffer, firstBinding, bindingCount, pBuffers, pOffsets);
+		}
+	};
+};
+struct CmdDraw {
+	using type = PFN_vkCmdDraw;
+	static constexpr const char* name = "vkCmdDraw";
+	template <typename Table> struct Wrapper {
+		void cmdDraw(VkCommandBuffer commandBuffer, uint32_t vertexCount, uint32_t instanceCount, uint32_t firstVertex, uint32_t firstInstance) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<CmdDraw>()(commandBuffer, vertexCount, instanceCount, firstVertex, firstInstance);
+		}
+	};
+};
+struct CmdDrawIndexed {
+	using type = PFN_vkCmdDrawIndexed;
+	static constexpr const char* name = "vkCmdDrawIndexed";
+	template <typename Table> struct Wrapper {
+		void cmdDrawIndexed(VkCommandBuffer commandBuffer, uint32_t indexCount, uint32_t instanceCount, uint32_t firstIndex, int32_t vertexOffset, uint32_t firstInstance) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<CmdDrawIndexed>()(commandBuffer, indexCount, instanceCount, firstIndex, vertexOffset, firstInstance);
+		}
+	};
+};
+#if (defined(VK_EXT_multi_draw))
+struct CmdDrawMultiEXT {
+	using type = PFN_vkCmdDrawMultiEXT;
+	static constexpr const char* name = "vkCmdDrawMultiEXT";
+	template <typename Table> struct Wrapper {
+		void cmdDrawMultiEXT(VkCommandBuffer commandBuffer, uint32_t drawCount, const VkMultiDrawInfoEXT* pVertexInfo, uint32_t instanceCount, uint32_t firstInstance, uint32_t stride) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<CmdDrawMultiEXT>()(commandBuffer, drawCount, pVertexInfo, instanceCount, firstInstance, stride);
+		}
+	};
+};
+#endif
+#if (defined(VK_EXT_multi_draw))
+struct CmdDrawMultiIndexedEXT {
+	using type = PFN_vkCmdDrawMultiIndexedEXT;
+	static constexpr const char* name = "vkCmdDrawMultiIndexedEXT";
+	template <typename Table> struct Wrapper {
+		void cmdDrawMultiIndexedEXT(VkCommandBuffer commandBuffer, uint32_t drawCount, const VkMultiDrawIndexedInfoEXT* pIndexInfo, uint32_t instanceCount, uint32_t firstInstance, uint32_t stride, const int32_t* pVertexOffset) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<CmdDrawMultiIndexedEXT>()(commandBuffer, drawCount, pIndexInfo, instanceCount, firstInstance, stride, pVertexOffset);
+		}
+	};
+};
+#endif
+struct CmdDrawIndirect {
+	using type = PFN_vkCmdDrawIndirect;
+	static constexpr const char* name = "vkCmdDrawIndirect";
+	template <typename Table> struct Wrapper {
+		void cmdDrawIndirect(VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset, uint32_t drawCount, uint32_t stride) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<CmdDrawIndirect>()(commandBuffer, buffer, offset, drawCount, stride);
+		}
+	};
+};
+struct CmdDrawIndexedIndirect {
+	using type = PFN_vkCmdDrawIndexedIndirect;
+	static constexpr const char* name = "vkCmdDrawIndexedIndirect";
+	template <typename Table> struct Wrapper {
+		void cmdDrawIndexedIndirect(VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset, uint32_t drawCount, uint32_t stride) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<CmdDrawIndexedIndirect>()(commandBuffer, buffer, offset, drawCount, stride);
+		}
+	};
+};
+struct CmdDispatch {
+	using type = PFN_vkCmdDispatch;
+	static constexpr const char* name = "vkCmdDispatch";
+	template <typename Table> struct Wrapper {
+		void cmdDispatch(VkCommandBuffer commandBuffer, uint32_t groupCountX, uint32_t groupCountY, uint32_t groupCountZ) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<CmdDispatch>()(commandBuffer, groupCountX, groupCountY, groupCountZ);
+		}
+	};
+};
+struct CmdDispatchIndirect {
+	using type = PFN_vkCmdDispatchIndirect;
+	static constexpr const char* name = "vkCmdDispatchIndirect";
+	template <typename Table> struct Wrapper {
+		void cmdDispatchIndirect(VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<CmdDispatchIndirect>()(commandBuffer, buffer, offset);
+		}
+	};
+};
+#if (defined(VK_HUAWEI_subpass_shading))
+struct CmdSubpassShadingHUAWEI {
+	using type = PFN_vkCmdSubpassShadingHUAWEI;
+	static constexpr const char* name = "vkCmdSubpassShadingHUAWEI";
+	template <typename Table> struct Wrapper {
+		void cmdSubpassShadingHUAWEI(VkCommandBuffer commandBuffer) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<CmdSubpassShadingHUAWEI>()(commandBuffer);
+		}
+	};
+};
+#endif
+struct CmdCopyBuffer {
+	using type = PFN_vkCmdCopyBuffer;
+	static constexpr const char* name = "vkCmdCopyBuffer";
+	template <typename Table> struct Wrapper {
+		void cmdCopyBuffer(VkCommandBuffer commandBuffer, VkBuffer srcBuffer, VkBuffer dstBuffer, uint32_t regionCount, const VkBufferCopy* pRegions) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<CmdCopyBuffer>()(commandBuffer, srcBuffer, dstBuffer, regionCount, pRegions);
+		}
+	};
+};
+struct CmdCopyImage {
+	using type = PFN_vkCmdCopyImage;
+	static constexpr const char* name = "vkCmdCopyImage";
+	template <typename Table> struct Wrapper {
+		void cmdCopyImage(VkCommandBuffer commandBuffer, VkImage srcImage, VkImageLayout srcImageLayout, VkImage dstImage, VkImageLayout dstImageLayout, uint32_t regionCount, const VkImageCopy* pRegions) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<CmdCopyImage>()(commandBuffer, srcImage, srcImageLayout, dstImage, dstImageLayout, regionCount, pRegions);
+		}
+	};
+};
+struct CmdBlitImage {
+	using type = PFN_vkCmdBlitImage;
+	static constexpr const char* name = "vkCmdBlitImage";
+	template <typename Table> struct Wrapper {
+		void cmdBlitImage(VkCommandBuffer commandBuffer, VkImage srcImage, VkImageLayout srcImageLayout, VkImage dstImage, VkImageLayout dstImageLayout, uint32_t regionCount, const VkImageBlit* pRegions, VkFilter filter) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<CmdBlitImage>()(commandBuffer, srcImage, srcImageLayout, dstImage, dstImageLayout, regionCount, pRegions, filter);
+		}
+	};
+};
+struct CmdCopyBufferToImage {
+	using type = PFN_vkCmdCopyBufferToImage;
+	static constexpr const char* name = "vkCmdCopyBufferToImage";
+	template <typename Table> struct Wrapper {
+		void cmdCopyBufferToImage(VkCommandBuffer commandBuffer, VkBuffer srcBuffer, VkImage dstImage, VkImageLayout dstImageLayout, uint32_t regionCount, const VkBufferImageCopy* pRegions) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<CmdCopyBufferToImage>()(commandBuffer, srcBuffer, dstImage, dstImageLayout, regionCount, pRegions);
+		}
+	};
+};
+struct CmdCopyImageToBuffer {
+	using type = PFN_vkCmdCopyImageToBuffer;
+	static constexpr const char* name = "vkCmdCopyImageToBuffer";
+	template <typename Table> struct Wrapper {
+		void cmdCopyImageToBuffer(VkCommandBuffer commandBuffer, VkImage srcImage, VkImageLayout srcImageLayout, VkBuffer dstBuffer, uint32_t regionCount, const VkBufferImageCopy* pRegions) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<CmdCopyImageToBuffer>()(commandBuffer, srcImage, srcImageLayout, dstBuffer, regionCount, pRegions);
+		}
+	};
+};
+struct CmdUpdateBuffer {
+	using type = PFN_vkCmdUpdateBuffer;
+	static constexpr const char* name = "vkCmdUpdateBuffer";
+	template <typename Table> struct Wrapper {
+		void cmdUpdateBuffer(VkCommandBuffer commandBuffer, VkBuffer dstBuffer, VkDeviceSize dstOffset, VkDeviceSize dataSize, const void* pData) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<CmdUpdateBuffer>()(commandBuffer, dstBuffer, dstOffset, dataSize, pData);
+		}
+	};
+};
+struct CmdFillBuffer {
+	using type = PFN_vkCmdFillBuffer;
+	static constexpr const char* name = "vkCmdFillBuffer";
+	template <typename Table> struct Wrapper {
+		void cmdFillBuffer(VkCommandBuffer commandBuffer, VkBuffer dstBuffer, VkDeviceSize dstOffset, VkDeviceSize size, uint32_t data) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<CmdFillBuffer>()(commandBuffer, dstBuffer, dstOffset, size, data);
+		}
+	};
+};
+struct CmdClearColorImage {
+	using type = PFN_vkCmdClearColorImage;
+	static constexpr const char* name = "vkCmdClearColorImage";
+	template <typename Table> struct Wrapper {
+		void cmdClearColorImage(VkCommandBuffer commandBuffer, VkImage image, VkImageLayout imageLayout, const VkClearColorValue* pColor, uint32_t rangeCount, const VkImageSubresourceRange* pRanges) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<CmdClearColorImage>()(commandBuffer, image, imageLayout, pColor, rangeCount, pRanges);
+		}
+	};
+};
+struct CmdClearDepthStencilImage {
+	using type = PFN_vkCmdClearDepthStencilImage;
+	static constexpr const char* name = "vkCmdClearDepthStencilImage";
+	template <typename Table> struct Wrapper {
+		void cmdClearDepthStencilImage(VkCommandBuffer commandBuffer, VkImage image, VkImageLayout imageLayout, const VkClearDepthStencilValue* pDepthStencil, uint32_t rangeCount, const VkImageSubresourceRange* pRanges) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<CmdClearDepthStencilImage>()(commandBuffer, image, imageLayout, pDepthStencil, rangeCount, pRanges);
+		}
+	};
+};
+struct CmdClearAttachments {
+	using type = PFN_vkCmdClearAttachments;
+	static constexpr const char* name = "vkCmdClearAttachments";
+	template <typename Table> struct Wrapper {
+		void cmdClearAttachments(VkCommandBuffer commandBuffer, uint32_t attachmentCount, const VkClearAttachment* pAttachments, uint32_t rectCount, const VkClearRect* pRects) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<CmdClearAttachments>()(commandBuffer, attachmentCount, pAttachments, rectCount, pRects);
+		}
+	};
+};
+struct CmdResolveImage {
+	using type = PFN_vkCmdResolveImage;
+	static constexpr const char* name = "vkCmdResolveImage";
+	template <typename Table> struct Wrapper {
+		void cmdResolveImage(VkCommandBuffer commandBuffer, VkImage srcImage, VkImageLayout srcImageLayout, VkImage dstImage, VkImageLayout dstImageLayout, uint32_t regionCount, const VkImageResolve* pRegions) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<CmdResolveImage>()(commandBuffer, srcImage, srcImageLayout, dstImage, dstImageLayout, regionCount, pRegions);
+		}
+	};
+};
+struct CmdSetEvent {
+	using type = PFN_vkCmdSetEvent;
+	static constexpr const char* name = "vkCmdSetEvent";
+	template <typename Table> struct Wrapper {
+		void cmdSetEvent(VkCommandBuffer commandBuffer, VkEvent event, VkPipelineStageFlags stageMask) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<CmdSetEvent>()(commandBuffer, event, stageMask);
+		}
+	};
+};
+struct CmdResetEvent {
+	using type = PFN_vkCmdResetEvent;
+	static constexpr const char* name = "vkCmdResetEvent";
+	template <typename Table> struct Wrapper {
+		void cmdResetEvent(VkCommandBuffer commandBuffer, VkEvent event, VkPipelineStageFlags stageMask) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<CmdResetEvent>()(commandBuffer, event, stageMask);
+		}
+	};
+};
+struct CmdWaitEvents {
+	using type = PFN_vkCmdWaitEvents;
+	static constexpr const char* name = "vkCmdWaitEvents";
+	template <typename Table> struct Wrapper {
+		void cmdWaitEvents(VkCommandBuffer commandBuffer, uint32_t eventCount, const VkEvent* pEvents, VkPipelineStageFlags srcStageMask, VkPipelineStageFlags dstStageMask, uint32_t memoryBarrierCount, const VkMemoryBarrier* pMemoryBarriers, uint32_t bufferMemoryBarrierCount, const VkBufferMemoryBarrier* pBufferMemoryBarriers, uint32_t imageMemoryBarrierCount, const VkImageMemoryBarrier* pImageMemoryBarriers) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<CmdWaitEvents>()(commandBuffer, eventCount, pEvents, srcStageMask, dstStageMask, memoryBarrierCount, pMemoryBarriers, bufferMemoryBarrierCount, pBufferMemoryBarriers, imageMemoryBarrierCount, pImageMemoryBarriers);
+		}
+	};
+};
+struct CmdPipelineBarrier {
+	using type = PFN_vkCmdPipelineBarrier;
+	static constexpr const char* name = "vkCmdPipelineBarrier";
+	template <typename Table> struct Wrapper {
+		void cmdPipelineBarrier(VkCommandBuffer commandBuffer, VkPipelineStageFlags srcStageMask, VkPipelineStageFlags dstStageMask, VkDependencyFlags dependencyFlags, uint32_t memoryBarrierCount, const VkMemoryBarrier* pMemoryBarriers, uint32_t bufferMemoryBarrierCount, const VkBufferMemoryBarrier* pBufferMemoryBarriers, uint32_t imageMemoryBarrierCount, const VkImageMemoryBarrier* pImageMemoryBarriers) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<CmdPipelineBarrier>()(commandBuffer, srcStageMask, dstStageMask, dependencyFlags, memoryBarrierCount, pMemoryBarriers, bufferMemoryBarrierCount, pBufferMemoryBarriers, imageMemoryBarrierCount, pImageMemoryBarriers);
+		}
+	};
+};
+struct CmdBeginQuery {
+	using type = PFN_vkCmdBeginQuery;
+	static constexpr const char* name = "vkCmdBeginQuery";
+	template <typename Table> struct Wrapper {
+		void cmdBeginQuery(VkCommandBuffer commandBuffer, VkQueryPool queryPool, uint32_t query, VkQueryControlFlags flags) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<CmdBeginQuery>()(commandBuffer, queryPool, query, flags);
+		}
+	};
+};
+struct CmdEndQuery {
+	using type = PFN_vkCmdEndQuery;
+	static constexpr const char* name = "vkCmdEndQuery";
+	template <typename Table> struct Wrapper {
+		void cmdEndQuery(VkCommandBuffer commandBuffer, VkQueryPool queryPool, uint32_t query) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<CmdEndQuery>()(commandBuffer, queryPool, query);
+		}
+	};
+};
+#if (defined(VK_EXT_conditional_rendering))
+struct CmdBeginConditionalRenderingEXT {
+	using type = PFN_vkCmdBeginConditionalRenderingEXT;
+	static constexpr const char* name = "vkCmdBeginConditionalRenderingEXT";
+	template <typename Table> struct Wrapper {
+		void cmdBeginConditionalRenderingEXT(VkCommandBuffer commandBuffer, const VkConditionalRenderingBeginInfoEXT* pConditionalRenderingBegin) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<CmdBeginConditionalRenderingEXT>()(commandBuffer, pConditionalRenderingBegin);
+		}
+	};
+};
+#endif
+#if (defined(VK_EXT_conditional_rendering))
+struct CmdEndConditionalRenderingEXT {
+	using type = PFN_vkCmdEndConditionalRenderingEXT;
+	static constexpr const char* name = "vkCmdEndConditionalRenderingEXT";
+	template <typename Table> struct Wrapper {
+		void cmdEndConditionalRenderingEXT(VkCommandBuffer commandBuffer) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<CmdEndConditionalRenderingEXT>()(commandBuffer);
+		}
+	};
+};
+#endif
+struct CmdResetQueryPool {
+	using type = PFN_vkCmdResetQueryPool;
+	static constexpr const char* name = "vkCmdResetQueryPool";
+	template <typename Table> struct Wrapper {
+		void cmdResetQueryPool(VkCommandBuffer commandBuffer, VkQueryPool queryPool, uint32_t firstQuery, uint32_t queryCount) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<CmdResetQueryPool>()(commandBuffer, queryPool, firstQuery, queryCount);
+		}
+	};
+};
+struct CmdWriteTimestamp {
+	using type = PFN_vkCmdWriteTimestamp;
+	static constexpr const char* name = "vkCmdWriteTimestamp";
+	template <typename Table> struct Wrapper {
+		void cmdWriteTimestamp(VkCommandBuffer commandBuffer, VkPipelineStageFlagBits pipelineStage, VkQueryPool queryPool, uint32_t query) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<CmdWriteTimestamp>()(commandBuffer, pipelineStage, queryPool, query);
+		}
+	};
+};
+struct CmdCopyQueryPoolResults {
+	using type = PFN_vkCmdCopyQueryPoolResults;
+	static constexpr const char* name = "vkCmdCopyQueryPoolResults";
+	template <typename Table> struct Wrapper {
+		void cmdCopyQueryPoolResults(VkCommandBuffer commandBuffer, VkQueryPool queryPool, uint32_t firstQuery, uint32_t queryCount, VkBuffer dstBuffer, VkDeviceSize dstOffset, VkDeviceSize stride, VkQueryResultFlags flags) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<CmdCopyQueryPoolResults>()(commandBuffer, queryPool, firstQuery, queryCount, dstBuffer, dstOffset, stride, flags);
+		}
+	};
+};
+struct CmdPushConstants {
+	using type = PFN_vkCmdPushConstants;
+	static constexpr const char* name = "vkCmdPushConstants";
+	template <typename Table> struct Wrapper {
+		void cmdPushConstants(VkCommandBuffer commandBuffer, VkPipelineLayout layout, VkShaderStageFlags stageFlags, uint32_t offset, uint32_t size, const void* pValues) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<CmdPushConstants>()(commandBuffer, layout, stageFlags, offset, size, pValues);
+		}
+	};
+};
+struct CmdBeginRenderPass {
+	using type = PFN_vkCmdBeginRenderPass;
+	static constexpr const char* name = "vkCmdBeginRenderPass";
+	template <typename Table> struct Wrapper {
+		void cmdBeginRenderPass(VkCommandBuffer commandBuffer, const VkRenderPassBeginInfo* pRenderPassBegin, VkSubpassContents contents) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<CmdBeginRenderPass>()(commandBuffer, pRenderPassBegin, contents);
+		}
+	};
+};
+struct CmdNextSubpass {
+	using type = PFN_vkCmdNextSubpass;
+	static constexpr const char* name = "vkCmdNextSubpass";
+	template <typename Table> struct Wrapper {
+		void cmdNextSubpass(VkCommandBuffer commandBuffer, VkSubpassContents contents) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<CmdNextSubpass>()(commandBuffer, contents);
+		}
+	};
+};
+struct CmdEndRenderPass {
+	using type = PFN_vkCmdEndRenderPass;
+	static constexpr const char* name = "vkCmdEndRenderPass";
+	template <typename Table> struct Wrapper {
+		void cmdEndRenderPass(VkCommandBuffer commandBuffer) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<CmdEndRenderPass>()(commandBuffer);
+		}
+	};
+};
+struct CmdExecuteCommands {
+	using type = PFN_vkCmdExecuteCommands;
+	static constexpr const char* name = "vkCmdExecuteCommands";
+	template <typename Table> struct Wrapper {
+		void cmdExecuteCommands(VkCommandBuffer commandBuffer, uint32_t commandBufferCount, const VkCommandBuffer* pCommandBuffers) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<CmdExecuteCommands>()(commandBuffer, commandBufferCount, pCommandBuffers);
+		}
+	};
+};
+#if (defined(VK_KHR_display_swapchain))
+struct CreateSharedSwapchainsKHR {
+	using type = PFN_vkCreateSharedSwapchainsKHR;
+	static constexpr const char* name = "vkCreateSharedSwapchainsKHR";
+	template <typename Table> struct Wrapper {
+		VkResult createSharedSwapchainsKHR(uint32_t swapchainCount, const VkSwapchainCreateInfoKHR* pCreateInfos, const VkAllocationCallbacks* pAllocator, VkSwapchainKHR* pSwapchains) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			return table.template get<CreateSharedSwapchainsKHR>()(table.device, swapchainCount, pCreateInfos, pAllocator, pSwapchains);
+		}
+	};
+};
+#endif
+#if (defined(VK_KHR_swapchain))
+struct CreateSwapchainKHR {
+	using type = PFN_vkCreateSwapchainKHR;
+	static constexpr const char* name = "vkCreateSwapchainKHR";
+	template <typename Table> struct Wrapper {
+		VkResult createSwapchainKHR(const VkSwapchainCreateInfoKHR* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkSwapchainKHR* pSwapchain) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			return table.template get<CreateSwapchainKHR>()(table.device, pCreateInfo, pAllocator, pSwapchain);
+		}
+	};
+};
+#endif
+#if (defined(VK_KHR_swapchain))
+struct DestroySwapchainKHR {
+	using type = PFN_vkDestroySwapchainKHR;
+	static constexpr const char* name = "vkDestroySwapchainKHR";
+	template <typename Table> struct Wrapper {
+		void destroySwapchainKHR(VkSwapchainKHR swapchain, const VkAllocationCallbacks* pAllocator) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<DestroySwapchainKHR>()(table.device, swapchain, pAllocator);
+		}
+	};
+};
+#endif
+#if (defined(VK_KHR_swapchain))
+struct GetSwapchainImagesKHR {
+	using type = PFN_vkGetSwapchainImagesKHR;
+	static constexpr const char* name = "vkGetSwapchainImagesKHR";
+	template <typename Table> struct Wrapper {
+		VkResult getSwapchainImagesKHR(VkSwapchainKHR swapchain, uint32_t* pSwapchainImageCount, VkImage* pSwapchainImages) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			return table.template get<GetSwapchainImagesKHR>()(table.device, swapchain, pSwapchainImageCount, pSwapchainImages);
+		}
+	};
+};
+#endif
+#if (defined(VK_KHR_swapchain))
+struct AcquireNextImageKHR {
+	using type = PFN_vkAcquireNextImageKHR;
+	static constexpr const char* name = "vkAcquireNextImageKHR";
+	template <typename Table> struct Wrapper {
+		VkResult acquireNextImageKHR(VkSwapchainKHR swapchain, uint64_t timeout, VkSemaphore semaphore, VkFence fence, uint32_t* pImageIndex) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			return table.template get<AcquireNextImageKHR>()(table.device, swapchain, timeout, semaphore, fence, pImageIndex);
+		}
+	};
+};
+#endif
+#if (defined(VK_KHR_swapchain))
+struct QueuePresentKHR {
+	using type = PFN_vkQueuePresentKHR;
+	static constexpr const char* name = "vkQueuePresentKHR";
+	template <typename Table> struct Wrapper {
+		VkResult queuePresentKHR(VkQueue queue, const VkPresentInfoKHR* pPresentInfo) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			return table.template get<QueuePresentKHR>()(queue, pPresentInfo);
+		}
+	};
+};
+#endif
+#if (defined(VK_EXT_debug_marker))
+struct DebugMarkerSetObjectNameEXT {
+	using type = PFN_vkDebugMarkerSetObjectNameEXT;
+	static constexpr const char* name = "vkDebugMarkerSetObjectNameEXT";
+	template <typename Table> struct Wrapper {
+		VkResult debugMarkerSetObjectNameEXT(const VkDebugMarkerObjectNameInfoEXT* pNameInfo) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			return table.template get<DebugMarkerSetObjectNameEXT>()(table.device, pNameInfo);
+		}
+	};
+};
+#endif
+#if (defined(VK_EXT_debug_marker))
+struct DebugMarkerSetObjectTagEXT {
+	using type = PFN_vkDebugMarkerSetObjectTagEXT;
+	static constexpr const char* name = "vkDebugMarkerSetObjectTagEXT";
+	template <typename Table> struct Wrapper {
+		VkResult debugMarkerSetObjectTagEXT(const VkDebugMarkerObjectTagInfoEXT* pTagInfo) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			return table.template get<DebugMarkerSetObjectTagEXT>()(table.device, pTagInfo);
+		}
+	};
+};
+#endif
+#if (defined(VK_EXT_debug_marker))
+struct CmdDebugMarkerBeginEXT {
+	using type = PFN_vkCmdDebugMarkerBeginEXT;
+	static constexpr const char* name = "vkCmdDebugMarkerBeginEXT";
+	template <typename Table> struct Wrapper {
+		void cmdDebugMarkerBeginEXT(VkCommandBuffer commandBuffer, const VkDebugMarkerMarkerInfoEXT* pMarkerInfo) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<CmdDebugMarkerBeginEXT>()(commandBuffer, pMarkerInfo);
+		}
+	};
+};
+#endif
+#if (defined(VK_EXT_debug_marker))
+struct CmdDebugMarkerEndEXT {
+	using type = PFN_vkCmdDebugMarkerEndEXT;
+	static constexpr const char* name = "vkCmdDebugMarkerEndEXT";
+	template <typename Table> struct Wrapper {
+		void cmdDebugMarkerEndEXT(VkCommandBuffer commandBuffer) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<CmdDebugMarkerEndEXT>()(commandBuffer);
+		}
+	};
+};
+#endif
+#if (defined(VK_EXT_debug_marker))
+struct CmdDebugMarkerInsertEXT {
+	using type = PFN_vkCmdDebugMarkerInsertEXT;
+	static constexpr const char* name = "vkCmdDebugMarkerInsertEXT";
+	template <typename Table> struct Wrapper {
+		void cmdDebugMarkerInsertEXT(VkCommandBuffer commandBuffer, const VkDebugMarkerMarkerInfoEXT* pMarkerInfo) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<CmdDebugMarkerInsertEXT>()(commandBuffer, pMarkerInfo);
+		}
+	};
+};
+#endif
+#if (defined(VK_NV_external_memory_win32))
+struct GetMemoryWin32HandleNV {
+	using type = PFN_vkGetMemoryWin32HandleNV;
+	static constexpr const char* name = "vkGetMemoryWin32HandleNV";
+	template <typename Table> struct Wrapper {
+		VkResult getMemoryWin32HandleNV(VkDeviceMemory memory, VkExternalMemoryHandleTypeFlagsNV handleType, HANDLE* pHandle) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			return table.template get<GetMemoryWin32HandleNV>()(table.device, memory, handleType, pHandle);
+		}
+	};
+};
+#endif
+#if (defined(VK_NV_device_generated_commands))
+struct CmdExecuteGeneratedCommandsNV {
+	using type = PFN_vkCmdExecuteGeneratedCommandsNV;
+	static constexpr const char* name = "vkCmdExecuteGeneratedCommandsNV";
+	template <typename Table> struct Wrapper {
+		void cmdExecuteGeneratedCommandsNV(VkCommandBuffer commandBuffer, VkBool32 isPreprocessed, const VkGeneratedCommandsInfoNV* pGeneratedCommandsInfo) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<CmdExecuteGeneratedCommandsNV>()(commandBuffer, isPreprocessed, pGeneratedCommandsInfo);
+		}
+	};
+};
+#endif
+#if (defined(VK_NV_device_generated_commands))
+struct CmdPreprocessGeneratedCommandsNV {
+	using type = PFN_vkCmdPreprocessGeneratedCommandsNV;
+	static constexpr const char* name = "vkCmdPreprocessGeneratedCommandsNV";
+	template <typename Table> struct Wrapper {
+		void cmdPreprocessGeneratedCommandsNV(VkCommandBuffer commandBuffer, const VkGeneratedCommandsInfoNV* pGeneratedCommandsInfo) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<CmdPreprocessGeneratedCommandsNV>()(commandBuffer, pGeneratedCommandsInfo);
+		}
+	};
+};
+#endif
+#if (defined(VK_NV_device_generated_commands))
+struct CmdBindPipelineShaderGroupNV {
+	using type = PFN_vkCmdBindPipelineShaderGroupNV;
+	static constexpr const char* name = "vkCmdBindPipelineShaderGroupNV";
+	template <typename Table> struct Wrapper {
+		void cmdBindPipelineShaderGroupNV(VkCommandBuffer commandBuffer, VkPipelineBindPoint pipelineBindPoint, VkPipeline pipeline, uint32_t groupIndex) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<CmdBindPipelineShaderGroupNV>()(commandBuffer, pipelineBindPoint, pipeline, groupIndex);
+		}
+	};
+};
+#endif
+#if (defined(VK_NV_device_generated_commands))
+struct GetGeneratedCommandsMemoryRequirementsNV {
+	using type = PFN_vkGetGeneratedCommandsMemoryRequirementsNV;
+	static constexpr const char* name = "vkGetGeneratedCommandsMemoryRequirementsNV";
+	template <typename Table> struct Wrapper {
+		void getGeneratedCommandsMemoryRequirementsNV(const VkGeneratedCommandsMemoryRequirementsInfoNV* pInfo, VkMemoryRequirements2KHR* pMemoryRequirements) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<GetGeneratedCommandsMemoryRequirementsNV>()(table.device, pInfo, pMemoryRequirements);
+		}
+	};
+};
+#endif
+#if (defined(VK_NV_device_generated_commands))
+struct CreateIndirectCommandsLayoutNV {
+	using type = PFN_vkCreateIndirectCommandsLayoutNV;
+	static constexpr const char* name = "vkCreateIndirectCommandsLayoutNV";
+	template <typename Table> struct Wrapper {
+		VkResult createIndirectCommandsLayoutNV(const VkIndirectCommandsLayoutCreateInfoNV* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkIndirectCommandsLayoutNV* pIndirectCommandsLayout) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			return table.template get<CreateIndirectCommandsLayoutNV>()(table.device, pCreateInfo, pAllocator, pIndirectCommandsLayout);
+		}
+	};
+};
+#endif
+#if (defined(VK_NV_device_generated_commands))
+struct DestroyIndirectCommandsLayoutNV {
+	using type = PFN_vkDestroyIndirectCommandsLayoutNV;
+	static constexpr const char* name = "vkDestroyIndirectCommandsLayoutNV";
+	template <typename Table> struct Wrapper {
+		void destroyIndirectCommandsLayoutNV(VkIndirectCommandsLayoutNV indirectCommandsLayout, const VkAllocationCallbacks* pAllocator) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<DestroyIndirectCommandsLayoutNV>()(table.device, indirectCommandsLayout, pAllocator);
+		}
+	};
+};
+#endif
+#if (defined(VK_KHR_push_descriptor))
+struct CmdPushDescriptorSetKHR {
+	using type = PFN_vkCmdPushDescriptorSetKHR;
+	static constexpr const char* name = "vkCmdPushDescriptorSetKHR";
+	template <typename Table> struct Wrapper {
+		void cmdPushDescriptorSetKHR(VkCommandBuffer commandBuffer, VkPipelineBindPoint pipelineBindPoint, VkPipelineLayout layout, uint32_t set, uint32_t descriptorWriteCount, const VkWriteDescriptorSet* pDescriptorWrites) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<CmdPushDescriptorSetKHR>()(commandBuffer, pipelineBindPoint, layout, set, descriptorWriteCount, pDescriptorWrites);
+		}
+	};
+};
+#endif
+#if (defined(VK_VERSION_1_1))
+struct TrimCommandPool {
+	using type = PFN_vkTrimCommandPool;
+	static constexpr const char* name = "vkTrimCommandPool";
+	template <typename Table> struct Wrapper {
+		void trimCommandPool(VkCommandPool commandPool, VkCommandPoolTrimFlagsKHR flags) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<TrimCommandPool>()(table.device, commandPool, flags);
+		}
+	};
+};
+#endif
+#if (defined(VK_KHR_external_memory_win32))
+struct GetMemoryWin32HandleKHR {
+	using type = PFN_vkGetMemoryWin32HandleKHR;
+	static constexpr const char* name = "vkGetMemoryWin32HandleKHR";
+	template <typename Table> struct Wrapper {
+		VkResult getMemoryWin32HandleKHR(const VkMemoryGetWin32HandleInfoKHR* pGetWin32HandleInfo, HANDLE* pHandle) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			return table.template get<GetMemoryWin32HandleKHR>()(table.device, pGetWin32HandleInfo, pHandle);
+		}
+	};
+};
+#endif
+#if (defined(VK_KHR_external_memory_win32))
+struct GetMemoryWin32HandlePropertiesKHR {
+	using type = PFN_vkGetMemoryWin32HandlePropertiesKHR;
+	static constexpr const char* name = "vkGetMemoryWin32HandlePropertiesKHR";
+	template <typename Table> struct Wrapper {
+		VkResult getMemoryWin32HandlePropertiesKHR(VkExternalMemoryHandleTypeFlagBitsKHR handleType, HANDLE handle, VkMemoryWin32HandlePropertiesKHR* pMemoryWin32HandleProperties) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			return table.template get<GetMemoryWin32HandlePropertiesKHR>()(table.device, handleType, handle, pMemoryWin32HandleProperties);
+		}
+	};
+};
+#endif
+#if (defined(VK_KHR_external_memory_fd))
+struct GetMemoryFdKHR {
+	using type = PFN_vkGetMemoryFdKHR;
+	static constexpr const char* name = "vkGetMemoryFdKHR";
+	template <typename Table> struct Wrapper {
+		VkResult getMemoryFdKHR(const VkMemoryGetFdInfoKHR* pGetFdInfo, int* pFd) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			return table.template get<GetMemoryFdKHR>()(table.device, pGetFdInfo, pFd);
+		}
+	};
+};
+#endif
+#if (defined(VK_KHR_external_memory_fd))
+struct GetMemoryFdPropertiesKHR {
+	using type = PFN_vkGetMemoryFdPropertiesKHR;
+	static constexpr const char* name = "vkGetMemoryFdPropertiesKHR";
+	template <typename Table> struct Wrapper {
+		VkResult getMemoryFdPropertiesKHR(VkExternalMemoryHandleTypeFlagBitsKHR handleType, int fd, VkMemoryFdPropertiesKHR* pMemoryFdProperties) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			return table.template get<GetMemoryFdPropertiesKHR>()(table.device, handleType, fd, pMemoryFdProperties);
+		}
+	};
+};
+#endif
+#if (defined(VK_FUCHSIA_external_memory))
+struct GetMemoryZirconHandleFUCHSIA {
+	using type = PFN_vkGetMemoryZirconHandleFUCHSIA;
+	static constexpr const char* name = "vkGetMemoryZirconHandleFUCHSIA";
+	template <typename Table> struct Wrapper {
+		VkResult getMemoryZirconHandleFUCHSIA(const VkMemoryGetZirconHandleInfoFUCHSIA* pGetZirconHandleInfo, zx_handle_t* pZirconHandle) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			return table.template get<GetMemoryZirconHandleFUCHSIA>()(table.device, pGetZirconHandleInfo, pZirconHandle);
+		}
+	};
+};
+#endif
+#if (defined(VK_FUCHSIA_external_memory))
+struct GetMemoryZirconHandlePropertiesFUCHSIA {
+	using type = PFN_vkGetMemoryZirconHandlePropertiesFUCHSIA;
+	static constexpr const char* name = "vkGetMemoryZirconHandlePropertiesFUCHSIA";
+	template <typename Table> struct Wrapper {
+		VkResult getMemoryZirconHandlePropertiesFUCHSIA(VkExternalMemoryHandleTypeFlagBitsKHR handleType, zx_handle_t zirconHandle, VkMemoryZirconHandlePropertiesFUCHSIA* pMemoryZirconHandleProperties) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			return table.template get<GetMemoryZirconHandlePropertiesFUCHSIA>()(table.device, handleType, zirconHandle, pMemoryZirconHandleProperties);
+		}
+	};
+};
+#endif
+#if (defined(VK_NV_external_memory_rdma))
+struct GetMemoryRemoteAddressNV {
+	using type = PFN_vkGetMemoryRemoteAddressNV;
+	static constexpr const char* name = "vkGetMemoryRemoteAddressNV";
+	template <typename Table> struct Wrapper {
+		VkResult getMemoryRemoteAddressNV(const VkMemoryGetRemoteAddressInfoNV* pMemoryGetRemoteAddressInfo, VkRemoteAddressNV* pAddress) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			return table.template get<GetMemoryRemoteAddressNV>()(table.device, pMemoryGetRemoteAddressInfo, pAddress);
+		}
+	};
+};
+#endif
+#if (defined(VK_KHR_external_semaphore_win32))
+struct GetSemaphoreWin32HandleKHR {
+	using type = PFN_vkGetSemaphoreWin32HandleKHR;
+	static constexpr const char* name = "vkGetSemaphoreWin32HandleKHR";
+	template <typename Table> struct Wrapper {
+		VkResult getSemaphoreWin32HandleKHR(const VkSemaphoreGetWin32HandleInfoKHR* pGetWin32HandleInfo, HANDLE* pHandle) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			return table.template get<GetSemaphoreWin32HandleKHR>()(table.device, pGetWin32HandleInfo, pHandle);
+		}
+	};
+};
+#endif
+#if (defined(VK_KHR_external_semaphore_win32))
+struct ImportSemaphoreWin32HandleKHR {
+	using type = PFN_vkImportSemaphoreWin32HandleKHR;
+	static constexpr const char* name = "vkImportSemaphoreWin32HandleKHR";
+	template <typename Table> struct Wrapper {
+		VkResult importSemaphoreWin32HandleKHR(const VkImportSemaphoreWin32HandleInfoKHR* pImportSemaphoreWin32HandleInfo) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			return table.template get<ImportSemaphoreWin32HandleKHR>()(table.device, pImportSemaphoreWin32HandleInfo);
+		}
+	};
+};
+#endif
+#if (defined(VK_KHR_external_semaphore_fd))
+struct GetSemaphoreFdKHR {
+	using type = PFN_vkGetSemaphoreFdKHR;
+	static constexpr const char* name = "vkGetSemaphoreFdKHR";
+	template <typename Table> struct Wrapper {
+		VkResult getSemaphoreFdKHR(const VkSemaphoreGetFdInfoKHR* pGetFdInfo, int* pFd) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			return table.template get<GetSemaphoreFdKHR>()(table.device, pGetFdInfo, pFd);
+		}
+	};
+};
+#endif
+#if (defined(VK_KHR_external_semaphore_fd))
+struct ImportSemaphoreFdKHR {
+	using type = PFN_vkImportSemaphoreFdKHR;
+	static constexpr const char* name = "vkImportSemaphoreFdKHR";
+	template <typename Table> struct Wrapper {
+		VkResult importSemaphoreFdKHR(const VkImportSemaphoreFdInfoKHR* pImportSemaphoreFdInfo) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			return table.template get<ImportSemaphoreFdKHR>()(table.device, pImportSemaphoreFdInfo);
+		}
+	};
+};
+#endif
+#if (defined(VK_FUCHSIA_external_semaphore))
+struct GetSemaphoreZirconHandleFUCHSIA {
+	using type = PFN_vkGetSemaphoreZirconHandleFUCHSIA;
+	static constexpr const char* name = "vkGetSemaphoreZirconHandleFUCHSIA";
+	template <typename Table> struct Wrapper {
+		VkResult getSemaphoreZirconHandleFUCHSIA(const VkSemaphoreGetZirconHandleInfoFUCHSIA* pGetZirconHandleInfo, zx_handle_t* pZirconHandle) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			return table.template get<GetSemaphoreZirconHandleFUCHSIA>()(table.device, pGetZirconHandleInfo, pZirconHandle);
+		}
+	};
+};
+#endif
+#if (defined(VK_FUCHSIA_external_semaphore))
+struct ImportSemaphoreZirconHandleFUCHSIA {
+	using type = PFN_vkImportSemaphoreZirconHandleFUCHSIA;
+	static constexpr const char* name = "vkImportSemaphoreZirconHandleFUCHSIA";
+	template <typename Table> struct Wrapper {
+		VkResult importSemaphoreZirconHandleFUCHSIA(const VkImportSemaphoreZirconHandleInfoFUCHSIA* pImportSemaphoreZirconHandleInfo) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			return table.template get<ImportSemaphoreZirconHandleFUCHSIA>()(table.device, pImportSemaphoreZirconHandleInfo);
+		}
+	};
+};
+#endif
+#if (defined(VK_KHR_external_fence_win32))
+struct GetFenceWin32HandleKHR {
+	using type = PFN_vkGetFenceWin32HandleKHR;
+	static constexpr const char* name = "vkGetFenceWin32HandleKHR";
+	template <typename Table> struct Wrapper {
+		VkResult getFenceWin32HandleKHR(const VkFenceGetWin32HandleInfoKHR* pGetWin32HandleInfo, HANDLE* pHandle) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			return table.template get<GetFenceWin32HandleKHR>()(table.device, pGetWin32HandleInfo, pHandle);
+		}
+	};
+};
+#endif
+#if (defined(VK_KHR_external_fence_win32))
+struct ImportFenceWin32HandleKHR {
+	using type = PFN_vkImportFenceWin32HandleKHR;
+	static constexpr const char* name = "vkImportFenceWin32HandleKHR";
+	template <typename Table> struct Wrapper {
+		VkResult importFenceWin32HandleKHR(const VkImportFenceWin32HandleInfoKHR* pImportFenceWin32HandleInfo) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			return table.template get<ImportFenceWin32HandleKHR>()(table.device, pImportFenceWin32HandleInfo);
+		}
+	};
+};
+#endif
+#if (defined(VK_KHR_external_fence_fd))
+struct GetFenceFdKHR {
+	using type = PFN_vkGetFenceFdKHR;
+	static constexpr const char* name = "vkGetFenceFdKHR";
+	template <typename Table> struct Wrapper {
+		VkResult getFenceFdKHR(const VkFenceGetFdInfoKHR* pGetFdInfo, int* pFd) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			return table.template get<GetFenceFdKHR>()(table.device, pGetFdInfo, pFd);
+		}
+	};
+};
+#endif
+#if (defined(VK_KHR_external_fence_fd))
+struct ImportFenceFdKHR {
+	using type = PFN_vkImportFenceFdKHR;
+	static constexpr const char* name = "vkImportFenceFdKHR";
+	template <typename Table> struct Wrapper {
+		VkResult importFenceFdKHR(const VkImportFenceFdInfoKHR* pImportFenceFdInfo) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			return table.template get<ImportFenceFdKHR>()(table.device, pImportFenceFdInfo);
+		}
+	};
+};
+#endif
+#if (defined(VK_EXT_display_control))
+struct DisplayPowerControlEXT {
+	using type = PFN_vkDisplayPowerControlEXT;
+	static constexpr const char* name = "vkDisplayPowerControlEXT";
+	template <typename Table> struct Wrapper {
+		VkResult displayPowerControlEXT(VkDisplayKHR display, const VkDisplayPowerInfoEXT* pDisplayPowerInfo) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			return table.template get<DisplayPowerControlEXT>()(table.device, display, pDisplayPowerInfo);
+		}
+	};
+};
+#endif
+#if (defined(VK_EXT_display_control))
+struct RegisterDeviceEventEXT {
+	using type = PFN_vkRegisterDeviceEventEXT;
+	static constexpr const char* name = "vkRegisterDeviceEventEXT";
+	template <typename Table> struct Wrapper {
+		VkResult registerDeviceEventEXT(const VkDeviceEventInfoEXT* pDeviceEventInfo, const VkAllocationCallbacks* pAllocator, VkFence* pFence) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			return table.template get<RegisterDeviceEventEXT>()(table.device, pDeviceEventInfo, pAllocator, pFence);
+		}
+	};
+};
+#endif
+#if (defined(VK_EXT_display_control))
+struct RegisterDisplayEventEXT {
+	using type = PFN_vkRegisterDisplayEventEXT;
+	static constexpr const char* name = "vkRegisterDisplayEventEXT";
+	template <typename Table> struct Wrapper {
+		VkResult registerDisplayEventEXT(VkDisplayKHR display, const VkDisplayEventInfoEXT* pDisplayEventInfo, const VkAllocationCallbacks* pAllocator, VkFence* pFence) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			return table.template get<RegisterDisplayEventEXT>()(table.device, display, pDisplayEventInfo, pAllocator, pFence);
+		}
+	};
+};
+#endif
+#if (defined(VK_EXT_display_control))
+struct GetSwapchainCounterEXT {
+	using type = PFN_vkGetSwapchainCounterEXT;
+	static constexpr const char* name = "vkGetSwapchainCounterEXT";
+	template <typename Table> struct Wrapper {
+		VkResult getSwapchainCounterEXT(VkSwapchainKHR swapchain, VkSurfaceCounterFlagBitsEXT counter, uint64_t* pCounterValue) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			return table.template get<GetSwapchainCounterEXT>()(table.device, swapchain, counter, pCounterValue);
+		}
+	};
+};
+#endif
+#if (defined(VK_VERSION_1_1))
+struct GetDeviceGroupPeerMemoryFeatures {
+	using type = PFN_vkGetDeviceGroupPeerMemoryFeatures;
+	static constexpr const char* name = "vkGetDeviceGroupPeerMemoryFeatures";
+	template <typename Table> struct Wrapper {
+		void getDeviceGroupPeerMemoryFeatures(uint32_t heapIndex, uint32_t localDeviceIndex, uint32_t remoteDeviceIndex, VkPeerMemoryFeatureFlagsKHR* pPeerMemoryFeatures) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<GetDeviceGroupPeerMemoryFeatures>()(table.device, heapIndex, localDeviceIndex, remoteDeviceIndex, pPeerMemoryFeatures);
+		}
+	};
+};
+#endif
+#if (defined(VK_VERSION_1_1))
+struct BindBufferMemory2 {
+	using type = PFN_vkBindBufferMemory2;
+	static constexpr const char* name = "vkBindBufferMemory2";
+	template <typename Table> struct Wrapper {
+		VkResult bindBufferMemory2(uint32_t bindInfoCount, const VkBindBufferMemoryInfoKHR* pBindInfos) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			return table.template get<BindBufferMemory2>()(table.device, bindInfoCount, pBindInfos);
+		}
+	};
+};
+#endif
+#if (defined(VK_VERSION_1_1))
+struct BindImageMemory2 {
+	using type = PFN_vkBindImageMemory2;
+	static constexpr const char* name = "vkBindImageMemory2";
+	template <typename Table> struct Wrapper {
+		VkResult bindImageMemory2(uint32_t bindInfoCount, const VkBindImageMemoryInfoKHR* pBindInfos) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			return table.template get<BindImageMemory2>()(table.device, bindInfoCount, pBindInfos);
+		}
+	};
+};
+#endif
+#if (defined(VK_VERSION_1_1))
+struct CmdSetDeviceMask {
+	using type = PFN_vkCmdSetDeviceMask;
+	static constexpr const char* name = "vkCmdSetDeviceMask";
+	template <typename Table> struct Wrapper {
+		void cmdSetDeviceMask(VkCommandBuffer commandBuffer, uint32_t deviceMask) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<CmdSetDeviceMask>()(commandBuffer, deviceMask);
+		}
+	};
+};
+#endif
+#if (defined(VK_KHR_swapchain) && defined(VK_VERSION_1_1)) || (defined(VK_KHR_device_group) && defined(VK_KHR_surface))
+struct GetDeviceGroupPresentCapabilitiesKHR {
+	using type = PFN_vkGetDeviceGroupPresentCapabilitiesKHR;
+	static constexpr const char* name = "vkGetDeviceGroupPresentCapabilitiesKHR";
+	template <typename Table> struct Wrapper {
+		VkResult getDeviceGroupPresentCapabilitiesKHR(VkDeviceGroupPresentCapabilitiesKHR* pDeviceGroupPresentCapabilities) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			return table.template get<GetDeviceGroupPresentCapabilitiesKHR>()(table.device, pDeviceGroupPresentCapabilities);
+		}
+	};
+};
+#endif
+#if (defined(VK_KHR_swapchain) && defined(VK_VERSION_1_1)) || (defined(VK_KHR_device_group) && defined(VK_KHR_surface))
+struct GetDeviceGroupSurfacePresentModesKHR {
+	using type = PFN_vkGetDeviceGroupSurfacePresentModesKHR;
+	static constexpr const char* name = "vkGetDeviceGroupSurfacePresentModesKHR";
+	template <typename Table> struct Wrapper {
+		VkResult getDeviceGroupSurfacePresentModesKHR(VkSurfaceKHR surface, VkDeviceGroupPresentModeFlagsKHR* pModes) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			return table.template get<GetDeviceGroupSurfacePresentModesKHR>()(table.device, surface, pModes);
+		}
+	};
+};
+#endif
+#if (defined(VK_KHR_swapchain) && defined(VK_VERSION_1_1)) || (defined(VK_KHR_device_group) && defined(VK_KHR_swapchain))
+struct AcquireNextImage2KHR {
+	using type = PFN_vkAcquireNextImage2KHR;
+	static constexpr const char* name = "vkAcquireNextImage2KHR";
+	template <typename Table> struct Wrapper {
+		VkResult acquireNextImage2KHR(const VkAcquireNextImageInfoKHR* pAcquireInfo, uint32_t* pImageIndex) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			return table.template get<AcquireNextImage2KHR>()(table.device, pAcquireInfo, pImageIndex);
+		}
+	};
+};
+#endif
+#if (defined(VK_VERSION_1_1))
+struct CmdDispatchBase {
+	using type = PFN_vkCmdDispatchBase;
+	static constexpr const char* name = "vkCmdDispatchBase";
+	template <typename Table> struct Wrapper {
+		void cmdDispatchBase(VkCommandBuffer commandBuffer, uint32_t baseGroupX, uint32_t baseGroupY, uint32_t baseGroupZ, uint32_t groupCountX, uint32_t groupCountY, uint32_t groupCountZ) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<CmdDispatchBase>()(commandBuffer, baseGroupX, baseGroupY, baseGroupZ, groupCountX, groupCountY, groupCountZ);
+		}
+	};
+};
+#endif
+#if (defined(VK_VERSION_1_1))
+struct CreateDescriptorUpdateTemplate {
+	using type = PFN_vkCreateDescriptorUpdateTemplate;
+	static constexpr const char* name = "vkCreateDescriptorUpdateTemplate";
+	template <typename Table> struct Wrapper {
+		VkResult createDescriptorUpdateTemplate(const VkDescriptorUpdateTemplateCreateInfoKHR* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkDescriptorUpdateTemplateKHR* pDescriptorUpdateTemplate) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			return table.template get<CreateDescriptorUpdateTemplate>()(table.device, pCreateInfo, pAllocator, pDescriptorUpdateTemplate);
+		}
+	};
+};
+#endif
+#if (defined(VK_VERSION_1_1))
+struct DestroyDescriptorUpdateTemplate {
+	using type = PFN_vkDestroyDescriptorUpdateTemplate;
+	static constexpr const char* name = "vkDestroyDescriptorUpdateTemplate";
+	template <typename Table> struct Wrapper {
+		void destroyDescriptorUpdateTemplate(VkDescriptorUpdateTemplateKHR descriptorUpdateTemplate, const VkAllocationCallbacks* pAllocator) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<DestroyDescriptorUpdateTemplate>()(table.device, descriptorUpdateTemplate, pAllocator);
+		}
+	};
+};
+#endif
+#if (defined(VK_VERSION_1_1))
+struct UpdateDescriptorSetWithTemplate {
+	using type = PFN_vkUpdateDescriptorSetWithTemplate;
+	static constexpr const char* name = "vkUpdateDescriptorSetWithTemplate";
+	template <typename Table> struct Wrapper {
+		void updateDescriptorSetWithTemplate(VkDescriptorSet descriptorSet, VkDescriptorUpdateTemplateKHR descriptorUpdateTemplate, const void* pData) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<UpdateDescriptorSetWithTemplate>()(table.device, descriptorSet, descriptorUpdateTemplate, pData);
+		}
+	};
+};
+#endif
+#if (defined(VK_KHR_push_descriptor) && defined(VK_VERSION_1_1)) || (defined(VK_KHR_push_descriptor) && defined(VK_KHR_descriptor_update_template)) || (defined(VK_KHR_descriptor_update_template) && defined(VK_KHR_push_descriptor))
+struct CmdPushDescriptorSetWithTemplateKHR {
+	using type = PFN_vkCmdPushDescriptorSetWithTemplateKHR;
+	static constexpr const char* name = "vkCmdPushDescriptorSetWithTemplateKHR";
+	template <typename Table> struct Wrapper {
+		void cmdPushDescriptorSetWithTemplateKHR(VkCommandBuffer commandBuffer, VkDescriptorUpdateTemplateKHR descriptorUpdateTemplate, VkPipelineLayout layout, uint32_t set, const void* pData) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<CmdPushDescriptorSetWithTemplateKHR>()(commandBuffer, descriptorUpdateTemplate, layout, set, pData);
+		}
+	};
+};
+#endif
+#if (defined(VK_EXT_hdr_metadata))
+struct SetHdrMetadataEXT {
+	using type = PFN_vkSetHdrMetadataEXT;
+	static constexpr const char* name = "vkSetHdrMetadataEXT";
+	template <typename Table> struct Wrapper {
+		void setHdrMetadataEXT(uint32_t swapchainCount, const VkSwapchainKHR* pSwapchains, const VkHdrMetadataEXT* pMetadata) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<SetHdrMetadataEXT>()(table.device, swapchainCount, pSwapchains, pMetadata);
+		}
+	};
+};
+#endif
+#if (defined(VK_KHR_shared_presentable_image))
+struct GetSwapchainStatusKHR {
+	using type = PFN_vkGetSwapchainStatusKHR;
+	static constexpr const char* name = "vkGetSwapchainStatusKHR";
+	template <typename Table> struct Wrapper {
+		VkResult getSwapchainStatusKHR(VkSwapchainKHR swapchain) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			return table.template get<GetSwapchainStatusKHR>()(table.device, swapchain);
+		}
+	};
+};
+#endif
+#if (defined(VK_GOOGLE_display_timing))
+struct GetRefreshCycleDurationGOOGLE {
+	using type = PFN_vkGetRefreshCycleDurationGOOGLE;
+	static constexpr const char* name = "vkGetRefreshCycleDurationGOOGLE";
+	template <typename Table> struct Wrapper {
+		VkResult getRefreshCycleDurationGOOGLE(VkSwapchainKHR swapchain, VkRefreshCycleDurationGOOGLE* pDisplayTimingProperties) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			return table.template get<GetRefreshCycleDurationGOOGLE>()(table.device, swapchain, pDisplayTimingProperties);
+		}
+	};
+};
+#endif
+#if (defined(VK_GOOGLE_display_timing))
+struct GetPastPresentationTimingGOOGLE {
+	using type = PFN_vkGetPastPresentationTimingGOOGLE;
+	static constexpr const char* name = "vkGetPastPresentationTimingGOOGLE";
+	template <typename Table> struct Wrapper {
+		VkResult getPastPresentationTimingGOOGLE(VkSwapchainKHR swapchain, uint32_t* pPresentationTimingCount, VkPastPresentationTimingGOOGLE* pPresentationTimings) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			return table.template get<GetPastPresentationTimingGOOGLE>()(table.device, swapchain, pPresentationTimingCount, pPresentationTimings);
+		}
+	};
+};
+#endif
+#if (defined(VK_NV_clip_space_w_scaling))
+struct CmdSetViewportWScalingNV {
+	using type = PFN_vkCmdSetViewportWScalingNV;
+	static constexpr const char* name = "vkCmdSetViewportWScalingNV";
+	template <typename Table> struct Wrapper {
+		void cmdSetViewportWScalingNV(VkCommandBuffer commandBuffer, uint32_t firstViewport, uint32_t viewportCount, const VkViewportWScalingNV* pViewportWScalings) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<CmdSetViewportWScalingNV>()(commandBuffer, firstViewport, viewportCount, pViewportWScalings);
+		}
+	};
+};
+#endif
+#if (defined(VK_EXT_discard_rectangles))
+struct CmdSetDiscardRectangleEXT {
+	using type = PFN_vkCmdSetDiscardRectangleEXT;
+	static constexpr const char* name = "vkCmdSetDiscardRectangleEXT";
+	template <typename Table> struct Wrapper {
+		void cmdSetDiscardRectangleEXT(VkCommandBuffer commandBuffer, uint32_t firstDiscardRectangle, uint32_t discardRectangleCount, const VkRect2D* pDiscardRectangles) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<CmdSetDiscardRectangleEXT>()(commandBuffer, firstDiscardRectangle, discardRectangleCount, pDiscardRectangles);
+		}
+	};
+};
+#endif
+#if (defined(VK_EXT_sample_locations))
+struct CmdSetSampleLocationsEXT {
+	using type = PFN_vkCmdSetSampleLocationsEXT;
+	static constexpr const char* name = "vkCmdSetSampleLocationsEXT";
+	template <typename Table> struct Wrapper {
+		void cmdSetSampleLocationsEXT(VkCommandBuffer commandBuffer, const VkSampleLocationsInfoEXT* pSampleLocationsInfo) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<CmdSetSampleLocationsEXT>()(commandBuffer, pSampleLocationsInfo);
+		}
+	};
+};
+#endif
+#if (defined(VK_VERSION_1_1))
+struct GetBufferMemoryRequirements2 {
+	using type = PFN_vkGetBufferMemoryRequirements2;
+	static constexpr const char* name = "vkGetBufferMemoryRequirements2";
+	template <typename Table> struct Wrapper {
+		void getBufferMemoryRequirements2(const VkBufferMemoryRequirementsInfo2KHR* pInfo, VkMemoryRequirements2KHR* pMemoryRequirements) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<GetBufferMemoryRequirements2>()(table.device, pInfo, pMemoryRequirements);
+		}
+	};
+};
+#endif
+#if (defined(VK_VERSION_1_1))
+struct GetImageMemoryRequirements2 {
+	using type = PFN_vkGetImageMemoryRequirements2;
+	static constexpr const char* name = "vkGetImageMemoryRequirements2";
+	template <typename Table> struct Wrapper {
+		void getImageMemoryRequirements2(const VkImageMemoryRequirementsInfo2KHR* pInfo, VkMemoryRequirements2KHR* pMemoryRequirements) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<GetImageMemoryRequirements2>()(table.device, pInfo, pMemoryRequirements);
+		}
+	};
+};
+#endif
+#if (defined(VK_VERSION_1_1))
+struct GetImageSparseMemoryRequirements2 {
+	using type = PFN_vkGetImageSparseMemoryRequirements2;
+	static constexpr const char* name = "vkGetImageSparseMemoryRequirements2";
+	template <typename Table> struct Wrapper {
+		void getImageSparseMemoryRequirements2(const VkImageSparseMemoryRequirementsInfo2KHR* pInfo, uint32_t* pSparseMemoryRequirementCount, VkSparseImageMemoryRequirements2KHR* pSparseMemoryRequirements) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<GetImageSparseMemoryRequirements2>()(table.device, pInfo, pSparseMemoryRequirementCount, pSparseMemoryRequirements);
+		}
+	};
+};
+#endif
+#if (defined(VK_VERSION_1_3))
+struct GetDeviceBufferMemoryRequirements {
+	using type = PFN_vkGetDeviceBufferMemoryRequirements;
+	static constexpr const char* name = "vkGetDeviceBufferMemoryRequirements";
+	template <typename Table> struct Wrapper {
+		void getDeviceBufferMemoryRequirements(const VkDeviceBufferMemoryRequirementsKHR* pInfo, VkMemoryRequirements2KHR* pMemoryRequirements) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<GetDeviceBufferMemoryRequirements>()(table.device, pInfo, pMemoryRequirements);
+		}
+	};
+};
+#endif
+#if (defined(VK_VERSION_1_3))
+struct GetDeviceImageMemoryRequirements {
+	using type = PFN_vkGetDeviceImageMemoryRequirements;
+	static constexpr const char* name = "vkGetDeviceImageMemoryRequirements";
+	template <typename Table> struct Wrapper {
+		void getDeviceImageMemoryRequirements(const VkDeviceImageMemoryRequirementsKHR* pInfo, VkMemoryRequirements2KHR* pMemoryRequirements) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<GetDeviceImageMemoryRequirements>()(table.device, pInfo, pMemoryRequirements);
+		}
+	};
+};
+#endif
+#if (defined(VK_VERSION_1_3))
+struct GetDeviceImageSparseMemoryRequirements {
+	using type = PFN_vkGetDeviceImageSparseMemoryRequirements;
+	static constexpr const char* name = "vkGetDeviceImageSparseMemoryRequirements";
+	template <typename Table> struct Wrapper {
+		void getDeviceImageSparseMemoryRequirements(const VkDeviceImageMemoryRequirementsKHR* pInfo, uint32_t* pSparseMemoryRequirementCount, VkSparseImageMemoryRequirements2KHR* pSparseMemoryRequirements) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<GetDeviceImageSparseMemoryRequirements>()(table.device, pInfo, pSparseMemoryRequirementCount, pSparseMemoryRequirements);
+		}
+	};
+};
+#endif
+#if (defined(VK_VERSION_1_1))
+struct CreateSamplerYcbcrConversion {
+	using type = PFN_vkCreateSamplerYcbcrConversion;
+	static constexpr const char* name = "vkCreateSamplerYcbcrConversion";
+	template <typename Table> struct Wrapper {
+		VkResult createSamplerYcbcrConversion(const VkSamplerYcbcrConversionCreateInfoKHR* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkSamplerYcbcrConversionKHR* pYcbcrConversion) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			return table.template get<CreateSamplerYcbcrConversion>()(table.device, pCreateInfo, pAllocator, pYcbcrConversion);
+		}
+	};
+};
+#endif
+#if (defined(VK_VERSION_1_1))
+struct DestroySamplerYcbcrConversion {
+	using type = PFN_vkDestroySamplerYcbcrConversion;
+	static constexpr const char* name = "vkDestroySamplerYcbcrConversion";
+	template <typename Table> struct Wrapper {
+		void destroySamplerYcbcrConversion(VkSamplerYcbcrConversionKHR ycbcrConversion, const VkAllocationCallbacks* pAllocator) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<DestroySamplerYcbcrConversion>()(table.device, ycbcrConversion, pAllocator);
+		}
+	};
+};
+#endif
+#if (defined(VK_VERSION_1_1))
+struct GetDeviceQueue2 {
+	using type = PFN_vkGetDeviceQueue2;
+	static constexpr const char* name = "vkGetDeviceQueue2";
+	template <typename Table> struct Wrapper {
+		void getDeviceQueue2(const VkDeviceQueueInfo2* pQueueInfo, VkQueue* pQueue) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<GetDeviceQueue2>()(table.device, pQueueInfo, pQueue);
+		}
+	};
+};
+#endif
+#if (defined(VK_EXT_validation_cache))
+struct CreateValidationCacheEXT {
+	using type = PFN_vkCreateValidationCacheEXT;
+	static constexpr const char* name = "vkCreateValidationCacheEXT";
+	template <typename Table> struct Wrapper {
+		VkResult createValidationCacheEXT(const VkValidationCacheCreateInfoEXT* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkValidationCacheEXT* pValidationCache) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			return table.template get<CreateValidationCacheEXT>()(table.device, pCreateInfo, pAllocator, pValidationCache);
+		}
+	};
+};
+#endif
+#if (defined(VK_EXT_validation_cache))
+struct DestroyValidationCacheEXT {
+	using type = PFN_vkDestroyValidationCacheEXT;
+	static constexpr const char* name = "vkDestroyValidationCacheEXT";
+	template <typename Table> struct Wrapper {
+		void destroyValidationCacheEXT(VkValidationCacheEXT validationCache, const VkAllocationCallbacks* pAllocator) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<DestroyValidationCacheEXT>()(table.device, validationCache, pAllocator);
+		}
+	};
+};
+#endif
+#if (defined(VK_EXT_validation_cache))
+struct GetValidationCacheDataEXT {
+	using type = PFN_vkGetValidationCacheDataEXT;
+	static constexpr const char* name = "vkGetValidationCacheDataEXT";
+	template <typename Table> struct Wrapper {
+		VkResult getValidationCacheDataEXT(VkValidationCacheEXT validationCache, size_t* pDataSize, void* pData) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			return table.template get<GetValidationCacheDataEXT>()(table.device, validationCache, pDataSize, pData);
+		}
+	};
+};
+#endif
+#if (defined(VK_EXT_validation_cache))
+struct MergeValidationCachesEXT {
+	using type = PFN_vkMergeValidationCachesEXT;
+	static constexpr const char* name = "vkMergeValidationCachesEXT";
+	template <typename Table> struct Wrapper {
+		VkResult mergeValidationCachesEXT(VkValidationCacheEXT dstCache, uint32_t srcCacheCount, const VkValidationCacheEXT* pSrcCaches) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			return table.template get<MergeValidationCachesEXT>()(table.device, dstCache, srcCacheCount, pSrcCaches);
+		}
+	};
+};
+#endif
+#if (defined(VK_VERSION_1_1))
+struct GetDescriptorSetLayoutSupport {
+	using type = PFN_vkGetDescriptorSetLayoutSupport;
+	static constexpr const char* name = "vkGetDescriptorSetLayoutSupport";
+	template <typename Table> struct Wrapper {
+		void getDescriptorSetLayoutSupport(const VkDescriptorSetLayoutCreateInfo* pCreateInfo, VkDescriptorSetLayoutSupportKHR* pSupport) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<GetDescriptorSetLayoutSupport>()(table.device, pCreateInfo, pSupport);
+		}
+	};
+};
+#endif
+#if (defined(VK_ANDROID_native_buffer))
+struct GetSwapchainGrallocUsageANDROID {
+	using type = PFN_vkGetSwapchainGrallocUsageANDROID;
+	static constexpr const char* name = "vkGetSwapchainGrallocUsageANDROID";
+	template <typename Table> struct Wrapper {
+		VkResult getSwapchainGrallocUsageANDROID(VkFormat format, VkImageUsageFlags imageUsage, int* grallocUsage) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			return table.template get<GetSwapchainGrallocUsageANDROID>()(table.device, format, imageUsage, grallocUsage);
+		}
+	};
+};
+#endif
+#if (defined(VK_ANDROID_native_buffer))
+struct GetSwapchainGrallocUsage2ANDROID {
+	using type = PFN_vkGetSwapchainGrallocUsage2ANDROID;
+	static constexpr const char* name = "vkGetSwapchainGrallocUsage2ANDROID";
+	template <typename Table> struct Wrapper {
+		VkResult getSwapchainGrallocUsage2ANDROID(VkFormat format, VkImageUsageFlags imageUsage, VkSwapchainImageUsageFlagsANDROID swapchainImageUsage, uint64_t* grallocConsumerUsage, uint64_t* grallocProducerUsage) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			return table.template get<GetSwapchainGrallocUsage2ANDROID>()(table.device, format, imageUsage, swapchainImageUsage, grallocConsumerUsage, grallocProducerUsage);
+		}
+	};
+};
+#endif
+#if (defined(VK_ANDROID_native_buffer))
+struct AcquireImageANDROID {
+	using type = PFN_vkAcquireImageANDROID;
+	static constexpr const char* name = "vkAcquireImageANDROID";
+	template <typename Table> struct Wrapper {
+		VkResult acquireImageANDROID(VkImage image, int nativeFenceFd, VkSemaphore semaphore, VkFence fence) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			return table.template get<AcquireImageANDROID>()(table.device, image, nativeFenceFd, semaphore, fence);
+		}
+	};
+};
+#endif
+#if (defined(VK_ANDROID_native_buffer))
+struct QueueSignalReleaseImageANDROID {
+	using type = PFN_vkQueueSignalReleaseImageANDROID;
+	static constexpr const char* name = "vkQueueSignalReleaseImageANDROID";
+	template <typename Table> struct Wrapper {
+		VkResult queueSignalReleaseImageANDROID(VkQueue queue, uint32_t waitSemaphoreCount, const VkSemaphore* pWaitSemaphores, VkImage image, int* pNativeFenceFd) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			return table.template get<QueueSignalReleaseImageANDROID>()(queue, waitSemaphoreCount, pWaitSemaphores, image, pNativeFenceFd);
+		}
+	};
+};
+#endif
+#if (defined(VK_AMD_shader_info))
+struct GetShaderInfoAMD {
+	using type = PFN_vkGetShaderInfoAMD;
+	static constexpr const char* name = "vkGetShaderInfoAMD";
+	template <typename Table> struct Wrapper {
+		VkResult getShaderInfoAMD(VkPipeline pipeline, VkShaderStageFlagBits shaderStage, VkShaderInfoTypeAMD infoType, size_t* pInfoSize, void* pInfo) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			return table.template get<GetShaderInfoAMD>()(table.device, pipeline, shaderStage, infoType, pInfoSize, pInfo);
+		}
+	};
+};
+#endif
+#if (defined(VK_AMD_display_native_hdr))
+struct SetLocalDimmingAMD {
+	using type = PFN_vkSetLocalDimmingAMD;
+	static constexpr const char* name = "vkSetLocalDimmingAMD";
+	template <typename Table> struct Wrapper {
+		void setLocalDimmingAMD(VkSwapchainKHR swapChain, VkBool32 localDimmingEnable) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<SetLocalDimmingAMD>()(table.device, swapChain, localDimmingEnable);
+		}
+	};
+};
+#endif
+#if (defined(VK_EXT_calibrated_timestamps))
+struct GetCalibratedTimestampsEXT {
+	using type = PFN_vkGetCalibratedTimestampsEXT;
+	static constexpr const char* name = "vkGetCalibratedTimestampsEXT";
+	template <typename Table> struct Wrapper {
+		VkResult getCalibratedTimestampsEXT(uint32_t timestampCount, const VkCalibratedTimestampInfoEXT* pTimestampInfos, uint64_t* pTimestamps, uint64_t* pMaxDeviation) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			return table.template get<GetCalibratedTimestampsEXT>()(table.device, timestampCount, pTimestampInfos, pTimestamps, pMaxDeviation);
+		}
+	};
+};
+#endif
+#if (defined(VK_EXT_debug_utils))
+struct SetDebugUtilsObjectNameEXT {
+	using type = PFN_vkSetDebugUtilsObjectNameEXT;
+	static constexpr const char* name = "vkSetDebugUtilsObjectNameEXT";
+	template <typename Table> struct Wrapper {
+		VkResult setDebugUtilsObjectNameEXT(const VkDebugUtilsObjectNameInfoEXT* pNameInfo) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			return table.template get<SetDebugUtilsObjectNameEXT>()(table.device, pNameInfo);
+		}
+	};
+};
+#endif
+#if (defined(VK_EXT_debug_utils))
+struct SetDebugUtilsObjectTagEXT {
+	using type = PFN_vkSetDebugUtilsObjectTagEXT;
+	static constexpr const char* name = "vkSetDebugUtilsObjectTagEXT";
+	template <typename Table> struct Wrapper {
+		VkResult setDebugUtilsObjectTagEXT(const VkDebugUtilsObjectTagInfoEXT* pTagInfo) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			return table.template get<SetDebugUtilsObjectTagEXT>()(table.device, pTagInfo);
+		}
+	};
+};
+#endif
+#if (defined(VK_EXT_debug_utils))
+struct QueueBeginDebugUtilsLabelEXT {
+	using type = PFN_vkQueueBeginDebugUtilsLabelEXT;
+	static constexpr const char* name = "vkQueueBeginDebugUtilsLabelEXT";
+	template <typename Table> struct Wrapper {
+		void queueBeginDebugUtilsLabelEXT(VkQueue queue, const VkDebugUtilsLabelEXT* pLabelInfo) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<QueueBeginDebugUtilsLabelEXT>()(queue, pLabelInfo);
+		}
+	};
+};
+#endif
+#if (defined(VK_EXT_debug_utils))
+struct QueueEndDebugUtilsLabelEXT {
+	using type = PFN_vkQueueEndDebugUtilsLabelEXT;
+	static constexpr const char* name = "vkQueueEndDebugUtilsLabelEXT";
+	template <typename Table> struct Wrapper {
+		void queueEndDebugUtilsLabelEXT(VkQueue queue) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<QueueEndDebugUtilsLabelEXT>()(queue);
+		}
+	};
+};
+#endif
+#if (defined(VK_EXT_debug_utils))
+struct QueueInsertDebugUtilsLabelEXT {
+	using type = PFN_vkQueueInsertDebugUtilsLabelEXT;
+	static constexpr const char* name = "vkQueueInsertDebugUtilsLabelEXT";
+	template <typename Table> struct Wrapper {
+		void queueInsertDebugUtilsLabelEXT(VkQueue queue, const VkDebugUtilsLabelEXT* pLabelInfo) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<QueueInsertDebugUtilsLabelEXT>()(queue, pLabelInfo);
+		}
+	};
+};
+#endif
+#if (defined(VK_EXT_debug_utils))
+struct CmdBeginDebugUtilsLabelEXT {
+	using type = PFN_vkCmdBeginDebugUtilsLabelEXT;
+	static constexpr const char* name = "vkCmdBeginDebugUtilsLabelEXT";
+	template <typename Table> struct Wrapper {
+		void cmdBeginDebugUtilsLabelEXT(VkCommandBuffer commandBuffer, const VkDebugUtilsLabelEXT* pLabelInfo) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<CmdBeginDebugUtilsLabelEXT>()(commandBuffer, pLabelInfo);
+		}
+	};
+};
+#endif
+#if (defined(VK_EXT_debug_utils))
+struct CmdEndDebugUtilsLabelEXT {
+	using type = PFN_vkCmdEndDebugUtilsLabelEXT;
+	static constexpr const char* name = "vkCmdEndDebugUtilsLabelEXT";
+	template <typename Table> struct Wrapper {
+		void cmdEndDebugUtilsLabelEXT(VkCommandBuffer commandBuffer) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<CmdEndDebugUtilsLabelEXT>()(commandBuffer);
+		}
+	};
+};
+#endif
+#if (defined(VK_EXT_debug_utils))
+struct CmdInsertDebugUtilsLabelEXT {
+	using type = PFN_vkCmdInsertDebugUtilsLabelEXT;
+	static constexpr const char* name = "vkCmdInsertDebugUtilsLabelEXT";
+	template <typename Table> struct Wrapper {
+		void cmdInsertDebugUtilsLabelEXT(VkCommandBuffer commandBuffer, const VkDebugUtilsLabelEXT* pLabelInfo) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<CmdInsertDebugUtilsLabelEXT>()(commandBuffer, pLabelInfo);
+		}
+	};
+};
+#endif
+#if (defined(VK_EXT_external_memory_host))
+struct GetMemoryHostPointerPropertiesEXT {
+	using type = PFN_vkGetMemoryHostPointerPropertiesEXT;
+	static constexpr const char* name = "vkGetMemoryHostPointerPropertiesEXT";
+	template <typename Table> struct Wrapper {
+		VkResult getMemoryHostPointerPropertiesEXT(VkExternalMemoryHandleTypeFlagBitsKHR handleType, const void* pHostPointer, VkMemoryHostPointerPropertiesEXT* pMemoryHostPointerProperties) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			return table.template get<GetMemoryHostPointerPropertiesEXT>()(table.device, handleType, pHostPointer, pMemoryHostPointerProperties);
+		}
+	};
+};
+#endif
+#if (defined(VK_AMD_buffer_marker))
+struct CmdWriteBufferMarkerAMD {
+	using type = PFN_vkCmdWriteBufferMarkerAMD;
+	static constexpr const char* name = "vkCmdWriteBufferMarkerAMD";
+	template <typename Table> struct Wrapper {
+		void cmdWriteBufferMarkerAMD(VkCommandBuffer commandBuffer, VkPipelineStageFlagBits pipelineStage, VkBuffer dstBuffer, VkDeviceSize dstOffset, uint32_t marker) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<CmdWriteBufferMarkerAMD>()(commandBuffer, pipelineStage, dstBuffer, dstOffset, marker);
+		}
+	};
+};
+#endif
+#if (defined(VK_VERSION_1_2))
+struct CreateRenderPass2 {
+	using type = PFN_vkCreateRenderPass2;
+	static constexpr const char* name = "vkCreateRenderPass2";
+	template <typename Table> struct Wrapper {
+		VkResult createRenderPass2(const VkRenderPassCreateInfo2KHR* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkRenderPass* pRenderPass) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			return table.template get<CreateRenderPass2>()(table.device, pCreateInfo, pAllocator, pRenderPass);
+		}
+	};
+};
+#endif
+#if (defined(VK_VERSION_1_2))
+struct CmdBeginRenderPass2 {
+	using type = PFN_vkCmdBeginRenderPass2;
+	static constexpr const char* name = "vkCmdBeginRenderPass2";
+	template <typename Table> struct Wrapper {
+		void cmdBeginRenderPass2(VkCommandBuffer commandBuffer, const VkRenderPassBeginInfo* pRenderPassBegin, const VkSubpassBeginInfoKHR* pSubpassBeginInfo) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<CmdBeginRenderPass2>()(commandBuffer, pRenderPassBegin, pSubpassBeginInfo);
+		}
+	};
+};
+#endif
+#if (defined(VK_VERSION_1_2))
+struct CmdNextSubpass2 {
+	using type = PFN_vkCmdNextSubpass2;
+	static constexpr const char* name = "vkCmdNextSubpass2";
+	template <typename Table> struct Wrapper {
+		void cmdNextSubpass2(VkCommandBuffer commandBuffer, const VkSubpassBeginInfoKHR* pSubpassBeginInfo, const VkSubpassEndInfoKHR* pSubpassEndInfo) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<CmdNextSubpass2>()(commandBuffer, pSubpassBeginInfo, pSubpassEndInfo);
+		}
+	};
+};
+#endif
+#if (defined(VK_VERSION_1_2))
+struct CmdEndRenderPass2 {
+	using type = PFN_vkCmdEndRenderPass2;
+	static constexpr const char* name = "vkCmdEndRenderPass2";
+	template <typename Table> struct Wrapper {
+		void cmdEndRenderPass2(VkCommandBuffer commandBuffer, const VkSubpassEndInfoKHR* pSubpassEndInfo) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<CmdEndRenderPass2>()(commandBuffer, pSubpassEndInfo);
+		}
+	};
+};
+#endif
+#if (defined(VK_VERSION_1_2))
+struct GetSemaphoreCounterValue {
+	using type = PFN_vkGetSemaphoreCounterValue;
+	static constexpr const char* name = "vkGetSemaphoreCounterValue";
+	template <typename Table> struct Wrapper {
+		VkResult getSemaphoreCounterValue(VkSemaphore semaphore, uint64_t* pValue) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			return table.template get<GetSemaphoreCounterValue>()(table.device, semaphore, pValue);
+		}
+	};
+};
+#endif
+#if (defined(VK_VERSION_1_2))
+struct WaitSemaphores {
+	using type = PFN_vkWaitSemaphores;
+	static constexpr const char* name = "vkWaitSemaphores";
+	template <typename Table> struct Wrapper {
+		VkResult waitSemaphores(const VkSemaphoreWaitInfoKHR* pWaitInfo, uint64_t timeout) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			return table.template get<WaitSemaphores>()(table.device, pWaitInfo, timeout);
+		}
+	};
+};
+#endif
+#if (defined(VK_VERSION_1_2))
+struct SignalSemaphore {
+	using type = PFN_vkSignalSemaphore;
+	static constexpr const char* name = "vkSignalSemaphore";
+	template <typename Table> struct Wrapper {
+		VkResult signalSemaphore(const VkSemaphoreSignalInfoKHR* pSignalInfo) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			return table.template get<SignalSemaphore>()(table.device, pSignalInfo);
+		}
+	};
+};
+#endif
+#if (defined(VK_ANDROID_external_memory_android_hardware_buffer))
+struct GetAndroidHardwareBufferPropertiesANDROID {
+	using type = PFN_vkGetAndroidHardwareBufferPropertiesANDROID;
+	static constexpr const char* name = "vkGetAndroidHardwareBufferPropertiesANDROID";
+	template <typename Table> struct Wrapper {
+		VkResult getAndroidHardwareBufferPropertiesANDROID(const struct AHardwareBuffer* buffer, VkAndroidHardwareBufferPropertiesANDROID* pProperties) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			return table.template get<GetAndroidHardwareBufferPropertiesANDROID>()(table.device, buffer, pProperties);
+		}
+	};
+};
+#endif
+#if (defined(VK_ANDROID_external_memory_android_hardware_buffer))
+struct GetMemoryAndroidHardwareBufferANDROID {
+	using type = PFN_vkGetMemoryAndroidHardwareBufferANDROID;
+	static constexpr const char* name = "vkGetMemoryAndroidHardwareBufferANDROID";
+	template <typename Table> struct Wrapper {
+		VkResult getMemoryAndroidHardwareBufferANDROID(const VkMemoryGetAndroidHardwareBufferInfoANDROID* pInfo, struct AHardwareBuffer** pBuffer) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			return table.template get<GetMemoryAndroidHardwareBufferANDROID>()(table.device, pInfo, pBuffer);
+		}
+	};
+};
+#endif
+#if (defined(VK_VERSION_1_2))
+struct CmdDrawIndirectCount {
+	using type = PFN_vkCmdDrawIndirectCount;
+	static constexpr const char* name = "vkCmdDrawIndirectCount";
+	template <typename Table> struct Wrapper {
+		void cmdDrawIndirectCount(VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset, VkBuffer countBuffer, VkDeviceSize countBufferOffset, uint32_t maxDrawCount, uint32_t stride) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<CmdDrawIndirectCount>()(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
+		}
+	};
+};
+#endif
+#if (defined(VK_VERSION_1_2))
+struct CmdDrawIndexedIndirectCount {
+	using type = PFN_vkCmdDrawIndexedIndirectCount;
+	static constexpr const char* name = "vkCmdDrawIndexedIndirectCount";
+	template <typename Table> struct Wrapper {
+		void cmdDrawIndexedIndirectCount(VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset, VkBuffer countBuffer, VkDeviceSize countBufferOffset, uint32_t maxDrawCount, uint32_t stride) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<CmdDrawIndexedIndirectCount>()(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
+		}
+	};
+};
+#endif
+#if (defined(VK_NV_device_diagnostic_checkpoints))
+struct CmdSetCheckpointNV {
+	using type = PFN_vkCmdSetCheckpointNV;
+	static constexpr const char* name = "vkCmdSetCheckpointNV";
+	template <typename Table> struct Wrapper {
+		void cmdSetCheckpointNV(VkCommandBuffer commandBuffer, const void* pCheckpointMarker) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<CmdSetCheckpointNV>()(commandBuffer, pCheckpointMarker);
+		}
+	};
+};
+#endif
+#if (defined(VK_NV_device_diagnostic_checkpoints))
+struct GetQueueCheckpointDataNV {
+	using type = PFN_vkGetQueueCheckpointDataNV;
+	static constexpr const char* name = "vkGetQueueCheckpointDataNV";
+	template <typename Table> struct Wrapper {
+		void getQueueCheckpointDataNV(VkQueue queue, uint32_t* pCheckpointDataCount, VkCheckpointDataNV* pCheckpointData) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<GetQueueCheckpointDataNV>()(queue, pCheckpointDataCount, pCheckpointData);
+		}
+	};
+};
+#endif
+#if (defined(VK_EXT_transform_feedback))
+struct CmdBindTransformFeedbackBuffersEXT {
+	using type = PFN_vkCmdBindTransformFeedbackBuffersEXT;
+	static constexpr const char* name = "vkCmdBindTransformFeedbackBuffersEXT";
+	template <typename Table> struct Wrapper {
+		void cmdBindTransformFeedbackBuffersEXT(VkCommandBuffer commandBuffer, uint32_t firstBinding, uint32_t bindingCount, const VkBuffer* pBuffers, const VkDeviceSize* pOffsets, const VkDeviceSize* pSizes) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<CmdBindTransformFeedbackBuffersEXT>()(commandBuffer, firstBinding, bindingCount, pBuffers, pOffsets, pSizes);
+		}
+	};
+};
+#endif
+#if (defined(VK_EXT_transform_feedback))
+struct CmdBeginTransformFeedbackEXT {
+	using type = PFN_vkCmdBeginTransformFeedbackEXT;
+	static constexpr const char* name = "vkCmdBeginTransformFeedbackEXT";
+	template <typename Table> struct Wrapper {
+		void cmdBeginTransformFeedbackEXT(VkCommandBuffer commandBuffer, uint32_t firstCounterBuffer, uint32_t counterBufferCount, const VkBuffer* pCounterBuffers, const VkDeviceSize* pCounterBufferOffsets) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<CmdBeginTransformFeedbackEXT>()(commandBuffer, firstCounterBuffer, counterBufferCount, pCounterBuffers, pCounterBufferOffsets);
+		}
+	};
+};
+#endif
+#if (defined(VK_EXT_transform_feedback))
+struct CmdEndTransformFeedbackEXT {
+	using type = PFN_vkCmdEndTransformFeedbackEXT;
+	static constexpr const char* name = "vkCmdEndTransformFeedbackEXT";
+	template <typename Table> struct Wrapper {
+		void cmdEndTransformFeedbackEXT(VkCommandBuffer commandBuffer, uint32_t firstCounterBuffer, uint32_t counterBufferCount, const VkBuffer* pCounterBuffers, const VkDeviceSize* pCounterBufferOffsets) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<CmdEndTransformFeedbackEXT>()(commandBuffer, firstCounterBuffer, counterBufferCount, pCounterBuffers, pCounterBufferOffsets);
+		}
+	};
+};
+#endif
+#if (defined(VK_EXT_transform_feedback))
+struct CmdBeginQueryIndexedEXT {
+	using type = PFN_vkCmdBeginQueryIndexedEXT;
+	static constexpr const char* name = "vkCmdBeginQueryIndexedEXT";
+	template <typename Table> struct Wrapper {
+		void cmdBeginQueryIndexedEXT(VkCommandBuffer commandBuffer, VkQueryPool queryPool, uint32_t query, VkQueryControlFlags flags, uint32_t index) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<CmdBeginQueryIndexedEXT>()(commandBuffer, queryPool, query, flags, index);
+		}
+	};
+};
+#endif
+#if (defined(VK_EXT_transform_feedback))
+struct CmdEndQueryIndexedEXT {
+	using type = PFN_vkCmdEndQueryIndexedEXT;
+	static constexpr const char* name = "vkCmdEndQueryIndexedEXT";
+	template <typename Table> struct Wrapper {
+		void cmdEndQueryIndexedEXT(VkCommandBuffer commandBuffer, VkQueryPool queryPool, uint32_t query, uint32_t index) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<CmdEndQueryIndexedEXT>()(commandBuffer, queryPool, query, index);
+		}
+	};
+};
+#endif
+#if (defined(VK_EXT_transform_feedback))
+struct CmdDrawIndirectByteCountEXT {
+	using type = PFN_vkCmdDrawIndirectByteCountEXT;
+	static constexpr const char* name = "vkCmdDrawIndirectByteCountEXT";
+	template <typename Table> struct Wrapper {
+		void cmdDrawIndirectByteCountEXT(VkCommandBuffer commandBuffer, uint32_t instanceCount, uint32_t firstInstance, VkBuffer counterBuffer, VkDeviceSize counterBufferOffset, uint32_t counterOffset, uint32_t vertexStride) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<CmdDrawIndirectByteCountEXT>()(commandBuffer, instanceCount, firstInstance, counterBuffer, counterBufferOffset, counterOffset, vertexStride);
+		}
+	};
+};
+#endif
+#if (defined(VK_NV_scissor_exclusive))
+struct CmdSetExclusiveScissorNV {
+	using type = PFN_vkCmdSetExclusiveScissorNV;
+	static constexpr const char* name = "vkCmdSetExclusiveScissorNV";
+	template <typename Table> struct Wrapper {
+		void cmdSetExclusiveScissorNV(VkCommandBuffer commandBuffer, uint32_t firstExclusiveScissor, uint32_t exclusiveScissorCount, const VkRect2D* pExclusiveScissors) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<CmdSetExclusiveScissorNV>()(commandBuffer, firstExclusiveScissor, exclusiveScissorCount, pExclusiveScissors);
+		}
+	};
+};
+#endif
+#if (defined(VK_NV_shading_rate_image))
+struct CmdBindShadingRateImageNV {
+	using type = PFN_vkCmdBindShadingRateImageNV;
+	static constexpr const char* name = "vkCmdBindShadingRateImageNV";
+	template <typename Table> struct Wrapper {
+		void cmdBindShadingRateImageNV(VkCommandBuffer commandBuffer, VkImageView imageView, VkImageLayout imageLayout) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<CmdBindShadingRateImageNV>()(commandBuffer, imageView, imageLayout);
+		}
+	};
+};
+#endif
+#if (defined(VK_NV_shading_rate_image))
+struct CmdSetViewportShadingRatePaletteNV {
+	using type = PFN_vkCmdSetViewportShadingRatePaletteNV;
+	static constexpr const char* name = "vkCmdSetViewportShadingRatePaletteNV";
+	template <typename Table> struct Wrapper {
+		void cmdSetViewportShadingRatePaletteNV(VkCommandBuffer commandBuffer, uint32_t firstViewport, uint32_t viewportCount, const VkShadingRatePaletteNV* pShadingRatePalettes) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<CmdSetViewportShadingRatePaletteNV>()(commandBuffer, firstViewport, viewportCount, pShadingRatePalettes);
+		}
+	};
+};
+#endif
+#if (defined(VK_NV_shading_rate_image))
+struct CmdSetCoarseSampleOrderNV {
+	using type = PFN_vkCmdSetCoarseSampleOrderNV;
+	static constexpr const char* name = "vkCmdSetCoarseSampleOrderNV";
+	template <typename Table> struct Wrapper {
+		void cmdSetCoarseSampleOrderNV(VkCommandBuffer commandBuffer, VkCoarseSampleOrderTypeNV sampleOrderType, uint32_t customSampleOrderCount, const VkCoarseSampleOrderCustomNV* pCustomSampleOrders) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<CmdSetCoarseSampleOrderNV>()(commandBuffer, sampleOrderType, customSampleOrderCount, pCustomSampleOrders);
+		}
+	};
+};
+#endif
+#if (defined(VK_NV_mesh_shader))
+struct CmdDrawMeshTasksNV {
+	using type = PFN_vkCmdDrawMeshTasksNV;
+	static constexpr const char* name = "vkCmdDrawMeshTasksNV";
+	template <typename Table> struct Wrapper {
+		void cmdDrawMeshTasksNV(VkCommandBuffer commandBuffer, uint32_t taskCount, uint32_t firstTask) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<CmdDrawMeshTasksNV>()(commandBuffer, taskCount, firstTask);
+		}
+	};
+};
+#endif
+#if (defined(VK_NV_mesh_shader))
+struct CmdDrawMeshTasksIndirectNV {
+	using type = PFN_vkCmdDrawMeshTasksIndirectNV;
+	static constexpr const char* name = "vkCmdDrawMeshTasksIndirectNV";
+	template <typename Table> struct Wrapper {
+		void cmdDrawMeshTasksIndirectNV(VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset, uint32_t drawCount, uint32_t stride) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<CmdDrawMeshTasksIndirectNV>()(commandBuffer, buffer, offset, drawCount, stride);
+		}
+	};
+};
+#endif
+#if (defined(VK_NV_mesh_shader))
+struct CmdDrawMeshTasksIndirectCountNV {
+	using type = PFN_vkCmdDrawMeshTasksIndirectCountNV;
+	static constexpr const char* name = "vkCmdDrawMeshTasksIndirectCountNV";
+	template <typename Table> struct Wrapper {
+		void cmdDrawMeshTasksIndirectCountNV(VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset, VkBuffer countBuffer, VkDeviceSize countBufferOffset, uint32_t maxDrawCount, uint32_t stride) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<CmdDrawMeshTasksIndirectCountNV>()(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
+		}
+	};
+};
+#endif
+#if (defined(VK_EXT_mesh_shader))
+struct CmdDrawMeshTasksEXT {
+	using type = PFN_vkCmdDrawMeshTasksEXT;
+	static constexpr const char* name = "vkCmdDrawMeshTasksEXT";
+	template <typename Table> struct Wrapper {
+		void cmdDrawMeshTasksEXT(VkCommandBuffer commandBuffer, uint32_t groupCountX, uint32_t groupCountY, uint32_t groupCountZ) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<CmdDrawMeshTasksEXT>()(commandBuffer, groupCountX, groupCountY, groupCountZ);
+		}
+	};
+};
+#endif
+#if (defined(VK_EXT_mesh_shader))
+struct CmdDrawMeshTasksIndirectEXT {
+	using type = PFN_vkCmdDrawMeshTasksIndirectEXT;
+	static constexpr const char* name = "vkCmdDrawMeshTasksIndirectEXT";
+	template <typename Table> struct Wrapper {
+		void cmdDrawMeshTasksIndirectEXT(VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset, uint32_t drawCount, uint32_t stride) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<CmdDrawMeshTasksIndirectEXT>()(commandBuffer, buffer, offset, drawCount, stride);
+		}
+	};
+};
+#endif
+#if (defined(VK_EXT_mesh_shader))
+struct CmdDrawMeshTasksIndirectCountEXT {
+	using type = PFN_vkCmdDrawMeshTasksIndirectCountEXT;
+	static constexpr const char* name = "vkCmdDrawMeshTasksIndirectCountEXT";
+	template <typename Table> struct Wrapper {
+		void cmdDrawMeshTasksIndirectCountEXT(VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset, VkBuffer countBuffer, VkDeviceSize countBufferOffset, uint32_t maxDrawCount, uint32_t stride) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<CmdDrawMeshTasksIndirectCountEXT>()(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
+		}
+	};
+};
+#endif
+#if (defined(VK_NV_ray_tracing))
+struct CompileDeferredNV {
+	using type = PFN_vkCompileDeferredNV;
+	static constexpr const char* name = "vkCompileDeferredNV";
+	template <typename Table> struct Wrapper {
+		VkResult compileDeferredNV(VkPipeline pipeline, uint32_t shader) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			return table.template get<CompileDeferredNV>()(table.device, pipeline, shader);
+		}
+	};
+};
+#endif
+#if (defined(VK_NV_ray_tracing))
+struct CreateAccelerationStructureNV {
+	using type = PFN_vkCreateAccelerationStructureNV;
+	static constexpr const char* name = "vkCreateAccelerationStructureNV";
+	template <typename Table> struct Wrapper {
+		VkResult createAccelerationStructureNV(const VkAccelerationStructureCreateInfoNV* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkAccelerationStructureNV* pAccelerationStructure) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			return table.template get<CreateAccelerationStructureNV>()(table.device, pCreateInfo, pAllocator, pAccelerationStructure);
+		}
+	};
+};
+#endif
+#if (defined(VK_HUAWEI_invocation_mask))
+struct CmdBindInvocationMaskHUAWEI {
+	using type = PFN_vkCmdBindInvocationMaskHUAWEI;
+	static constexpr const char* name = "vkCmdBindInvocationMaskHUAWEI";
+	template <typename Table> struct Wrapper {
+		void cmdBindInvocationMaskHUAWEI(VkCommandBuffer commandBuffer, VkImageView imageView, VkImageLayout imageLayout) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<CmdBindInvocationMaskHUAWEI>()(commandBuffer, imageView, imageLayout);
+		}
+	};
+};
+#endif
+#if (defined(VK_KHR_acceleration_structure))
+struct DestroyAccelerationStructureKHR {
+	using type = PFN_vkDestroyAccelerationStructureKHR;
+	static constexpr const char* name = "vkDestroyAccelerationStructureKHR";
+	template <typename Table> struct Wrapper {
+		void destroyAccelerationStructureKHR(VkAccelerationStructureKHR accelerationStructure, const VkAllocationCallbacks* pAllocator) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<DestroyAccelerationStructureKHR>()(table.device, accelerationStructure, pAllocator);
+		}
+	};
+};
+#endif
+#if (defined(VK_NV_ray_tracing))
+struct DestroyAccelerationStructureNV {
+	using type = PFN_vkDestroyAccelerationStructureNV;
+	static constexpr const char* name = "vkDestroyAccelerationStructureNV";
+	template <typename Table> struct Wrapper {
+		void destroyAccelerationStructureNV(VkAccelerationStructureNV accelerationStructure, const VkAllocationCallbacks* pAllocator) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<DestroyAccelerationStructureNV>()(table.device, accelerationStructure, pAllocator);
+		}
+	};
+};
+#endif
+#if (defined(VK_NV_ray_tracing))
+struct GetAccelerationStructureMemoryRequirementsNV {
+	using type = PFN_vkGetAccelerationStructureMemoryRequirementsNV;
+	static constexpr const char* name = "vkGetAccelerationStructureMemoryRequirementsNV";
+	template <typename Table> struct Wrapper {
+		void getAccelerationStructureMemoryRequirementsNV(const VkAccelerationStructureMemoryRequirementsInfoNV* pInfo, VkMemoryRequirements2KHR* pMemoryRequirements) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<GetAccelerationStructureMemoryRequirementsNV>()(table.device, pInfo, pMemoryRequirements);
+		}
+	};
+};
+#endif
+#if (defined(VK_NV_ray_tracing))
+struct BindAccelerationStructureMemoryNV {
+	using type = PFN_vkBindAccelerationStructureMemoryNV;
+	static constexpr const char* name = "vkBindAccelerationStructureMemoryNV";
+	template <typename Table> struct Wrapper {
+		VkResult bindAccelerationStructureMemoryNV(uint32_t bindInfoCount, const VkBindAccelerationStructureMemoryInfoNV* pBindInfos) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			return table.template get<BindAccelerationStructureMemoryNV>()(table.device, bindInfoCount, pBindInfos);
+		}
+	};
+};
+#endif
+#if (defined(VK_NV_ray_tracing))
+struct CmdCopyAccelerationStructureNV {
+	using type = PFN_vkCmdCopyAccelerationStructureNV;
+	static constexpr const char* name = "vkCmdCopyAccelerationStructureNV";
+	template <typename Table> struct Wrapper {
+		void cmdCopyAccelerationStructureNV(VkCommandBuffer commandBuffer, VkAccelerationStructureNV dst, VkAccelerationStructureNV src, VkCopyAccelerationStructureModeNV mode) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<CmdCopyAccelerationStructureNV>()(commandBuffer, dst, src, mode);
+		}
+	};
+};
+#endif
+#if (defined(VK_KHR_acceleration_structure))
+struct CmdCopyAccelerationStructureKHR {
+	using type = PFN_vkCmdCopyAccelerationStructureKHR;
+	static constexpr const char* name = "vkCmdCopyAccelerationStructureKHR";
+	template <typename Table> struct Wrapper {
+		void cmdCopyAccelerationStructureKHR(VkCommandBuffer commandBuffer, const VkCopyAccelerationStructureInfoKHR* pInfo) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<CmdCopyAccelerationStructureKHR>()(commandBuffer, pInfo);
+		}
+	};
+};
+#endif
+#if (defined(VK_KHR_acceleration_structure))
+struct CopyAccelerationStructureKHR {
+	using type = PFN_vkCopyAccelerationStructureKHR;
+	static constexpr const char* name = "vkCopyAccelerationStructureKHR";
+	template <typename Table> struct Wrapper {
+		VkResult copyAccelerationStructureKHR(VkDeferredOperationKHR deferredOperation, const VkCopyAccelerationStructureInfoKHR* pInfo) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			return table.template get<CopyAccelerationStructureKHR>()(table.device, deferredOperation, pInfo);
+		}
+	};
+};
+#endif
+#if (defined(VK_KHR_acceleration_structure))
+struct CmdCopyAccelerationStructureToMemoryKHR {
+	using type = PFN_vkCmdCopyAccelerationStructureToMemoryKHR;
+	static constexpr const char* name = "vkCmdCopyAccelerationStructureToMemoryKHR";
+	template <typename Table> struct Wrapper {
+		void cmdCopyAccelerationStructureToMemoryKHR(VkCommandBuffer commandBuffer, const VkCopyAccelerationStructureToMemoryInfoKHR* pInfo) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<CmdCopyAccelerationStructureToMemoryKHR>()(commandBuffer, pInfo);
+		}
+	};
+};
+#endif
+#if (defined(VK_KHR_acceleration_structure))
+struct CopyAccelerationStructureToMemoryKHR {
+	using type = PFN_vkCopyAccelerationStructureToMemoryKHR;
+	static constexpr const char* name = "vkCopyAccelerationStructureToMemoryKHR";
+	template <typename Table> struct Wrapper {
+		VkResult copyAccelerationStructureToMemoryKHR(VkDeferredOperationKHR deferredOperation, const VkCopyAccelerationStructureToMemoryInfoKHR* pInfo) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			return table.template get<CopyAccelerationStructureToMemoryKHR>()(table.device, deferredOperation, pInfo);
+		}
+	};
+};
+#endif
+#if (defined(VK_KHR_acceleration_structure))
+struct CmdCopyMemoryToAccelerationStructureKHR {
+	using type = PFN_vkCmdCopyMemoryToAccelerationStructureKHR;
+	static constexpr const char* name = "vkCmdCopyMemoryToAccelerationStructureKHR";
+	template <typename Table> struct Wrapper {
+		void cmdCopyMemoryToAccelerationStructureKHR(VkCommandBuffer commandBuffer, const VkCopyMemoryToAccelerationStructureInfoKHR* pInfo) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<CmdCopyMemoryToAccelerationStructureKHR>()(commandBuffer, pInfo);
+		}
+	};
+};
+#endif
+#if (defined(VK_KHR_acceleration_structure))
+struct CopyMemoryToAccelerationStructureKHR {
+	using type = PFN_vkCopyMemoryToAccelerationStructureKHR;
+	static constexpr const char* name = "vkCopyMemoryToAccelerationStructureKHR";
+	template <typename Table> struct Wrapper {
+		VkResult copyMemoryToAccelerationStructureKHR(VkDeferredOperationKHR deferredOperation, const VkCopyMemoryToAccelerationStructureInfoKHR* pInfo) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			return table.template get<CopyMemoryToAccelerationStructureKHR>()(table.device, deferredOperation, pInfo);
+		}
+	};
+};
+#endif
+#if (defined(VK_KHR_acceleration_structure))
+struct CmdWriteAccelerationStructuresPropertiesKHR {
+	using type = PFN_vkCmdWriteAccelerationStructuresPropertiesKHR;
+	static constexpr const char* name = "vkCmdWriteAccelerationStructuresPropertiesKHR";
+	template <typename Table> struct Wrapper {
+		void cmdWriteAccelerationStructuresPropertiesKHR(VkCommandBuffer commandBuffer, uint32_t accelerationStructureCount, const VkAccelerationStructureKHR* pAccelerationStructures, VkQueryType queryType, VkQueryPool queryPool, uint32_t firstQuery) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<CmdWriteAccelerationStructuresPropertiesKHR>()(commandBuffer, accelerationStructureCount, pAccelerationStructures, queryType, queryPool, firstQuery);
+		}
+	};
+};
+#endif
+#if (defined(VK_NV_ray_tracing))
+struct CmdWriteAccelerationStructuresPropertiesNV {
+	using type = PFN_vkCmdWriteAccelerationStructuresPropertiesNV;
+	static constexpr const char* name = "vkCmdWriteAccelerationStructuresPropertiesNV";
+	template <typename Table> struct Wrapper {
+		void cmdWriteAccelerationStructuresPropertiesNV(VkCommandBuffer commandBuffer, uint32_t accelerationStructureCount, const VkAccelerationStructureNV* pAccelerationStructures, VkQueryType queryType, VkQueryPool queryPool, uint32_t firstQuery) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<CmdWriteAccelerationStructuresPropertiesNV>()(commandBuffer, accelerationStructureCount, pAccelerationStructures, queryType, queryPool, firstQuery);
+		}
+	};
+};
+#endif
+#if (defined(VK_NV_ray_tracing))
+struct CmdBuildAccelerationStructureNV {
+	using type = PFN_vkCmdBuildAccelerationStructureNV;
+	static constexpr const char* name = "vkCmdBuildAccelerationStructureNV";
+	template <typename Table> struct Wrapper {
+		void cmdBuildAccelerationStructureNV(VkCommandBuffer commandBuffer, const VkAccelerationStructureInfoNV* pInfo, VkBuffer instanceData, VkDeviceSize instanceOffset, VkBool32 update, VkAccelerationStructureNV dst, VkAccelerationStructureNV src, VkBuffer scratch, VkDeviceSize scratchOffset) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<CmdBuildAccelerationStructureNV>()(commandBuffer, pInfo, instanceData, instanceOffset, update, dst, src, scratch, scratchOffset);
+		}
+	};
+};
+#endif
+#if (defined(VK_KHR_acceleration_structure))
+struct WriteAccelerationStructuresPropertiesKHR {
+	using type = PFN_vkWriteAccelerationStructuresPropertiesKHR;
+	static constexpr const char* name = "vkWriteAccelerationStructuresPropertiesKHR";
+	template <typename Table> struct Wrapper {
+		VkResult writeAccelerationStructuresPropertiesKHR(uint32_t accelerationStructureCount, const VkAccelerationStructureKHR* pAccelerationStructures, VkQueryType queryType, size_t dataSize, void* pData, size_t stride) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			return table.template get<WriteAccelerationStructuresPropertiesKHR>()(table.device, accelerationStructureCount, pAccelerationStructures, queryType, dataSize, pData, stride);
+		}
+	};
+};
+#endif
+#if (defined(VK_KHR_ray_tracing_pipeline))
+struct CmdTraceRaysKHR {
+	using type = PFN_vkCmdTraceRaysKHR;
+	static constexpr const char* name = "vkCmdTraceRaysKHR";
+	template <typename Table> struct Wrapper {
+		void cmdTraceRaysKHR(VkCommandBuffer commandBuffer, const VkStridedDeviceAddressRegionKHR* pRaygenShaderBindingTable, const VkStridedDeviceAddressRegionKHR* pMissShaderBindingTable, const VkStridedDeviceAddressRegionKHR* pHitShaderBindingTable, const VkStridedDeviceAddressRegionKHR* pCallableShaderBindingTable, uint32_t width, uint32_t height, uint32_t depth) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<CmdTraceRaysKHR>()(commandBuffer, pRaygenShaderBindingTable, pMissShaderBindingTable, pHitShaderBindingTable, pCallableShaderBindingTable, width, height, depth);
+		}
+	};
+};
+#endif
+#if (defined(VK_NV_ray_tracing))
+struct CmdTraceRaysNV {
+	using type = PFN_vkCmdTraceRaysNV;
+	static constexpr const char* name = "vkCmdTraceRaysNV";
+	template <typename Table> struct Wrapper {
+		void cmdTraceRaysNV(VkCommandBuffer commandBuffer, VkBuffer raygenShaderBindingTableBuffer, VkDeviceSize raygenShaderBindingOffset, VkBuffer missShaderBindingTableBuffer, VkDeviceSize missShaderBindingOffset, VkDeviceSize missShaderBindingStride, VkBuffer hitShaderBindingTableBuffer, VkDeviceSize hitShaderBindingOffset, VkDeviceSize hitShaderBindingStride, VkBuffer callableShaderBindingTableBuffer, VkDeviceSize callableShaderBindingOffset, VkDeviceSize callableShaderBindingStride, uint32_t width, uint32_t height, uint32_t depth) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<CmdTraceRaysNV>()(commandBuffer, raygenShaderBindingTableBuffer, raygenShaderBindingOffset, missShaderBindingTableBuffer, missShaderBindingOffset, missShaderBindingStride, hitShaderBindingTableBuffer, hitShaderBindingOffset, hitShaderBindingStride, callableShaderBindingTableBuffer, callableShaderBindingOffset, callableShaderBindingStride, width, height, depth);
+		}
+	};
+};
+#endif
+#if (defined(VK_KHR_ray_tracing_pipeline))
+struct GetRayTracingShaderGroupHandlesKHR {
+	using type = PFN_vkGetRayTracingShaderGroupHandlesKHR;
+	static constexpr const char* name = "vkGetRayTracingShaderGroupHandlesKHR";
+	template <typename Table> struct Wrapper {
+		VkResult getRayTracingShaderGroupHandlesKHR(VkPipeline pipeline, uint32_t firstGroup, uint32_t groupCount, size_t dataSize, void* pData) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			return table.template get<GetRayTracingShaderGroupHandlesKHR>()(table.device, pipeline, firstGroup, groupCount, dataSize, pData);
+		}
+	};
+};
+#endif
+#if (defined(VK_KHR_ray_tracing_pipeline))
+struct GetRayTracingCaptureReplayShaderGroupHandlesKHR {
+	using type = PFN_vkGetRayTracingCaptureReplayShaderGroupHandlesKHR;
+	static constexpr const char* name = "vkGetRayTracingCaptureReplayShaderGroupHandlesKHR";
+	template <typename Table> struct Wrapper {
+		VkResult getRayTracingCaptureReplayShaderGroupHandlesKHR(VkPipeline pipeline, uint32_t firstGroup, uint32_t groupCount, size_t dataSize, void* pData) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			return table.template get<GetRayTracingCaptureReplayShaderGroupHandlesKHR>()(table.device, pipeline, firstGroup, groupCount, dataSize, pData);
+		}
+	};
+};
+#endif
+#if (defined(VK_NV_ray_tracing))
+struct GetAccelerationStructureHandleNV {
+	using type = PFN_vkGetAccelerationStructureHandleNV;
+	static constexpr const char* name = "vkGetAccelerationStructureHandleNV";
+	template <typename Table> struct Wrapper {
+		VkResult getAccelerationStructureHandleNV(VkAccelerationStructureNV accelerationStructure, size_t dataSize, void* pData) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			return table.template get<GetAccelerationStructureHandleNV>()(table.device, accelerationStructure, dataSize, pData);
+		}
+	};
+};
+#endif
+#if (defined(VK_NV_ray_tracing))
+struct CreateRayTracingPipelinesNV {
+	using type = PFN_vkCreateRayTracingPipelinesNV;
+	static constexpr const char* name = "vkCreateRayTracingPipelinesNV";
+	template <typename Table> struct Wrapper {
+		VkResult createRayTracingPipelinesNV(VkPipelineCache pipelineCache, uint32_t createInfoCount, const VkRayTracingPipelineCreateInfoNV* pCreateInfos, const VkAllocationCallbacks* pAllocator, VkPipeline* pPipelines) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			return table.template get<CreateRayTracingPipelinesNV>()(table.device, pipelineCache, createInfoCount, pCreateInfos, pAllocator, pPipelines);
+		}
+	};
+};
+#endif
+#if (defined(VK_KHR_ray_tracing_pipeline))
+struct CreateRayTracingPipelinesKHR {
+	using type = PFN_vkCreateRayTracingPipelinesKHR;
+	static constexpr const char* name = "vkCreateRayTracingPipelinesKHR";
+	template <typename Table> struct Wrapper {
+		VkResult createRayTracingPipelinesKHR(VkDeferredOperationKHR deferredOperation, VkPipelineCache pipelineCache, uint32_t createInfoCount, const VkRayTracingPipelineCreateInfoKHR* pCreateInfos, const VkAllocationCallbacks* pAllocator, VkPipeline* pPipelines) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			return table.template get<CreateRayTracingPipelinesKHR>()(table.device, deferredOperation, pipelineCache, createInfoCount, pCreateInfos, pAllocator, pPipelines);
+		}
+	};
+};
+#endif
+#if (defined(VK_KHR_ray_tracing_pipeline))
+struct CmdTraceRaysIndirectKHR {
+	using type = PFN_vkCmdTraceRaysIndirectKHR;
+	static constexpr const char* name = "vkCmdTraceRaysIndirectKHR";
+	template <typename Table> struct Wrapper {
+		void cmdTraceRaysIndirectKHR(VkCommandBuffer commandBuffer, const VkStridedDeviceAddressRegionKHR* pRaygenShaderBindingTable, const VkStridedDeviceAddressRegionKHR* pMissShaderBindingTable, const VkStridedDeviceAddressRegionKHR* pHitShaderBindingTable, const VkStridedDeviceAddressRegionKHR* pCallableShaderBindingTable, VkDeviceAddress indirectDeviceAddress) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<CmdTraceRaysIndirectKHR>()(commandBuffer, pRaygenShaderBindingTable, pMissShaderBindingTable, pHitShaderBindingTable, pCallableShaderBindingTable, indirectDeviceAddress);
+		}
+	};
+};
+#endif
+#if (defined(VK_KHR_ray_tracing_maintenance1) && defined(VK_KHR_ray_tracing_pipeline))
+struct CmdTraceRaysIndirect2KHR {
+	using type = PFN_vkCmdTraceRaysIndirect2KHR;
+	static constexpr const char* name = "vkCmdTraceRaysIndirect2KHR";
+	template <typename Table> struct Wrapper {
+		void cmdTraceRaysIndirect2KHR(VkCommandBuffer commandBuffer, VkDeviceAddress indirectDeviceAddress) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<CmdTraceRaysIndirect2KHR>()(commandBuffer, indirectDeviceAddress);
+		}
+	};
+};
+#endif
+#if (defined(VK_KHR_acceleration_structure))
+struct GetDeviceAccelerationStructureCompatibilityKHR {
+	using type = PFN_vkGetDeviceAccelerationStructureCompatibilityKHR;
+	static constexpr const char* name = "vkGetDeviceAccelerationStructureCompatibilityKHR";
+	template <typename Table> struct Wrapper {
+		void getDeviceAccelerationStructureCompatibilityKHR(const VkAccelerationStructureVersionInfoKHR* pVersionInfo, VkAccelerationStructureCompatibilityKHR* pCompatibility) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<GetDeviceAccelerationStructureCompatibilityKHR>()(table.device, pVersionInfo, pCompatibility);
+		}
+	};
+};
+#endif
+#if (defined(VK_KHR_ray_tracing_pipeline))
+struct GetRayTracingShaderGroupStackSizeKHR {
+	using type = PFN_vkGetRayTracingShaderGroupStackSizeKHR;
+	static constexpr const char* name = "vkGetRayTracingShaderGroupStackSizeKHR";
+	template <typename Table> struct Wrapper {
+		VkDeviceSize getRayTracingShaderGroupStackSizeKHR(VkPipeline pipeline, uint32_t group, VkShaderGroupShaderKHR groupShader) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			return table.template get<GetRayTracingShaderGroupStackSizeKHR>()(table.device, pipeline, group, groupShader);
+		}
+	};
+};
+#endif
+#if (defined(VK_KHR_ray_tracing_pipeline))
+struct CmdSetRayTracingPipelineStackSizeKHR {
+	using type = PFN_vkCmdSetRayTracingPipelineStackSizeKHR;
+	static constexpr const char* name = "vkCmdSetRayTracingPipelineStackSizeKHR";
+	template <typename Table> struct Wrapper {
+		void cmdSetRayTracingPipelineStackSizeKHR(VkCommandBuffer commandBuffer, uint32_t pipelineStackSize) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<CmdSetRayTracingPipelineStackSizeKHR>()(commandBuffer, pipelineStackSize);
+		}
+	};
+};
+#endif
+#if (defined(VK_EXT_full_screen_exclusive) && defined(VK_KHR_device_group)) || (defined(VK_EXT_full_screen_exclusive) && defined(VK_VERSION_1_1))
+struct GetDeviceGroupSurfacePresentModes2EXT {
+	using type = PFN_vkGetDeviceGroupSurfacePresentModes2EXT;
+	static constexpr const char* name = "vkGetDeviceGroupSurfacePresentModes2EXT";
+	template <typename Table> struct Wrapper {
+		VkResult getDeviceGroupSurfacePresentModes2EXT(const VkPhysicalDeviceSurfaceInfo2KHR* pSurfaceInfo, VkDeviceGroupPresentModeFlagsKHR* pModes) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			return table.template get<GetDeviceGroupSurfacePresentModes2EXT>()(table.device, pSurfaceInfo, pModes);
+		}
+	};
+};
+#endif
+#if (defined(VK_EXT_full_screen_exclusive))
+struct AcquireFullScreenExclusiveModeEXT {
+	using type = PFN_vkAcquireFullScreenExclusiveModeEXT;
+	static constexpr const char* name = "vkAcquireFullScreenExclusiveModeEXT";
+	template <typename Table> struct Wrapper {
+		VkResult acquireFullScreenExclusiveModeEXT(VkSwapchainKHR swapchain) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			return table.template get<AcquireFullScreenExclusiveModeEXT>()(table.device, swapchain);
+		}
+	};
+};
+#endif
+#if (defined(VK_EXT_full_screen_exclusive))
+struct ReleaseFullScreenExclusiveModeEXT {
+	using type = PFN_vkReleaseFullScreenExclusiveModeEXT;
+	static constexpr const char* name = "vkReleaseFullScreenExclusiveModeEXT";
+	template <typename Table> struct Wrapper {
+		VkResult releaseFullScreenExclusiveModeEXT(VkSwapchainKHR swapchain) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			return table.template get<ReleaseFullScreenExclusiveModeEXT>()(table.device, swapchain);
+		}
+	};
+};
+#endif
+#if (defined(VK_KHR_performance_query))
+struct AcquireProfilingLockKHR {
+	using type = PFN_vkAcquireProfilingLockKHR;
+	static constexpr const char* name = "vkAcquireProfilingLockKHR";
+	template <typename Table> struct Wrapper {
+		VkResult acquireProfilingLockKHR(const VkAcquireProfilingLockInfoKHR* pInfo) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			return table.template get<AcquireProfilingLockKHR>()(table.device, pInfo);
+		}
+	};
+};
+#endif
+#if (defined(VK_KHR_performance_query))
+struct ReleaseProfilingLockKHR {
+	using type = PFN_vkReleaseProfilingLockKHR;
+	static constexpr const char* name = "vkReleaseProfilingLockKHR";
+	template <typename Table> struct Wrapper {
+		void releaseProfilingLockKHR() const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<ReleaseProfilingLockKHR>()(table.device);
+		}
+	};
+};
+#endif
+#if (defined(VK_EXT_image_drm_format_modifier))
+struct GetImageDrmFormatModifierPropertiesEXT {
+	using type = PFN_vkGetImageDrmFormatModifierPropertiesEXT;
+	static constexpr const char* name = "vkGetImageDrmFormatModifierPropertiesEXT";
+	template <typename Table> struct Wrapper {
+		VkResult getImageDrmFormatModifierPropertiesEXT(VkImage image, VkImageDrmFormatModifierPropertiesEXT* pProperties) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			return table.template get<GetImageDrmFormatModifierPropertiesEXT>()(table.device, image, pProperties);
+		}
+	};
+};
+#endif
+#if (defined(VK_VERSION_1_2))
+struct GetBufferOpaqueCaptureAddress {
+	using type = PFN_vkGetBufferOpaqueCaptureAddress;
+	static constexpr const char* name = "vkGetBufferOpaqueCaptureAddress";
+	template <typename Table> struct Wrapper {
+		uint64_t getBufferOpaqueCaptureAddress(const VkBufferDeviceAddressInfoEXT* pInfo) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			return table.template get<GetBufferOpaqueCaptureAddress>()(table.device, pInfo);
+		}
+	};
+};
+#endif
+#if (defined(VK_VERSION_1_2))
+struct GetBufferDeviceAddress {
+	using type = PFN_vkGetBufferDeviceAddress;
+	static constexpr const char* name = "vkGetBufferDeviceAddress";
+	template <typename Table> struct Wrapper {
+		VkDeviceAddress getBufferDeviceAddress(const VkBufferDeviceAddressInfoEXT* pInfo) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			return table.template get<GetBufferDeviceAddress>()(table.device, pInfo);
+		}
+	};
+};
+#endif
+#if (defined(VK_INTEL_performance_query))
+struct InitializePerformanceApiINTEL {
+	using type = PFN_vkInitializePerformanceApiINTEL;
+	static constexpr const char* name = "vkInitializePerformanceApiINTEL";
+	template <typename Table> struct Wrapper {
+		VkResult initializePerformanceApiINTEL(const VkInitializePerformanceApiInfoINTEL* pInitializeInfo) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			return table.template get<InitializePerformanceApiINTEL>()(table.device, pInitializeInfo);
+		}
+	};
+};
+#endif
+#if (defined(VK_INTEL_performance_query))
+struct UninitializePerformanceApiINTEL {
+	using type = PFN_vkUninitializePerformanceApiINTEL;
+	static constexpr const char* name = "vkUninitializePerformanceApiINTEL";
+	template <typename Table> struct Wrapper {
+		void uninitializePerformanceApiINTEL() const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<UninitializePerformanceApiINTEL>()(table.device);
+		}
+	};
+};
+#endif
+#if (defined(VK_INTEL_performance_query))
+struct CmdSetPerformanceMarkerINTEL {
+	using type = PFN_vkCmdSetPerformanceMarkerINTEL;
+	static constexpr const char* name = "vkCmdSetPerformanceMarkerINTEL";
+	template <typename Table> struct Wrapper {
+		VkResult cmdSetPerformanceMarkerINTEL(VkCommandBuffer commandBuffer, const VkPerformanceMarkerInfoINTEL* pMarkerInfo) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			return table.template get<CmdSetPerformanceMarkerINTEL>()(commandBuffer, pMarkerInfo);
+		}
+	};
+};
+#endif
+#if (defined(VK_INTEL_performance_query))
+struct CmdSetPerformanceStreamMarkerINTEL {
+	using type = PFN_vkCmdSetPerformanceStreamMarkerINTEL;
+	static constexpr const char* name = "vkCmdSetPerformanceStreamMarkerINTEL";
+	template <typename Table> struct Wrapper {
+		VkResult cmdSetPerformanceStreamMarkerINTEL(VkCommandBuffer commandBuffer, const VkPerformanceStreamMarkerInfoINTEL* pMarkerInfo) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			return table.template get<CmdSetPerformanceStreamMarkerINTEL>()(commandBuffer, pMarkerInfo);
+		}
+	};
+};
+#endif
+#if (defined(VK_INTEL_performance_query))
+struct CmdSetPerformanceOverrideINTEL {
+	using type = PFN_vkCmdSetPerformanceOverrideINTEL;
+	static constexpr const char* name = "vkCmdSetPerformanceOverrideINTEL";
+	template <typename Table> struct Wrapper {
+		VkResult cmdSetPerformanceOverrideINTEL(VkCommandBuffer commandBuffer, const VkPerformanceOverrideInfoINTEL* pOverrideInfo) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			return table.template get<CmdSetPerformanceOverrideINTEL>()(commandBuffer, pOverrideInfo);
+		}
+	};
+};
+#endif
+#if (defined(VK_INTEL_performance_query))
+struct AcquirePerformanceConfigurationINTEL {
+	using type = PFN_vkAcquirePerformanceConfigurationINTEL;
+	static constexpr const char* name = "vkAcquirePerformanceConfigurationINTEL";
+	template <typename Table> struct Wrapper {
+		VkResult acquirePerformanceConfigurationINTEL(const VkPerformanceConfigurationAcquireInfoINTEL* pAcquireInfo, VkPerformanceConfigurationINTEL* pConfiguration) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			return table.template get<AcquirePerformanceConfigurationINTEL>()(table.device, pAcquireInfo, pConfiguration);
+		}
+	};
+};
+#endif
+#if (defined(VK_INTEL_performance_query))
+struct ReleasePerformanceConfigurationINTEL {
+	using type = PFN_vkReleasePerformanceConfigurationINTEL;
+	static constexpr const char* name = "vkReleasePerformanceConfigurationINTEL";
+	template <typename Table> struct Wrapper {
+		VkResult releasePerformanceConfigurationINTEL(VkPerformanceConfigurationINTEL configuration) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			return table.template get<ReleasePerformanceConfigurationINTEL>()(table.device, configuration);
+		}
+	};
+};
+#endif
+#if (defined(VK_INTEL_performance_query))
+struct QueueSetPerformanceConfigurationINTEL {
+	using type = PFN_vkQueueSetPerformanceConfigurationINTEL;
+	static constexpr const char* name = "vkQueueSetPerformanceConfigurationINTEL";
+	template <typename Table> struct Wrapper {
+		VkResult queueSetPerformanceConfigurationINTEL(VkQueue queue, VkPerformanceConfigurationINTEL configuration) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			return table.template get<QueueSetPerformanceConfigurationINTEL>()(queue, configuration);
+		}
+	};
+};
+#endif
+#if (defined(VK_INTEL_performance_query))
+struct GetPerformanceParameterINTEL {
+	using type = PFN_vkGetPerformanceParameterINTEL;
+	static constexpr const char* name = "vkGetPerformanceParameterINTEL";
+	template <typename Table> struct Wrapper {
+		VkResult getPerformanceParameterINTEL(VkPerformanceParameterTypeINTEL parameter, VkPerformanceValueINTEL* pValue) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			return table.template get<GetPerformanceParameterINTEL>()(table.device, parameter, pValue);
+		}
+	};
+};
+#endif
+#if (defined(VK_VERSION_1_2))
+struct GetDeviceMemoryOpaqueCaptureAddress {
+	using type = PFN_vkGetDeviceMemoryOpaqueCaptureAddress;
+	static constexpr const char* name = "vkGetDeviceMemoryOpaqueCaptureAddress";
+	template <typename Table> struct Wrapper {
+		uint64_t getDeviceMemoryOpaqueCaptureAddress(const VkDeviceMemoryOpaqueCaptureAddressInfoKHR* pInfo) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			return table.template get<GetDeviceMemoryOpaqueCaptureAddress>()(table.device, pInfo);
+		}
+	};
+};
+#endif
+#if (defined(VK_KHR_pipeline_executable_properties))
+struct GetPipelineExecutablePropertiesKHR {
+	using type = PFN_vkGetPipelineExecutablePropertiesKHR;
+	static constexpr const char* name = "vkGetPipelineExecutablePropertiesKHR";
+	template <typename Table> struct Wrapper {
+		VkResult getPipelineExecutablePropertiesKHR(const VkPipelineInfoKHR* pPipelineInfo, uint32_t* pExecutableCount, VkPipelineExecutablePropertiesKHR* pProperties) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			return table.template get<GetPipelineExecutablePropertiesKHR>()(table.device, pPipelineInfo, pExecutableCount, pProperties);
+		}
+	};
+};
+#endif
+#if (defined(VK_KHR_pipeline_executable_properties))
+struct GetPipelineExecutableStatisticsKHR {
+	using type = PFN_vkGetPipelineExecutableStatisticsKHR;
+	static constexpr const char* name = "vkGetPipelineExecutableStatisticsKHR";
+	template <typename Table> struct Wrapper {
+		VkResult getPipelineExecutableStatisticsKHR(const VkPipelineExecutableInfoKHR* pExecutableInfo, uint32_t* pStatisticCount, VkPipelineExecutableStatisticKHR* pStatistics) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			return table.template get<GetPipelineExecutableStatisticsKHR>()(table.device, pExecutableInfo, pStatisticCount, pStatistics);
+		}
+	};
+};
+#endif
+#if (defined(VK_KHR_pipeline_executable_properties))
+struct GetPipelineExecutableInternalRepresentationsKHR {
+	using type = PFN_vkGetPipelineExecutableInternalRepresentationsKHR;
+	static constexpr const char* name = "vkGetPipelineExecutableInternalRepresentationsKHR";
+	template <typename Table> struct Wrapper {
+		VkResult getPipelineExecutableInternalRepresentationsKHR(const VkPipelineExecutableInfoKHR* pExecutableInfo, uint32_t* pInternalRepresentationCount, VkPipelineExecutableInternalRepresentationKHR* pInternalRepresentations) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			return table.template get<GetPipelineExecutableInternalRepresentationsKHR>()(table.device, pExecutableInfo, pInternalRepresentationCount, pInternalRepresentations);
+		}
+	};
+};
+#endif
+#if (defined(VK_EXT_line_rasterization))
+struct CmdSetLineStippleEXT {
+	using type = PFN_vkCmdSetLineStippleEXT;
+	static constexpr const char* name = "vkCmdSetLineStippleEXT";
+	template <typename Table> struct Wrapper {
+		void cmdSetLineStippleEXT(VkCommandBuffer commandBuffer, uint32_t lineStippleFactor, uint16_t lineStipplePattern) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<CmdSetLineStippleEXT>()(commandBuffer, lineStippleFactor, lineStipplePattern);
+		}
+	};
+};
+#endif
+#if (defined(VK_KHR_acceleration_structure))
+struct CreateAccelerationStructureKHR {
+	using type = PFN_vkCreateAccelerationStructureKHR;
+	static constexpr const char* name = "vkCreateAccelerationStructureKHR";
+	template <typename Table> struct Wrapper {
+		VkResult createAccelerationStructureKHR(const VkAccelerationStructureCreateInfoKHR* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkAccelerationStructureKHR* pAccelerationStructure) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			return table.template get<CreateAccelerationStructureKHR>()(table.device, pCreateInfo, pAllocator, pAccelerationStructure);
+		}
+	};
+};
+#endif
+#if (defined(VK_KHR_acceleration_structure))
+struct CmdBuildAccelerationStructuresKHR {
+	using type = PFN_vkCmdBuildAccelerationStructuresKHR;
+	static constexpr const char* name = "vkCmdBuildAccelerationStructuresKHR";
+	template <typename Table> struct Wrapper {
+		void cmdBuildAccelerationStructuresKHR(VkCommandBuffer commandBuffer, uint32_t infoCount, const VkAccelerationStructureBuildGeometryInfoKHR* pInfos, const VkAccelerationStructureBuildRangeInfoKHR* const* ppBuildRangeInfos) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<CmdBuildAccelerationStructuresKHR>()(commandBuffer, infoCount, pInfos, ppBuildRangeInfos);
+		}
+	};
+};
+#endif
+#if (defined(VK_KHR_acceleration_structure))
+struct CmdBuildAccelerationStructuresIndirectKHR {
+	using type = PFN_vkCmdBuildAccelerationStructuresIndirectKHR;
+	static constexpr const char* name = "vkCmdBuildAccelerationStructuresIndirectKHR";
+	template <typename Table> struct Wrapper {
+		void cmdBuildAccelerationStructuresIndirectKHR(VkCommandBuffer commandBuffer, uint32_t infoCount, const VkAccelerationStructureBuildGeometryInfoKHR* pInfos, const VkDeviceAddress* pIndirectDeviceAddresses, const uint32_t* pIndirectStrides, const uint32_t* const* ppMaxPrimitiveCounts) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<CmdBuildAccelerationStructuresIndirectKHR>()(commandBuffer, infoCount, pInfos, pIndirectDeviceAddresses, pIndirectStrides, ppMaxPrimitiveCounts);
+		}
+	};
+};
+#endif
+#if (defined(VK_KHR_acceleration_structure))
+struct BuildAccelerationStructuresKHR {
+	using type = PFN_vkBuildAccelerationStructuresKHR;
+	static constexpr const char* name = "vkBuildAccelerationStructuresKHR";
+	template <typename Table> struct Wrapper {
+		VkResult buildAccelerationStructuresKHR(VkDeferredOperationKHR deferredOperation, uint32_t infoCount, const VkAccelerationStructureBuildGeometryInfoKHR* pInfos, const VkAccelerationStructureBuildRangeInfoKHR* const* ppBuildRangeInfos) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			return table.template get<BuildAccelerationStructuresKHR>()(table.device, deferredOperation, infoCount, pInfos, ppBuildRangeInfos);
+		}
+	};
+};
+#endif
+#if (defined(VK_KHR_acceleration_structure))
+struct GetAccelerationStructureDeviceAddressKHR {
+	using type = PFN_vkGetAccelerationStructureDeviceAddressKHR;
+	static constexpr const char* name = "vkGetAccelerationStructureDeviceAddressKHR";
+	template <typename Table> struct Wrapper {
+		VkDeviceAddress getAccelerationStructureDeviceAddressKHR(const VkAccelerationStructureDeviceAddressInfoKHR* pInfo) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			return table.template get<GetAccelerationStructureDeviceAddressKHR>()(table.device, pInfo);
+		}
+	};
+};
+#endif
+#if (defined(VK_KHR_deferred_host_operations))
+struct CreateDeferredOperationKHR {
+	using type = PFN_vkCreateDeferredOperationKHR;
+	static constexpr const char* name = "vkCreateDeferredOperationKHR";
+	template <typename Table> struct Wrapper {
+		VkResult createDeferredOperationKHR(const VkAllocationCallbacks* pAllocator, VkDeferredOperationKHR* pDeferredOperation) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			return table.template get<CreateDeferredOperationKHR>()(table.device, pAllocator, pDeferredOperation);
+		}
+	};
+};
+#endif
+#if (defined(VK_KHR_deferred_host_operations))
+struct DestroyDeferredOperationKHR {
+	using type = PFN_vkDestroyDeferredOperationKHR;
+	static constexpr const char* name = "vkDestroyDeferredOperationKHR";
+	template <typename Table> struct Wrapper {
+		void destroyDeferredOperationKHR(VkDeferredOperationKHR operation, const VkAllocationCallbacks* pAllocator) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<DestroyDeferredOperationKHR>()(table.device, operation, pAllocator);
+		}
+	};
+};
+#endif
+#if (defined(VK_KHR_deferred_host_operations))
+struct GetDeferredOperationMaxConcurrencyKHR {
+	using type = PFN_vkGetDeferredOperationMaxConcurrencyKHR;
+	static constexpr const char* name = "vkGetDeferredOperationMaxConcurrencyKHR";
+	template <typename Table> struct Wrapper {
+		uint32_t getDeferredOperationMaxConcurrencyKHR(VkDeferredOperationKHR operation) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			return table.template get<GetDeferredOperationMaxConcurrencyKHR>()(table.device, operation);
+		}
+	};
+};
+#endif
+#if (defined(VK_KHR_deferred_host_operations))
+struct GetDeferredOperationResultKHR {
+	using type = PFN_vkGetDeferredOperationResultKHR;
+	static constexpr const char* name = "vkGetDeferredOperationResultKHR";
+	template <typename Table> struct Wrapper {
+		VkResult getDeferredOperationResultKHR(VkDeferredOperationKHR operation) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			return table.template get<GetDeferredOperationResultKHR>()(table.device, operation);
+		}
+	};
+};
+#endif
+#if (defined(VK_KHR_deferred_host_operations))
+struct DeferredOperationJoinKHR {
+	using type = PFN_vkDeferredOperationJoinKHR;
+	static constexpr const char* name = "vkDeferredOperationJoinKHR";
+	template <typename Table> struct Wrapper {
+		VkResult deferredOperationJoinKHR(VkDeferredOperationKHR operation) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			return table.template get<DeferredOperationJoinKHR>()(table.device, operation);
+		}
+	};
+};
+#endif
+#if (defined(VK_VERSION_1_3))
+struct CmdSetCullMode {
+	using type = PFN_vkCmdSetCullMode;
+	static constexpr const char* name = "vkCmdSetCullMode";
+	template <typename Table> struct Wrapper {
+		void cmdSetCullMode(VkCommandBuffer commandBuffer, VkCullModeFlags cullMode) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<CmdSetCullMode>()(commandBuffer, cullMode);
+		}
+	};
+};
+#endif
+#if (defined(VK_VERSION_1_3))
+struct CmdSetFrontFace {
+	using type = PFN_vkCmdSetFrontFace;
+	static constexpr const char* name = "vkCmdSetFrontFace";
+	template <typename Table> struct Wrapper {
+		void cmdSetFrontFace(VkCommandBuffer commandBuffer, VkFrontFace frontFace) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<CmdSetFrontFace>()(commandBuffer, frontFace);
+		}
+	};
+};
+#endif
+#if (defined(VK_VERSION_1_3))
+struct CmdSetPrimitiveTopology {
+	using type = PFN_vkCmdSetPrimitiveTopology;
+	static constexpr const char* name = "vkCmdSetPrimitiveTopology";
+	template <typename Table> struct Wrapper {
+		void cmdSetPrimitiveTopology(VkCommandBuffer commandBuffer, VkPrimitiveTopology primitiveTopology) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<CmdSetPrimitiveTopology>()(commandBuffer, primitiveTopology);
+		}
+	};
+};
+#endif
+#if (defined(VK_VERSION_1_3))
+struct CmdSetViewportWithCount {
+	using type = PFN_vkCmdSetViewportWithCount;
+	static constexpr const char* name = "vkCmdSetViewportWithCount";
+	template <typename Table> struct Wrapper {
+		void cmdSetViewportWithCount(VkCommandBuffer commandBuffer, uint32_t viewportCount, const VkViewport* pViewports) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<CmdSetViewportWithCount>()(commandBuffer, viewportCount, pViewports);
+		}
+	};
+};
+#endif
+#if (defined(VK_VERSION_1_3))
+struct CmdSetScissorWithCount {
+	using type = PFN_vkCmdSetScissorWithCount;
+	static constexpr const char* name = "vkCmdSetScissorWithCount";
+	template <typename Table> struct Wrapper {
+		void cmdSetScissorWithCount(VkCommandBuffer commandBuffer, uint32_t scissorCount, const VkRect2D* pScissors) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<CmdSetScissorWithCount>()(commandBuffer, scissorCount, pScissors);
+		}
+	};
+};
+#endif
+#if (defined(VK_VERSION_1_3))
+struct CmdBindVertexBuffers2 {
+	using type = PFN_vkCmdBindVertexBuffers2;
+	static constexpr const char* name = "vkCmdBindVertexBuffers2";
+	template <typename Table> struct Wrapper {
+		void cmdBindVertexBuffers2(VkCommandBuffer commandBuffer, uint32_t firstBinding, uint32_t bindingCount, const VkBuffer* pBuffers, const VkDeviceSize* pOffsets, const VkDeviceSize* pSizes, const VkDeviceSize* pStrides) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<CmdBindVertexBuffers2>()(commandBuffer, firstBinding, bindingCount, pBuffers, pOffsets, pSizes, pStrides);
+		}
+	};
+};
+#endif
+#if (defined(VK_VERSION_1_3))
+struct CmdSetDepthTestEnable {
+	using type = PFN_vkCmdSetDepthTestEnable;
+	static constexpr const char* name = "vkCmdSetDepthTestEnable";
+	template <typename Table> struct Wrapper {
+		void cmdSetDepthTestEnable(VkCommandBuffer commandBuffer, VkBool32 depthTestEnable) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<CmdSetDepthTestEnable>()(commandBuffer, depthTestEnable);
+		}
+	};
+};
+#endif
+#if (defined(VK_VERSION_1_3))
+struct CmdSetDepthWriteEnable {
+	using type = PFN_vkCmdSetDepthWriteEnable;
+	static constexpr const char* name = "vkCmdSetDepthWriteEnable";
+	template <typename Table> struct Wrapper {
+		void cmdSetDepthWriteEnable(VkCommandBuffer commandBuffer, VkBool32 depthWriteEnable) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<CmdSetDepthWriteEnable>()(commandBuffer, depthWriteEnable);
+		}
+	};
+};
+#endif
+#if (defined(VK_VERSION_1_3))
+struct CmdSetDepthCompareOp {
+	using type = PFN_vkCmdSetDepthCompareOp;
+	static constexpr const char* name = "vkCmdSetDepthCompareOp";
+	template <typename Table> struct Wrapper {
+		void cmdSetDepthCompareOp(VkCommandBuffer commandBuffer, VkCompareOp depthCompareOp) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<CmdSetDepthCompareOp>()(commandBuffer, depthCompareOp);
+		}
+	};
+};
+#endif
+#if (defined(VK_VERSION_1_3))
+struct CmdSetDepthBoundsTestEnable {
+	using type = PFN_vkCmdSetDepthBoundsTestEnable;
+	static constexpr const char* name = "vkCmdSetDepthBoundsTestEnable";
+	template <typename Table> struct Wrapper {
+		void cmdSetDepthBoundsTestEnable(VkCommandBuffer commandBuffer, VkBool32 depthBoundsTestEnable) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<CmdSetDepthBoundsTestEnable>()(commandBuffer, depthBoundsTestEnable);
+		}
+	};
+};
+#endif
+#if (defined(VK_VERSION_1_3))
+struct CmdSetStencilTestEnable {
+	using type = PFN_vkCmdSetStencilTestEnable;
+	static constexpr const char* name = "vkCmdSetStencilTestEnable";
+	template <typename Table> struct Wrapper {
+		void cmdSetStencilTestEnable(VkCommandBuffer commandBuffer, VkBool32 stencilTestEnable) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<CmdSetStencilTestEnable>()(commandBuffer, stencilTestEnable);
+		}
+	};
+};
+#endif
+#if (defined(VK_VERSION_1_3))
+struct CmdSetStencilOp {
+	using type = PFN_vkCmdSetStencilOp;
+	static constexpr const char* name = "vkCmdSetStencilOp";
+	template <typename Table> struct Wrapper {
+		void cmdSetStencilOp(VkCommandBuffer commandBuffer, VkStencilFaceFlags faceMask, VkStencilOp failOp, VkStencilOp passOp, VkStencilOp depthFailOp, VkCompareOp compareOp) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<CmdSetStencilOp>()(commandBuffer, faceMask, failOp, passOp, depthFailOp, compareOp);
+		}
+	};
+};
+#endif
+#if (defined(VK_EXT_extended_dynamic_state2))
+struct CmdSetPatchControlPointsEXT {
+	using type = PFN_vkCmdSetPatchControlPointsEXT;
+	static constexpr const char* name = "vkCmdSetPatchControlPointsEXT";
+	template <typename Table> struct Wrapper {
+		void cmdSetPatchControlPointsEXT(VkCommandBuffer commandBuffer, uint32_t patchControlPoints) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<CmdSetPatchControlPointsEXT>()(commandBuffer, patchControlPoints);
+		}
+	};
+};
+#endif
+#if (defined(VK_VERSION_1_3))
+struct CmdSetRasterizerDiscardEnable {
+	using type = PFN_vkCmdSetRasterizerDiscardEnable;
+	static constexpr const char* name = "vkCmdSetRasterizerDiscardEnable";
+	template <typename Table> struct Wrapper {
+		void cmdSetRasterizerDiscardEnable(VkCommandBuffer commandBuffer, VkBool32 rasterizerDiscardEnable) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<CmdSetRasterizerDiscardEnable>()(commandBuffer, rasterizerDiscardEnable);
+		}
+	};
+};
+#endif
+#if (defined(VK_VERSION_1_3))
+struct CmdSetDepthBiasEnable {
+	using type = PFN_vkCmdSetDepthBiasEnable;
+	static constexpr const char* name = "vkCmdSetDepthBiasEnable";
+	template <typename Table> struct Wrapper {
+		void cmdSetDepthBiasEnable(VkCommandBuffer commandBuffer, VkBool32 depthBiasEnable) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<CmdSetDepthBiasEnable>()(commandBuffer, depthBiasEnable);
+		}
+	};
+};
+#endif
+#if (defined(VK_EXT_extended_dynamic_state2))
+struct CmdSetLogicOpEXT {
+	using type = PFN_vkCmdSetLogicOpEXT;
+	static constexpr const char* name = "vkCmdSetLogicOpEXT";
+	template <typename Table> struct Wrapper {
+		void cmdSetLogicOpEXT(VkCommandBuffer commandBuffer, VkLogicOp logicOp) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<CmdSetLogicOpEXT>()(commandBuffer, logicOp);
+		}
+	};
+};
+#endif
+#if (defined(VK_VERSION_1_3))
+struct CmdSetPrimitiveRestartEnable {
+	using type = PFN_vkCmdSetPrimitiveRestartEnable;
+	static constexpr const char* name = "vkCmdSetPrimitiveRestartEnable";
+	template <typename Table> struct Wrapper {
+		void cmdSetPrimitiveRestartEnable(VkCommandBuffer commandBuffer, VkBool32 primitiveRestartEnable) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<CmdSetPrimitiveRestartEnable>()(commandBuffer, primitiveRestartEnable);
+		}
+	};
+};
+#endif
+#if (defined(VK_VERSION_1_3))
+struct CreatePrivateDataSlot {
+	using type = PFN_vkCreatePrivateDataSlot;
+	static constexpr const char* name = "vkCreatePrivateDataSlot";
+	template <typename Table> struct Wrapper {
+		VkResult createPrivateDataSlot(const VkPrivateDataSlotCreateInfoEXT* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkPrivateDataSlotEXT* pPrivateDataSlot) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			return table.template get<CreatePrivateDataSlot>()(table.device, pCreateInfo, pAllocator, pPrivateDataSlot);
+		}
+	};
+};
+#endif
+#if (defined(VK_EXT_extended_dynamic_state3))
+struct CmdSetTessellationDomainOriginEXT {
+	using type = PFN_vkCmdSetTessellationDomainOriginEXT;
+	static constexpr const char* name = "vkCmdSetTessellationDomainOriginEXT";
+	template <typename Table> struct Wrapper {
+		void cmdSetTessellationDomainOriginEXT(VkCommandBuffer commandBuffer, VkTessellationDomainOriginKHR domainOrigin) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<CmdSetTessellationDomainOriginEXT>()(commandBuffer, domainOrigin);
+		}
+	};
+};
+#endif
+#if (defined(VK_EXT_extended_dynamic_state3))
+struct CmdSetDepthClampEnableEXT {
+	using type = PFN_vkCmdSetDepthClampEnableEXT;
+	static constexpr const char* name = "vkCmdSetDepthClampEnableEXT";
+	template <typename Table> struct Wrapper {
+		void cmdSetDepthClampEnableEXT(VkCommandBuffer commandBuffer, VkBool32 depthClampEnable) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<CmdSetDepthClampEnableEXT>()(commandBuffer, depthClampEnable);
+		}
+	};
+};
+#endif
+#if (defined(VK_EXT_extended_dynamic_state3))
+struct CmdSetPolygonModeEXT {
+	using type = PFN_vkCmdSetPolygonModeEXT;
+	static constexpr const char* name = "vkCmdSetPolygonModeEXT";
+	template <typename Table> struct Wrapper {
+		void cmdSetPolygonModeEXT(VkCommandBuffer commandBuffer, VkPolygonMode polygonMode) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<CmdSetPolygonModeEXT>()(commandBuffer, polygonMode);
+		}
+	};
+};
+#endif
+#if (defined(VK_EXT_extended_dynamic_state3))
+struct CmdSetRasterizationSamplesEXT {
+	using type = PFN_vkCmdSetRasterizationSamplesEXT;
+	static constexpr const char* name = "vkCmdSetRasterizationSamplesEXT";
+	template <typename Table> struct Wrapper {
+		void cmdSetRasterizationSamplesEXT(VkCommandBuffer commandBuffer, VkSampleCountFlagBits rasterizationSamples) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<CmdSetRasterizationSamplesEXT>()(commandBuffer, rasterizationSamples);
+		}
+	};
+};
+#endif
+#if (defined(VK_EXT_extended_dynamic_state3))
+struct CmdSetSampleMaskEXT {
+	using type = PFN_vkCmdSetSampleMaskEXT;
+	static constexpr const char* name = "vkCmdSetSampleMaskEXT";
+	template <typename Table> struct Wrapper {
+		void cmdSetSampleMaskEXT(VkCommandBuffer commandBuffer, VkSampleCountFlagBits samples, const VkSampleMask* pSampleMask) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<CmdSetSampleMaskEXT>()(commandBuffer, samples, pSampleMask);
+		}
+	};
+};
+#endif
+#if (defined(VK_EXT_extended_dynamic_state3))
+struct CmdSetAlphaToCoverageEnableEXT {
+	using type = PFN_vkCmdSetAlphaToCoverageEnableEXT;
+	static constexpr const char* name = "vkCmdSetAlphaToCoverageEnableEXT";
+	template <typename Table> struct Wrapper {
+		void cmdSetAlphaToCoverageEnableEXT(VkCommandBuffer commandBuffer, VkBool32 alphaToCoverageEnable) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<CmdSetAlphaToCoverageEnableEXT>()(commandBuffer, alphaToCoverageEnable);
+		}
+	};
+};
+#endif
+#if (defined(VK_EXT_extended_dynamic_state3))
+struct CmdSetAlphaToOneEnableEXT {
+	using type = PFN_vkCmdSetAlphaToOneEnableEXT;
+	static constexpr const char* name = "vkCmdSetAlphaToOneEnableEXT";
+	template <typename Table> struct Wrapper {
+		void cmdSetAlphaToOneEnableEXT(VkCommandBuffer commandBuffer, VkBool32 alphaToOneEnable) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<CmdSetAlphaToOneEnableEXT>()(commandBuffer, alphaToOneEnable);
+		}
+	};
+};
+#endif
+#if (defined(VK_EXT_extended_dynamic_state3))
+struct CmdSetLogicOpEnableEXT {
+	using type = PFN_vkCmdSetLogicOpEnableEXT;
+	static constexpr const char* name = "vkCmdSetLogicOpEnableEXT";
+	template <typename Table> struct Wrapper {
+		void cmdSetLogicOpEnableEXT(VkCommandBuffer commandBuffer, VkBool32 logicOpEnable) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<CmdSetLogicOpEnableEXT>()(commandBuffer, logicOpEnable);
+		}
+	};
+};
+#endif
+#if (defined(VK_EXT_extended_dynamic_state3))
+struct CmdSetColorBlendEnableEXT {
+	using type = PFN_vkCmdSetColorBlendEnableEXT;
+	static constexpr const char* name = "vkCmdSetColorBlendEnableEXT";
+	template <typename Table> struct Wrapper {
+		void cmdSetColorBlendEnableEXT(VkCommandBuffer commandBuffer, uint32_t firstAttachment, uint32_t attachmentCount, const VkBool32* pColorBlendEnables) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<CmdSetColorBlendEnableEXT>()(commandBuffer, firstAttachment, attachmentCount, pColorBlendEnables);
+		}
+	};
+};
+#endif
+#if (defined(VK_EXT_extended_dynamic_state3))
+struct CmdSetColorBlendEquationEXT {
+	using type = PFN_vkCmdSetColorBlendEquationEXT;
+	static constexpr const char* name = "vkCmdSetColorBlendEquationEXT";
+	template <typename Table> struct Wrapper {
+		void cmdSetColorBlendEquationEXT(VkCommandBuffer commandBuffer, uint32_t firstAttachment, uint32_t attachmentCount, const VkColorBlendEquationEXT* pColorBlendEquations) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<CmdSetColorBlendEquationEXT>()(commandBuffer, firstAttachment, attachmentCount, pColorBlendEquations);
+		}
+	};
+};
+#endif
+#if (defined(VK_EXT_extended_dynamic_state3))
+struct CmdSetColorWriteMaskEXT {
+	using type = PFN_vkCmdSetColorWriteMaskEXT;
+	static constexpr const char* name = "vkCmdSetColorWriteMaskEXT";
+	template <typename Table> struct Wrapper {
+		void cmdSetColorWriteMaskEXT(VkCommandBuffer commandBuffer, uint32_t firstAttachment, uint32_t attachmentCount, const VkColorComponentFlags* pColorWriteMasks) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<CmdSetColorWriteMaskEXT>()(commandBuffer, firstAttachment, attachmentCount, pColorWriteMasks);
+		}
+	};
+};
+#endif
+#if (defined(VK_EXT_extended_dynamic_state3))
+struct CmdSetRasterizationStreamEXT {
+	using type = PFN_vkCmdSetRasterizationStreamEXT;
+	static constexpr const char* name = "vkCmdSetRasterizationStreamEXT";
+	template <typename Table> struct Wrapper {
+		void cmdSetRasterizationStreamEXT(VkCommandBuffer commandBuffer, uint32_t rasterizationStream) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<CmdSetRasterizationStreamEXT>()(commandBuffer, rasterizationStream);
+		}
+	};
+};
+#endif
+#if (defined(VK_EXT_extended_dynamic_state3))
+struct CmdSetConservativeRasterizationModeEXT {
+	using type = PFN_vkCmdSetConservativeRasterizationModeEXT;
+	static constexpr const char* name = "vkCmdSetConservativeRasterizationModeEXT";
+	template <typename Table> struct Wrapper {
+		void cmdSetConservativeRasterizationModeEXT(VkCommandBuffer commandBuffer, VkConservativeRasterizationModeEXT conservativeRasterizationMode) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<CmdSetConservativeRasterizationModeEXT>()(commandBuffer, conservativeRasterizationMode);
+		}
+	};
+};
+#endif
+#if (defined(VK_EXT_extended_dynamic_state3))
+struct CmdSetExtraPrimitiveOverestimationSizeEXT {
+	using type = PFN_vkCmdSetExtraPrimitiveOverestimationSizeEXT;
+	static constexpr const char* name = "vkCmdSetExtraPrimitiveOverestimationSizeEXT";
+	template <typename Table> struct Wrapper {
+		void cmdSetExtraPrimitiveOverestimationSizeEXT(VkCommandBuffer commandBuffer, float extraPrimitiveOverestimationSize) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<CmdSetExtraPrimitiveOverestimationSizeEXT>()(commandBuffer, extraPrimitiveOverestimationSize);
+		}
+	};
+};
+#endif
+#if (defined(VK_EXT_extended_dynamic_state3))
+struct CmdSetDepthClipEnableEXT {
+	using type = PFN_vkCmdSetDepthClipEnableEXT;
+	static constexpr const char* name = "vkCmdSetDepthClipEnableEXT";
+	template <typename Table> struct Wrapper {
+		void cmdSetDepthClipEnableEXT(VkCommandBuffer commandBuffer, VkBool32 depthClipEnable) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<CmdSetDepthClipEnableEXT>()(commandBuffer, depthClipEnable);
+		}
+	};
+};
+#endif
+#if (defined(VK_EXT_extended_dynamic_state3))
+struct CmdSetSampleLocationsEnableEXT {
+	using type = PFN_vkCmdSetSampleLocationsEnableEXT;
+	static constexpr const char* name = "vkCmdSetSampleLocationsEnableEXT";
+	template <typename Table> struct Wrapper {
+		void cmdSetSampleLocationsEnableEXT(VkCommandBuffer commandBuffer, VkBool32 sampleLocationsEnable) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<CmdSetSampleLocationsEnableEXT>()(commandBuffer, sampleLocationsEnable);
+		}
+	};
+};
+#endif
+#if (defined(VK_EXT_extended_dynamic_state3))
+struct CmdSetColorBlendAdvancedEXT {
+	using type = PFN_vkCmdSetColorBlendAdvancedEXT;
+	static constexpr const char* name = "vkCmdSetColorBlendAdvancedEXT";
+	template <typename Table> struct Wrapper {
+		void cmdSetColorBlendAdvancedEXT(VkCommandBuffer commandBuffer, uint32_t firstAttachment, uint32_t attachmentCount, const VkColorBlendAdvancedEXT* pColorBlendAdvanced) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<CmdSetColorBlendAdvancedEXT>()(commandBuffer, firstAttachment, attachmentCount, pColorBlendAdvanced);
+		}
+	};
+};
+#endif
+#if (defined(VK_EXT_extended_dynamic_state3))
+struct CmdSetProvokingVertexModeEXT {
+	using type = PFN_vkCmdSetProvokingVertexModeEXT;
+	static constexpr const char* name = "vkCmdSetProvokingVertexModeEXT";
+	template <typename Table> struct Wrapper {
+		void cmdSetProvokingVertexModeEXT(VkCommandBuffer commandBuffer, VkProvokingVertexModeEXT provokingVertexMode) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<CmdSetProvokingVertexModeEXT>()(commandBuffer, provokingVertexMode);
+		}
+	};
+};
+#endif
+#if (defined(VK_EXT_extended_dynamic_state3))
+struct CmdSetLineRasterizationModeEXT {
+	using type = PFN_vkCmdSetLineRasterizationModeEXT;
+	static constexpr const char* name = "vkCmdSetLineRasterizationModeEXT";
+	template <typename Table> struct Wrapper {
+		void cmdSetLineRasterizationModeEXT(VkCommandBuffer commandBuffer, VkLineRasterizationModeEXT lineRasterizationMode) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<CmdSetLineRasterizationModeEXT>()(commandBuffer, lineRasterizationMode);
+		}
+	};
+};
+#endif
+#if (defined(VK_EXT_extended_dynamic_state3))
+struct CmdSetLineStippleEnableEXT {
+	using type = PFN_vkCmdSetLineStippleEnableEXT;
+	static constexpr const char* name = "vkCmdSetLineStippleEnableEXT";
+	template <typename Table> struct Wrapper {
+		void cmdSetLineStippleEnableEXT(VkCommandBuffer commandBuffer, VkBool32 stippledLineEnable) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<CmdSetLineStippleEnableEXT>()(commandBuffer, stippledLineEnable);
+		}
+	};
+};
+#endif
+#if (defined(VK_EXT_extended_dynamic_state3))
+struct CmdSetDepthClipNegativeOneToOneEXT {
+	using type = PFN_vkCmdSetDepthClipNegativeOneToOneEXT;
+	static constexpr const char* name = "vkCmdSetDepthClipNegativeOneToOneEXT";
+	template <typename Table> struct Wrapper {
+		void cmdSetDepthClipNegativeOneToOneEXT(VkCommandBuffer commandBuffer, VkBool32 negativeOneToOne) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<CmdSetDepthClipNegativeOneToOneEXT>()(commandBuffer, negativeOneToOne);
+		}
+	};
+};
+#endif
+#if (defined(VK_EXT_extended_dynamic_state3))
+struct CmdSetViewportWScalingEnableNV {
+	using type = PFN_vkCmdSetViewportWScalingEnableNV;
+	static constexpr const char* name = "vkCmdSetViewportWScalingEnableNV";
+	template <typename Table> struct Wrapper {
+		void cmdSetViewportWScalingEnableNV(VkCommandBuffer commandBuffer, VkBool32 viewportWScalingEnable) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<CmdSetViewportWScalingEnableNV>()(commandBuffer, viewportWScalingEnable);
+		}
+	};
+};
+#endif
+#if (defined(VK_EXT_extended_dynamic_state3))
+struct CmdSetViewportSwizzleNV {
+	using type = PFN_vkCmdSetViewportSwizzleNV;
+	static constexpr const char* name = "vkCmdSetViewportSwizzleNV";
+	template <typename Table> struct Wrapper {
+		void cmdSetViewportSwizzleNV(VkCommandBuffer commandBuffer, uint32_t firstViewport, uint32_t viewportCount, const VkViewportSwizzleNV* pViewportSwizzles) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<CmdSetViewportSwizzleNV>()(commandBuffer, firstViewport, viewportCount, pViewportSwizzles);
+		}
+	};
+};
+#endif
+#if (defined(VK_EXT_extended_dynamic_state3))
+struct CmdSetCoverageToColorEnableNV {
+	using type = PFN_vkCmdSetCoverageToColorEnableNV;
+	static constexpr const char* name = "vkCmdSetCoverageToColorEnableNV";
+	template <typename Table> struct Wrapper {
+		void cmdSetCoverageToColorEnableNV(VkCommandBuffer commandBuffer, VkBool32 coverageToColorEnable) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<CmdSetCoverageToColorEnableNV>()(commandBuffer, coverageToColorEnable);
+		}
+	};
+};
+#endif
+#if (defined(VK_EXT_extended_dynamic_state3))
+struct CmdSetCoverageToColorLocationNV {
+	using type = PFN_vkCmdSetCoverageToColorLocationNV;
+	static constexpr const char* name = "vkCmdSetCoverageToColorLocationNV";
+	template <typename Table> struct Wrapper {
+		void cmdSetCoverageToColorLocationNV(VkCommandBuffer commandBuffer, uint32_t coverageToColorLocation) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<CmdSetCoverageToColorLocationNV>()(commandBuffer, coverageToColorLocation);
+		}
+	};
+};
+#endif
+#if (defined(VK_EXT_extended_dynamic_state3))
+struct CmdSetCoverageModulationModeNV {
+	using type = PFN_vkCmdSetCoverageModulationModeNV;
+	static constexpr const char* name = "vkCmdSetCoverageModulationModeNV";
+	template <typename Table> struct Wrapper {
+		void cmdSetCoverageModulationModeNV(VkCommandBuffer commandBuffer, VkCoverageModulationModeNV coverageModulationMode) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<CmdSetCoverageModulationModeNV>()(commandBuffer, coverageModulationMode);
+		}
+	};
+};
+#endif
+#if (defined(VK_EXT_extended_dynamic_state3))
+struct CmdSetCoverageModulationTableEnableNV {
+	using type = PFN_vkCmdSetCoverageModulationTableEnableNV;
+	static constexpr const char* name = "vkCmdSetCoverageModulationTableEnableNV";
+	template <typename Table> struct Wrapper {
+		void cmdSetCoverageModulationTableEnableNV(VkCommandBuffer commandBuffer, VkBool32 coverageModulationTableEnable) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<CmdSetCoverageModulationTableEnableNV>()(commandBuffer, coverageModulationTableEnable);
+		}
+	};
+};
+#endif
+#if (defined(VK_EXT_extended_dynamic_state3))
+struct CmdSetCoverageModulationTableNV {
+	using type = PFN_vkCmdSetCoverageModulationTableNV;
+	static constexpr const char* name = "vkCmdSetCoverageModulationTableNV";
+	template <typename Table> struct Wrapper {
+		void cmdSetCoverageModulationTableNV(VkCommandBuffer commandBuffer, uint32_t coverageModulationTableCount, const float* pCoverageModulationTable) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<CmdSetCoverageModulationTableNV>()(commandBuffer, coverageModulationTableCount, pCoverageModulationTable);
+		}
+	};
+};
+#endif
+#if (defined(VK_EXT_extended_dynamic_state3))
+struct CmdSetShadingRateImageEnableNV {
+	using type = PFN_vkCmdSetShadingRateImageEnableNV;
+	static constexpr const char* name = "vkCmdSetShadingRateImageEnableNV";
+	template <typename Table> struct Wrapper {
+		void cmdSetShadingRateImageEnableNV(VkCommandBuffer commandBuffer, VkBool32 shadingRateImageEnable) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<CmdSetShadingRateImageEnableNV>()(commandBuffer, shadingRateImageEnable);
+		}
+	};
+};
+#endif
+#if (defined(VK_EXT_extended_dynamic_state3))
+struct CmdSetCoverageReductionModeNV {
+	using type = PFN_vkCmdSetCoverageReductionModeNV;
+	static constexpr const char* name = "vkCmdSetCoverageReductionModeNV";
+	template <typename Table> struct Wrapper {
+		void cmdSetCoverageReductionModeNV(VkCommandBuffer commandBuffer, VkCoverageReductionModeNV coverageReductionMode) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<CmdSetCoverageReductionModeNV>()(commandBuffer, coverageReductionMode);
+		}
+	};
+};
+#endif
+#if (defined(VK_EXT_extended_dynamic_state3))
+struct CmdSetRepresentativeFragmentTestEnableNV {
+	using type = PFN_vkCmdSetRepresentativeFragmentTestEnableNV;
+	static constexpr const char* name = "vkCmdSetRepresentativeFragmentTestEnableNV";
+	template <typename Table> struct Wrapper {
+		void cmdSetRepresentativeFragmentTestEnableNV(VkCommandBuffer commandBuffer, VkBool32 representativeFragmentTestEnable) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<CmdSetRepresentativeFragmentTestEnableNV>()(commandBuffer, representativeFragmentTestEnable);
+		}
+	};
+};
+#endif
+#if (defined(VK_VERSION_1_3))
+struct DestroyPrivateDataSlot {
+	using type = PFN_vkDestroyPrivateDataSlot;
+	static constexpr const char* name = "vkDestroyPrivateDataSlot";
+	template <typename Table> struct Wrapper {
+		void destroyPrivateDataSlot(VkPrivateDataSlotEXT privateDataSlot, const VkAllocationCallbacks* pAllocator) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<DestroyPrivateDataSlot>()(table.device, privateDataSlot, pAllocator);
+		}
+	};
+};
+#endif
+#if (defined(VK_VERSION_1_3))
+struct SetPrivateData {
+	using type = PFN_vkSetPrivateData;
+	static constexpr const char* name = "vkSetPrivateData";
+	template <typename Table> struct Wrapper {
+		VkResult setPrivateData(VkObjectType objectType, uint64_t objectHandle, VkPrivateDataSlotEXT privateDataSlot, uint64_t data) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			return table.template get<SetPrivateData>()(table.device, objectType, objectHandle, privateDataSlot, data);
+		}
+	};
+};
+#endif
+#if (defined(VK_VERSION_1_3))
+struct GetPrivateData {
+	using type = PFN_vkGetPrivateData;
+	static constexpr const char* name = "vkGetPrivateData";
+	template <typename Table> struct Wrapper {
+		void getPrivateData(VkObjectType objectType, uint64_t objectHandle, VkPrivateDataSlotEXT privateDataSlot, uint64_t* pData) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<GetPrivateData>()(table.device, objectType, objectHandle, privateDataSlot, pData);
+		}
+	};
+};
+#endif
+#if (defined(VK_VERSION_1_3))
+struct CmdCopyBuffer2 {
+	using type = PFN_vkCmdCopyBuffer2;
+	static constexpr const char* name = "vkCmdCopyBuffer2";
+	template <typename Table> struct Wrapper {
+		void cmdCopyBuffer2(VkCommandBuffer commandBuffer, const VkCopyBufferInfo2KHR* pCopyBufferInfo) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<CmdCopyBuffer2>()(commandBuffer, pCopyBufferInfo);
+		}
+	};
+};
+#endif
+#if (defined(VK_VERSION_1_3))
+struct CmdCopyImage2 {
+	using type = PFN_vkCmdCopyImage2;
+	static constexpr const char* name = "vkCmdCopyImage2";
+	template <typename Table> struct Wrapper {
+		void cmdCopyImage2(VkCommandBuffer commandBuffer, const VkCopyImageInfo2KHR* pCopyImageInfo) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<CmdCopyImage2>()(commandBuffer, pCopyImageInfo);
+		}
+	};
+};
+#endif
+#if (defined(VK_VERSION_1_3))
+struct CmdBlitImage2 {
+	using type = PFN_vkCmdBlitImage2;
+	static constexpr const char* name = "vkCmdBlitImage2";
+	template <typename Table> struct Wrapper {
+		void cmdBlitImage2(VkCommandBuffer commandBuffer, const VkBlitImageInfo2KHR* pBlitImageInfo) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<CmdBlitImage2>()(commandBuffer, pBlitImageInfo);
+		}
+	};
+};
+#endif
+#if (defined(VK_VERSION_1_3))
+struct CmdCopyBufferToImage2 {
+	using type = PFN_vkCmdCopyBufferToImage2;
+	static constexpr const char* name = "vkCmdCopyBufferToImage2";
+	template <typename Table> struct Wrapper {
+		void cmdCopyBufferToImage2(VkCommandBuffer commandBuffer, const VkCopyBufferToImageInfo2KHR* pCopyBufferToImageInfo) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<CmdCopyBufferToImage2>()(commandBuffer, pCopyBufferToImageInfo);
+		}
+	};
+};
+#endif
+#if (defined(VK_VERSION_1_3))
+struct CmdCopyImageToBuffer2 {
+	using type = PFN_vkCmdCopyImageToBuffer2;
+	static constexpr const char* name = "vkCmdCopyImageToBuffer2";
+	template <typename Table> struct Wrapper {
+		void cmdCopyImageToBuffer2(VkCommandBuffer commandBuffer, const VkCopyImageToBufferInfo2KHR* pCopyImageToBufferInfo) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<CmdCopyImageToBuffer2>()(commandBuffer, pCopyImageToBufferInfo);
+		}
+	};
+};
+#endif
+#if (defined(VK_VERSION_1_3))
+struct CmdResolveImage2 {
+	using type = PFN_vkCmdResolveImage2;
+	static constexpr const char* name = "vkCmdResolveImage2";
+	template <typename Table> struct Wrapper {
+		void cmdResolveImage2(VkCommandBuffer commandBuffer, const VkResolveImageInfo2KHR* pResolveImageInfo) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<CmdResolveImage2>()(commandBuffer, pResolveImageInfo);
+		}
+	};
+};
+#endif
+#if (defined(VK_KHR_fragment_shading_rate))
+struct CmdSetFragmentShadingRateKHR {
+	using type = PFN_vkCmdSetFragmentShadingRateKHR;
+	static constexpr const char* name = "vkCmdSetFragmentShadingRateKHR";
+	template <typename Table> struct Wrapper {
+		void cmdSetFragmentShadingRateKHR(VkCommandBuffer commandBuffer, const VkExtent2D* pFragmentSize, VkFragmentShadingRateCombinerOpKHR combinerOps[2]) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<CmdSetFragmentShadingRateKHR>()(commandBuffer, pFragmentSize, combinerOps);
+		}
+	};
+};
+#endif
+#if (defined(VK_NV_fragment_shading_rate_enums))
+struct CmdSetFragmentShadingRateEnumNV {
+	using type = PFN_vkCmdSetFragmentShadingRateEnumNV;
+	static constexpr const char* name = "vkCmdSetFragmentShadingRateEnumNV";
+	template <typename Table> struct Wrapper {
+		void cmdSetFragmentShadingRateEnumNV(VkCommandBuffer commandBuffer, VkFragmentShadingRateNV shadingRate, VkFragmentShadingRateCombinerOpKHR combinerOps[2]) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<CmdSetFragmentShadingRateEnumNV>()(commandBuffer, shadingRate, combinerOps);
+		}
+	};
+};
+#endif
+#if (defined(VK_KHR_acceleration_structure))
+struct GetAccelerationStructureBuildSizesKHR {
+	using type = PFN_vkGetAccelerationStructureBuildSizesKHR;
+	static constexpr const char* name = "vkGetAccelerationStructureBuildSizesKHR";
+	template <typename Table> struct Wrapper {
+		void getAccelerationStructureBuildSizesKHR(VkAccelerationStructureBuildTypeKHR buildType, const VkAccelerationStructureBuildGeometryInfoKHR* pBuildInfo, const uint32_t* pMaxPrimitiveCounts, VkAccelerationStructureBuildSizesInfoKHR* pSizeInfo) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<GetAccelerationStructureBuildSizesKHR>()(table.device, buildType, pBuildInfo, pMaxPrimitiveCounts, pSizeInfo);
+		}
+	};
+};
+#endif
+#if (defined(VK_EXT_vertex_input_dynamic_state))
+struct CmdSetVertexInputEXT {
+	using type = PFN_vkCmdSetVertexInputEXT;
+	static constexpr const char* name = "vkCmdSetVertexInputEXT";
+	template <typename Table> struct Wrapper {
+		void cmdSetVertexInputEXT(VkCommandBuffer commandBuffer, uint32_t vertexBindingDescriptionCount, const VkVertexInputBindingDescription2EXT* pVertexBindingDescriptions, uint32_t vertexAttributeDescriptionCount, const VkVertexInputAttributeDescription2EXT* pVertexAttributeDescriptions) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<CmdSetVertexInputEXT>()(commandBuffer, vertexBindingDescriptionCount, pVertexBindingDescriptions, vertexAttributeDescriptionCount, pVertexAttributeDescriptions);
+		}
+	};
+};
+#endif
+#if (defined(VK_EXT_color_write_enable))
+struct CmdSetColorWriteEnableEXT {
+	using type = PFN_vkCmdSetColorWriteEnableEXT;
+	static constexpr const char* name = "vkCmdSetColorWriteEnableEXT";
+	template <typename Table> struct Wrapper {
+		void cmdSetColorWriteEnableEXT(VkCommandBuffer commandBuffer, uint32_t attachmentCount, const VkBool32* pColorWriteEnables) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<CmdSetColorWriteEnableEXT>()(commandBuffer, attachmentCount, pColorWriteEnables);
+		}
+	};
+};
+#endif
+#if (defined(VK_VERSION_1_3))
+struct CmdSetEvent2 {
+	using type = PFN_vkCmdSetEvent2;
+	static constexpr const char* name = "vkCmdSetEvent2";
+	template <typename Table> struct Wrapper {
+		void cmdSetEvent2(VkCommandBuffer commandBuffer, VkEvent event, const VkDependencyInfoKHR* pDependencyInfo) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<CmdSetEvent2>()(commandBuffer, event, pDependencyInfo);
+		}
+	};
+};
+#endif
+#if (defined(VK_VERSION_1_3))
+struct CmdResetEvent2 {
+	using type = PFN_vkCmdResetEvent2;
+	static constexpr const char* name = "vkCmdResetEvent2";
+	template <typename Table> struct Wrapper {
+		void cmdResetEvent2(VkCommandBuffer commandBuffer, VkEvent event, VkPipelineStageFlags2KHR stageMask) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<CmdResetEvent2>()(commandBuffer, event, stageMask);
+		}
+	};
+};
+#endif
+#if (defined(VK_VERSION_1_3))
+struct CmdWaitEvents2 {
+	using type = PFN_vkCmdWaitEvents2;
+	static constexpr const char* name = "vkCmdWaitEvents2";
+	template <typename Table> struct Wrapper {
+		void cmdWaitEvents2(VkCommandBuffer commandBuffer, uint32_t eventCount, const VkEvent* pEvents, const VkDependencyInfoKHR* pDependencyInfos) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<CmdWaitEvents2>()(commandBuffer, eventCount, pEvents, pDependencyInfos);
+		}
+	};
+};
+#endif
+#if (defined(VK_VERSION_1_3))
+struct CmdPipelineBarrier2 {
+	using type = PFN_vkCmdPipelineBarrier2;
+	static constexpr const char* name = "vkCmdPipelineBarrier2";
+	template <typename Table> struct Wrapper {
+		void cmdPipelineBarrier2(VkCommandBuffer commandBuffer, const VkDependencyInfoKHR* pDependencyInfo) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<CmdPipelineBarrier2>()(commandBuffer, pDependencyInfo);
+		}
+	};
+};
+#endif
+#if (defined(VK_VERSION_1_3))
+struct QueueSubmit2 {
+	using type = PFN_vkQueueSubmit2;
+	static constexpr const char* name = "vkQueueSubmit2";
+	template <typename Table> struct Wrapper {
+		VkResult queueSubmit2(VkQueue queue, uint32_t submitCount, const VkSubmitInfo2KHR* pSubmits, VkFence fence) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			return table.template get<QueueSubmit2>()(queue, submitCount, pSubmits, fence);
+		}
+	};
+};
+#endif
+#if (defined(VK_VERSION_1_3))
+struct CmdWriteTimestamp2 {
+	using type = PFN_vkCmdWriteTimestamp2;
+	static constexpr const char* name = "vkCmdWriteTimestamp2";
+	template <typename Table> struct Wrapper {
+		void cmdWriteTimestamp2(VkCommandBuffer commandBuffer, VkPipelineStageFlags2KHR stage, VkQueryPool queryPool, uint32_t query) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<CmdWriteTimestamp2>()(commandBuffer, stage, queryPool, query);
+		}
+	};
+};
+#endif
+#if (defined(VK_KHR_synchronization2) && defined(VK_AMD_buffer_marker))
+struct CmdWriteBufferMarker2AMD {
+	using type = PFN_vkCmdWriteBufferMarker2AMD;
+	static constexpr const char* name = "vkCmdWriteBufferMarker2AMD";
+	template <typename Table> struct Wrapper {
+		void cmdWriteBufferMarker2AMD(VkCommandBuffer commandBuffer, VkPipelineStageFlags2KHR stage, VkBuffer dstBuffer, VkDeviceSize dstOffset, uint32_t marker) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<CmdWriteBufferMarker2AMD>()(commandBuffer, stage, dstBuffer, dstOffset, marker);
+		}
+	};
+};
+#endif
+#if (defined(VK_KHR_synchronization2) && defined(VK_NV_device_diagnostic_checkpoints))
+struct GetQueueCheckpointData2NV {
+	using type = PFN_vkGetQueueCheckpointData2NV;
+	static constexpr const char* name = "vkGetQueueCheckpointData2NV";
+	template <typename Table> struct Wrapper {
+		void getQueueCheckpointData2NV(VkQueue queue, uint32_t* pCheckpointDataCount, VkCheckpointData2NV* pCheckpointData) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<GetQueueCheckpointData2NV>()(queue, pCheckpointDataCount, pCheckpointData);
+		}
+	};
+};
+#endif
+#if (defined(VK_KHR_video_queue))
+struct CreateVideoSessionKHR {
+	using type = PFN_vkCreateVideoSessionKHR;
+	static constexpr const char* name = "vkCreateVideoSessionKHR";
+	template <typename Table> struct Wrapper {
+		VkResult createVideoSessionKHR(const VkVideoSessionCreateInfoKHR* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkVideoSessionKHR* pVideoSession) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			return table.template get<CreateVideoSessionKHR>()(table.device, pCreateInfo, pAllocator, pVideoSession);
+		}
+	};
+};
+#endif
+#if (defined(VK_KHR_video_queue))
+struct DestroyVideoSessionKHR {
+	using type = PFN_vkDestroyVideoSessionKHR;
+	static constexpr const char* name = "vkDestroyVideoSessionKHR";
+	template <typename Table> struct Wrapper {
+		void destroyVideoSessionKHR(VkVideoSessionKHR videoSession, const VkAllocationCallbacks* pAllocator) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<DestroyVideoSessionKHR>()(table.device, videoSession, pAllocator);
+		}
+	};
+};
+#endif
+#if (defined(VK_KHR_video_queue))
+struct CreateVideoSessionParametersKHR {
+	using type = PFN_vkCreateVideoSessionParametersKHR;
+	static constexpr const char* name = "vkCreateVideoSessionParametersKHR";
+	template <typename Table> struct Wrapper {
+		VkResult createVideoSessionParametersKHR(const VkVideoSessionParametersCreateInfoKHR* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkVideoSessionParametersKHR* pVideoSessionParameters) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			return table.template get<CreateVideoSessionParametersKHR>()(table.device, pCreateInfo, pAllocator, pVideoSessionParameters);
+		}
+	};
+};
+#endif
+#if (defined(VK_KHR_video_queue))
+struct UpdateVideoSessionParametersKHR {
+	using type = PFN_vkUpdateVideoSessionParametersKHR;
+	static constexpr const char* name = "vkUpdateVideoSessionParametersKHR";
+	template <typename Table> struct Wrapper {
+		VkResult updateVideoSessionParametersKHR(VkVideoSessionParametersKHR videoSessionParameters, const VkVideoSessionParametersUpdateInfoKHR* pUpdateInfo) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			return table.template get<UpdateVideoSessionParametersKHR>()(table.device, videoSessionParameters, pUpdateInfo);
+		}
+	};
+};
+#endif
+#if (defined(VK_KHR_video_queue))
+struct DestroyVideoSessionParametersKHR {
+	using type = PFN_vkDestroyVideoSessionParametersKHR;
+	static constexpr const char* name = "vkDestroyVideoSessionParametersKHR";
+	template <typename Table> struct Wrapper {
+		void destroyVideoSessionParametersKHR(VkVideoSessionParametersKHR videoSessionParameters, const VkAllocationCallbacks* pAllocator) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<DestroyVideoSessionParametersKHR>()(table.device, videoSessionParameters, pAllocator);
+		}
+	};
+};
+#endif
+#if (defined(VK_KHR_video_queue))
+struct GetVideoSessionMemoryRequirementsKHR {
+	using type = PFN_vkGetVideoSessionMemoryRequirementsKHR;
+	static constexpr const char* name = "vkGetVideoSessionMemoryRequirementsKHR";
+	template <typename Table> struct Wrapper {
+		VkResult getVideoSessionMemoryRequirementsKHR(VkVideoSessionKHR videoSession, uint32_t* pMemoryRequirementsCount, VkVideoSessionMemoryRequirementsKHR* pMemoryRequirements) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			return table.template get<GetVideoSessionMemoryRequirementsKHR>()(table.device, videoSession, pMemoryRequirementsCount, pMemoryRequirements);
+		}
+	};
+};
+#endif
+#if (defined(VK_KHR_video_queue))
+struct BindVideoSessionMemoryKHR {
+	using type = PFN_vkBindVideoSessionMemoryKHR;
+	static constexpr const char* name = "vkBindVideoSessionMemoryKHR";
+	template <typename Table> struct Wrapper {
+		VkResult bindVideoSessionMemoryKHR(VkVideoSessionKHR videoSession, uint32_t bindSessionMemoryInfoCount, const VkBindVideoSessionMemoryInfoKHR* pBindSessionMemoryInfos) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			return table.template get<BindVideoSessionMemoryKHR>()(table.device, videoSession, bindSessionMemoryInfoCount, pBindSessionMemoryInfos);
+		}
+	};
+};
+#endif
+#if (defined(VK_KHR_video_decode_queue))
+struct CmdDecodeVideoKHR {
+	using type = PFN_vkCmdDecodeVideoKHR;
+	static constexpr const char* name = "vkCmdDecodeVideoKHR";
+	template <typename Table> struct Wrapper {
+		void cmdDecodeVideoKHR(VkCommandBuffer commandBuffer, const VkVideoDecodeInfoKHR* pDecodeInfo) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<CmdDecodeVideoKHR>()(commandBuffer, pDecodeInfo);
+		}
+	};
+};
+#endif
+#if (defined(VK_KHR_video_queue))
+struct CmdBeginVideoCodingKHR {
+	using type = PFN_vkCmdBeginVideoCodingKHR;
+	static constexpr const char* name = "vkCmdBeginVideoCodingKHR";
+	template <typename Table> struct Wrapper {
+		void cmdBeginVideoCodingKHR(VkCommandBuffer commandBuffer, const VkVideoBeginCodingInfoKHR* pBeginInfo) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<CmdBeginVideoCodingKHR>()(commandBuffer, pBeginInfo);
+		}
+	};
+};
+#endif
+#if (defined(VK_KHR_video_queue))
+struct CmdControlVideoCodingKHR {
+	using type = PFN_vkCmdControlVideoCodingKHR;
+	static constexpr const char* name = "vkCmdControlVideoCodingKHR";
+	template <typename Table> struct Wrapper {
+		void cmdControlVideoCodingKHR(VkCommandBuffer commandBuffer, const VkVideoCodingControlInfoKHR* pCodingControlInfo) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<CmdControlVideoCodingKHR>()(commandBuffer, pCodingControlInfo);
+		}
+	};
+};
+#endif
+#if (defined(VK_KHR_video_queue))
+struct CmdEndVideoCodingKHR {
+	using type = PFN_vkCmdEndVideoCodingKHR;
+	static constexpr const char* name = "vkCmdEndVideoCodingKHR";
+	template <typename Table> struct Wrapper {
+		void cmdEndVideoCodingKHR(VkCommandBuffer commandBuffer, const VkVideoEndCodingInfoKHR* pEndCodingInfo) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<CmdEndVideoCodingKHR>()(commandBuffer, pEndCodingInfo);
+		}
+	};
+};
+#endif
+#if (defined(VK_KHR_video_encode_queue))
+struct CmdEncodeVideoKHR {
+	using type = PFN_vkCmdEncodeVideoKHR;
+	static constexpr const char* name = "vkCmdEncodeVideoKHR";
+	template <typename Table> struct Wrapper {
+		void cmdEncodeVideoKHR(VkCommandBuffer commandBuffer, const VkVideoEncodeInfoKHR* pEncodeInfo) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<CmdEncodeVideoKHR>()(commandBuffer, pEncodeInfo);
+		}
+	};
+};
+#endif
+#if (defined(VK_EXT_pageable_device_local_memory))
+struct SetDeviceMemoryPriorityEXT {
+	using type = PFN_vkSetDeviceMemoryPriorityEXT;
+	static constexpr const char* name = "vkSetDeviceMemoryPriorityEXT";
+	template <typename Table> struct Wrapper {
+		void setDeviceMemoryPriorityEXT(VkDeviceMemory memory, float priority) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<SetDeviceMemoryPriorityEXT>()(table.device, memory, priority);
+		}
+	};
+};
+#endif
+#if (defined(VK_KHR_present_wait))
+struct WaitForPresentKHR {
+	using type = PFN_vkWaitForPresentKHR;
+	static constexpr const char* name = "vkWaitForPresentKHR";
+	template <typename Table> struct Wrapper {
+		VkResult waitForPresentKHR(VkSwapchainKHR swapchain, uint64_t presentId, uint64_t timeout) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			return table.template get<WaitForPresentKHR>()(table.device, swapchain, presentId, timeout);
+		}
+	};
+};
+#endif
+#if (defined(VK_FUCHSIA_buffer_collection))
+struct CreateBufferCollectionFUCHSIA {
+	using type = PFN_vkCreateBufferCollectionFUCHSIA;
+	static constexpr const char* name = "vkCreateBufferCollectionFUCHSIA";
+	template <typename Table> struct Wrapper {
+		VkResult createBufferCollectionFUCHSIA(const VkBufferCollectionCreateInfoFUCHSIA* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkBufferCollectionFUCHSIA* pCollection) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			return table.template get<CreateBufferCollectionFUCHSIA>()(table.device, pCreateInfo, pAllocator, pCollection);
+		}
+	};
+};
+#endif
+#if (defined(VK_FUCHSIA_buffer_collection))
+struct SetBufferCollectionBufferConstraintsFUCHSIA {
+	using type = PFN_vkSetBufferCollectionBufferConstraintsFUCHSIA;
+	static constexpr const char* name = "vkSetBufferCollectionBufferConstraintsFUCHSIA";
+	template <typename Table> struct Wrapper {
+		VkResult setBufferCollectionBufferConstraintsFUCHSIA(VkBufferCollectionFUCHSIA collection, const VkBufferConstraintsInfoFUCHSIA* pBufferConstraintsInfo) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			return table.template get<SetBufferCollectionBufferConstraintsFUCHSIA>()(table.device, collection, pBufferConstraintsInfo);
+		}
+	};
+};
+#endif
+#if (defined(VK_FUCHSIA_buffer_collection))
+struct SetBufferCollectionImageConstraintsFUCHSIA {
+	using type = PFN_vkSetBufferCollectionImageConstraintsFUCHSIA;
+	static constexpr const char* name = "vkSetBufferCollectionImageConstraintsFUCHSIA";
+	template <typename Table> struct Wrapper {
+		VkResult setBufferCollectionImageConstraintsFUCHSIA(VkBufferCollectionFUCHSIA collection, const VkImageConstraintsInfoFUCHSIA* pImageConstraintsInfo) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			return table.template get<SetBufferCollectionImageConstraintsFUCHSIA>()(table.device, collection, pImageConstraintsInfo);
+		}
+	};
+};
+#endif
+#if (defined(VK_FUCHSIA_buffer_collection))
+struct DestroyBufferCollectionFUCHSIA {
+	using type = PFN_vkDestroyBufferCollectionFUCHSIA;
+	static constexpr const char* name = "vkDestroyBufferCollectionFUCHSIA";
+	template <typename Table> struct Wrapper {
+		void destroyBufferCollectionFUCHSIA(VkBufferCollectionFUCHSIA collection, const VkAllocationCallbacks* pAllocator) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<DestroyBufferCollectionFUCHSIA>()(table.device, collection, pAllocator);
+		}
+	};
+};
+#endif
+#if (defined(VK_FUCHSIA_buffer_collection))
+struct GetBufferCollectionPropertiesFUCHSIA {
+	using type = PFN_vkGetBufferCollectionPropertiesFUCHSIA;
+	static constexpr const char* name = "vkGetBufferCollectionPropertiesFUCHSIA";
+	template <typename Table> struct Wrapper {
+		VkResult getBufferCollectionPropertiesFUCHSIA(VkBufferCollectionFUCHSIA collection, VkBufferCollectionPropertiesFUCHSIA* pProperties) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			return table.template get<GetBufferCollectionPropertiesFUCHSIA>()(table.device, collection, pProperties);
+		}
+	};
+};
+#endif
+#if (defined(VK_VERSION_1_3))
+struct CmdBeginRendering {
+	using type = PFN_vkCmdBeginRendering;
+	static constexpr const char* name = "vkCmdBeginRendering";
+	template <typename Table> struct Wrapper {
+		void cmdBeginRendering(VkCommandBuffer commandBuffer, const VkRenderingInfoKHR* pRenderingInfo) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<CmdBeginRendering>()(commandBuffer, pRenderingInfo);
+		}
+	};
+};
+#endif
+#if (defined(VK_VERSION_1_3))
+struct CmdEndRendering {
+	using type = PFN_vkCmdEndRendering;
+	static constexpr const char* name = "vkCmdEndRendering";
+	template <typename Table> struct Wrapper {
+		void cmdEndRendering(VkCommandBuffer commandBuffer) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<CmdEndRendering>()(commandBuffer);
+		}
+	};
+};
+#endif
+#if (defined(VK_VALVE_descriptor_set_host_mapping))
+struct GetDescriptorSetLayoutHostMappingInfoVALVE {
+	using type = PFN_vkGetDescriptorSetLayoutHostMappingInfoVALVE;
+	static constexpr const char* name = "vkGetDescriptorSetLayoutHostMappingInfoVALVE";
+	template <typename Table> struct Wrapper {
+		void getDescriptorSetLayoutHostMappingInfoVALVE(const VkDescriptorSetBindingReferenceVALVE* pBindingReference, VkDescriptorSetLayoutHostMappingInfoVALVE* pHostMapping) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<GetDescriptorSetLayoutHostMappingInfoVALVE>()(table.device, pBindingReference, pHostMapping);
+		}
+	};
+};
+#endif
+#if (defined(VK_VALVE_descriptor_set_host_mapping))
+struct GetDescriptorSetHostMappingVALVE {
+	using type = PFN_vkGetDescriptorSetHostMappingVALVE;
+	static constexpr const char* name = "vkGetDescriptorSetHostMappingVALVE";
+	template <typename Table> struct Wrapper {
+		void getDescriptorSetHostMappingVALVE(VkDescriptorSet descriptorSet, void** ppData) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<GetDescriptorSetHostMappingVALVE>()(table.device, descriptorSet, ppData);
+		}
+	};
+};
+#endif
+#if (defined(VK_EXT_opacity_micromap))
+struct CreateMicromapEXT {
+	using type = PFN_vkCreateMicromapEXT;
+	static constexpr const char* name = "vkCreateMicromapEXT";
+	template <typename Table> struct Wrapper {
+		VkResult createMicromapEXT(const VkMicromapCreateInfoEXT* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkMicromapEXT* pMicromap) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			return table.template get<CreateMicromapEXT>()(table.device, pCreateInfo, pAllocator, pMicromap);
+		}
+	};
+};
+#endif
+#if (defined(VK_EXT_opacity_micromap))
+struct CmdBuildMicromapsEXT {
+	using type = PFN_vkCmdBuildMicromapsEXT;
+	static constexpr const char* name = "vkCmdBuildMicromapsEXT";
+	template <typename Table> struct Wrapper {
+		void cmdBuildMicromapsEXT(VkCommandBuffer commandBuffer, uint32_t infoCount, const VkMicromapBuildInfoEXT* pInfos) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<CmdBuildMicromapsEXT>()(commandBuffer, infoCount, pInfos);
+		}
+	};
+};
+#endif
+#if (defined(VK_EXT_opacity_micromap))
+struct BuildMicromapsEXT {
+	using type = PFN_vkBuildMicromapsEXT;
+	static constexpr const char* name = "vkBuildMicromapsEXT";
+	template <typename Table> struct Wrapper {
+		VkResult buildMicromapsEXT(VkDeferredOperationKHR deferredOperation, uint32_t infoCount, const VkMicromapBuildInfoEXT* pInfos) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			return table.template get<BuildMicromapsEXT>()(table.device, deferredOperation, infoCount, pInfos);
+		}
+	};
+};
+#endif
+#if (defined(VK_EXT_opacity_micromap))
+struct DestroyMicromapEXT {
+	using type = PFN_vkDestroyMicromapEXT;
+	static constexpr const char* name = "vkDestroyMicromapEXT";
+	template <typename Table> struct Wrapper {
+		void destroyMicromapEXT(VkMicromapEXT micromap, const VkAllocationCallbacks* pAllocator) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<DestroyMicromapEXT>()(table.device, micromap, pAllocator);
+		}
+	};
+};
+#endif
+#if (defined(VK_EXT_opacity_micromap))
+struct CmdCopyMicromapEXT {
+	using type = PFN_vkCmdCopyMicromapEXT;
+	static constexpr const char* name = "vkCmdCopyMicromapEXT";
+	template <typename Table> struct Wrapper {
+		void cmdCopyMicromapEXT(VkCommandBuffer commandBuffer, const VkCopyMicromapInfoEXT* pInfo) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<CmdCopyMicromapEXT>()(commandBuffer, pInfo);
+		}
+	};
+};
+#endif
+#if (defined(VK_EXT_opacity_micromap))
+struct CopyMicromapEXT {
+	using type = PFN_vkCopyMicromapEXT;
+	static constexpr const char* name = "vkCopyMicromapEXT";
+	template <typename Table> struct Wrapper {
+		VkResult copyMicromapEXT(VkDeferredOperationKHR deferredOperation, const VkCopyMicromapInfoEXT* pInfo) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			return table.template get<CopyMicromapEXT>()(table.device, deferredOperation, pInfo);
+		}
+	};
+};
+#endif
+#if (defined(VK_EXT_opacity_micromap))
+struct CmdCopyMicromapToMemoryEXT {
+	using type = PFN_vkCmdCopyMicromapToMemoryEXT;
+	static constexpr const char* name = "vkCmdCopyMicromapToMemoryEXT";
+	template <typename Table> struct Wrapper {
+		void cmdCopyMicromapToMemoryEXT(VkCommandBuffer commandBuffer, const VkCopyMicromapToMemoryInfoEXT* pInfo) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<CmdCopyMicromapToMemoryEXT>()(commandBuffer, pInfo);
+		}
+	};
+};
+#endif
+#if (defined(VK_EXT_opacity_micromap))
+struct CopyMicromapToMemoryEXT {
+	using type = PFN_vkCopyMicromapToMemoryEXT;
+	static constexpr const char* name = "vkCopyMicromapToMemoryEXT";
+	template <typename Table> struct Wrapper {
+		VkResult copyMicromapToMemoryEXT(VkDeferredOperationKHR deferredOperation, const VkCopyMicromapToMemoryInfoEXT* pInfo) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			return table.template get<CopyMicromapToMemoryEXT>()(table.device, deferredOperation, pInfo);
+		}
+	};
+};
+#endif
+#if (defined(VK_EXT_opacity_micromap))
+struct CmdCopyMemoryToMicromapEXT {
+	using type = PFN_vkCmdCopyMemoryToMicromapEXT;
+	static constexpr const char* name = "vkCmdCopyMemoryToMicromapEXT";
+	template <typename Table> struct Wrapper {
+		void cmdCopyMemoryToMicromapEXT(VkCommandBuffer commandBuffer, const VkCopyMemoryToMicromapInfoEXT* pInfo) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<CmdCopyMemoryToMicromapEXT>()(commandBuffer, pInfo);
+		}
+	};
+};
+#endif
+#if (defined(VK_EXT_opacity_micromap))
+struct CopyMemoryToMicromapEXT {
+	using type = PFN_vkCopyMemoryToMicromapEXT;
+	static constexpr const char* name = "vkCopyMemoryToMicromapEXT";
+	template <typename Table> struct Wrapper {
+		VkResult copyMemoryToMicromapEXT(VkDeferredOperationKHR deferredOperation, const VkCopyMemoryToMicromapInfoEXT* pInfo) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			return table.template get<CopyMemoryToMicromapEXT>()(table.device, deferredOperation, pInfo);
+		}
+	};
+};
+#endif
+#if (defined(VK_EXT_opacity_micromap))
+struct CmdWriteMicromapsPropertiesEXT {
+	using type = PFN_vkCmdWriteMicromapsPropertiesEXT;
+	static constexpr const char* name = "vkCmdWriteMicromapsPropertiesEXT";
+	template <typename Table> struct Wrapper {
+		void cmdWriteMicromapsPropertiesEXT(VkCommandBuffer commandBuffer, uint32_t micromapCount, const VkMicromapEXT* pMicromaps, VkQueryType queryType, VkQueryPool queryPool, uint32_t firstQuery) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<CmdWriteMicromapsPropertiesEXT>()(commandBuffer, micromapCount, pMicromaps, queryType, queryPool, firstQuery);
+		}
+	};
+};
+#endif
+#if (defined(VK_EXT_opacity_micromap))
+struct WriteMicromapsPropertiesEXT {
+	using type = PFN_vkWriteMicromapsPropertiesEXT;
+	static constexpr const char* name = "vkWriteMicromapsPropertiesEXT";
+	template <typename Table> struct Wrapper {
+		VkResult writeMicromapsPropertiesEXT(uint32_t micromapCount, const VkMicromapEXT* pMicromaps, VkQueryType queryType, size_t dataSize, void* pData, size_t stride) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			return table.template get<WriteMicromapsPropertiesEXT>()(table.device, micromapCount, pMicromaps, queryType, dataSize, pData, stride);
+		}
+	};
+};
+#endif
+#if (defined(VK_EXT_opacity_micromap))
+struct GetDeviceMicromapCompatibilityEXT {
+	using type = PFN_vkGetDeviceMicromapCompatibilityEXT;
+	static constexpr const char* name = "vkGetDeviceMicromapCompatibilityEXT";
+	template <typename Table> struct Wrapper {
+		void getDeviceMicromapCompatibilityEXT(const VkMicromapVersionInfoEXT* pVersionInfo, VkAccelerationStructureCompatibilityKHR* pCompatibility) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<GetDeviceMicromapCompatibilityEXT>()(table.device, pVersionInfo, pCompatibility);
+		}
+	};
+};
+#endif
+#if (defined(VK_EXT_opacity_micromap))
+struct GetMicromapBuildSizesEXT {
+	using type = PFN_vkGetMicromapBuildSizesEXT;
+	static constexpr const char* name = "vkGetMicromapBuildSizesEXT";
+	template <typename Table> struct Wrapper {
+		void getMicromapBuildSizesEXT(VkAccelerationStructureBuildTypeKHR buildType, const VkMicromapBuildInfoEXT* pBuildInfo, VkMicromapBuildSizesInfoEXT* pSizeInfo) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<GetMicromapBuildSizesEXT>()(table.device, buildType, pBuildInfo, pSizeInfo);
+		}
+	};
+};
+#endif
+#if (defined(VK_EXT_shader_module_identifier))
+struct GetShaderModuleIdentifierEXT {
+	using type = PFN_vkGetShaderModuleIdentifierEXT;
+	static constexpr const char* name = "vkGetShaderModuleIdentifierEXT";
+	template <typename Table> struct Wrapper {
+		void getShaderModuleIdentifierEXT(VkShaderModule shaderModule, VkShaderModuleIdentifierEXT* pIdentifier) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<GetShaderModuleIdentifierEXT>()(table.device, shaderModule, pIdentifier);
+		}
+	};
+};
+#endif
+#if (defined(VK_EXT_shader_module_identifier))
+struct GetShaderModuleCreateInfoIdentifierEXT {
+	using type = PFN_vkGetShaderModuleCreateInfoIdentifierEXT;
+	static constexpr const char* name = "vkGetShaderModuleCreateInfoIdentifierEXT";
+	template <typename Table> struct Wrapper {
+		void getShaderModuleCreateInfoIdentifierEXT(const VkShaderModuleCreateInfo* pCreateInfo, VkShaderModuleIdentifierEXT* pIdentifier) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<GetShaderModuleCreateInfoIdentifierEXT>()(table.device, pCreateInfo, pIdentifier);
+		}
+	};
+};
+#endif
+#if (defined(VK_EXT_image_compression_control))
+struct GetImageSubresourceLayout2EXT {
+	using type = PFN_vkGetImageSubresourceLayout2EXT;
+	static constexpr const char* name = "vkGetImageSubresourceLayout2EXT";
+	template <typename Table> struct Wrapper {
+		void getImageSubresourceLayout2EXT(VkImage image, const VkImageSubresource2EXT* pSubresource, VkSubresourceLayout2EXT* pLayout) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<GetImageSubresourceLayout2EXT>()(table.device, image, pSubresource, pLayout);
+		}
+	};
+};
+#endif
+#if (defined(VK_EXT_pipeline_properties))
+struct GetPipelinePropertiesEXT {
+	using type = PFN_vkGetPipelinePropertiesEXT;
+	static constexpr const char* name = "vkGetPipelinePropertiesEXT";
+	template <typename Table> struct Wrapper {
+		VkResult getPipelinePropertiesEXT(const VkPipelineInfoEXT* pPipelineInfo, VkBaseOutStructure* pPipelineProperties) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			return table.template get<GetPipelinePropertiesEXT>()(table.device, pPipelineInfo, pPipelineProperties);
+		}
+	};
+};
+#endif
+#if (defined(VK_EXT_metal_objects))
+struct ExportMetalObjectsEXT {
+	using type = PFN_vkExportMetalObjectsEXT;
+	static constexpr const char* name = "vkExportMetalObjectsEXT";
+	template <typename Table> struct Wrapper {
+		void exportMetalObjectsEXT(VkExportMetalObjectsInfoEXT* pMetalObjectsInfo) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<ExportMetalObjectsEXT>()(table.device, pMetalObjectsInfo);
+		}
+	};
+};
+#endif
+#if (defined(VK_QCOM_tile_properties))
+struct GetFramebufferTilePropertiesQCOM {
+	using type = PFN_vkGetFramebufferTilePropertiesQCOM;
+	static constexpr const char* name = "vkGetFramebufferTilePropertiesQCOM";
+	template <typename Table> struct Wrapper {
+		VkResult getFramebufferTilePropertiesQCOM(VkFramebuffer framebuffer, uint32_t* pPropertiesCount, VkTilePropertiesQCOM* pProperties) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			return table.template get<GetFramebufferTilePropertiesQCOM>()(table.device, framebuffer, pPropertiesCount, pProperties);
+		}
+	};
+};
+#endif
+#if (defined(VK_QCOM_tile_properties))
+struct GetDynamicRenderingTilePropertiesQCOM {
+	using type = PFN_vkGetDynamicRenderingTilePropertiesQCOM;
+	static constexpr const char* name = "vkGetDynamicRenderingTilePropertiesQCOM";
+	template <typename Table> struct Wrapper {
+		VkResult getDynamicRenderingTilePropertiesQCOM(const VkRenderingInfoKHR* pRenderingInfo, VkTilePropertiesQCOM* pProperties) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			return table.template get<GetDynamicRenderingTilePropertiesQCOM>()(table.device, pRenderingInfo, pProperties);
+		}
+	};
+};
+#endif
+#if (defined(VK_NV_optical_flow))
+struct CreateOpticalFlowSessionNV {
+	using type = PFN_vkCreateOpticalFlowSessionNV;
+	static constexpr const char* name = "vkCreateOpticalFlowSessionNV";
+	template <typename Table> struct Wrapper {
+		VkResult createOpticalFlowSessionNV(const VkOpticalFlowSessionCreateInfoNV* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkOpticalFlowSessionNV* pSession) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			return table.template get<CreateOpticalFlowSessionNV>()(table.device, pCreateInfo, pAllocator, pSession);
+		}
+	};
+};
+#endif
+#if (defined(VK_NV_optical_flow))
+struct DestroyOpticalFlowSessionNV {
+	using type = PFN_vkDestroyOpticalFlowSessionNV;
+	static constexpr const char* name = "vkDestroyOpticalFlowSessionNV";
+	template <typename Table> struct Wrapper {
+		void destroyOpticalFlowSessionNV(VkOpticalFlowSessionNV session, const VkAllocationCallbacks* pAllocator) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<DestroyOpticalFlowSessionNV>()(table.device, session, pAllocator);
+		}
+	};
+};
+#endif
+#if (defined(VK_NV_optical_flow))
+struct BindOpticalFlowSessionImageNV {
+	using type = PFN_vkBindOpticalFlowSessionImageNV;
+	static constexpr const char* name = "vkBindOpticalFlowSessionImageNV";
+	template <typename Table> struct Wrapper {
+		VkResult bindOpticalFlowSessionImageNV(VkOpticalFlowSessionNV session, VkOpticalFlowSessionBindingPointNV bindingPoint, VkImageView view, VkImageLayout layout) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			return table.template get<BindOpticalFlowSessionImageNV>()(table.device, session, bindingPoint, view, layout);
+		}
+	};
+};
+#endif
+#if (defined(VK_NV_optical_flow))
+struct CmdOpticalFlowExecuteNV {
+	using type = PFN_vkCmdOpticalFlowExecuteNV;
+	static constexpr const char* name = "vkCmdOpticalFlowExecuteNV";
+	template <typename Table> struct Wrapper {
+		void cmdOpticalFlowExecuteNV(VkCommandBuffer commandBuffer, VkOpticalFlowSessionNV session, const VkOpticalFlowExecuteInfoNV* pExecuteInfo) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<CmdOpticalFlowExecuteNV>()(commandBuffer, session, pExecuteInfo);
+		}
+	};
+};
+#endif
+#if (defined(VK_EXT_device_fault))
+struct GetDeviceFaultInfoEXT {
+	using type = PFN_vkGetDeviceFaultInfoEXT;
+	static constexpr const char* name = "vkGetDeviceFaultInfoEXT";
+	template <typename Table> struct Wrapper {
+		VkResult getDeviceFaultInfoEXT(VkDeviceFaultCountsEXT* pFaultCounts, VkDeviceFaultInfoEXT* pFaultInfo) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			return table.template get<GetDeviceFaultInfoEXT>()(table.device, pFaultCounts, pFaultInfo);
+		}
+	};
+};
+#endif
+#if (defined(VK_EXT_host_query_reset))
+struct ResetQueryPoolEXT {
+	using type = PFN_vkResetQueryPoolEXT;
+	static constexpr const char* name = "vkResetQueryPoolEXT";
+	template <typename Table> struct Wrapper {
+		void resetQueryPoolEXT(VkQueryPool queryPool, uint32_t firstQuery, uint32_t queryCount) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<ResetQueryPoolEXT>()(table.device, queryPool, firstQuery, queryCount);
+		}
+	};
+};
+#endif
+#if (defined(VK_KHR_maintenance1))
+struct TrimCommandPoolKHR {
+	using type = PFN_vkTrimCommandPoolKHR;
+	static constexpr const char* name = "vkTrimCommandPoolKHR";
+	template <typename Table> struct Wrapper {
+		void trimCommandPoolKHR(VkCommandPool commandPool, VkCommandPoolTrimFlagsKHR flags) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<TrimCommandPoolKHR>()(table.device, commandPool, flags);
+		}
+	};
+};
+#endif
+#if (defined(VK_KHR_device_group))
+struct GetDeviceGroupPeerMemoryFeaturesKHR {
+	using type = PFN_vkGetDeviceGroupPeerMemoryFeaturesKHR;
+	static constexpr const char* name = "vkGetDeviceGroupPeerMemoryFeaturesKHR";
+	template <typename Table> struct Wrapper {
+		void getDeviceGroupPeerMemoryFeaturesKHR(uint32_t heapIndex, uint32_t localDeviceIndex, uint32_t remoteDeviceIndex, VkPeerMemoryFeatureFlagsKHR* pPeerMemoryFeatures) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<GetDeviceGroupPeerMemoryFeaturesKHR>()(table.device, heapIndex, localDeviceIndex, remoteDeviceIndex, pPeerMemoryFeatures);
+		}
+	};
+};
+#endif
+#if (defined(VK_KHR_bind_memory2))
+struct BindBufferMemory2KHR {
+	using type = PFN_vkBindBufferMemory2KHR;
+	static constexpr const char* name = "vkBindBufferMemory2KHR";
+	template <typename Table> struct Wrapper {
+		VkResult bindBufferMemory2KHR(uint32_t bindInfoCount, const VkBindBufferMemoryInfoKHR* pBindInfos) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			return table.template get<BindBufferMemory2KHR>()(table.device, bindInfoCount, pBindInfos);
+		}
+	};
+};
+#endif
+#if (defined(VK_KHR_bind_memory2))
+struct BindImageMemory2KHR {
+	using type = PFN_vkBindImageMemory2KHR;
+	static constexpr const char* name = "vkBindImageMemory2KHR";
+	template <typename Table> struct Wrapper {
+		VkResult bindImageMemory2KHR(uint32_t bindInfoCount, const VkBindImageMemoryInfoKHR* pBindInfos) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			return table.template get<BindImageMemory2KHR>()(table.device, bindInfoCount, pBindInfos);
+		}
+	};
+};
+#endif
+#if (defined(VK_KHR_device_group))
+struct CmdSetDeviceMaskKHR {
+	using type = PFN_vkCmdSetDeviceMaskKHR;
+	static constexpr const char* name = "vkCmdSetDeviceMaskKHR";
+	template <typename Table> struct Wrapper {
+		void cmdSetDeviceMaskKHR(VkCommandBuffer commandBuffer, uint32_t deviceMask) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<CmdSetDeviceMaskKHR>()(commandBuffer, deviceMask);
+		}
+	};
+};
+#endif
+#if (defined(VK_KHR_device_group))
+struct CmdDispatchBaseKHR {
+	using type = PFN_vkCmdDispatchBaseKHR;
+	static constexpr const char* name = "vkCmdDispatchBaseKHR";
+	template <typename Table> struct Wrapper {
+		void cmdDispatchBaseKHR(VkCommandBuffer commandBuffer, uint32_t baseGroupX, uint32_t baseGroupY, uint32_t baseGroupZ, uint32_t groupCountX, uint32_t groupCountY, uint32_t groupCountZ) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<CmdDispatchBaseKHR>()(commandBuffer, baseGroupX, baseGroupY, baseGroupZ, groupCountX, groupCountY, groupCountZ);
+		}
+	};
+};
+#endif
+#if (defined(VK_KHR_descriptor_update_template))
+struct CreateDescriptorUpdateTemplateKHR {
+	using type = PFN_vkCreateDescriptorUpdateTemplateKHR;
+	static constexpr const char* name = "vkCreateDescriptorUpdateTemplateKHR";
+	template <typename Table> struct Wrapper {
+		VkResult createDescriptorUpdateTemplateKHR(const VkDescriptorUpdateTemplateCreateInfoKHR* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkDescriptorUpdateTemplateKHR* pDescriptorUpdateTemplate) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			return table.template get<CreateDescriptorUpdateTemplateKHR>()(table.device, pCreateInfo, pAllocator, pDescriptorUpdateTemplate);
+		}
+	};
+};
+#endif
+#if (defined(VK_KHR_descriptor_update_template))
+struct DestroyDescriptorUpdateTemplateKHR {
+	using type = PFN_vkDestroyDescriptorUpdateTemplateKHR;
+	static constexpr const char* name = "vkDestroyDescriptorUpdateTemplateKHR";
+	template <typename Table> struct Wrapper {
+		void destroyDescriptorUpdateTemplateKHR(VkDescriptorUpdateTemplateKHR descriptorUpdateTemplate, const VkAllocationCallbacks* pAllocator) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<DestroyDescriptorUpdateTemplateKHR>()(table.device, descriptorUpdateTemplate, pAllocator);
+		}
+	};
+};
+#endif
+#if (defined(VK_KHR_descriptor_update_template))
+struct UpdateDescriptorSetWithTemplateKHR {
+	using type = PFN_vkUpdateDescriptorSetWithTemplateKHR;
+	static constexpr const char* name = "vkUpdateDescriptorSetWithTemplateKHR";
+	template <typename Table> struct Wrapper {
+		void updateDescriptorSetWithTemplateKHR(VkDescriptorSet descriptorSet, VkDescriptorUpdateTemplateKHR descriptorUpdateTemplate, const void* pData) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<UpdateDescriptorSetWithTemplateKHR>()(table.device, descriptorSet, descriptorUpdateTemplate, pData);
+		}
+	};
+};
+#endif
+#if (defined(VK_KHR_get_memory_requirements2))
+struct GetBufferMemoryRequirements2KHR {
+	using type = PFN_vkGetBufferMemoryRequirements2KHR;
+	static constexpr const char* name = "vkGetBufferMemoryRequirements2KHR";
+	template <typename Table> struct Wrapper {
+		void getBufferMemoryRequirements2KHR(const VkBufferMemoryRequirementsInfo2KHR* pInfo, VkMemoryRequirements2KHR* pMemoryRequirements) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<GetBufferMemoryRequirements2KHR>()(table.device, pInfo, pMemoryRequirements);
+		}
+	};
+};
+#endif
+#if (defined(VK_KHR_get_memory_requirements2))
+struct GetImageMemoryRequirements2KHR {
+	using type = PFN_vkGetImageMemoryRequirements2KHR;
+	static constexpr const char* name = "vkGetImageMemoryRequirements2KHR";
+	template <typename Table> struct Wrapper {
+		void getImageMemoryRequirements2KHR(const VkImageMemoryRequirementsInfo2KHR* pInfo, VkMemoryRequirements2KHR* pMemoryRequirements) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<GetImageMemoryRequirements2KHR>()(table.device, pInfo, pMemoryRequirements);
+		}
+	};
+};
+#endif
+#if (defined(VK_KHR_get_memory_requirements2))
+struct GetImageSparseMemoryRequirements2KHR {
+	using type = PFN_vkGetImageSparseMemoryRequirements2KHR;
+	static constexpr const char* name = "vkGetImageSparseMemoryRequirements2KHR";
+	template <typename Table> struct Wrapper {
+		void getImageSparseMemoryRequirements2KHR(const VkImageSparseMemoryRequirementsInfo2KHR* pInfo, uint32_t* pSparseMemoryRequirementCount, VkSparseImageMemoryRequirements2KHR* pSparseMemoryRequirements) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<GetImageSparseMemoryRequirements2KHR>()(table.device, pInfo, pSparseMemoryRequirementCount, pSparseMemoryRequirements);
+		}
+	};
+};
+#endif
+#if (defined(VK_KHR_maintenance4))
+struct GetDeviceBufferMemoryRequirementsKHR {
+	using type = PFN_vkGetDeviceBufferMemoryRequirementsKHR;
+	static constexpr const char* name = "vkGetDeviceBufferMemoryRequirementsKHR";
+	template <typename Table> struct Wrapper {
+		void getDeviceBufferMemoryRequirementsKHR(const VkDeviceBufferMemoryRequirementsKHR* pInfo, VkMemoryRequirements2KHR* pMemoryRequirements) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<GetDeviceBufferMemoryRequirementsKHR>()(table.device, pInfo, pMemoryRequirements);
+		}
+	};
+};
+#endif
+#if (defined(VK_KHR_maintenance4))
+struct GetDeviceImageMemoryRequirementsKHR {
+	using type = PFN_vkGetDeviceImageMemoryRequirementsKHR;
+	static constexpr const char* name = "vkGetDeviceImageMemoryRequirementsKHR";
+	template <typename Table> struct Wrapper {
+		void getDeviceImageMemoryRequirementsKHR(const VkDeviceImageMemoryRequirementsKHR* pInfo, VkMemoryRequirements2KHR* pMemoryRequirements) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<GetDeviceImageMemoryRequirementsKHR>()(table.device, pInfo, pMemoryRequirements);
+		}
+	};
+};
+#endif
+#if (defined(VK_KHR_maintenance4))
+struct GetDeviceImageSparseMemoryRequirementsKHR {
+	using type = PFN_vkGetDeviceImageSparseMemoryRequirementsKHR;
+	static constexpr const char* name = "vkGetDeviceImageSparseMemoryRequirementsKHR";
+	template <typename Table> struct Wrapper {
+		void getDeviceImageSparseMemoryRequirementsKHR(const VkDeviceImageMemoryRequirementsKHR* pInfo, uint32_t* pSparseMemoryRequirementCount, VkSparseImageMemoryRequirements2KHR* pSparseMemoryRequirements) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<GetDeviceImageSparseMemoryRequirementsKHR>()(table.device, pInfo, pSparseMemoryRequirementCount, pSparseMemoryRequirements);
+		}
+	};
+};
+#endif
+#if (defined(VK_KHR_sampler_ycbcr_conversion))
+struct CreateSamplerYcbcrConversionKHR {
+	using type = PFN_vkCreateSamplerYcbcrConversionKHR;
+	static constexpr const char* name = "vkCreateSamplerYcbcrConversionKHR";
+	template <typename Table> struct Wrapper {
+		VkResult createSamplerYcbcrConversionKHR(const VkSamplerYcbcrConversionCreateInfoKHR* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkSamplerYcbcrConversionKHR* pYcbcrConversion) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			return table.template get<CreateSamplerYcbcrConversionKHR>()(table.device, pCreateInfo, pAllocator, pYcbcrConversion);
+		}
+	};
+};
+#endif
+#if (defined(VK_KHR_sampler_ycbcr_conversion))
+struct DestroySamplerYcbcrConversionKHR {
+	using type = PFN_vkDestroySamplerYcbcrConversionKHR;
+	static constexpr const char* name = "vkDestroySamplerYcbcrConversionKHR";
+	template <typename Table> struct Wrapper {
+		void destroySamplerYcbcrConversionKHR(VkSamplerYcbcrConversionKHR ycbcrConversion, const VkAllocationCallbacks* pAllocator) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<DestroySamplerYcbcrConversionKHR>()(table.device, ycbcrConversion, pAllocator);
+		}
+	};
+};
+#endif
+#if (defined(VK_KHR_maintenance3))
+struct GetDescriptorSetLayoutSupportKHR {
+	using type = PFN_vkGetDescriptorSetLayoutSupportKHR;
+	static constexpr const char* name = "vkGetDescriptorSetLayoutSupportKHR";
+	template <typename Table> struct Wrapper {
+		void getDescriptorSetLayoutSupportKHR(const VkDescriptorSetLayoutCreateInfo* pCreateInfo, VkDescriptorSetLayoutSupportKHR* pSupport) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<GetDescriptorSetLayoutSupportKHR>()(table.device, pCreateInfo, pSupport);
+		}
+	};
+};
+#endif
+#if (defined(VK_KHR_create_renderpass2))
+struct CreateRenderPass2KHR {
+	using type = PFN_vkCreateRenderPass2KHR;
+	static constexpr const char* name = "vkCreateRenderPass2KHR";
+	template <typename Table> struct Wrapper {
+		VkResult createRenderPass2KHR(const VkRenderPassCreateInfo2KHR* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkRenderPass* pRenderPass) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			return table.template get<CreateRenderPass2KHR>()(table.device, pCreateInfo, pAllocator, pRenderPass);
+		}
+	};
+};
+#endif
+#if (defined(VK_KHR_create_renderpass2))
+struct CmdBeginRenderPass2KHR {
+	using type = PFN_vkCmdBeginRenderPass2KHR;
+	static constexpr const char* name = "vkCmdBeginRenderPass2KHR";
+	template <typename Table> struct Wrapper {
+		void cmdBeginRenderPass2KHR(VkCommandBuffer commandBuffer, const VkRenderPassBeginInfo* pRenderPassBegin, const VkSubpassBeginInfoKHR* pSubpassBeginInfo) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<CmdBeginRenderPass2KHR>()(commandBuffer, pRenderPassBegin, pSubpassBeginInfo);
+		}
+	};
+};
+#endif
+#if (defined(VK_KHR_create_renderpass2))
+struct CmdNextSubpass2KHR {
+	using type = PFN_vkCmdNextSubpass2KHR;
+	static constexpr const char* name = "vkCmdNextSubpass2KHR";
+	template <typename Table> struct Wrapper {
+		void cmdNextSubpass2KHR(VkCommandBuffer commandBuffer, const VkSubpassBeginInfoKHR* pSubpassBeginInfo, const VkSubpassEndInfoKHR* pSubpassEndInfo) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<CmdNextSubpass2KHR>()(commandBuffer, pSubpassBeginInfo, pSubpassEndInfo);
+		}
+	};
+};
+#endif
+#if (defined(VK_KHR_create_renderpass2))
+struct CmdEndRenderPass2KHR {
+	using type = PFN_vkCmdEndRenderPass2KHR;
+	static constexpr const char* name = "vkCmdEndRenderPass2KHR";
+	template <typename Table> struct Wrapper {
+		void cmdEndRenderPass2KHR(VkCommandBuffer commandBuffer, const VkSubpassEndInfoKHR* pSubpassEndInfo) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<CmdEndRenderPass2KHR>()(commandBuffer, pSubpassEndInfo);
+		}
+	};
+};
+#endif
+#if (defined(VK_KHR_timeline_semaphore))
+struct GetSemaphoreCounterValueKHR {
+	using type = PFN_vkGetSemaphoreCounterValueKHR;
+	static constexpr const char* name = "vkGetSemaphoreCounterValueKHR";
+	template <typename Table> struct Wrapper {
+		VkResult getSemaphoreCounterValueKHR(VkSemaphore semaphore, uint64_t* pValue) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			return table.template get<GetSemaphoreCounterValueKHR>()(table.device, semaphore, pValue);
+		}
+	};
+};
+#endif
+#if (defined(VK_KHR_timeline_semaphore))
+struct WaitSemaphoresKHR {
+	using type = PFN_vkWaitSemaphoresKHR;
+	static constexpr const char* name = "vkWaitSemaphoresKHR";
+	template <typename Table> struct Wrapper {
+		VkResult waitSemaphoresKHR(const VkSemaphoreWaitInfoKHR* pWaitInfo, uint64_t timeout) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			return table.template get<WaitSemaphoresKHR>()(table.device, pWaitInfo, timeout);
+		}
+	};
+};
+#endif
+#if (defined(VK_KHR_timeline_semaphore))
+struct SignalSemaphoreKHR {
+	using type = PFN_vkSignalSemaphoreKHR;
+	static constexpr const char* name = "vkSignalSemaphoreKHR";
+	template <typename Table> struct Wrapper {
+		VkResult signalSemaphoreKHR(const VkSemaphoreSignalInfoKHR* pSignalInfo) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			return table.template get<SignalSemaphoreKHR>()(table.device, pSignalInfo);
+		}
+	};
+};
+#endif
+#if (defined(VK_AMD_draw_indirect_count))
+struct CmdDrawIndirectCountAMD {
+	using type = PFN_vkCmdDrawIndirectCountAMD;
+	static constexpr const char* name = "vkCmdDrawIndirectCountAMD";
+	template <typename Table> struct Wrapper {
+		void cmdDrawIndirectCountAMD(VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset, VkBuffer countBuffer, VkDeviceSize countBufferOffset, uint32_t maxDrawCount, uint32_t stride) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<CmdDrawIndirectCountAMD>()(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
+		}
+	};
+};
+#endif
+#if (defined(VK_AMD_draw_indirect_count))
+struct CmdDrawIndexedIndirectCountAMD {
+	using type = PFN_vkCmdDrawIndexedIndirectCountAMD;
+	static constexpr const char* name = "vkCmdDrawIndexedIndirectCountAMD";
+	template <typename Table> struct Wrapper {
+		void cmdDrawIndexedIndirectCountAMD(VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset, VkBuffer countBuffer, VkDeviceSize countBufferOffset, uint32_t maxDrawCount, uint32_t stride) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<CmdDrawIndexedIndirectCountAMD>()(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
+		}
+	};
+};
+#endif
+#if (defined(VK_NV_ray_tracing))
+struct GetRayTracingShaderGroupHandlesNV {
+	using type = PFN_vkGetRayTracingShaderGroupHandlesNV;
+	static constexpr const char* name = "vkGetRayTracingShaderGroupHandlesNV";
+	template <typename Table> struct Wrapper {
+		VkResult getRayTracingShaderGroupHandlesNV(VkPipeline pipeline, uint32_t firstGroup, uint32_t groupCount, size_t dataSize, void* pData) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			return table.template get<GetRayTracingShaderGroupHandlesNV>()(table.device, pipeline, firstGroup, groupCount, dataSize, pData);
+		}
+	};
+};
+#endif
+#if (defined(VK_KHR_buffer_device_address))
+struct GetBufferOpaqueCaptureAddressKHR {
+	using type = PFN_vkGetBufferOpaqueCaptureAddressKHR;
+	static constexpr const char* name = "vkGetBufferOpaqueCaptureAddressKHR";
+	template <typename Table> struct Wrapper {
+		uint64_t getBufferOpaqueCaptureAddressKHR(const VkBufferDeviceAddressInfoEXT* pInfo) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			return table.template get<GetBufferOpaqueCaptureAddressKHR>()(table.device, pInfo);
+		}
+	};
+};
+#endif
+#if (defined(VK_EXT_buffer_device_address))
+struct GetBufferDeviceAddressEXT {
+	using type = PFN_vkGetBufferDeviceAddressEXT;
+	static constexpr const char* name = "vkGetBufferDeviceAddressEXT";
+	template <typename Table> struct Wrapper {
+		VkDeviceAddress getBufferDeviceAddressEXT(const VkBufferDeviceAddressInfoEXT* pInfo) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			return table.template get<GetBufferDeviceAddressEXT>()(table.device, pInfo);
+		}
+	};
+};
+#endif
+#if (defined(VK_KHR_buffer_device_address))
+struct GetDeviceMemoryOpaqueCaptureAddressKHR {
+	using type = PFN_vkGetDeviceMemoryOpaqueCaptureAddressKHR;
+	static constexpr const char* name = "vkGetDeviceMemoryOpaqueCaptureAddressKHR";
+	template <typename Table> struct Wrapper {
+		uint64_t getDeviceMemoryOpaqueCaptureAddressKHR(const VkDeviceMemoryOpaqueCaptureAddressInfoKHR* pInfo) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			return table.template get<GetDeviceMemoryOpaqueCaptureAddressKHR>()(table.device, pInfo);
+		}
+	};
+};
+#endif
+#if (defined(VK_EXT_extended_dynamic_state))
+struct CmdSetCullModeEXT {
+	using type = PFN_vkCmdSetCullModeEXT;
+	static constexpr const char* name = "vkCmdSetCullModeEXT";
+	template <typename Table> struct Wrapper {
+		void cmdSetCullModeEXT(VkCommandBuffer commandBuffer, VkCullModeFlags cullMode) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<CmdSetCullModeEXT>()(commandBuffer, cullMode);
+		}
+	};
+};
+#endif
+#if (defined(VK_EXT_extended_dynamic_state))
+struct CmdSetFrontFaceEXT {
+	using type = PFN_vkCmdSetFrontFaceEXT;
+	static constexpr const char* name = "vkCmdSetFrontFaceEXT";
+	template <typename Table> struct Wrapper {
+		void cmdSetFrontFaceEXT(VkCommandBuffer commandBuffer, VkFrontFace frontFace) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<CmdSetFrontFaceEXT>()(commandBuffer, frontFace);
+		}
+	};
+};
+#endif
+#if (defined(VK_EXT_extended_dynamic_state))
+struct CmdSetPrimitiveTopologyEXT {
+	using type = PFN_vkCmdSetPrimitiveTopologyEXT;
+	static constexpr const char* name = "vkCmdSetPrimitiveTopologyEXT";
+	template <typename Table> struct Wrapper {
+		void cmdSetPrimitiveTopologyEXT(VkCommandBuffer commandBuffer, VkPrimitiveTopology primitiveTopology) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<CmdSetPrimitiveTopologyEXT>()(commandBuffer, primitiveTopology);
+		}
+	};
+};
+#endif
+#if (defined(VK_EXT_extended_dynamic_state))
+struct CmdSetViewportWithCountEXT {
+	using type = PFN_vkCmdSetViewportWithCountEXT;
+	static constexpr const char* name = "vkCmdSetViewportWithCountEXT";
+	template <typename Table> struct Wrapper {
+		void cmdSetViewportWithCountEXT(VkCommandBuffer commandBuffer, uint32_t viewportCount, const VkViewport* pViewports) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<CmdSetViewportWithCountEXT>()(commandBuffer, viewportCount, pViewports);
+		}
+	};
+};
+#endif
+#if (defined(VK_EXT_extended_dynamic_state))
+struct CmdSetScissorWithCountEXT {
+	using type = PFN_vkCmdSetScissorWithCountEXT;
+	static constexpr const char* name = "vkCmdSetScissorWithCountEXT";
+	template <typename Table> struct Wrapper {
+		void cmdSetScissorWithCountEXT(VkCommandBuffer commandBuffer, uint32_t scissorCount, const VkRect2D* pScissors) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<CmdSetScissorWithCountEXT>()(commandBuffer, scissorCount, pScissors);
+		}
+	};
+};
+#endif
+#if (defined(VK_EXT_extended_dynamic_state))
+struct CmdBindVertexBuffers2EXT {
+	using type = PFN_vkCmdBindVertexBuffers2EXT;
+	static constexpr const char* name = "vkCmdBindVertexBuffers2EXT";
+	template <typename Table> struct Wrapper {
+		void cmdBindVertexBuffers2EXT(VkCommandBuffer commandBuffer, uint32_t firstBinding, uint32_t bindingCount, const VkBuffer* pBuffers, const VkDeviceSize* pOffsets, const VkDeviceSize* pSizes, const VkDeviceSize* pStrides) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<CmdBindVertexBuffers2EXT>()(commandBuffer, firstBinding, bindingCount, pBuffers, pOffsets, pSizes, pStrides);
+		}
+	};
+};
+#endif
+#if (defined(VK_EXT_extended_dynamic_state))
+struct CmdSetDepthTestEnableEXT {
+	using type = PFN_vkCmdSetDepthTestEnableEXT;
+	static constexpr const char* name = "vkCmdSetDepthTestEnableEXT";
+	template <typename Table> struct Wrapper {
+		void cmdSetDepthTestEnableEXT(VkCommandBuffer commandBuffer, VkBool32 depthTestEnable) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<CmdSetDepthTestEnableEXT>()(commandBuffer, depthTestEnable);
+		}
+	};
+};
+#endif
+#if (defined(VK_EXT_extended_dynamic_state))
+struct CmdSetDepthWriteEnableEXT {
+	using type = PFN_vkCmdSetDepthWriteEnableEXT;
+	static constexpr const char* name = "vkCmdSetDepthWriteEnableEXT";
+	template <typename Table> struct Wrapper {
+		void cmdSetDepthWriteEnableEXT(VkCommandBuffer commandBuffer, VkBool32 depthWriteEnable) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<CmdSetDepthWriteEnableEXT>()(commandBuffer, depthWriteEnable);
+		}
+	};
+};
+#endif
+#if (defined(VK_EXT_extended_dynamic_state))
+struct CmdSetDepthCompareOpEXT {
+	using type = PFN_vkCmdSetDepthCompareOpEXT;
+	static constexpr const char* name = "vkCmdSetDepthCompareOpEXT";
+	template <typename Table> struct Wrapper {
+		void cmdSetDepthCompareOpEXT(VkCommandBuffer commandBuffer, VkCompareOp depthCompareOp) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<CmdSetDepthCompareOpEXT>()(commandBuffer, depthCompareOp);
+		}
+	};
+};
+#endif
+#if (defined(VK_EXT_extended_dynamic_state))
+struct CmdSetDepthBoundsTestEnableEXT {
+	using type = PFN_vkCmdSetDepthBoundsTestEnableEXT;
+	static constexpr const char* name = "vkCmdSetDepthBoundsTestEnableEXT";
+	template <typename Table> struct Wrapper {
+		void cmdSetDepthBoundsTestEnableEXT(VkCommandBuffer commandBuffer, VkBool32 depthBoundsTestEnable) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<CmdSetDepthBoundsTestEnableEXT>()(commandBuffer, depthBoundsTestEnable);
+		}
+	};
+};
+#endif
+#if (defined(VK_EXT_extended_dynamic_state))
+struct CmdSetStencilTestEnableEXT {
+	using type = PFN_vkCmdSetStencilTestEnableEXT;
+	static constexpr const char* name = "vkCmdSetStencilTestEnableEXT";
+	template <typename Table> struct Wrapper {
+		void cmdSetStencilTestEnableEXT(VkCommandBuffer commandBuffer, VkBool32 stencilTestEnable) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<CmdSetStencilTestEnableEXT>()(commandBuffer, stencilTestEnable);
+		}
+	};
+};
+#endif
+#if (defined(VK_EXT_extended_dynamic_state))
+struct CmdSetStencilOpEXT {
+	using type = PFN_vkCmdSetStencilOpEXT;
+	static constexpr const char* name = "vkCmdSetStencilOpEXT";
+	template <typename Table> struct Wrapper {
+		void cmdSetStencilOpEXT(VkCommandBuffer commandBuffer, VkStencilFaceFlags faceMask, VkStencilOp failOp, VkStencilOp passOp, VkStencilOp depthFailOp, VkCompareOp compareOp) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<CmdSetStencilOpEXT>()(commandBuffer, faceMask, failOp, passOp, depthFailOp, compareOp);
+		}
+	};
+};
+#endif
+#if (defined(VK_EXT_extended_dynamic_state2))
+struct CmdSetRasterizerDiscardEnableEXT {
+	using type = PFN_vkCmdSetRasterizerDiscardEnableEXT;
+	static constexpr const char* name = "vkCmdSetRasterizerDiscardEnableEXT";
+	template <typename Table> struct Wrapper {
+		void cmdSetRasterizerDiscardEnableEXT(VkCommandBuffer commandBuffer, VkBool32 rasterizerDiscardEnable) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<CmdSetRasterizerDiscardEnableEXT>()(commandBuffer, rasterizerDiscardEnable);
+		}
+	};
+};
+#endif
+#if (defined(VK_EXT_extended_dynamic_state2))
+struct CmdSetDepthBiasEnableEXT {
+	using type = PFN_vkCmdSetDepthBiasEnableEXT;
+	static constexpr const char* name = "vkCmdSetDepthBiasEnableEXT";
+	template <typename Table> struct Wrapper {
+		void cmdSetDepthBiasEnableEXT(VkCommandBuffer commandBuffer, VkBool32 depthBiasEnable) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<CmdSetDepthBiasEnableEXT>()(commandBuffer, depthBiasEnable);
+		}
+	};
+};
+#endif
+#if (defined(VK_EXT_extended_dynamic_state2))
+struct CmdSetPrimitiveRestartEnableEXT {
+	using type = PFN_vkCmdSetPrimitiveRestartEnableEXT;
+	static constexpr const char* name = "vkCmdSetPrimitiveRestartEnableEXT";
+	template <typename Table> struct Wrapper {
+		void cmdSetPrimitiveRestartEnableEXT(VkCommandBuffer commandBuffer, VkBool32 primitiveRestartEnable) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<CmdSetPrimitiveRestartEnableEXT>()(commandBuffer, primitiveRestartEnable);
+		}
+	};
+};
+#endif
+#if (defined(VK_EXT_private_data))
+struct CreatePrivateDataSlotEXT {
+	using type = PFN_vkCreatePrivateDataSlotEXT;
+	static constexpr const char* name = "vkCreatePrivateDataSlotEXT";
+	template <typename Table> struct Wrapper {
+		VkResult createPrivateDataSlotEXT(const VkPrivateDataSlotCreateInfoEXT* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkPrivateDataSlotEXT* pPrivateDataSlot) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			return table.template get<CreatePrivateDataSlotEXT>()(table.device, pCreateInfo, pAllocator, pPrivateDataSlot);
+		}
+	};
+};
+#endif
+#if (defined(VK_EXT_private_data))
+struct DestroyPrivateDataSlotEXT {
+	using type = PFN_vkDestroyPrivateDataSlotEXT;
+	static constexpr const char* name = "vkDestroyPrivateDataSlotEXT";
+	template <typename Table> struct Wrapper {
+		void destroyPrivateDataSlotEXT(VkPrivateDataSlotEXT privateDataSlot, const VkAllocationCallbacks* pAllocator) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<DestroyPrivateDataSlotEXT>()(table.device, privateDataSlot, pAllocator);
+		}
+	};
+};
+#endif
+#if (defined(VK_EXT_private_data))
+struct SetPrivateDataEXT {
+	using type = PFN_vkSetPrivateDataEXT;
+	static constexpr const char* name = "vkSetPrivateDataEXT";
+	template <typename Table> struct Wrapper {
+		VkResult setPrivateDataEXT(VkObjectType objectType, uint64_t objectHandle, VkPrivateDataSlotEXT privateDataSlot, uint64_t data) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			return table.template get<SetPrivateDataEXT>()(table.device, objectType, objectHandle, privateDataSlot, data);
+		}
+	};
+};
+#endif
+#if (defined(VK_EXT_private_data))
+struct GetPrivateDataEXT {
+	using type = PFN_vkGetPrivateDataEXT;
+	static constexpr const char* name = "vkGetPrivateDataEXT";
+	template <typename Table> struct Wrapper {
+		void getPrivateDataEXT(VkObjectType objectType, uint64_t objectHandle, VkPrivateDataSlotEXT privateDataSlot, uint64_t* pData) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<GetPrivateDataEXT>()(table.device, objectType, objectHandle, privateDataSlot, pData);
+		}
+	};
+};
+#endif
+#if (defined(VK_KHR_copy_commands2))
+struct CmdCopyBuffer2KHR {
+	using type = PFN_vkCmdCopyBuffer2KHR;
+	static constexpr const char* name = "vkCmdCopyBuffer2KHR";
+	template <typename Table> struct Wrapper {
+		void cmdCopyBuffer2KHR(VkCommandBuffer commandBuffer, const VkCopyBufferInfo2KHR* pCopyBufferInfo) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<CmdCopyBuffer2KHR>()(commandBuffer, pCopyBufferInfo);
+		}
+	};
+};
+#endif
+#if (defined(VK_KHR_copy_commands2))
+struct CmdCopyImage2KHR {
+	using type = PFN_vkCmdCopyImage2KHR;
+	static constexpr const char* name = "vkCmdCopyImage2KHR";
+	template <typename Table> struct Wrapper {
+		void cmdCopyImage2KHR(VkCommandBuffer commandBuffer, const VkCopyImageInfo2KHR* pCopyImageInfo) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<CmdCopyImage2KHR>()(commandBuffer, pCopyImageInfo);
+		}
+	};
+};
+#endif
+#if (defined(VK_KHR_copy_commands2))
+struct CmdBlitImage2KHR {
+	using type = PFN_vkCmdBlitImage2KHR;
+	static constexpr const char* name = "vkCmdBlitImage2KHR";
+	template <typename Table> struct Wrapper {
+		void cmdBlitImage2KHR(VkCommandBuffer commandBuffer, const VkBlitImageInfo2KHR* pBlitImageInfo) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<CmdBlitImage2KHR>()(commandBuffer, pBlitImageInfo);
+		}
+	};
+};
+#endif
+#if (defined(VK_KHR_copy_commands2))
+struct CmdCopyBufferToImage2KHR {
+	using type = PFN_vkCmdCopyBufferToImage2KHR;
+	static constexpr const char* name = "vkCmdCopyBufferToImage2KHR";
+	template <typename Table> struct Wrapper {
+		void cmdCopyBufferToImage2KHR(VkCommandBuffer commandBuffer, const VkCopyBufferToImageInfo2KHR* pCopyBufferToImageInfo) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<CmdCopyBufferToImage2KHR>()(commandBuffer, pCopyBufferToImageInfo);
+		}
+	};
+};
+#endif
+#if (defined(VK_KHR_copy_commands2))
+struct CmdCopyImageToBuffer2KHR {
+	using type = PFN_vkCmdCopyImageToBuffer2KHR;
+	static constexpr const char* name = "vkCmdCopyImageToBuffer2KHR";
+	template <typename Table> struct Wrapper {
+		void cmdCopyImageToBuffer2KHR(VkCommandBuffer commandBuffer, const VkCopyImageToBufferInfo2KHR* pCopyImageToBufferInfo) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<CmdCopyImageToBuffer2KHR>()(commandBuffer, pCopyImageToBufferInfo);
+		}
+	};
+};
+#endif
+#if (defined(VK_KHR_copy_commands2))
+struct CmdResolveImage2KHR {
+	using type = PFN_vkCmdResolveImage2KHR;
+	static constexpr const char* name = "vkCmdResolveImage2KHR";
+	template <typename Table> struct Wrapper {
+		void cmdResolveImage2KHR(VkCommandBuffer commandBuffer, const VkResolveImageInfo2KHR* pResolveImageInfo) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<CmdResolveImage2KHR>()(commandBuffer, pResolveImageInfo);
+		}
+	};
+};
+#endif
+#if (defined(VK_KHR_synchronization2))
+struct CmdSetEvent2KHR {
+	using type = PFN_vkCmdSetEvent2KHR;
+	static constexpr const char* name = "vkCmdSetEvent2KHR";
+	template <typename Table> struct Wrapper {
+		void cmdSetEvent2KHR(VkCommandBuffer commandBuffer, VkEvent event, const VkDependencyInfoKHR* pDependencyInfo) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<CmdSetEvent2KHR>()(commandBuffer, event, pDependencyInfo);
+		}
+	};
+};
+#endif
+#if (defined(VK_KHR_synchronization2))
+struct CmdResetEvent2KHR {
+	using type = PFN_vkCmdResetEvent2KHR;
+	static constexpr const char* name = "vkCmdResetEvent2KHR";
+	template <typename Table> struct Wrapper {
+		void cmdResetEvent2KHR(VkCommandBuffer commandBuffer, VkEvent event, VkPipelineStageFlags2KHR stageMask) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<CmdResetEvent2KHR>()(commandBuffer, event, stageMask);
+		}
+	};
+};
+#endif
+#if (defined(VK_KHR_synchronization2))
+struct CmdWaitEvents2KHR {
+	using type = PFN_vkCmdWaitEvents2KHR;
+	static constexpr const char* name = "vkCmdWaitEvents2KHR";
+	template <typename Table> struct Wrapper {
+		void cmdWaitEvents2KHR(VkCommandBuffer commandBuffer, uint32_t eventCount, const VkEvent* pEvents, const VkDependencyInfoKHR* pDependencyInfos) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<CmdWaitEvents2KHR>()(commandBuffer, eventCount, pEvents, pDependencyInfos);
+		}
+	};
+};
+#endif
+#if (defined(VK_KHR_synchronization2))
+struct CmdPipelineBarrier2KHR {
+	using type = PFN_vkCmdPipelineBarrier2KHR;
+	static constexpr const char* name = "vkCmdPipelineBarrier2KHR";
+	template <typename Table> struct Wrapper {
+		void cmdPipelineBarrier2KHR(VkCommandBuffer commandBuffer, const VkDependencyInfoKHR* pDependencyInfo) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<CmdPipelineBarrier2KHR>()(commandBuffer, pDependencyInfo);
+		}
+	};
+};
+#endif
+#if (defined(VK_KHR_synchronization2))
+struct QueueSubmit2KHR {
+	using type = PFN_vkQueueSubmit2KHR;
+	static constexpr const char* name = "vkQueueSubmit2KHR";
+	template <typename Table> struct Wrapper {
+		VkResult queueSubmit2KHR(VkQueue queue, uint32_t submitCount, const VkSubmitInfo2KHR* pSubmits, VkFence fence) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			return table.template get<QueueSubmit2KHR>()(queue, submitCount, pSubmits, fence);
+		}
+	};
+};
+#endif
+#if (defined(VK_KHR_synchronization2))
+struct CmdWriteTimestamp2KHR {
+	using type = PFN_vkCmdWriteTimestamp2KHR;
+	static constexpr const char* name = "vkCmdWriteTimestamp2KHR";
+	template <typename Table> struct Wrapper {
+		void cmdWriteTimestamp2KHR(VkCommandBuffer commandBuffer, VkPipelineStageFlags2KHR stage, VkQueryPool queryPool, uint32_t query) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<CmdWriteTimestamp2KHR>()(commandBuffer, stage, queryPool, query);
+		}
+	};
+};
+#endif
+#if (defined(VK_KHR_dynamic_rendering))
+struct CmdBeginRenderingKHR {
+	using type = PFN_vkCmdBeginRenderingKHR;
+	static constexpr const char* name = "vkCmdBeginRenderingKHR";
+	template <typename Table> struct Wrapper {
+		void cmdBeginRenderingKHR(VkCommandBuffer commandBuffer, const VkRenderingInfoKHR* pRenderingInfo) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<CmdBeginRenderingKHR>()(commandBuffer, pRenderingInfo);
+		}
+	};
+};
+#endif
+#if (defined(VK_KHR_dynamic_rendering))
+struct CmdEndRenderingKHR {
+	using type = PFN_vkCmdEndRenderingKHR;
+	static constexpr const char* name = "vkCmdEndRenderingKHR";
+	template <typename Table> struct Wrapper {
+		void cmdEndRenderingKHR(VkCommandBuffer commandBuffer) const noexcept {
+			auto const& table = static_cast<Table const&>(*this);
+			table.template get<CmdEndRenderingKHR>()(commandBuffer);
+		}
+	};
+};
+#endif
+
+} // namespace dispatch
+
+// A device dispatch table with only the entry points in `Entries`, tags from vkb::dispatch:
+//
+//   using FrameDispatch = vkb::DispatchSubset<vkb::dispatch::CmdDraw, vkb::dispatch::QueueSubmit>;
+//   FrameDispatch dispatch { device.device, device.fp_vkGetDeviceProcAddr };
+//   dispatch.cmdDraw(commandBuffer, 3, 1, 0, 0);
+//
+// The pointers sit next to each other in one small array and are all resolved when the table is
+// created. Calling an entry point that isn't listed doesn't compile.
+template <typename... Entries> struct DispatchSubset : Entries::template Wrapper<DispatchSubset<Entries...>>... {
+	static_assert(sizeof...(Entries) > 0, "A DispatchSubset needs at least one entry point");
+
+	DispatchSubset() = default;
+	DispatchSubset(VkDevice device, PFN_vkGetDeviceProcAddr procAddr) : device(device), populated(true) {
+		size_t i = 0;
+		((pointers[i++] = procAddr(device, Entries::name)), ...);
+	}
+
+	template <typename Entry> typename Entry::type get() const noexcept {
+		static_assert(index<Entry>() < sizeof...(Entries), "Entry point isn't part of this DispatchSubset");
+		return reinterpret_cast<typename Entry::type>(pointers[index<Entry>()]);
+	}
+
+	static constexpr size_t size() { return sizeof...(Entries); }
+	bool is_populated() const { return populated; }
+	VkDevice device = VK_NULL_HANDLE;
+
+	private:
+	// Position rather than pointer type, different entry points can share a PFN alias
+	template <typename Entry> static constexpr size_t index() {
+		constexpr bool matches[] = { std::is_same_v<Entry, Entries>... };
+		for (size_t i = 0; i < sizeof...(Entries); i++) {
+			if (matches[i]) return i;
+		}
+		return sizeof...(Entries);
+	}
+
+	PFN_vkVoidFunction pointers[sizeof...(Entries)] = {};
+	bool populated = false;
+};
+
+} // namespace vkb
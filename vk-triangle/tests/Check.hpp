@@ -0,0 +1,28 @@
+//
+//  Check.hpp
+//  vk-triangle
+//
+//  Created by Kai Chen on 10/18/26.
+//
+
+#ifndef Check_hpp
+#define Check_hpp
+
+#include <iostream>
+
+// Failed checks so far. A test executable returns non-zero when there are any.
+inline int& checkFailures() {
+    static int failures = 0;
+    return failures;
+}
+
+// Reports a failed condition and carries on with the rest of the test.
+#define CHECK(condition)                                                                          \
+    do {                                                                                          \
+        if (!(condition)) {                                                                       \
+            std::cout << __FILE__ << ":" << __LINE__ << ": CHECK(" #condition ") failed" << std::endl; \
+            checkFailures()++;                                                                    \
+        }                                                                                         \
+    } while (false)
+
+#endif /* Check_hpp */
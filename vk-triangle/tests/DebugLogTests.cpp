@@ -0,0 +1,120 @@
+//
+//  DebugLogTests.cpp
+//  vk-triangle
+//
+//  Created by Kai Chen on 10/18/26.
+//
+
+#include "DebugLog.hpp"
+
+#include <sstream>
+#include <string>
+
+#include "Check.hpp"
+
+namespace {
+
+const VkDebugUtilsMessageTypeFlagsEXT kValidation = VK_DEBUG_UTILS_MESSAGE_TYPE_VALIDATION_BIT_EXT;
+
+void send(DebugLog& log, VkDebugUtilsMessageSeverityFlagBitsEXT severity, int32_t messageId, const char* message) {
+    VkDebugUtilsMessengerCallbackDataEXT data = {};
+    data.sType = VK_STRUCTURE_TYPE_DEBUG_UTILS_MESSENGER_CALLBACK_DATA_EXT;
+    data.messageIdNumber = messageId;
+    data.pMessage = message;
+    DebugLog::callback(severity, kValidation, &data, &log);
+}
+
+// What a DebugLog printed from its construction to its destruction, which prints everything still queued
+template <typename Send> std::string capture(Send send) {
+    std::ostringstream output;
+    auto* previous = std::cout.rdbuf(output.rdbuf());
+    {
+        DebugLog log;
+        send(log);
+    }
+    std::cout.rdbuf(previous);
+    return output.str();
+}
+
+size_t occurrences(const std::string& text, const std::string& part) {
+    size_t count = 0;
+    for (size_t at = text.find(part); at != std::string::npos; at = text.find(part, at + part.size())) {
+        count++;
+    }
+    return count;
+}
+
+void testFoldsRepeatsIntoOneLine() {
+    auto output = capture([](DebugLog& log) {
+        for (int i = 0; i < 10; i++) {
+            send(log, VK_DEBUG_UTILS_MESSAGE_SEVERITY_WARNING_BIT_EXT, 42, "vkCmdDraw: descriptor set not bound");
+        }
+        // Same id, another severity
+        send(log, VK_DEBUG_UTILS_MESSAGE_SEVERITY_ERROR_BIT_EXT, 42, "vkCmdDraw: descriptor set not bound");
+    });
+
+    CHECK(occurrences(output, "] vkCmdDraw: descriptor set not bound\n") == 2);
+    CHECK(occurrences(output, "debug messenger: repeated 9 more times: vkCmdDraw: descriptor set not bound\n") == 1);
+    CHECK(occurrences(output, "repeated") == 1);
+}
+
+void testTellsMessagesWithoutAnIdApartByText() {
+    auto output = capture([](DebugLog& log) {
+        for (int i = 0; i < 3; i++) {
+            send(log, VK_DEBUG_UTILS_MESSAGE_SEVERITY_INFO_BIT_EXT, 0, "loader: found ICD");
+            send(log, VK_DEBUG_UTILS_MESSAGE_SEVERITY_INFO_BIT_EXT, 0, "loader: found layer");
+        }
+    });
+
+    CHECK(occurrences(output, "] loader: found ICD\n") == 1);
+    CHECK(occurrences(output, "] loader: found layer\n") == 1);
+    CHECK(occurrences(output, "repeated 2 more times: loader: found ICD\n") == 1);
+    CHECK(occurrences(output, "repeated 2 more times: loader: found layer\n") == 1);
+}
+
+void testLimitsLinesPerSecond() {
+    const int kMessages = 200;
+    auto output = capture([](DebugLog& log) {
+        for (int i = 0; i < kMessages; i++) {
+            std::string message = "message " + std::to_string(i);
+            send(log, VK_DEBUG_UTILS_MESSAGE_SEVERITY_WARNING_BIT_EXT, 1000 + i, message.c_str());
+        }
+    });
+
+    // Every message is either printed or counted as not shown
+    size_t printed = occurrences(output, "] message ");
+    size_t notShown = 0;
+    std::istringstream lines(output);
+    std::string line;
+    const std::string limited = "debug messenger: ";
+    while (std::getline(lines, line)) {
+        if (line.find(" per second not shown") != std::string::npos) {
+            notShown += std::stoul(line.substr(limited.size()));
+        }
+    }
+    CHECK(printed >= DebugLog::kMaxLinesPerSecond);
+    CHECK(printed < kMessages);
+    CHECK(notShown > 0);
+    CHECK(printed + notShown == kMessages);
+    CHECK(occurrences(output, "messages over 50 per second not shown") >= 1);
+}
+
+void testCutsOffLongMessages() {
+    std::string message(DebugLog::kMaxMessageLength + 100, 'x');
+    auto output = capture([&message](DebugLog& log) {
+        send(log, VK_DEBUG_UTILS_MESSAGE_SEVERITY_ERROR_BIT_EXT, 7, message.c_str());
+    });
+
+    CHECK(occurrences(output, std::string(DebugLog::kMaxMessageLength, 'x') + "\n") == 1);
+    CHECK(occurrences(output, std::string(DebugLog::kMaxMessageLength + 1, 'x')) == 0);
+}
+
+} // namespace
+
+int main() {
+    testFoldsRepeatsIntoOneLine();
+    testTellsMessagesWithoutAnIdApartByText();
+    testLimitsLinesPerSecond();
+    testCutsOffLongMessages();
+    return checkFailures() == 0 ? 0 : 1;
+}
@@ -0,0 +1,106 @@
+//
+//  ExtensionSetTests.cpp
+//  vk-triangle
+//
+//  Created by Kai Chen on 10/18/26.
+//
+
+#include "VkBootstrap.h"
+
+#include <cstring>
+#include <string>
+
+#include "Check.hpp"
+
+namespace {
+
+using vkb::detail::ExtensionSet;
+
+std::vector<VkExtensionProperties> properties(std::initializer_list<const char*> names) {
+    std::vector<VkExtensionProperties> result;
+    for (const char* name: names) {
+        VkExtensionProperties extension = {};
+        std::strncpy(extension.extensionName, name, VK_MAX_EXTENSION_NAME_SIZE - 1);
+        extension.specVersion = 1;
+        result.push_back(extension);
+    }
+    return result;
+}
+
+void testFindsWhatItWasBuiltFrom() {
+    ExtensionSet set(properties({ "VK_KHR_swapchain", "VK_KHR_synchronization2", "VK_EXT_debug_utils" }));
+
+    CHECK(set.contains("VK_KHR_swapchain"));
+    CHECK(set.contains("VK_KHR_synchronization2"));
+    CHECK(set.contains("VK_EXT_debug_utils"));
+    CHECK(!set.contains("VK_KHR_maintenance4"));
+    // Whole names only
+    CHECK(!set.contains("VK_KHR_swap"));
+    CHECK(!set.contains("VK_KHR_swapchain_mutable_format"));
+    CHECK(!set.contains(""));
+    CHECK(!set.contains(nullptr));
+}
+
+void testEmptySetContainsNothing() {
+    ExtensionSet empty;
+    CHECK(!empty.contains("VK_KHR_swapchain"));
+    CHECK(empty.find("VK_KHR_swapchain") == nullptr);
+
+    ExtensionSet none(properties({}));
+    CHECK(!none.contains("VK_KHR_swapchain"));
+}
+
+void testNamesAreInterned() {
+    // A name in a buffer of its own is looked up by its contents and found as the interned one
+    std::string name = "VK_KHR_dynamic_rendering";
+    ExtensionSet set(properties({ "VK_KHR_dynamic_rendering" }));
+    ExtensionSet other(properties({ "VK_KHR_multiview", "VK_KHR_dynamic_rendering" }));
+
+    const char* found = set.find(name.c_str());
+    CHECK(found != nullptr);
+    CHECK(found != name.c_str());
+    CHECK(found == other.find("VK_KHR_dynamic_rendering"));
+    CHECK(found == vkb::detail::intern_extension_name(name.c_str()));
+    CHECK(std::strcmp(found, "VK_KHR_dynamic_rendering") == 0);
+    // Interning doesn't add to any set
+    CHECK(!set.contains(vkb::detail::intern_extension_name("VK_KHR_multiview")));
+}
+
+void testCopiesShareTheTable() {
+    ExtensionSet original(properties({ "VK_KHR_swapchain" }));
+    ExtensionSet copy = original;
+    ExtensionSet moved = std::move(original);
+
+    CHECK(copy.contains("VK_KHR_swapchain"));
+    CHECK(moved.contains("VK_KHR_swapchain"));
+    CHECK(copy.find("VK_KHR_swapchain") == moved.find("VK_KHR_swapchain"));
+}
+
+void testManyNames() {
+    std::vector<std::string> names;
+    for (int i = 0; i < 500; i++) {
+        names.push_back("VK_TEST_extension_" + std::to_string(i));
+    }
+    std::vector<VkExtensionProperties> list;
+    for (const auto& name: names) {
+        auto extension = properties({ name.c_str() });
+        list.push_back(extension.front());
+    }
+    ExtensionSet set(list);
+
+    for (const auto& name: names) {
+        CHECK(set.contains(name.c_str()));
+    }
+    CHECK(!set.contains("VK_TEST_extension_500"));
+}
+
+} // namespace
+
+int main() {
+    testFindsWhatItWasBuiltFrom();
+    testEmptySetContainsNothing();
+    testNamesAreInterned();
+    testCopiesShareTheTable();
+    testManyNames();
+    return checkFailures() == 0 ? 0 : 1;
+}
@@ -0,0 +1,190 @@
+//
+//  FakeVulkan.cpp
+//  vk-triangle
+//
+//  Created by Kai Chen on 10/18/26.
+//
+
+#include "FakeVulkan.hpp"
+
+#include <cstdint>
+
+namespace {
+
+const VkDeviceSize kImageAlignment = 256;
+const VkDeviceSize kBufferAlignment = 16;
+
+// What the fake driver wants for each image and buffer, from its create info
+std::map<VkImage, VkDeviceSize> imageSizes;
+std::map<VkBuffer, VkDeviceSize> bufferSizes;
+uint64_t nextHandle = 1;
+
+template <typename T> T makeHandle() {
+    return reinterpret_cast<T>(static_cast<uintptr_t>(nextHandle++));
+}
+
+VkDeviceSize alignUp(VkDeviceSize value, VkDeviceSize alignment) {
+    return (value + alignment - 1) / alignment * alignment;
+}
+
+void created(const VkAllocationCallbacks* allocationCallbacks) {
+    fake::device().liveObjects++;
+    fake::device().allocationCallbacks.insert(allocationCallbacks);
+}
+
+void destroyed(const VkAllocationCallbacks* allocationCallbacks) {
+    fake::device().liveObjects--;
+    fake::device().allocationCallbacks.insert(allocationCallbacks);
+}
+
+} // namespace
+
+namespace fake {
+
+Device& device() {
+    static Device device;
+    return device;
+}
+
+void reset() {
+    device() = {};
+    imageSizes.clear();
+    bufferSizes.clear();
+}
+
+VkDevice deviceHandle() {
+    return reinterpret_cast<VkDevice>(static_cast<uintptr_t>(0xde71ce));
+}
+
+VkPhysicalDeviceMemoryProperties memoryProperties() {
+    VkPhysicalDeviceMemoryProperties properties = {};
+    properties.memoryTypeCount = 1;
+    properties.memoryTypes[0].propertyFlags = VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT;
+    properties.memoryHeapCount = 1;
+    properties.memoryHeaps[0].size = 1ull << 30;
+    properties.memoryHeaps[0].flags = VK_MEMORY_HEAP_DEVICE_LOCAL_BIT;
+    return properties;
+}
+
+VKAPI_ATTR void VKAPI_CALL cmdPipelineBarrier2(VkCommandBuffer, const VkDependencyInfoKHR* dependencyInfo) {
+    BarrierCall call;
+    call.synchronization2 = true;
+    call.memoryBarriers = dependencyInfo->memoryBarrierCount;
+    for (uint32_t i = 0; i < dependencyInfo->imageMemoryBarrierCount; i++) {
+        const auto& barrier = dependencyInfo->pImageMemoryBarriers[i];
+        call.images.push_back({ barrier.image, barrier.oldLayout, barrier.newLayout, barrier.srcStageMask,
+                                barrier.srcAccessMask, barrier.dstStageMask, barrier.dstAccessMask });
+    }
+    for (uint32_t i = 0; i < dependencyInfo->bufferMemoryBarrierCount; i++) {
+        const auto& barrier = dependencyInfo->pBufferMemoryBarriers[i];
+        call.buffers.push_back({ barrier.buffer, barrier.srcStageMask, barrier.srcAccessMask,
+                                 barrier.dstStageMask, barrier.dstAccessMask });
+    }
+    device().barrierCalls.push_back(call);
+    device().commands.push_back("barrier");
+}
+
+} // namespace fake
+
+extern "C" {
+
+VKAPI_ATTR VkResult VKAPI_CALL vkCreateImage(VkDevice, const VkImageCreateInfo* createInfo,
+                                             const VkAllocationCallbacks* allocator, VkImage* image) {
+    *image = makeHandle<VkImage>();
+    imageSizes[*image] = alignUp(VkDeviceSize(createInfo->extent.width) * createInfo->extent.height * 4, kImageAlignment);
+    created(allocator);
+    return VK_SUCCESS;
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDestroyImage(VkDevice, VkImage image, const VkAllocationCallbacks* allocator) {
+    if (image != VK_NULL_HANDLE) {
+        destroyed(allocator);
+    }
+}
+
+VKAPI_ATTR void VKAPI_CALL vkGetImageMemoryRequirements(VkDevice, VkImage image, VkMemoryRequirements* requirements) {
+    requirements->size = imageSizes[image];
+    requirements->alignment = kImageAlignment;
+    requirements->memoryTypeBits = ~0u;
+}
+
+VKAPI_ATTR VkResult VKAPI_CALL vkBindImageMemory(VkDevice, VkImage image, VkDeviceMemory memory, VkDeviceSize offset) {
+    fake::device().imageBindings[image] = { memory, offset, imageSizes[image] };
+    return VK_SUCCESS;
+}
+
+VKAPI_ATTR VkResult VKAPI_CALL vkCreateImageView(VkDevice, const VkImageViewCreateInfo*,
+                                                 const VkAllocationCallbacks* allocator, VkImageView* view) {
+    *view = makeHandle<VkImageView>();
+    created(allocator);
+    return VK_SUCCESS;
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDestroyImageView(VkDevice, VkImageView view, const VkAllocationCallbacks* allocator) {
+    if (view != VK_NULL_HANDLE) {
+        destroyed(allocator);
+    }
+}
+
+VKAPI_ATTR VkResult VKAPI_CALL vkCreateBuffer(VkDevice, const VkBufferCreateInfo* createInfo,
+                                              const VkAllocationCallbacks* allocator, VkBuffer* buffer) {
+    *buffer = makeHandle<VkBuffer>();
+    bufferSizes[*buffer] = alignUp(createInfo->size, kBufferAlignment);
+    created(allocator);
+    return VK_SUCCESS;
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDestroyBuffer(VkDevice, VkBuffer buffer, const VkAllocationCallbacks* allocator) {
+    if (buffer != VK_NULL_HANDLE) {
+        destroyed(allocator);
+    }
+}
+
+VKAPI_ATTR void VKAPI_CALL vkGetBufferMemoryRequirements(VkDevice, VkBuffer buffer, VkMemoryRequirements* requirements) {
+    requirements->size = bufferSizes[buffer];
+    requirements->alignment = kBufferAlignment;
+    requirements->memoryTypeBits = ~0u;
+}
+
+VKAPI_ATTR VkResult VKAPI_CALL vkBindBufferMemory(VkDevice, VkBuffer buffer, VkDeviceMemory memory, VkDeviceSize offset) {
+    fake::device().bufferBindings[buffer] = { memory, offset, bufferSizes[buffer] };
+    return VK_SUCCESS;
+}
+
+VKAPI_ATTR VkResult VKAPI_CALL vkAllocateMemory(VkDevice, const VkMemoryAllocateInfo*,
+                                                const VkAllocationCallbacks* allocator, VkDeviceMemory* memory) {
+    *memory = makeHandle<VkDeviceMemory>();
+    created(allocator);
+    return VK_SUCCESS;
+}
+
+VKAPI_ATTR void VKAPI_CALL vkFreeMemory(VkDevice, VkDeviceMemory memory, const VkAllocationCallbacks* allocator) {
+    if (memory != VK_NULL_HANDLE) {
+        destroyed(allocator);
+    }
+}
+
+VKAPI_ATTR void VKAPI_CALL vkCmdPipelineBarrier(VkCommandBuffer, VkPipelineStageFlags srcStageMask,
+                                                VkPipelineStageFlags dstStageMask, VkDependencyFlags,
+                                                uint32_t memoryBarrierCount, const VkMemoryBarrier*,
+                                                uint32_t bufferMemoryBarrierCount,
+                                                const VkBufferMemoryBarrier* bufferMemoryBarriers,
+                                                uint32_t imageMemoryBarrierCount,
+                                                const VkImageMemoryBarrier* imageMemoryBarriers) {
+    fake::BarrierCall call;
+    call.memoryBarriers = memoryBarrierCount;
+    for (uint32_t i = 0; i < imageMemoryBarrierCount; i++) {
+        const auto& barrier = imageMemoryBarriers[i];
+        call.images.push_back({ barrier.image, barrier.oldLayout, barrier.newLayout, srcStageMask,
+                                barrier.srcAccessMask, dstStageMask, barrier.dstAccessMask });
+    }
+    for (uint32_t i = 0; i < bufferMemoryBarrierCount; i++) {
+        const auto& barrier = bufferMemoryBarriers[i];
+        call.buffers.push_back({ barrier.buffer, srcStageMask, barrier.srcAccessMask,
+                                 dstStageMask, barrier.dstAccessMask });
+    }
+    fake::device().barrierCalls.push_back(call);
+    fake::device().commands.push_back("barrier");
+}
+
+} // extern "C"
@@ -0,0 +1,81 @@
+//
+//  FakeVulkan.hpp
+//  vk-triangle
+//
+//  Created by Kai Chen on 10/18/26.
+//
+
+#ifndef FakeVulkan_hpp
+#define FakeVulkan_hpp
+
+#include <vulkan/vulkan.h>
+
+#include <map>
+#include <set>
+#include <string>
+#include <vector>
+
+// Definitions of the device entry points the render graph and PipelineBarriers call, for tests
+// linked without the Vulkan loader. They record what they're called with instead of reaching a
+// driver. Handles are made up and only good for comparing.
+namespace fake {
+
+// Masks of the legacy call are copied into each of its barriers
+struct ImageBarrier {
+    VkImage image;
+    VkImageLayout oldLayout;
+    VkImageLayout newLayout;
+    VkFlags64 srcStages;
+    VkFlags64 srcAccess;
+    VkFlags64 dstStages;
+    VkFlags64 dstAccess;
+};
+
+struct BufferBarrier {
+    VkBuffer buffer;
+    VkFlags64 srcStages;
+    VkFlags64 srcAccess;
+    VkFlags64 dstStages;
+    VkFlags64 dstAccess;
+};
+
+// One vkCmdPipelineBarrier or vkCmdPipelineBarrier2 call
+struct BarrierCall {
+    bool synchronization2 = false;
+    uint32_t memoryBarriers = 0;
+    std::vector<ImageBarrier> images;
+    std::vector<BufferBarrier> buffers;
+};
+
+struct Binding {
+    VkDeviceMemory memory = VK_NULL_HANDLE;
+    VkDeviceSize offset = 0;
+    VkDeviceSize size = 0;
+};
+
+struct Device {
+    // "barrier" for every barrier call, tests add their own entries (ie pass names) in between
+    std::vector<std::string> commands;
+    std::vector<BarrierCall> barrierCalls;
+    std::map<VkImage, Binding> imageBindings;
+    std::map<VkBuffer, Binding> bufferBindings;
+    // Images, views, buffers and memory created and not destroyed yet
+    int liveObjects = 0;
+    // Every VkAllocationCallbacks pointer passed to a create, destroy, allocate or free
+    std::set<const VkAllocationCallbacks*> allocationCallbacks;
+};
+
+// Cleared by reset()
+Device& device();
+void reset();
+VkDevice deviceHandle();
+
+// Memory properties with one device local type
+VkPhysicalDeviceMemoryProperties memoryProperties();
+
+// For RenderGraph::useSynchronization2() and PipelineBarriers
+VKAPI_ATTR void VKAPI_CALL cmdPipelineBarrier2(VkCommandBuffer commandBuffer, const VkDependencyInfoKHR* dependencyInfo);
+
+} // namespace fake
+
+#endif /* FakeVulkan_hpp */
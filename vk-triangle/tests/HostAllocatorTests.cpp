@@ -0,0 +1,260 @@
+//
+//  HostAllocatorTests.cpp
+//  vk-triangle
+//
+//  Created by Kai Chen on 10/18/26.
+//
+
+#include "HostAllocator.hpp"
+
+#include <atomic>
+#include <cstring>
+#include <thread>
+
+#include "Check.hpp"
+
+namespace {
+
+void* allocate(VkAllocationCallbacks* callbacks, size_t size, size_t alignment, VkSystemAllocationScope scope) {
+    return callbacks->pfnAllocation(callbacks->pUserData, size, alignment, scope);
+}
+
+void* reallocate(VkAllocationCallbacks* callbacks, void* original, size_t size, size_t alignment,
+                 VkSystemAllocationScope scope) {
+    return callbacks->pfnReallocation(callbacks->pUserData, original, size, alignment, scope);
+}
+
+void free(VkAllocationCallbacks* callbacks, void* memory) {
+    callbacks->pfnFree(callbacks->pUserData, memory);
+}
+
+bool aligned(void* memory, size_t alignment) {
+    return reinterpret_cast<uintptr_t>(memory) % alignment == 0;
+}
+
+void testCountsPerScope() {
+    HostAllocator allocator;
+    auto* callbacks = allocator.callbacks();
+    CHECK(callbacks->pUserData == &allocator);
+
+    void* command = allocate(callbacks, 100, 8, VK_SYSTEM_ALLOCATION_SCOPE_COMMAND);
+    void* object = allocate(callbacks, 200, 16, VK_SYSTEM_ALLOCATION_SCOPE_OBJECT);
+    void* device = allocate(callbacks, 300, 64, VK_SYSTEM_ALLOCATION_SCOPE_DEVICE);
+    CHECK(command != nullptr && object != nullptr && device != nullptr);
+
+    auto stats = allocator.stats();
+    CHECK(stats.scopes[VK_SYSTEM_ALLOCATION_SCOPE_COMMAND].allocations == 1);
+    CHECK(stats.scopes[VK_SYSTEM_ALLOCATION_SCOPE_COMMAND].liveBytes == 100);
+    CHECK(stats.scopes[VK_SYSTEM_ALLOCATION_SCOPE_OBJECT].liveBytes == 200);
+    CHECK(stats.scopes[VK_SYSTEM_ALLOCATION_SCOPE_DEVICE].liveBytes == 300);
+    CHECK(stats.scopes[VK_SYSTEM_ALLOCATION_SCOPE_INSTANCE].allocations == 0);
+
+    free(callbacks, command);
+    free(callbacks, object);
+    free(callbacks, device);
+    // Freeing nothing counts nothing
+    free(callbacks, nullptr);
+
+    stats = allocator.stats();
+    for (uint32_t scope = 0; scope < HostAllocator::kScopeCount; scope++) {
+        CHECK(stats.scopes[scope].liveBytes == 0);
+        CHECK(stats.scopes[scope].frees == stats.scopes[scope].allocations);
+    }
+    CHECK(stats.scopes[VK_SYSTEM_ALLOCATION_SCOPE_DEVICE].peakBytes == 300);
+    // Zero bytes is no allocation
+    CHECK(allocate(callbacks, 0, 8, VK_SYSTEM_ALLOCATION_SCOPE_OBJECT) == nullptr);
+    CHECK(allocator.stats().scopes[VK_SYSTEM_ALLOCATION_SCOPE_OBJECT].allocations == 1);
+}
+
+void testReallocationIsCountedOnce() {
+    HostAllocator allocator;
+    auto* callbacks = allocator.callbacks();
+    const auto scope = VK_SYSTEM_ALLOCATION_SCOPE_OBJECT;
+
+    auto* memory = static_cast<char*>(allocate(callbacks, 64, 8, scope));
+    std::memcpy(memory, "host allocator", 15);
+    auto* grown = static_cast<char*>(reallocate(callbacks, memory, 4096, 8, scope));
+    CHECK(grown != nullptr);
+    CHECK(std::strcmp(grown, "host allocator") == 0);
+
+    auto stats = allocator.stats().scopes[scope];
+    CHECK(stats.allocations == 1);
+    CHECK(stats.reallocations == 1);
+    CHECK(stats.frees == 0);
+    CHECK(stats.liveBytes == 4096);
+
+    // Moving to another scope moves the live bytes with it
+    auto* moved = static_cast<char*>(reallocate(callbacks, grown, 32, 8, VK_SYSTEM_ALLOCATION_SCOPE_CACHE));
+    CHECK(std::strncmp(moved, "host allocator", 15) == 0);
+    CHECK(allocator.stats().scopes[scope].liveBytes == 0);
+    CHECK(allocator.stats().scopes[VK_SYSTEM_ALLOCATION_SCOPE_CACHE].liveBytes == 32);
+    CHECK(allocator.stats().scopes[VK_SYSTEM_ALLOCATION_SCOPE_CACHE].reallocations == 1);
+    free(callbacks, moved);
+}
+
+void testReallocationOfNothingOrToNothing() {
+    HostAllocator allocator;
+    auto* callbacks = allocator.callbacks();
+    const auto scope = VK_SYSTEM_ALLOCATION_SCOPE_DEVICE;
+
+    // Like realloc, no original is an allocation and no size is a free
+    void* memory = reallocate(callbacks, nullptr, 128, 16, scope);
+    CHECK(memory != nullptr);
+    CHECK(reallocate(callbacks, memory, 0, 16, scope) == nullptr);
+
+    auto stats = allocator.stats().scopes[scope];
+    CHECK(stats.allocations == 1);
+    CHECK(stats.reallocations == 0);
+    CHECK(stats.frees == 1);
+    CHECK(stats.liveBytes == 0);
+    CHECK(stats.peakBytes == 128);
+}
+
+void testHonoursAlignment() {
+    HostAllocator allocator;
+    auto* callbacks = allocator.callbacks();
+    const VkSystemAllocationScope scopes[] = {
+        VK_SYSTEM_ALLOCATION_SCOPE_COMMAND, VK_SYSTEM_ALLOCATION_SCOPE_OBJECT, VK_SYSTEM_ALLOCATION_SCOPE_INSTANCE,
+    };
+    std::vector<void*> allocations;
+    for (auto scope: scopes) {
+        for (size_t alignment = 1; alignment <= 256; alignment *= 2) {
+            void* memory = allocate(callbacks, 24, alignment, scope);
+            CHECK(aligned(memory, alignment));
+            allocations.push_back(memory);
+            void* moved = reallocate(callbacks, allocate(callbacks, 8, 8, scope), 40, alignment, scope);
+            CHECK(aligned(moved, alignment));
+            allocations.push_back(moved);
+        }
+    }
+    for (void* memory: allocations) {
+        free(callbacks, memory);
+    }
+}
+
+void testReusesEmptiedChunks() {
+    HostAllocator allocator;
+    auto* callbacks = allocator.callbacks();
+    const auto scope = VK_SYSTEM_ALLOCATION_SCOPE_COMMAND;
+
+    // Several chunks' worth, but never more than a few allocations live at once
+    for (int i = 0; i < 1000; i++) {
+        void* first = allocate(callbacks, 1024, 16, scope);
+        void* second = allocate(callbacks, 512, 16, scope);
+        free(callbacks, first);
+        free(callbacks, second);
+    }
+    CHECK(allocator.stats().arenaBytes == HostAllocator::kChunkSize);
+
+    // A chunk with something left in it isn't reused, another one is added
+    void* kept = allocate(callbacks, 1024, 16, scope);
+    for (int i = 0; i < 100; i++) {
+        free(callbacks, allocate(callbacks, 1024, 16, scope));
+    }
+    CHECK(allocator.stats().arenaBytes == 2 * HostAllocator::kChunkSize);
+    free(callbacks, kept);
+    CHECK(allocator.stats().scopes[scope].liveBytes == 0);
+}
+
+void testLargeAllocationsSkipTheArenas() {
+    HostAllocator allocator;
+    auto* callbacks = allocator.callbacks();
+
+    void* large = allocate(callbacks, HostAllocator::kChunkSize / 4, 8, VK_SYSTEM_ALLOCATION_SCOPE_OBJECT);
+    void* cache = allocate(callbacks, 16, 8, VK_SYSTEM_ALLOCATION_SCOPE_CACHE);
+    CHECK(large != nullptr && cache != nullptr);
+    CHECK(allocator.stats().arenaBytes == 0);
+    std::memset(large, 0xab, HostAllocator::kChunkSize / 4);
+    free(callbacks, large);
+    free(callbacks, cache);
+}
+
+void testTracksInternalAllocations() {
+    HostAllocator allocator;
+    auto* callbacks = allocator.callbacks();
+    const auto scope = VK_SYSTEM_ALLOCATION_SCOPE_DEVICE;
+
+    callbacks->pfnInternalAllocation(callbacks->pUserData, 4096, VK_INTERNAL_ALLOCATION_TYPE_EXECUTABLE, scope);
+    callbacks->pfnInternalAllocation(callbacks->pUserData, 1024, VK_INTERNAL_ALLOCATION_TYPE_EXECUTABLE, scope);
+    CHECK(allocator.stats().scopes[scope].internalBytes == 5120);
+    callbacks->pfnInternalFree(callbacks->pUserData, 4096, VK_INTERNAL_ALLOCATION_TYPE_EXECUTABLE, scope);
+    CHECK(allocator.stats().scopes[scope].internalBytes == 1024);
+    // The driver owns that memory, it's not in the allocation counts
+    CHECK(allocator.stats().scopes[scope].allocations == 0);
+    CHECK(allocator.stats().scopes[scope].liveBytes == 0);
+    callbacks->pfnInternalFree(callbacks->pUserData, 1024, VK_INTERNAL_ALLOCATION_TYPE_EXECUTABLE, scope);
+}
+
+void testPeakBytes() {
+    HostAllocator allocator;
+    auto* callbacks = allocator.callbacks();
+    const auto scope = VK_SYSTEM_ALLOCATION_SCOPE_OBJECT;
+
+    void* a = allocate(callbacks, 1000, 8, scope);
+    void* b = allocate(callbacks, 2000, 8, scope);
+    free(callbacks, a);
+    void* c = allocate(callbacks, 500, 8, scope);
+    free(callbacks, b);
+    free(callbacks, c);
+
+    auto stats = allocator.stats().scopes[scope];
+    CHECK(stats.peakBytes == 3000);
+    CHECK(stats.liveBytes == 0);
+}
+
+void testThreadsShareTheArenas() {
+    HostAllocator allocator;
+    auto* callbacks = allocator.callbacks();
+    const int kThreads = 4;
+    const int kIterations = 2000;
+
+    // CHECK isn't thread safe, the threads only count what they found
+    std::atomic<int> corrupted = 0;
+    std::vector<std::thread> threads;
+    for (int t = 0; t < kThreads; t++) {
+        threads.emplace_back([callbacks, t, &corrupted] {
+            for (int i = 0; i < kIterations; i++) {
+                auto scope = (i + t) % 2 == 0 ? VK_SYSTEM_ALLOCATION_SCOPE_COMMAND : VK_SYSTEM_ALLOCATION_SCOPE_OBJECT;
+                size_t size = 16 + (i * 7 + t) % 512;
+                auto* memory = static_cast<unsigned char*>(allocate(callbacks, size, 16, scope));
+                std::memset(memory, t, size);
+                memory = static_cast<unsigned char*>(reallocate(callbacks, memory, size * 2, 16, scope));
+                if (memory[0] != t || memory[size - 1] != t) {
+                    corrupted++;
+                }
+                free(callbacks, memory);
+            }
+        });
+    }
+    for (auto& thread: threads) {
+        thread.join();
+    }
+    CHECK(corrupted == 0);
+
+    auto stats = allocator.stats();
+    uint64_t allocations = 0;
+    uint64_t reallocations = 0;
+    for (uint32_t scope = 0; scope < HostAllocator::kScopeCount; scope++) {
+        CHECK(stats.scopes[scope].liveBytes == 0);
+        CHECK(stats.scopes[scope].frees == stats.scopes[scope].allocations);
+        allocations += stats.scopes[scope].allocations;
+        reallocations += stats.scopes[scope].reallocations;
+    }
+    CHECK(allocations == kThreads * kIterations);
+    CHECK(reallocations == kThreads * kIterations);
+}
+
+} // namespace
+
+int main() {
+    testCountsPerScope();
+    testReallocationIsCountedOnce();
+    testReallocationOfNothingOrToNothing();
+    testHonoursAlignment();
+    testReusesEmptiedChunks();
+    testLargeAllocationsSkipTheArenas();
+    testTracksInternalAllocations();
+    testPeakBytes();
+    testThreadsShareTheArenas();
+    return checkFailures() == 0 ? 0 : 1;
+}
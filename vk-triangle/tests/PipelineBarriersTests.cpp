@@ -0,0 +1,211 @@
+//
+//  PipelineBarriersTests.cpp
+//  vk-triangle
+//
+//  Created by Kai Chen on 10/18/26.
+//
+
+#include "PipelineBarriers.hpp"
+
+#include "Check.hpp"
+#include "FakeVulkan.hpp"
+
+namespace {
+
+const VkCommandBuffer kCommandBuffer = reinterpret_cast<VkCommandBuffer>(static_cast<uintptr_t>(0xc0b));
+const VkImage kImage = reinterpret_cast<VkImage>(static_cast<uintptr_t>(0x1a));
+const VkImage kOtherImage = reinterpret_cast<VkImage>(static_cast<uintptr_t>(0x1b));
+const VkBuffer kBuffer = reinterpret_cast<VkBuffer>(static_cast<uintptr_t>(0xb0));
+const VkImageSubresourceRange kColorRange = { VK_IMAGE_ASPECT_COLOR_BIT, 0, 1, 0, 1 };
+
+void testMergesBarriersForTheSameTransition() {
+    fake::reset();
+    PipelineBarriers barriers;
+    barriers.image(kImage, kColorRange, VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT, VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT,
+                   VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT, VK_ACCESS_SHADER_READ_BIT,
+                   VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL);
+    barriers.image(kImage, kColorRange, VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT, VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT,
+                   VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, VK_ACCESS_SHADER_READ_BIT,
+                   VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL);
+    // Another transition of the same image stays a barrier of its own
+    barriers.image(kImage, kColorRange, 0, 0, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_ACCESS_TRANSFER_WRITE_BIT,
+                   VK_IMAGE_LAYOUT_UNDEFINED, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL);
+    barriers.buffer(kBuffer, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_ACCESS_TRANSFER_WRITE_BIT,
+                    VK_PIPELINE_STAGE_VERTEX_INPUT_BIT, VK_ACCESS_VERTEX_ATTRIBUTE_READ_BIT);
+    barriers.buffer(kBuffer, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_ACCESS_TRANSFER_WRITE_BIT,
+                    VK_PIPELINE_STAGE_DRAW_INDIRECT_BIT, VK_ACCESS_INDIRECT_COMMAND_READ_BIT);
+    barriers.buffer(kBuffer, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_ACCESS_TRANSFER_WRITE_BIT,
+                    VK_PIPELINE_STAGE_VERTEX_INPUT_BIT, VK_ACCESS_VERTEX_ATTRIBUTE_READ_BIT, 256, 64);
+    barriers.memory(VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, VK_ACCESS_SHADER_WRITE_BIT,
+                    VK_PIPELINE_STAGE_VERTEX_SHADER_BIT, VK_ACCESS_SHADER_READ_BIT);
+    barriers.memory(VK_PIPELINE_STAGE_TRANSFER_BIT, VK_ACCESS_TRANSFER_WRITE_BIT,
+                    VK_PIPELINE_STAGE_HOST_BIT, VK_ACCESS_HOST_READ_BIT);
+    barriers.flush(kCommandBuffer);
+
+    const auto& calls = fake::device().barrierCalls;
+    CHECK(calls.size() == 1);
+    if (calls.size() != 1) {
+        return;
+    }
+    CHECK(calls[0].images.size() == 2);
+    CHECK(calls[0].buffers.size() == 2);
+    CHECK(calls[0].memoryBarriers == 1);
+    const auto& merged = calls[0].images[0];
+    CHECK(merged.image == kImage);
+    CHECK(merged.newLayout == VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL);
+    CHECK(merged.dstAccess == VK_ACCESS_SHADER_READ_BIT);
+    CHECK(calls[0].buffers[0].dstAccess == (VK_ACCESS_VERTEX_ATTRIBUTE_READ_BIT | VK_ACCESS_INDIRECT_COMMAND_READ_BIT));
+    CHECK(calls[0].buffers[1].dstAccess == VK_ACCESS_VERTEX_ATTRIBUTE_READ_BIT);
+}
+
+void testLegacyCallTakesTheUnionOfTheStages() {
+    fake::reset();
+    PipelineBarriers barriers;
+    barriers.image(kImage, kColorRange, VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT, VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT,
+                   VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT, VK_ACCESS_SHADER_READ_BIT,
+                   VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL);
+    barriers.image(kOtherImage, kColorRange, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_ACCESS_TRANSFER_WRITE_BIT,
+                   VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, VK_ACCESS_SHADER_READ_BIT,
+                   VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL);
+    barriers.flush(kCommandBuffer);
+
+    // No stages at all is spelled top and bottom of pipe
+    barriers.image(kImage, kColorRange, 0, 0, 0, 0, VK_IMAGE_LAYOUT_UNDEFINED, VK_IMAGE_LAYOUT_GENERAL);
+    barriers.flush(kCommandBuffer);
+
+    const auto& calls = fake::device().barrierCalls;
+    CHECK(calls.size() == 2);
+    if (calls.size() != 2) {
+        return;
+    }
+    CHECK(!calls[0].synchronization2);
+    for (const auto& barrier: calls[0].images) {
+        CHECK(barrier.srcStages == (VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT | VK_PIPELINE_STAGE_TRANSFER_BIT));
+        CHECK(barrier.dstStages == (VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT | VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT));
+    }
+    CHECK(calls[1].images.size() == 1);
+    CHECK(calls[1].images[0].srcStages == VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT);
+    CHECK(calls[1].images[0].dstStages == VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT);
+}
+
+void testFlushRecordsNothingWhenEmpty() {
+    fake::reset();
+    PipelineBarriers barriers;
+    CHECK(barriers.empty());
+    barriers.flush(kCommandBuffer);
+    CHECK(fake::device().barrierCalls.empty());
+
+    barriers.memory(VK_PIPELINE_STAGE_TRANSFER_BIT, VK_ACCESS_TRANSFER_WRITE_BIT,
+                    VK_PIPELINE_STAGE_HOST_BIT, VK_ACCESS_HOST_READ_BIT);
+    CHECK(!barriers.empty());
+    barriers.flush(kCommandBuffer);
+    CHECK(barriers.empty());
+    barriers.flush(kCommandBuffer);
+    CHECK(fake::device().barrierCalls.size() == 1);
+}
+
+int deviceBarrierCalls = 0;
+
+// Stands in for the device's vkCmdPipelineBarrier from its dispatch table
+VKAPI_ATTR void VKAPI_CALL deviceCmdPipelineBarrier(VkCommandBuffer commandBuffer, VkPipelineStageFlags srcStageMask,
+                                                    VkPipelineStageFlags dstStageMask, VkDependencyFlags dependencyFlags,
+                                                    uint32_t memoryBarrierCount, const VkMemoryBarrier* memoryBarriers,
+                                                    uint32_t bufferMemoryBarrierCount,
+                                                    const VkBufferMemoryBarrier* bufferMemoryBarriers,
+                                                    uint32_t imageMemoryBarrierCount,
+                                                    const VkImageMemoryBarrier* imageMemoryBarriers) {
+    deviceBarrierCalls++;
+    vkCmdPipelineBarrier(commandBuffer, srcStageMask, dstStageMask, dependencyFlags, memoryBarrierCount,
+                         memoryBarriers, bufferMemoryBarrierCount, bufferMemoryBarriers, imageMemoryBarrierCount,
+                         imageMemoryBarriers);
+}
+
+void testRecordsWithTheGivenEntryPoint() {
+    fake::reset();
+    deviceBarrierCalls = 0;
+    PipelineBarriers barriers(deviceCmdPipelineBarrier);
+    barriers.memory(VK_PIPELINE_STAGE_TRANSFER_BIT, VK_ACCESS_TRANSFER_WRITE_BIT,
+                    VK_PIPELINE_STAGE_HOST_BIT, VK_ACCESS_HOST_READ_BIT);
+    barriers.flush(kCommandBuffer);
+    CHECK(deviceBarrierCalls == 1);
+    CHECK(fake::device().barrierCalls.size() == 1);
+}
+
+#if defined(VK_KHR_synchronization2)
+void testSynchronization2KeepsStagesPerBarrier() {
+    fake::reset();
+    PipelineBarriers barriers(vkCmdPipelineBarrier, fake::cmdPipelineBarrier2);
+    barriers.image(kImage, kColorRange, VK_PIPELINE_STAGE_2_COLOR_ATTACHMENT_OUTPUT_BIT_KHR,
+                   VK_ACCESS_2_COLOR_ATTACHMENT_WRITE_BIT_KHR, VK_PIPELINE_STAGE_2_FRAGMENT_SHADER_BIT_KHR,
+                   VK_ACCESS_2_SHADER_READ_BIT_KHR, VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL,
+                   VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL);
+    // A stage only synchronization2 has
+    barriers.image(kOtherImage, kColorRange, VK_PIPELINE_STAGE_2_COPY_BIT_KHR, VK_ACCESS_2_TRANSFER_WRITE_BIT_KHR,
+                   VK_PIPELINE_STAGE_2_COMPUTE_SHADER_BIT_KHR, VK_ACCESS_2_SHADER_STORAGE_READ_BIT_KHR,
+                   VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, VK_IMAGE_LAYOUT_GENERAL);
+    barriers.flush(kCommandBuffer);
+
+    const auto& calls = fake::device().barrierCalls;
+    CHECK(calls.size() == 1);
+    if (calls.size() != 1 || calls[0].images.size() != 2) {
+        return;
+    }
+    CHECK(calls[0].synchronization2);
+    CHECK(calls[0].memoryBarriers == 0);
+    CHECK(calls[0].images[0].srcStages == VK_PIPELINE_STAGE_2_COLOR_ATTACHMENT_OUTPUT_BIT_KHR);
+    CHECK(calls[0].images[0].dstStages == VK_PIPELINE_STAGE_2_FRAGMENT_SHADER_BIT_KHR);
+    CHECK(calls[0].images[1].srcStages == VK_PIPELINE_STAGE_2_COPY_BIT_KHR);
+    CHECK(calls[0].images[1].dstAccess == VK_ACCESS_2_SHADER_STORAGE_READ_BIT_KHR);
+}
+
+void testLegacyCallCoversSynchronization2OnlyBits() {
+    fake::reset();
+    PipelineBarriers barriers;
+    barriers.image(kImage, kColorRange, VK_PIPELINE_STAGE_2_COPY_BIT_KHR, VK_ACCESS_2_TRANSFER_WRITE_BIT_KHR,
+                   VK_PIPELINE_STAGE_2_COMPUTE_SHADER_BIT_KHR, VK_ACCESS_2_SHADER_STORAGE_READ_BIT_KHR,
+                   VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, VK_IMAGE_LAYOUT_GENERAL);
+    barriers.image(kOtherImage, kColorRange, VK_PIPELINE_STAGE_2_BLIT_BIT_KHR | VK_PIPELINE_STAGE_2_RESOLVE_BIT_KHR,
+                   VK_ACCESS_2_TRANSFER_WRITE_BIT_KHR, VK_PIPELINE_STAGE_2_PRE_RASTERIZATION_SHADERS_BIT_KHR,
+                   VK_ACCESS_2_SHADER_SAMPLED_READ_BIT_KHR, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
+                   VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL);
+    barriers.buffer(kBuffer, VK_PIPELINE_STAGE_2_CLEAR_BIT_KHR | VK_PIPELINE_STAGE_2_COMPUTE_SHADER_BIT_KHR,
+                    VK_ACCESS_2_SHADER_STORAGE_WRITE_BIT_KHR,
+                    VK_PIPELINE_STAGE_2_INDEX_INPUT_BIT_KHR | VK_PIPELINE_STAGE_2_VERTEX_ATTRIBUTE_INPUT_BIT_KHR,
+                    VK_ACCESS_2_TRANSFER_READ_BIT_KHR);
+    barriers.flush(kCommandBuffer);
+
+    const auto& calls = fake::device().barrierCalls;
+    CHECK(calls.size() == 1);
+    if (calls.size() != 1 || calls[0].images.size() != 2 || calls[0].buffers.size() != 1) {
+        return;
+    }
+    CHECK(!calls[0].synchronization2);
+    const auto& copy = calls[0].images[0];
+    CHECK(copy.srcStages == (VK_PIPELINE_STAGE_TRANSFER_BIT | VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT));
+    CHECK(copy.dstStages == (VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT | VK_PIPELINE_STAGE_VERTEX_SHADER_BIT |
+                             VK_PIPELINE_STAGE_TESSELLATION_CONTROL_SHADER_BIT |
+                             VK_PIPELINE_STAGE_TESSELLATION_EVALUATION_SHADER_BIT |
+                             VK_PIPELINE_STAGE_GEOMETRY_SHADER_BIT | VK_PIPELINE_STAGE_VERTEX_INPUT_BIT));
+    CHECK(copy.srcAccess == VK_ACCESS_TRANSFER_WRITE_BIT);
+    CHECK(copy.dstAccess == VK_ACCESS_SHADER_READ_BIT);
+    CHECK(calls[0].images[1].dstAccess == VK_ACCESS_SHADER_READ_BIT);
+    CHECK(calls[0].buffers[0].srcAccess == VK_ACCESS_SHADER_WRITE_BIT);
+    CHECK(calls[0].buffers[0].dstAccess == VK_ACCESS_TRANSFER_READ_BIT);
+    // Nothing above the lower 32 bits reaches the legacy call
+    CHECK((copy.srcStages >> 32) == 0 && (copy.dstStages >> 32) == 0);
+}
+#endif
+
+} // namespace
+
+int main() {
+    testMergesBarriersForTheSameTransition();
+    testLegacyCallTakesTheUnionOfTheStages();
+    testFlushRecordsNothingWhenEmpty();
+    testRecordsWithTheGivenEntryPoint();
+#if defined(VK_KHR_synchronization2)
+    testSynchronization2KeepsStagesPerBarrier();
+    testLegacyCallCoversSynchronization2OnlyBits();
+#endif
+    return checkFailures() == 0 ? 0 : 1;
+}
@@ -0,0 +1,311 @@
+//
+//  RenderGraphTests.cpp
+//  vk-triangle
+//
+//  Created by Kai Chen on 10/18/26.
+//
+
+#include "RenderGraph.hpp"
+
+#include <stdexcept>
+
+#include "Check.hpp"
+#include "FakeVulkan.hpp"
+
+namespace {
+
+using Access = RenderGraph::Access;
+
+const VkImage kBackbuffer = reinterpret_cast<VkImage>(static_cast<uintptr_t>(0xbac));
+const VkCommandBuffer kCommandBuffer = reinterpret_cast<VkCommandBuffer>(static_cast<uintptr_t>(0xc0b));
+
+RenderGraph::ImageDesc colorDesc(uint32_t width = 64, uint32_t height = 64) {
+    RenderGraph::ImageDesc desc;
+    desc.format = VK_FORMAT_B8G8R8A8_UNORM;
+    desc.extent = { width, height };
+    return desc;
+}
+
+void initGraph(RenderGraph& graph) {
+    fake::reset();
+    graph.init(fake::deviceHandle(), fake::memoryProperties(), 1);
+}
+
+RenderGraph::Resource importBackbuffer(RenderGraph& graph) {
+    return graph.importImage("backbuffer", VK_IMAGE_ASPECT_COLOR_BIT, VK_IMAGE_LAYOUT_UNDEFINED,
+                             VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT, VK_IMAGE_LAYOUT_PRESENT_SRC_KHR);
+}
+
+// Logs the pass in between the barrier calls
+RenderGraph::ExecuteFn logPass(const std::string& name) {
+    return [name] (VkCommandBuffer, const RenderGraph&) { fake::device().commands.push_back(name); };
+}
+
+const fake::ImageBarrier* findBarrier(const fake::BarrierCall& call, VkImage image) {
+    for (const auto& barrier: call.images) {
+        if (barrier.image == image) {
+            return &barrier;
+        }
+    }
+    return nullptr;
+}
+
+void testCullsPassesNothingNeeds() {
+    RenderGraph graph;
+    initGraph(graph);
+    auto backbuffer = importBackbuffer(graph);
+    auto unused = graph.createImage("unused", colorDesc());
+    auto chained = graph.createImage("chained", colorDesc());
+    auto dead = graph.createImage("dead", colorDesc());
+
+    graph.addPass("unread", [&] (auto& pass) { pass.write(unused, Access::ColorAttachment); }, logPass("unread"));
+    // Only read by a pass that's culled itself
+    graph.addPass("chain", [&] (auto& pass) { pass.write(chained, Access::ColorAttachment); }, logPass("chain"));
+    graph.addPass("chainEnd", [&] (auto& pass) {
+        pass.read(chained, Access::FragmentSampled);
+        pass.write(dead, Access::ColorAttachment);
+    }, logPass("chainEnd"));
+    graph.addPass("draw", [&] (auto& pass) { pass.write(backbuffer, Access::ColorAttachment); }, logPass("draw"));
+    graph.addPass("readback", [&] (auto& pass) { pass.sideEffect(); }, logPass("readback"));
+    graph.compile();
+    graph.bindImage(backbuffer, kBackbuffer, VK_NULL_HANDLE);
+    graph.execute(kCommandBuffer);
+
+    CHECK(graph.stats().passes == 2);
+    CHECK(graph.stats().culledPasses == 3);
+    CHECK(graph.stats().transientImages == 0);
+    CHECK(graph.image(unused) == VK_NULL_HANDLE);
+    CHECK(graph.image(chained) == VK_NULL_HANDLE);
+    CHECK((fake::device().commands == std::vector<std::string> { "barrier", "draw", "readback", "barrier" }));
+
+    graph.reset();
+    CHECK(fake::device().liveObjects == 0);
+}
+
+void testSchedulesBarriersAndTransitions() {
+    RenderGraph graph;
+    initGraph(graph);
+    auto backbuffer = importBackbuffer(graph);
+    auto scene = graph.createImage("scene", colorDesc());
+
+    graph.addPass("scene", [&] (auto& pass) { pass.write(scene, Access::ColorAttachment); }, logPass("scene"));
+    graph.addPass("post", [&] (auto& pass) {
+        pass.read(scene, Access::FragmentSampled);
+        pass.write(backbuffer, Access::ColorAttachment);
+    }, logPass("post"));
+    graph.compile();
+    graph.bindImage(backbuffer, kBackbuffer, VK_NULL_HANDLE);
+    graph.execute(kCommandBuffer);
+
+    const auto& device = fake::device();
+    CHECK((device.commands == std::vector<std::string> { "barrier", "scene", "barrier", "post", "barrier" }));
+    CHECK(device.barrierCalls.size() == 3);
+    CHECK(graph.stats().imageBarriers == 4);
+    if (device.barrierCalls.size() != 3) {
+        return;
+    }
+    VkImage sceneImage = graph.image(scene);
+
+    // The transient starts over every frame, after the previous frame's sampling is done
+    const auto* discard = findBarrier(device.barrierCalls[0], sceneImage);
+    CHECK(discard != nullptr);
+    if (discard != nullptr) {
+        CHECK(discard->oldLayout == VK_IMAGE_LAYOUT_UNDEFINED);
+        CHECK(discard->newLayout == VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL);
+        CHECK((discard->srcStages & VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT) != 0);
+        CHECK((discard->dstStages & VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT) != 0);
+    }
+
+    // Read after write, and the backbuffer's first use, in one call
+    const auto* sample = findBarrier(device.barrierCalls[1], sceneImage);
+    const auto* target = findBarrier(device.barrierCalls[1], kBackbuffer);
+    CHECK(device.barrierCalls[1].images.size() == 2);
+    CHECK(sample != nullptr && target != nullptr);
+    if (sample != nullptr && target != nullptr) {
+        CHECK(sample->oldLayout == VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL);
+        CHECK(sample->newLayout == VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL);
+        CHECK((sample->srcAccess & VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT) != 0);
+        CHECK((sample->dstAccess & VK_ACCESS_SHADER_READ_BIT) != 0);
+        CHECK(target->oldLayout == VK_IMAGE_LAYOUT_UNDEFINED);
+        CHECK(target->newLayout == VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL);
+    }
+
+    // Handed over for presenting
+    const auto* present = findBarrier(device.barrierCalls[2], kBackbuffer);
+    CHECK(device.barrierCalls[2].images.size() == 1);
+    CHECK(present != nullptr);
+    if (present != nullptr) {
+        CHECK(present->oldLayout == VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL);
+        CHECK(present->newLayout == VK_IMAGE_LAYOUT_PRESENT_SRC_KHR);
+        CHECK(present->dstAccess == 0);
+    }
+
+    graph.reset();
+    CHECK(fake::device().liveObjects == 0);
+}
+
+void testReadAfterReadNeedsNoBarrier() {
+    RenderGraph graph;
+    initGraph(graph);
+    auto backbuffer = importBackbuffer(graph);
+    auto scene = graph.createImage("scene", colorDesc());
+
+    graph.addPass("scene", [&] (auto& pass) { pass.write(scene, Access::ColorAttachment); }, logPass("scene"));
+    graph.addPass("first", [&] (auto& pass) {
+        pass.read(scene, Access::FragmentSampled);
+        pass.write(backbuffer, Access::ColorAttachment);
+    }, logPass("first"));
+    graph.addPass("second", [&] (auto& pass) {
+        pass.read(scene, Access::FragmentSampled);
+        pass.write(backbuffer, Access::ColorAttachment);
+    }, logPass("second"));
+    graph.compile();
+    graph.bindImage(backbuffer, kBackbuffer, VK_NULL_HANDLE);
+    graph.execute(kCommandBuffer);
+
+    // Before "second" only the backbuffer's write after write
+    const auto& device = fake::device();
+    CHECK((device.commands == std::vector<std::string> { "barrier", "scene", "barrier", "first", "barrier", "second", "barrier" }));
+    if (device.barrierCalls.size() == 4) {
+        CHECK(device.barrierCalls[2].images.size() == 1);
+        CHECK(findBarrier(device.barrierCalls[2], kBackbuffer) != nullptr);
+    }
+    graph.reset();
+}
+
+void testAliasesTransientsThatAreNeverLiveTogether() {
+    RenderGraph graph;
+    initGraph(graph);
+    auto backbuffer = importBackbuffer(graph);
+    auto first = graph.createImage("first", colorDesc());
+    auto second = graph.createImage("second", colorDesc());
+    auto third = graph.createImage("third", colorDesc());
+    auto indirect = graph.createBuffer("indirect", { 256 });
+
+    graph.addPass("first", [&] (auto& pass) { pass.write(first, Access::ColorAttachment); }, logPass("first"));
+    graph.addPass("second", [&] (auto& pass) {
+        pass.read(first, Access::FragmentSampled);
+        pass.write(second, Access::ColorAttachment);
+    }, logPass("second"));
+    graph.addPass("third", [&] (auto& pass) {
+        pass.read(second, Access::FragmentSampled);
+        pass.write(third, Access::ColorAttachment);
+        pass.write(indirect, Access::ComputeStorageWrite);
+    }, logPass("third"));
+    graph.addPass("present", [&] (auto& pass) {
+        // Sampled by compute, so the fragment stage in the take-over barrier can only come from "first"
+        pass.read(third, Access::ComputeSampled);
+        pass.read(indirect, Access::IndirectRead);
+        pass.write(backbuffer, Access::ColorAttachment);
+    }, logPass("present"));
+    graph.compile();
+    graph.bindImage(backbuffer, kBackbuffer, VK_NULL_HANDLE);
+    graph.execute(kCommandBuffer);
+
+    const auto& device = fake::device();
+    const auto& stats = graph.stats();
+    CHECK(stats.transientImages == 3);
+    CHECK(stats.transientBuffers == 1);
+    CHECK(stats.memoryBlocks == 1);
+    CHECK(stats.transientBytes < stats.naiveBytes);
+
+    // "first" is done before "third" starts, they share memory
+    auto bindingOf = [&device] (VkImage image) { return device.imageBindings.at(image); };
+    auto firstBinding = bindingOf(graph.image(first));
+    auto secondBinding = bindingOf(graph.image(second));
+    auto thirdBinding = bindingOf(graph.image(third));
+    CHECK(firstBinding.memory == thirdBinding.memory);
+    CHECK(firstBinding.offset < thirdBinding.offset + thirdBinding.size &&
+          thirdBinding.offset < firstBinding.offset + firstBinding.size);
+    CHECK(secondBinding.offset >= firstBinding.offset + firstBinding.size ||
+          firstBinding.offset >= secondBinding.offset + secondBinding.size);
+
+    // Taking over the memory waits for the sampling of "first" in the pass before
+    CHECK((device.commands == std::vector<std::string> { "barrier", "first", "barrier", "second", "barrier", "third",
+                                                         "barrier", "present", "barrier" }));
+    if (device.barrierCalls.size() == 5) {
+        const auto* takeOver = findBarrier(device.barrierCalls[2], graph.image(third));
+        CHECK(takeOver != nullptr);
+        if (takeOver != nullptr) {
+            CHECK(takeOver->oldLayout == VK_IMAGE_LAYOUT_UNDEFINED);
+            CHECK((takeOver->srcStages & VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT) != 0);
+        }
+        CHECK(device.barrierCalls[3].buffers.size() == 1);
+    }
+
+    graph.reset();
+    CHECK(device.liveObjects == 0);
+}
+
+#if defined(VK_KHR_synchronization2)
+void testSynchronization2KeepsEachBarriersStages() {
+    RenderGraph graph;
+    initGraph(graph);
+    graph.useSynchronization2(vkCmdPipelineBarrier, fake::cmdPipelineBarrier2);
+    auto backbuffer = importBackbuffer(graph);
+    auto scene = graph.createImage("scene", colorDesc());
+    auto indirect = graph.createBuffer("indirect", { 256 });
+
+    graph.addPass("scene", [&] (auto& pass) { pass.write(scene, Access::ColorAttachment); }, logPass("scene"));
+    graph.addPass("cull", [&] (auto& pass) { pass.write(indirect, Access::ComputeStorageWrite); }, logPass("cull"));
+    graph.addPass("post", [&] (auto& pass) {
+        pass.read(scene, Access::FragmentSampled);
+        pass.read(indirect, Access::IndirectRead);
+        pass.write(backbuffer, Access::ColorAttachment);
+    }, logPass("post"));
+    graph.compile();
+    graph.bindImage(backbuffer, kBackbuffer, VK_NULL_HANDLE);
+    graph.execute(kCommandBuffer);
+
+    const auto& device = fake::device();
+    CHECK((device.commands == std::vector<std::string> { "barrier", "scene", "barrier", "cull", "barrier", "post", "barrier" }));
+    if (device.barrierCalls.size() != 4) {
+        return;
+    }
+    const auto& beforePost = device.barrierCalls[2];
+    CHECK(beforePost.synchronization2);
+    const auto* sample = findBarrier(beforePost, graph.image(scene));
+    CHECK(sample != nullptr);
+    if (sample != nullptr) {
+        CHECK(sample->srcStages == VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT);
+        CHECK(sample->dstStages == VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT);
+    }
+    CHECK(beforePost.buffers.size() == 1);
+    if (beforePost.buffers.size() == 1) {
+        CHECK(beforePost.buffers[0].srcStages == VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT);
+        CHECK(beforePost.buffers[0].dstStages == VK_PIPELINE_STAGE_DRAW_INDIRECT_BIT);
+    }
+    graph.reset();
+}
+#endif
+
+void testRejectsTwoLayoutsInOnePass() {
+    RenderGraph graph;
+    initGraph(graph);
+    auto scene = graph.createImage("scene", colorDesc());
+
+    bool threw = false;
+    try {
+        graph.addPass("feedback", [&] (auto& pass) {
+            pass.write(scene, Access::ColorAttachment);
+            pass.read(scene, Access::FragmentSampled);
+        }, logPass("feedback"));
+    } catch (const std::runtime_error&) {
+        threw = true;
+    }
+    CHECK(threw);
+}
+
+} // namespace
+
+int main() {
+    testCullsPassesNothingNeeds();
+    testSchedulesBarriersAndTransitions();
+    testReadAfterReadNeedsNoBarrier();
+    testAliasesTransientsThatAreNeverLiveTogether();
+#if defined(VK_KHR_synchronization2)
+    testSynchronization2KeepsEachBarriersStages();
+#endif
+    testRejectsTwoLayoutsInOnePass();
+    return checkFailures() == 0 ? 0 : 1;
+}
@@ -0,0 +1,270 @@
+//
+//  ScratchArenaTests.cpp
+//  vk-triangle
+//
+//  Created by Kai Chen on 10/18/26.
+//
+
+#include "VkBootstrap.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+#include "Check.hpp"
+
+// Every heap allocation in the executable goes through these, so a test can count what a piece of code allocates
+namespace {
+
+std::atomic<size_t> heapAllocations = 0;
+
+void* countedAllocate(size_t size, size_t alignment) {
+    heapAllocations++;
+    alignment = std::max(alignment, alignof(std::max_align_t));
+    size = (std::max<size_t>(size, 1) + alignment - 1) & ~(alignment - 1);
+    void* memory = std::aligned_alloc(alignment, size);
+    if (memory == nullptr) {
+        throw std::bad_alloc();
+    }
+    return memory;
+}
+
+} // namespace
+
+void* operator new(size_t size) { return countedAllocate(size, alignof(std::max_align_t)); }
+void* operator new[](size_t size) { return countedAllocate(size, alignof(std::max_align_t)); }
+void* operator new(size_t size, std::align_val_t alignment) { return countedAllocate(size, static_cast<size_t>(alignment)); }
+void* operator new[](size_t size, std::align_val_t alignment) { return countedAllocate(size, static_cast<size_t>(alignment)); }
+void operator delete(void* memory) noexcept { std::free(memory); }
+void operator delete[](void* memory) noexcept { std::free(memory); }
+void operator delete(void* memory, size_t) noexcept { std::free(memory); }
+void operator delete[](void* memory, size_t) noexcept { std::free(memory); }
+void operator delete(void* memory, std::align_val_t) noexcept { std::free(memory); }
+void operator delete[](void* memory, std::align_val_t) noexcept { std::free(memory); }
+void operator delete(void* memory, size_t, std::align_val_t) noexcept { std::free(memory); }
+void operator delete[](void* memory, size_t, std::align_val_t) noexcept { std::free(memory); }
+
+namespace {
+
+// ctest reports a test that returns this as skipped
+const int kSkipped = 77;
+
+// What a call may still take from the heap with a scratch arena: the results it hands back (the Instance's
+// layer names, the PhysicalDevice's and Device's copies of the device details) and the C++ runtime's own.
+// select() additionally queries each device on a std::async worker, whose shared state and thread aren't
+// covered by the arena, so its bound grows with the number of devices.
+const size_t kMaxInstanceBuildHeapAllocations = 16;
+const size_t kMaxSelectHeapAllocations = 8;
+const size_t kMaxSelectHeapAllocationsPerDevice = 16;
+const size_t kMaxDeviceBuildHeapAllocations = 12;
+
+using vkb::ScratchArena;
+using vkb::detail::ScratchVector;
+
+void testFittingVectorsStayOffTheHeap() {
+    alignas(16) std::byte buffer[1024];
+    ScratchArena arena(buffer, sizeof(buffer));
+
+    size_t before = heapAllocations;
+    {
+        ScratchVector<const char*> names{ &arena };
+        names.reserve(16);
+        for (int i = 0; i < 16; i++) {
+            names.push_back("VK_KHR_swapchain");
+        }
+        ScratchVector<uint64_t> values{ &arena };
+        values.assign(32, 7);
+        CHECK(arena.used() >= 16 * sizeof(const char*) + 32 * sizeof(uint64_t));
+        CHECK(reinterpret_cast<uintptr_t>(values.data()) % alignof(uint64_t) == 0);
+    }
+    CHECK(heapAllocations == before);
+    CHECK(arena.heap_allocations() == 0);
+    // Everything came back, so the buffer starts over
+    CHECK(arena.used() == 0);
+    CHECK(arena.peak() >= 16 * sizeof(const char*) + 32 * sizeof(uint64_t));
+}
+
+void testOverflowGoesToTheHeap() {
+    alignas(16) std::byte buffer[256];
+    ScratchArena arena(buffer, sizeof(buffer));
+
+    size_t before = heapAllocations;
+    {
+        ScratchVector<uint64_t> small{ &arena };
+        small.reserve(8);
+        ScratchVector<uint64_t> large{ &arena };
+        large.reserve(64);
+        CHECK(arena.used() == 8 * sizeof(uint64_t));
+        CHECK(arena.heap_allocations() == 1);
+        CHECK(heapAllocations == before + 1);
+    }
+    CHECK(arena.used() == 0);
+    CHECK(arena.peak() == 8 * sizeof(uint64_t));
+
+    // No buffer at all is the heap every time
+    ScratchArena empty(nullptr, 0);
+    ScratchVector<int> values{ &empty };
+    values.reserve(4);
+    CHECK(empty.heap_allocations() == 1);
+    CHECK(heapAllocations == before + 2);
+}
+
+void testMemoryIsGivenBackInReverse() {
+    alignas(16) std::byte buffer[512];
+    ScratchArena arena(buffer, sizeof(buffer));
+
+    void* first = arena.allocate(64, 8);
+    void* second = arena.allocate(64, 8);
+    arena.deallocate(second, 64, 8);
+    CHECK(arena.used() == 64);
+    // The freed space is reused right away
+    CHECK(arena.allocate(32, 8) == second);
+    // Out of order, the space waits until everything is back
+    arena.deallocate(first, 64, 8);
+    CHECK(arena.used() == 96);
+    arena.deallocate(second, 32, 8);
+    CHECK(arena.used() == 0);
+    CHECK(arena.peak() == 128);
+}
+
+void testVectorsWithoutAnArenaUseTheHeap() {
+    size_t before = heapAllocations;
+    {
+        ScratchVector<int> values;
+        values.reserve(4);
+    }
+    CHECK(heapAllocations == before + 1);
+}
+
+// Heap allocations of one InstanceBuilder::build() and destroy_instance(), with or without an arena
+bool countInstanceBuild(ScratchArena* arena, size_t& count) {
+    size_t before = heapAllocations;
+    auto instance = vkb::InstanceBuilder().set_headless().set_scratch_arena(arena).build();
+    if (!instance) {
+        return false;
+    }
+    vkb::destroy_instance(instance.value());
+    count = heapAllocations - before;
+    return true;
+}
+
+bool testInstanceBuildWithAnArenaAllocatesLess() {
+    // The first build loads Vulkan and fills the caches, it isn't counted
+    size_t count = 0;
+    if (!countInstanceBuild(nullptr, count)) {
+        std::cout << "no Vulkan instance, skipping the instance build" << std::endl;
+        return false;
+    }
+
+    alignas(16) static std::byte buffer[16 * 1024];
+    ScratchArena arena(buffer, sizeof(buffer));
+    size_t withoutArena = 0;
+    size_t withArena = 0;
+    CHECK(countInstanceBuild(nullptr, withoutArena));
+    CHECK(countInstanceBuild(&arena, withArena));
+    std::cout << "InstanceBuilder::build: " << withoutArena << " heap allocations, " << withArena
+              << " with a scratch arena (" << arena.peak() << " bytes of it)" << std::endl;
+
+    CHECK(withArena < withoutArena);
+    CHECK(withArena <= kMaxInstanceBuildHeapAllocations);
+    CHECK(arena.heap_allocations() == 0);
+    CHECK(arena.used() == 0);
+    CHECK(arena.peak() > 0);
+    return true;
+}
+
+// Heap allocations of one PhysicalDeviceSelector::select(), with or without an arena
+bool countSelect(vkb::Instance const& instance, ScratchArena* arena, size_t& count, vkb::PhysicalDevice& selected) {
+    vkb::PhysicalDeviceSelector selector(instance);
+    selector.require_present(false).set_scratch_arena(arena);
+    size_t before = heapAllocations;
+    {
+        auto physicalDevice = selector.select();
+        if (!physicalDevice) {
+            return false;
+        }
+        count = heapAllocations - before;
+        selected = physicalDevice.value();
+    }
+    return true;
+}
+
+// Heap allocations of one DeviceBuilder::build() and destroy_device(), with or without an arena
+bool countDeviceBuild(vkb::PhysicalDevice const& physicalDevice, ScratchArena* arena, size_t& count) {
+    vkb::DeviceBuilder builder(physicalDevice);
+    builder.set_scratch_arena(arena);
+    size_t before = heapAllocations;
+    {
+        auto device = builder.build();
+        if (!device) {
+            return false;
+        }
+        vkb::destroy_device(device.value());
+    }
+    count = heapAllocations - before;
+    return true;
+}
+
+bool testSelectAndDeviceBuildWithAnArenaStayBounded() {
+    auto instance = vkb::InstanceBuilder().set_headless().build();
+    if (!instance) {
+        std::cout << "no Vulkan instance, skipping device selection" << std::endl;
+        return false;
+    }
+    auto enumeratePhysicalDevices = reinterpret_cast<PFN_vkEnumeratePhysicalDevices>(
+        instance->fp_vkGetInstanceProcAddr(instance->instance, "vkEnumeratePhysicalDevices"));
+    uint32_t deviceCount = 0;
+    enumeratePhysicalDevices(instance->instance, &deviceCount, nullptr);
+
+    // The first select() queries and caches the device details, the first build() loads the device
+    // entry points, neither is counted
+    size_t count = 0;
+    vkb::PhysicalDevice physicalDevice;
+    if (deviceCount == 0 || !countSelect(instance.value(), nullptr, count, physicalDevice) ||
+        !countDeviceBuild(physicalDevice, nullptr, count)) {
+        std::cout << "no Vulkan device, skipping device selection" << std::endl;
+        vkb::destroy_instance(instance.value());
+        return false;
+    }
+
+    alignas(16) static std::byte buffer[16 * 1024];
+    ScratchArena arena(buffer, sizeof(buffer));
+    size_t selectWithoutArena = 0;
+    size_t selectWithArena = 0;
+    CHECK(countSelect(instance.value(), nullptr, selectWithoutArena, physicalDevice));
+    CHECK(countSelect(instance.value(), &arena, selectWithArena, physicalDevice));
+    std::cout << "PhysicalDeviceSelector::select: " << selectWithoutArena << " heap allocations, " << selectWithArena
+              << " with a scratch arena, " << deviceCount << " devices" << std::endl;
+    CHECK(selectWithArena < selectWithoutArena);
+    CHECK(selectWithArena <= kMaxSelectHeapAllocations + deviceCount * kMaxSelectHeapAllocationsPerDevice);
+
+    size_t buildWithoutArena = 0;
+    size_t buildWithArena = 0;
+    CHECK(countDeviceBuild(physicalDevice, nullptr, buildWithoutArena));
+    CHECK(countDeviceBuild(physicalDevice, &arena, buildWithArena));
+    std::cout << "DeviceBuilder::build: " << buildWithoutArena << " heap allocations, " << buildWithArena
+              << " with a scratch arena" << std::endl;
+    CHECK(buildWithArena < buildWithoutArena);
+    CHECK(buildWithArena <= kMaxDeviceBuildHeapAllocations);
+
+    CHECK(arena.heap_allocations() == 0);
+    CHECK(arena.used() == 0);
+    vkb::destroy_instance(instance.value());
+    return true;
+}
+
+} // namespace
+
+int main() {
+    testFittingVectorsStayOffTheHeap();
+    testOverflowGoesToTheHeap();
+    testMemoryIsGivenBackInReverse();
+    testVectorsWithoutAnArenaUseTheHeap();
+    bool built = testInstanceBuildWithAnArenaAllocatesLess();
+    built = testSelectAndDeviceBuildWithAnArenaStayBounded() && built;
+    if (checkFailures() != 0) {
+        return 1;
+    }
+    return built ? 0 : kSkipped;
+}
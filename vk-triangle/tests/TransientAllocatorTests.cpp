@@ -0,0 +1,103 @@
+//
+//  TransientAllocatorTests.cpp
+//  vk-triangle
+//
+//  Created by Kai Chen on 10/18/26.
+//
+
+#include "TransientAllocator.hpp"
+
+#include "Check.hpp"
+
+namespace {
+
+TransientAllocator::Request request(VkDeviceSize size, uint32_t firstUse, uint32_t lastUse,
+                                    VkDeviceSize alignment = 256, uint32_t memoryType = 0) {
+    TransientAllocator::Request request;
+    request.size = size;
+    request.alignment = alignment;
+    request.memoryType = memoryType;
+    request.firstUse = firstUse;
+    request.lastUse = lastUse;
+    return request;
+}
+
+void testAliasesDisjointLifetimes() {
+    // Passes 0-1, 1-2 and 2-3: the first and the last never live at the same time
+    std::vector<TransientAllocator::Request> requests = {
+        request(1000, 0, 1),
+        request(1000, 1, 2),
+        request(1000, 2, 3),
+    };
+    TransientAllocator allocator;
+    allocator.place(requests);
+
+    const auto& placements = allocator.placements();
+    CHECK(placements.size() == 3);
+    CHECK(allocator.blocks().size() == 1);
+    CHECK(allocator.overlaps(0, 2));
+    CHECK(!allocator.overlaps(0, 1));
+    CHECK(!allocator.overlaps(1, 2));
+    CHECK(placements[0].offset == placements[2].offset);
+    CHECK(allocator.naiveBytes() == 3 * 1024);
+    CHECK(allocator.peakBytes() == 1024 + 1000);
+}
+
+void testKeepsOverlappingLifetimesApart() {
+    std::vector<TransientAllocator::Request> requests = {
+        request(4096, 0, 3),
+        request(512, 1, 1),
+        request(512, 2, 3),
+        request(100, 3, 3),
+    };
+    TransientAllocator allocator;
+    allocator.place(requests);
+
+    for (size_t a = 0; a < requests.size(); a++) {
+        CHECK(allocator.placements()[a].offset % requests[a].alignment == 0);
+        for (size_t b = a + 1; b < requests.size(); b++) {
+            bool live = requests[a].firstUse <= requests[b].lastUse && requests[b].firstUse <= requests[a].lastUse;
+            CHECK(!(live && allocator.overlaps(a, b)));
+        }
+    }
+    // The two 512 byte requests take turns
+    CHECK(allocator.overlaps(1, 2));
+    CHECK(allocator.peakBytes() < allocator.naiveBytes());
+}
+
+void testSeparatesMemoryTypes() {
+    std::vector<TransientAllocator::Request> requests = {
+        request(1024, 0, 0, 256, 0),
+        request(1024, 1, 1, 256, 3),
+    };
+    TransientAllocator allocator;
+    allocator.place(requests);
+
+    CHECK(allocator.blocks().size() == 2);
+    CHECK(allocator.placements()[0].block != allocator.placements()[1].block);
+    CHECK(!allocator.overlaps(0, 1));
+    CHECK(allocator.blocks()[allocator.placements()[1].block].memoryType == 3);
+}
+
+void testPlaceReplacesThePreviousPlacement() {
+    TransientAllocator allocator;
+    std::vector<TransientAllocator::Request> requests = { request(1024, 0, 0), request(1024, 0, 0) };
+    allocator.place(requests);
+    CHECK(allocator.peakBytes() == 2048);
+
+    requests.pop_back();
+    allocator.place(requests);
+    CHECK(allocator.placements().size() == 1);
+    CHECK(allocator.peakBytes() == 1024);
+    CHECK(allocator.naiveBytes() == 1024);
+}
+
+} // namespace
+
+int main() {
+    testAliasesDisjointLifetimes();
+    testKeepsOverlappingLifetimesApart();
+    testSeparatesMemoryTypes();
+    testPlaceReplacesThePreviousPlacement();
+    return checkFailures() == 0 ? 0 : 1;
+}
@@ -0,0 +1,263 @@
+#!/usr/bin/env python3
+#
+#  generate_dispatch.py
+#  vk-triangle
+#
+#  Regenerates vkb::DispatchTable in VkBootstrapDispatch.h with the entry points
+#  it already lists. The input can be the header as vk-bootstrap generates it or
+#  one this script wrote, so after updating vk-bootstrap drop in its header and
+#  run this again.
+#
+#  The table resolves every entry point when it's created, like upstream's. A
+#  table created with vkb::lazy_resolve resolves each one the first time its
+#  wrapper is called instead, into atomic slots shared by the table's copies.
+#
+#  With --subset it also writes VkBootstrapDispatchSubset.h: one tag type per
+#  entry point and vkb::DispatchSubset, a table with only the tagged ones.
+#
+#  usage: generate_dispatch.py path/to/VkBootstrapDispatch.h [--subset path/to/VkBootstrapDispatchSubset.h]
+#
+
+import argparse
+import re
+import sys
+
+WRAPPER_BODY = re.compile(
+    r'^\t\t(return )?(?:fp_(vk\w+)|load\(fp_(vk\w+), (?:\d+, )?"(vk\w+)"\))\((.*)\);$')
+MEMBER = re.compile(r'^\t(?:mutable )?PFN_(vk\w+) fp_(vk\w+) = nullptr;$')
+
+
+class Entry:
+    def __init__(self, name, guard, signature, returns, args):
+        self.name = name
+        self.guard = guard
+        self.signature = signature
+        self.returns = returns
+        self.args = args
+
+
+def parse(text):
+    """Returns the text before the table, the entry points in order and the text after the table."""
+    start = text.index('struct DispatchTable {')
+    end = text.index('\n};\n', start) + len('\n};\n')
+    lines = text[start:end].split('\n')
+
+    entries = []
+    members = []
+    i = 0
+    while i < len(lines):
+        line = lines[i]
+        if line == 'private:':
+            break
+        guard = lines[i - 1] if lines[i - 1].startswith('#if') else None
+        if line.startswith('\t') and not line.startswith('\t\t') and line.endswith(') const noexcept {'):
+            match = WRAPPER_BODY.match(lines[i + 1])
+            if not match or lines[i + 2] != '\t}':
+                raise ValueError('unexpected wrapper body: %s' % lines[i + 1])
+            returns, plain, loaded, quoted, args = match.groups()
+            name = plain or loaded
+            if loaded and loaded != quoted:
+                raise ValueError('%s loads %s' % (loaded, quoted))
+            entries.append(Entry(name, guard, line, returns or '', args))
+            i += 3
+            continue
+        match = MEMBER.match(line)
+        if match:
+            if match.group(1) != match.group(2):
+                raise ValueError('fp_%s has the type of %s' % (match.group(2), match.group(1)))
+            members.append((match.group(1), guard))
+        i += 1
+
+    if [(e.name, e.guard) for e in entries] != members:
+        raise ValueError('the wrappers and the fp_ members list different entry points')
+    if not entries:
+        raise ValueError('no entry points found')
+    return text[:start], entries, text[end:]
+
+
+def guarded(entry, lines):
+    out = []
+    if entry.guard:
+        out.append(entry.guard)
+    out.extend(lines)
+    if entry.guard:
+        out.append('#endif')
+    return out
+
+
+def generate_table(entries):
+    out = ['''struct DispatchTable {
+	DispatchTable() = default;
+	DispatchTable(VkDevice device, PFN_vkGetDeviceProcAddr procAddr) : device(device), populated(true) {''']
+    for entry in entries:
+        out += guarded(entry, ['\t\tfp_%s = reinterpret_cast<PFN_%s>(procAddr(device, "%s"));'
+                               % (entry.name, entry.name, entry.name)])
+    out.append('''	}
+	// Resolves each entry point the first time its wrapper is called, which makes creating the table nearly free.
+	// The fp_ members stay null. Copies share what's resolved and may be used from any thread.
+	DispatchTable(VkDevice device, PFN_vkGetDeviceProcAddr procAddr, lazy_resolve_t)
+	: device(device), populated(true), lazy(std::make_shared<LazyEntryPoints>()) {
+		lazy->procAddr = procAddr;
+	}''')
+    for index, entry in enumerate(entries):
+        body = '\t\t%sload(fp_%s, %d, "%s")(%s);' % (entry.returns, entry.name, index, entry.name, entry.args)
+        out += guarded(entry, [entry.signature, body, '\t}'])
+    for entry in entries:
+        out += guarded(entry, ['\tPFN_%s fp_%s = nullptr;' % (entry.name, entry.name)])
+    out.append('''	bool is_populated() const { return populated; }
+	VkDevice device = VK_NULL_HANDLE;
+private:
+	 bool populated = false;
+
+	struct LazyEntryPoints {
+		PFN_vkGetDeviceProcAddr procAddr = nullptr;
+		std::atomic<PFN_vkVoidFunction> pointers[%d] {};
+	};
+	std::shared_ptr<LazyEntryPoints> lazy;
+
+	// `fp` on tables resolved up front, otherwise the entry point's slot, resolved if it's still empty
+	template <typename T> T load(T fp, size_t index, const char* name) const noexcept {
+		if (fp != nullptr || !lazy) return fp;
+		PFN_vkVoidFunction function = lazy->pointers[index].load(std::memory_order_acquire);
+		if (function == nullptr) {
+			// Threads racing on the first call all resolve the same pointer
+			function = lazy->procAddr(device, name);
+			lazy->pointers[index].store(function, std::memory_order_release);
+		}
+		return reinterpret_cast<T>(function);
+	}
+};
+''' % len(entries))
+    return '\n'.join(out)
+
+
+LAZY_TAG = '''// Passed to the DispatchTable constructor to resolve entry points on first use
+struct lazy_resolve_t {
+	explicit lazy_resolve_t() = default;
+};
+inline constexpr lazy_resolve_t lazy_resolve {};
+
+'''
+
+
+def generate(text):
+    before, entries, after = parse(text)
+    # Upstream's header only includes vulkan.h
+    before = re.sub(r'(#include <atomic>\n#include <cstddef>\n#include <memory>\n\n)?#include <vulkan/vulkan.h>',
+                    '#include <atomic>\n#include <cstddef>\n#include <memory>\n\n#include <vulkan/vulkan.h>', before, count=1)
+    if LAZY_TAG not in before:
+        before += LAZY_TAG
+    return before + generate_table(entries) + after
+
+
+SUBSET_HEADER = '''//
+//  VkBootstrapDispatchSubset.h
+//  vk-triangle
+//
+//  Generated by tools/generate_dispatch.py from VkBootstrapDispatch.h, do not edit.
+//
+
+#pragma once
+
+#include <cstddef>
+#include <type_traits>
+
+#include <vulkan/vulkan.h>
+
+namespace vkb {
+
+// One tag per device entry point, named after the function without its vk prefix. A tag names the
+// pointer type and the function, and brings the same wrapper as DispatchTable into a DispatchSubset.
+namespace dispatch {
+'''
+
+SUBSET_TABLE = '''
+} // namespace dispatch
+
+// A device dispatch table with only the entry points in `Entries`, tags from vkb::dispatch:
+//
+//   using FrameDispatch = vkb::DispatchSubset<vkb::dispatch::CmdDraw, vkb::dispatch::QueueSubmit>;
+//   FrameDispatch dispatch { device.device, device.fp_vkGetDeviceProcAddr };
+//   dispatch.cmdDraw(commandBuffer, 3, 1, 0, 0);
+//
+// The pointers sit next to each other in one small array and are all resolved when the table is
+// created. Calling an entry point that isn't listed doesn't compile.
+template <typename... Entries> struct DispatchSubset : Entries::template Wrapper<DispatchSubset<Entries...>>... {
+	static_assert(sizeof...(Entries) > 0, "A DispatchSubset needs at least one entry point");
+
+	DispatchSubset() = default;
+	DispatchSubset(VkDevice device, PFN_vkGetDeviceProcAddr procAddr) : device(device), populated(true) {
+		size_t i = 0;
+		((pointers[i++] = procAddr(device, Entries::name)), ...);
+	}
+
+	template <typename Entry> typename Entry::type get() const noexcept {
+		static_assert(index<Entry>() < sizeof...(Entries), "Entry point isn't part of this DispatchSubset");
+		return reinterpret_cast<typename Entry::type>(pointers[index<Entry>()]);
+	}
+
+	static constexpr size_t size() { return sizeof...(Entries); }
+	bool is_populated() const { return populated; }
+	VkDevice device = VK_NULL_HANDLE;
+
+	private:
+	// Position rather than pointer type, different entry points can share a PFN alias
+	template <typename Entry> static constexpr size_t index() {
+		constexpr bool matches[] = { std::is_same_v<Entry, Entries>... };
+		for (size_t i = 0; i < sizeof...(Entries); i++) {
+			if (matches[i]) return i;
+		}
+		return sizeof...(Entries);
+	}
+
+	PFN_vkVoidFunction pointers[sizeof...(Entries)] = {};
+	bool populated = false;
+};
+
+} // namespace vkb
+'''
+
+
+def generate_subset(entries):
+    out = [SUBSET_HEADER]
+    for entry in entries:
+        tag = entry.name[2:]
+        # The wrappers pass the table's device
+        args = re.sub(r'^device(?=, |$)', 'table.device', entry.args)
+        out += guarded(entry, [
+            'struct %s {' % tag,
+            '\tusing type = PFN_%s;' % entry.name,
+            '\tstatic constexpr const char* name = "%s";' % entry.name,
+            '\ttemplate <typename Table> struct Wrapper {',
+            '\t' + entry.signature,
+            '\t\t\tauto const& table = static_cast<Table const&>(*this);',
+            '\t\t\t%stable.template get<%s>()(%s);' % (entry.returns, tag, args),
+            '\t\t}',
+            '\t};',
+            '};',
+        ])
+    out.append(SUBSET_TABLE)
+    return '\n'.join(out)
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Regenerate vkb::DispatchTable.')
+    parser.add_argument('header', help='VkBootstrapDispatch.h, rewritten in place')
+    parser.add_argument('--subset', help='also write the DispatchSubset header')
+    args = parser.parse_args()
+
+    with open(args.header) as f:
+        text = f.read()
+    with open(args.header, 'w') as f:
+        f.write(generate(text))
+    if args.subset:
+        with open(args.subset, 'w') as f:
+            f.write(generate_subset(parse(text)[1]))
+
+
+if __name__ == '__main__':
+    try:
+        main()
+    except (OSError, ValueError) as e:
+        sys.stderr.write('generate_dispatch: %s\n' % e)
+        sys.exit(1)
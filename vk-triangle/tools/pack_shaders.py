@@ -0,0 +1,315 @@
+#!/usr/bin/env python3
+#
+#  pack_shaders.py
+#  vk-triangle
+#
+#  Packs compiled SPIR-V modules into the archive read by ShaderArchive.
+#  Every module is stored as an aligned blob next to a table of contents and
+#  the descriptor bindings / push constant ranges reflected from the SPIR-V,
+#  so the application never has to parse SPIR-V at runtime.
+#
+#  usage: pack_shaders.py -o shaders.pak [--embed shaders_pak.inc] vert.spv frag.spv
+#
+
+import argparse
+import os
+import struct
+import sys
+
+MAGIC = 0x41534B56  # "VKSA"
+VERSION = 1
+BLOB_ALIGNMENT = 16
+NAME_LENGTH = 32
+
+HEADER_FORMAT = '<8I'
+TOC_FORMAT = '<%ds%ds8IQ' % (NAME_LENGTH, NAME_LENGTH)
+BINDING_FORMAT = '<4I'
+PUSH_CONSTANT_FORMAT = '<2I'
+
+# SPIR-V opcodes
+OP_NAME = 5
+OP_ENTRY_POINT = 15
+OP_TYPE_BOOL = 20
+OP_TYPE_INT = 21
+OP_TYPE_FLOAT = 22
+OP_TYPE_VECTOR = 23
+OP_TYPE_MATRIX = 24
+OP_TYPE_IMAGE = 25
+OP_TYPE_SAMPLER = 26
+OP_TYPE_SAMPLED_IMAGE = 27
+OP_TYPE_ARRAY = 28
+OP_TYPE_RUNTIME_ARRAY = 29
+OP_TYPE_STRUCT = 30
+OP_TYPE_POINTER = 32
+OP_CONSTANT = 43
+OP_VARIABLE = 59
+OP_DECORATE = 71
+OP_MEMBER_DECORATE = 72
+OP_TYPE_ACCELERATION_STRUCTURE = 5341
+
+# SPIR-V decorations
+DECORATION_BUFFER_BLOCK = 3
+DECORATION_ARRAY_STRIDE = 6
+DECORATION_MATRIX_STRIDE = 7
+DECORATION_BINDING = 33
+DECORATION_DESCRIPTOR_SET = 34
+DECORATION_OFFSET = 35
+
+# SPIR-V storage classes
+STORAGE_UNIFORM_CONSTANT = 0
+STORAGE_UNIFORM = 2
+STORAGE_PUSH_CONSTANT = 9
+STORAGE_STORAGE_BUFFER = 12
+
+# SPIR-V execution model -> VkShaderStageFlagBits
+STAGES = {
+    0: 0x01,  # Vertex
+    1: 0x02,  # TessellationControl
+    2: 0x04,  # TessellationEvaluation
+    3: 0x08,  # Geometry
+    4: 0x10,  # Fragment
+    5: 0x20,  # GLCompute
+}
+
+# VkDescriptorType
+SAMPLER = 0
+COMBINED_IMAGE_SAMPLER = 1
+SAMPLED_IMAGE = 2
+STORAGE_IMAGE = 3
+UNIFORM_TEXEL_BUFFER = 4
+STORAGE_TEXEL_BUFFER = 5
+UNIFORM_BUFFER = 6
+STORAGE_BUFFER = 7
+INPUT_ATTACHMENT = 10
+ACCELERATION_STRUCTURE = 1000150000
+
+
+def fnv1a64(data):
+    h = 0xcbf29ce484222325
+    for b in data:
+        h ^= b
+        h = (h * 0x100000001b3) & 0xffffffffffffffff
+    return h
+
+
+def align(value, alignment):
+    return (value + alignment - 1) & ~(alignment - 1)
+
+
+def decode_string(words):
+    raw = b''.join(struct.pack('<I', w) for w in words)
+    return raw.split(b'\0', 1)[0].decode('utf-8')
+
+
+class Module:
+    def __init__(self, name, code):
+        if len(code) % 4 != 0:
+            raise ValueError('%s: SPIR-V size is not a multiple of 4' % name)
+        words = struct.unpack('<%dI' % (len(code) // 4), code)
+        if len(words) < 5 or words[0] != 0x07230203:
+            raise ValueError('%s: not a SPIR-V module' % name)
+
+        self.name = name
+        self.code = code
+        self.entry_point = None
+        self.stage = None
+        self.types = {}
+        self.constants = {}
+        self.decorations = {}
+        self.member_decorations = {}
+        self.variables = []
+
+        i = 5
+        while i < len(words):
+            count = words[i] >> 16
+            opcode = words[i] & 0xffff
+            if count == 0:
+                raise ValueError('%s: malformed instruction at word %d' % (name, i))
+            self.instruction(opcode, words[i + 1:i + count])
+            i += count
+
+        if self.stage is None:
+            raise ValueError('%s: no supported OpEntryPoint' % name)
+
+    def instruction(self, opcode, ops):
+        if opcode == OP_ENTRY_POINT and self.stage is None:
+            if ops[0] in STAGES:
+                self.stage = STAGES[ops[0]]
+                self.entry_point = decode_string(ops[2:])
+        elif opcode == OP_DECORATE:
+            self.decorations.setdefault(ops[0], {})[ops[1]] = ops[2] if len(ops) > 2 else True
+        elif opcode == OP_MEMBER_DECORATE:
+            self.member_decorations.setdefault(ops[0], {}).setdefault(ops[1], {})[ops[2]] = ops[3] if len(ops) > 3 else True
+        elif opcode == OP_CONSTANT:
+            self.constants[ops[1]] = ops[2]
+        elif opcode == OP_VARIABLE:
+            self.variables.append((ops[1], ops[0], ops[2]))
+        elif opcode in (OP_TYPE_BOOL, OP_TYPE_INT, OP_TYPE_FLOAT, OP_TYPE_VECTOR, OP_TYPE_MATRIX, OP_TYPE_IMAGE,
+                        OP_TYPE_SAMPLER, OP_TYPE_SAMPLED_IMAGE, OP_TYPE_ARRAY, OP_TYPE_RUNTIME_ARRAY,
+                        OP_TYPE_STRUCT, OP_TYPE_ACCELERATION_STRUCTURE):
+            self.types[ops[0]] = (opcode, ops[1:])
+        elif opcode == OP_TYPE_POINTER:
+            self.types[ops[0]] = (opcode, ops[1:])
+
+    def type_size(self, type_id, matrix_stride=None):
+        opcode, ops = self.types[type_id]
+        if opcode in (OP_TYPE_INT, OP_TYPE_FLOAT):
+            return ops[0] // 8
+        if opcode == OP_TYPE_BOOL:
+            return 4
+        if opcode == OP_TYPE_VECTOR:
+            return ops[1] * self.type_size(ops[0])
+        if opcode == OP_TYPE_MATRIX:
+            if matrix_stride is not None:
+                return ops[1] * matrix_stride
+            return ops[1] * self.type_size(ops[0])
+        if opcode == OP_TYPE_ARRAY:
+            stride = self.decorations.get(type_id, {}).get(DECORATION_ARRAY_STRIDE)
+            length = self.constants.get(ops[1], 1)
+            return length * (stride if stride else self.type_size(ops[0]))
+        if opcode == OP_TYPE_STRUCT:
+            members = self.member_decorations.get(type_id, {})
+            size = 0
+            for index, member_type in enumerate(ops):
+                decorations = members.get(index, {})
+                offset = decorations.get(DECORATION_OFFSET, size)
+                size = max(size, offset + self.type_size(member_type, decorations.get(DECORATION_MATRIX_STRIDE)))
+            return size
+        return 0
+
+    def descriptor(self, type_id, storage_class):
+        count = 1
+        opcode, ops = self.types[type_id]
+        while opcode in (OP_TYPE_ARRAY, OP_TYPE_RUNTIME_ARRAY):
+            # runtime arrays are reported with a count of 0, the layout decides the size
+            count = count * self.constants.get(ops[1], 1) if opcode == OP_TYPE_ARRAY else 0
+            type_id = ops[0]
+            opcode, ops = self.types[type_id]
+
+        if opcode == OP_TYPE_STRUCT:
+            if storage_class == STORAGE_STORAGE_BUFFER or DECORATION_BUFFER_BLOCK in self.decorations.get(type_id, {}):
+                return STORAGE_BUFFER, count
+            return UNIFORM_BUFFER, count
+        if opcode == OP_TYPE_SAMPLER:
+            return SAMPLER, count
+        if opcode == OP_TYPE_SAMPLED_IMAGE:
+            return COMBINED_IMAGE_SAMPLER, count
+        if opcode == OP_TYPE_ACCELERATION_STRUCTURE:
+            return ACCELERATION_STRUCTURE, count
+        if opcode == OP_TYPE_IMAGE:
+            dim, sampled = ops[1], ops[5]
+            if dim == 6:  # SubpassData
+                return INPUT_ATTACHMENT, count
+            if dim == 5:  # Buffer
+                return (STORAGE_TEXEL_BUFFER if sampled == 2 else UNIFORM_TEXEL_BUFFER), count
+            return (STORAGE_IMAGE if sampled == 2 else SAMPLED_IMAGE), count
+        raise ValueError('%s: unsupported descriptor type for type id %d' % (self.name, type_id))
+
+    def reflect(self):
+        bindings = []
+        push_constants = []
+        for var_id, pointer_type, storage_class in self.variables:
+            _, pointer_ops = self.types[pointer_type]
+            pointee = pointer_ops[1]
+            if storage_class == STORAGE_PUSH_CONSTANT:
+                push_constants.append(self.push_constant_range(pointee))
+            elif storage_class in (STORAGE_UNIFORM_CONSTANT, STORAGE_UNIFORM, STORAGE_STORAGE_BUFFER):
+                decorations = self.decorations.get(var_id, {})
+                if DECORATION_BINDING not in decorations:
+                    continue
+                descriptor_type, count = self.descriptor(pointee, storage_class)
+                bindings.append((decorations.get(DECORATION_DESCRIPTOR_SET, 0), decorations[DECORATION_BINDING],
+                                 descriptor_type, count))
+        bindings.sort()
+        return bindings, push_constants
+
+    def push_constant_range(self, struct_id):
+        members = self.member_decorations.get(struct_id, {})
+        offsets = [d.get(DECORATION_OFFSET, 0) for d in members.values()] or [0]
+        start = min(offsets)
+        return start, self.type_size(struct_id) - start
+
+
+def pack(modules):
+    toc_offset = struct.calcsize(HEADER_FORMAT)
+    cursor = toc_offset + len(modules) * struct.calcsize(TOC_FORMAT)
+
+    reflection = bytearray()
+    entries = []
+    for module in modules:
+        bindings, push_constants = module.reflect()
+
+        binding_offset = cursor + len(reflection)
+        for record in bindings:
+            reflection += struct.pack(BINDING_FORMAT, *record)
+        push_constant_offset = cursor + len(reflection)
+        for record in push_constants:
+            reflection += struct.pack(PUSH_CONSTANT_FORMAT, *record)
+
+        entries.append([module, binding_offset, len(bindings), push_constant_offset, len(push_constants), 0])
+
+    cursor = align(cursor + len(reflection), BLOB_ALIGNMENT)
+    blobs = bytearray()
+    for entry in entries:
+        entry[5] = cursor + len(blobs)
+        blobs += entry[0].code
+        blobs += b'\0' * (align(len(blobs), BLOB_ALIGNMENT) - len(blobs))
+
+    total_size = cursor + len(blobs)
+
+    out = bytearray(struct.pack(HEADER_FORMAT, MAGIC, VERSION, len(modules), toc_offset, total_size, 0, 0, 0))
+    for module, binding_offset, binding_count, push_constant_offset, push_constant_count, code_offset in entries:
+        for label, value in (('name', module.name), ('entry point', module.entry_point)):
+            if len(value.encode('utf-8')) >= NAME_LENGTH:
+                raise ValueError('%s: %s "%s" is too long' % (module.name, label, value))
+        out += struct.pack(TOC_FORMAT,
+                           module.name.encode('utf-8'),
+                           module.entry_point.encode('utf-8'),
+                           module.stage,
+                           code_offset,
+                           len(module.code),
+                           binding_offset,
+                           binding_count,
+                           push_constant_offset,
+                           push_constant_count,
+                           0,
+                           fnv1a64(module.code))
+    out += reflection
+    out += b'\0' * (align(len(out), BLOB_ALIGNMENT) - len(out))
+    out += blobs
+    assert len(out) == total_size
+    return bytes(out)
+
+
+def write_embedded(path, data):
+    with open(path, 'w') as f:
+        f.write('// Generated by pack_shaders.py, do not edit.\n')
+        for i in range(0, len(data), 16):
+            f.write(', '.join('0x%02x' % b for b in data[i:i + 16]) + ',\n')
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Pack SPIR-V modules into a shader archive.')
+    parser.add_argument('-o', '--output', required=True, help='archive to write')
+    parser.add_argument('--embed', help='also write the archive as a C array initializer')
+    parser.add_argument('modules', nargs='+', help='SPIR-V files, stored under their file name without extension')
+    args = parser.parse_args()
+
+    modules = []
+    for path in args.modules:
+        with open(path, 'rb') as f:
+            modules.append(Module(os.path.splitext(os.path.basename(path))[0], f.read()))
+
+    data = pack(modules)
+    with open(args.output, 'wb') as f:
+        f.write(data)
+    if args.embed:
+        write_embedded(args.embed, data)
+
+
+if __name__ == '__main__':
+    try:
+        main()
+    except (OSError, ValueError) as e:
+        sys.stderr.write('pack_shaders: %s\n' % e)
+        sys.exit(1)